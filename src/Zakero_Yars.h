@@ -37,11 +37,30 @@
  */
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
+#include <numeric>
 #include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <variant>
 #include <vector>
 
 
@@ -117,1824 +136,12422 @@ class Yars
 		}
 
 	// }}}
-	// {{{ Ctor / Dtor
+	// {{{ FlatMap
 
 	public:
-		Yars();
-		explicit Yars(std::mt19937&);
-
-	// }}}
-	// {{{ Data Types
+		template <typename Key
+			, typename Value
+			, typename Hash     = std::hash<Key>
+			, typename KeyEqual = std::equal_to<Key>
+			>
+		class FlatMap
+		{
+			public:
+				using key_type    = Key;
+				using mapped_type = Value;
+				using value_type  = std::pair<const Key, Value>;
+				using size_type   = size_t;
+				using hasher      = Hash;
+				using key_equal   = KeyEqual;
+
+				static constexpr bool Is_Transparent = requires
+				{
+					typename Hash::is_transparent;
+					typename KeyEqual::is_transparent;
+				};
 
-	public:
-		using Id                   = uint64_t;
-		using MapStringBool        = std::unordered_map<std::string, bool>;
-		using MapStringFloat       = std::unordered_map<std::string, float>;
-		using MapStringInt32       = std::unordered_map<std::string, int32_t>;
-		using MapStringString      = std::unordered_map<std::string, std::string>;
-		using MapIdMapStringBool   = std::unordered_map<Yars::Id, Yars::MapStringBool>;
-		using MapIdMapStringFloat  = std::unordered_map<Yars::Id, Yars::MapStringFloat>;
-		using MapIdMapStringInt32  = std::unordered_map<Yars::Id, Yars::MapStringInt32>;
-		using MapIdMapStringString = std::unordered_map<Yars::Id, Yars::MapStringString>;
-		using MultimapIdId         = std::unordered_multimap<Yars::Id, Yars::Id>;
-		using VectorId             = std::vector<Yars::Id>;
-		using VectorString         = std::vector<std::string>;
+				template <bool Is_Const>
+				class Iterator
+				{
+					public:
+						using iterator_category = std::forward_iterator_tag;
+						using value_type        = FlatMap::value_type;
+						using difference_type   = std::ptrdiff_t;
+						using pointer           = std::conditional_t<Is_Const, const value_type*, value_type*>;
+						using reference         = std::conditional_t<Is_Const, const value_type&, value_type&>;
+						using map_pointer       = std::conditional_t<Is_Const, const FlatMap*, FlatMap*>;
+
+						Iterator() noexcept = default;
+
+						Iterator(map_pointer map, const size_t index) noexcept
+							: map(map)
+							, index(index)
+						{
+						}
+
+						operator Iterator<true>() const noexcept requires (Is_Const == false)
+						{
+							return {map, index};
+						}
+
+						reference operator*() const noexcept
+						{
+							return map->slot[index];
+						}
+
+						pointer operator->() const noexcept
+						{
+							return &map->slot[index];
+						}
+
+						Iterator& operator++() noexcept
+						{
+							index = map->indexNextFull(index + 1);
+
+							return *this;
+						}
+
+						Iterator operator++(int) noexcept
+						{
+							Iterator retval = *this;
+							++(*this);
+
+							return retval;
+						}
+
+						bool operator==(const Iterator& other) const noexcept
+						{
+							return (index == other.index);
+						}
+
+						bool operator!=(const Iterator& other) const noexcept
+						{
+							return (index != other.index);
+						}
+
+					private:
+						friend class FlatMap;
+
+						map_pointer map   = nullptr;
+						size_t      index = 0;
+				};
+
+				using iterator       = Iterator<false>;
+				using const_iterator = Iterator<true>;
+
+				FlatMap() noexcept
+				{
+				}
 
-	// }}}
-	// {{{ Health
+				FlatMap(std::initializer_list<value_type> list)
+				{
+					reserve(list.size());
 
-	public:
-		struct Health
-		{
-			uint32_t current          = 0;
-			uint32_t maximum          = 0;
-			uint32_t maximum_base     = 0;
-			int32_t  maximum_modifier = 0;
-		};
+					for(const value_type& value : list)
+					{
+						insert(value);
+					}
+				}
 
-		using MapIdHealth = std::unordered_map<Yars::Id, Yars::Health>;
+				FlatMap(const FlatMap& other)
+				{
+					if(other.slot_capacity == 0)
+					{
+						return;
+					}
+
+					allocate(other.slot_capacity);
+
+					control      = other.control;
+					slot_size    = other.slot_size;
+					growth_left  = other.growth_left;
+
+					for(size_t index = 0; index < slot_capacity; index++)
+					{
+						if(control[index] >= 0)
+						{
+							::new((void*)(slot + index)) value_type(other.slot[index]);
+						}
+					}
+				}
 
-		static constexpr int32_t Health_Max = std::numeric_limits<int32_t>::max();
-		static constexpr int32_t Health_Min = std::numeric_limits<int32_t>::min();
+				FlatMap(FlatMap&& other) noexcept
+				{
+					swap(other);
+				}
 
-		static void healthSet(Yars::Health&, const uint32_t, const uint32_t) noexcept;
-		static void healthModifierSet(Yars::Health&, const int32_t) noexcept;
+				~FlatMap() noexcept
+				{
+					destroy();
+				}
 
-		static void healthAdjust(Yars::Health&, const int32_t) noexcept;
-		static void healthMaximumAdjust(Yars::Health&, const int32_t) noexcept;
-		static void healthModifierAdjust(Yars::Health&, const int32_t) noexcept;
+				FlatMap& operator=(const FlatMap& other)
+				{
+					if(this != &other)
+					{
+						FlatMap copy(other);
+						swap(copy);
+					}
 
-		static void healthIncreaseToMaximum(Yars::Health&) noexcept;
+					return *this;
+				}
 
-	private:
-		static void healthUpdate(Yars::Health&) noexcept;
+				FlatMap& operator=(FlatMap&& other) noexcept
+				{
+					if(this != &other)
+					{
+						destroy();
+						swap(other);
+					}
 
-	// }}}
-	// {{{ Level
+					return *this;
+				}
 
-	public:
-		struct Level
-		{
-			float   partial    = 0;
-			int32_t modifier   = 0;
-			int32_t value      = 0;
-			int32_t value_base = 0;
-		};
+				iterator       begin() noexcept        { return {this, indexNextFull(0)}; }
+				const_iterator begin() const noexcept  { return {this, indexNextFull(0)}; }
+				const_iterator cbegin() const noexcept { return {this, indexNextFull(0)}; }
+				iterator       end() noexcept          { return {this, slot_capacity}; }
+				const_iterator end() const noexcept    { return {this, slot_capacity}; }
+				const_iterator cend() const noexcept   { return {this, slot_capacity}; }
 
-		static constexpr int32_t Level_Max = std::numeric_limits<int32_t>::max();
-		static constexpr int32_t Level_Min = std::numeric_limits<int32_t>::min();
+				bool   empty() const noexcept    { return (slot_size == 0); }
+				size_t size() const noexcept     { return slot_size; }
+				size_t capacity() const noexcept { return slot_capacity; }
 
-		static uint32_t levelIncrease(Yars::Level&, const float) noexcept;
-		static void     levelModifierAdjust(Yars::Level&, const int32_t) noexcept;
-		static void     levelSet(Yars::Level&, const int32_t, const float = 0) noexcept;
-	
-	private:
-		static void     levelUpdate(Yars::Level&) noexcept;
+				Value& at(const Key& key)
+				{
+					const size_t index = indexOf(key);
 
-	// }}}
-	// {{{ Attribute
+					if(index == slot_capacity)
+					{
+						throw std::out_of_range("Yars::FlatMap::at");
+					}
 
-	public:
-		struct Attribute
-		{
-			Yars::Level level = {};
-		};
+					return slot[index].second;
+				}
 
-		using MapStringAttribute      = std::unordered_map<std::string, Yars::Attribute>;
-		using MapIdMapStringAttribute = std::unordered_map<Yars::Id, Yars::MapStringAttribute>;
+				const Value& at(const Key& key) const
+				{
+					const size_t index = indexOf(key);
 
-		Yars::Attribute&       attribute(const std::string&) noexcept;
-		const Yars::Attribute& attribute(const std::string&) const noexcept;
-		bool                   attributeAdd(const std::string&) noexcept;
-		bool                   attributeExists(const std::string&) const noexcept;
+					if(index == slot_capacity)
+					{
+						throw std::out_of_range("Yars::FlatMap::at");
+					}
 
-	private:
-		MapStringAttribute attribute_map;
+					return slot[index].second;
+				}
 
-	// }}}
-	// {{{ Skill
+				Value& operator[](const Key& key)
+				{
+					return try_emplace(key).first->second;
+				}
 
-	public:
-		struct Skill
-		{
-			Yars::MapStringInt32 attribute_contribution = {};
-			Yars::Level          level                  = {};
-		};
+				Value& operator[](Key&& key)
+				{
+					return try_emplace(std::move(key)).first->second;
+				}
 
-		using MapStringSkill      = std::unordered_map<std::string, Yars::Skill>;
-		using MapIdMapStringSkill = std::unordered_map<Yars::Id, Yars::MapStringSkill>;
+				bool contains(const Key& key) const noexcept
+				{
+					return (indexOf(key) != slot_capacity);
+				}
 
-		Yars::Skill&       skill(const std::string&) noexcept;
-		const Yars::Skill& skill(const std::string&) const noexcept;
-		bool               skillAdd(const std::string&, const Yars::Skill&) noexcept;
-		bool               skillRemove(const std::string&) noexcept;
-		bool               skillExists(const std::string&) const noexcept;
-		Yars::VectorString skillList() const noexcept;
+				size_t count(const Key& key) const noexcept
+				{
+					return (indexOf(key) != slot_capacity) ? 1 : 0;
+				}
 
-	private:
-		MapStringSkill skill_map;
+				iterator find(const Key& key) noexcept
+				{
+					return {this, indexOf(key)};
+				}
 
-	// }}}
-	// {{{ Item
+				const_iterator find(const Key& key) const noexcept
+				{
+					return {this, indexOf(key)};
+				}
 
-	public:
-		struct Item
-		{
-			Yars::MapStringInt32 affect_attribute      = {};
-			Yars::MapStringInt32 affect_skill          = {};
-			Yars::MapStringInt32 modify_attribute      = {};
-			Yars::MapStringInt32 modify_skill          = {};
-			Yars::VectorString   skill_attacker        = {};
-			Yars::VectorString   skill_defender        = {};
-			uint32_t             count                 = 0;
-			int32_t              affect_health_current = 0;
-			int32_t              affect_health_maximum = 0;
-			int32_t              modify_health_current = 0;
-			int32_t              modify_health_maximum = 0;
-		};
+				template <typename K>
+				Value& at(const K& key) requires Is_Transparent
+				{
+					const size_t index = indexOf(key);
 
-		using MapStringItem           = std::unordered_map<std::string, Yars::Item>;
-		using MultimapStringItem      = std::unordered_multimap<std::string, Yars::Item>;
-		using MapIdMapStringItem      = std::unordered_map<Yars::Id, Yars::MapStringItem>;
-		using MapIdMultimapStringItem = std::unordered_map<Yars::Id, Yars::MultimapStringItem>;
+					if(index == slot_capacity)
+					{
+						throw std::out_of_range("Yars::FlatMap::at");
+					}
 
-		Yars::Item&        item(const std::string&) noexcept;
-		const Yars::Item&  item(const std::string&) const noexcept;
-		bool               itemAdd(const std::string&, const Yars::Item&) noexcept;
-		bool               itemRemove(const std::string&) noexcept;
-		bool               itemExists(const std::string&) const noexcept;
-		bool               itemIsUsable(const std::string&) const noexcept;
-		bool               itemIsUsableByAttacker(const std::string&) const noexcept;
-		bool               itemIsUsableByDefender(const std::string&) const noexcept;
-		Yars::VectorString itemList() const noexcept;
+					return slot[index].second;
+				}
 
-	private:
-		MapStringItem item_map;
+				template <typename K>
+				const Value& at(const K& key) const requires Is_Transparent
+				{
+					const size_t index = indexOf(key);
 
-	// }}}
-	// {{{ Character
+					if(index == slot_capacity)
+					{
+						throw std::out_of_range("Yars::FlatMap::at");
+					}
 
-	public:
-		Yars::Id                        characterCreate() noexcept;
-		bool                            characterDelete(const Yars::Id) noexcept;
-		bool                            characterExists(const Yars::Id) const noexcept;
-		bool                            characterConfigItemStackMax(const Yars::Id, const uint32_t) noexcept;
+					return slot[index].second;
+				}
 
-		Yars::Health&                   characterHealth(const Yars::Id) noexcept;
-		const Yars::Health&             characterHealth(const Yars::Id) const noexcept;
+				template <typename K>
+				bool contains(const K& key) const noexcept requires Is_Transparent
+				{
+					return (indexOf(key) != slot_capacity);
+				}
 
-		Yars::Attribute&                characterAttribute(const Yars::Id, const std::string&) noexcept;
-		const Yars::Attribute&          characterAttribute(const Yars::Id, const std::string&) const noexcept;
-		bool                            characterAttributeExists(const Yars::Id, const std::string&) const noexcept;
-		Yars::MapStringAttribute&       characterAttributeMap(const Yars::Id) noexcept;
-		const Yars::MapStringAttribute& characterAttributeMap(const Yars::Id) const noexcept;
+				template <typename K>
+				iterator find(const K& key) noexcept requires Is_Transparent
+				{
+					return {this, indexOf(key)};
+				}
 
-		bool                            characterDataClear(const Yars::Id) noexcept;
-		bool                            characterDataErase(const Yars::Id, const std::string&) noexcept;
-		bool                            characterDataGet(const Yars::Id, const std::string&, bool&) const noexcept;
-		bool                            characterDataGet(const Yars::Id, const std::string&, float&) const noexcept;
-		bool                            characterDataGet(const Yars::Id, const std::string&, int32_t&) const noexcept;
-		bool                            characterDataGet(const Yars::Id, const std::string&, std::string&) const noexcept;
-		bool                            characterDataSet(const Yars::Id, const std::string&, const bool) noexcept;
-		bool                            characterDataSet(const Yars::Id, const std::string&, const float) noexcept;
-		bool                            characterDataSet(const Yars::Id, const std::string&, const int32_t) noexcept;
-		bool                            characterDataSet(const Yars::Id, const std::string&, const std::string&) noexcept;
+				template <typename K>
+				const_iterator find(const K& key) const noexcept requires Is_Transparent
+				{
+					return {this, indexOf(key)};
+				}
 
-		Yars::Skill&                    characterSkill(const Yars::Id, const std::string&) noexcept;
-		const Yars::Skill&              characterSkill(const Yars::Id, const std::string&) const noexcept;
-		bool                            characterSkillAdd(const Yars::Id, const std::string&) noexcept;
-		bool                            characterSkillRemove(const Yars::Id, const std::string&) noexcept;
-		bool                            characterSkillIncrease(const Yars::Id, const std::string&, const float) noexcept;
-		bool                            characterSkillExists(const Yars::Id, const std::string&) const noexcept;
-		Yars::VectorString              characterSkillList(const Yars::Id) const noexcept;
-		Yars::MapStringSkill&           characterSkillMap(const Yars::Id) noexcept;
-		const Yars::MapStringSkill&     characterSkillMap(const Yars::Id) const noexcept;
+				template <typename K, typename... Args>
+				std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+				{
+					const uint64_t hash  = hashOf(key);
+					size_t         index = indexOf(key, hash);
 
-		Yars::Item&                     characterItem(const Yars::Id, const std::string&, const uint32_t = 0) noexcept;
-		const Yars::Item&               characterItem(const Yars::Id, const std::string&, const uint32_t = 0) const noexcept;
-		bool                            characterItemAdd(const Yars::Id, const std::string&, const uint32_t = 1) noexcept;
-		bool                            characterItemRemove(const Yars::Id, const std::string&, const uint32_t = 1) noexcept;
-		Yars::Item                      characterItemTake(const Yars::Id, const std::string&) noexcept;
-		bool                            characterItemExists(const Yars::Id, const std::string&) const noexcept;
-		uint32_t                        characterItemCount(const Yars::Id, const std::string&) const noexcept;
-		uint32_t                        characterItemCount(const Yars::Id, const std::string&, uint32_t&) const noexcept;
-		bool                            characterItemIsUsable(const Yars::Id, const std::string&) const noexcept;
-		bool                            characterItemIsUsableByAttacker(const Yars::Id, const std::string&) const noexcept;
-		bool                            characterItemIsUsableByAttacker(const Yars::Id, const std::string&, const std::string&) const noexcept;
-		bool                            characterItemIsUsableByAttacker(const Yars::Id, const Yars::Item&) const noexcept;
-		bool                            characterItemIsUsableByDefender(const Yars::Id, const std::string&) const noexcept;
-		bool                            characterItemIsUsableByDefender(const Yars::Id, const std::string&, const std::string&) const noexcept;
-		bool                            characterItemIsUsableByDefender(const Yars::Id, const Yars::Item&) const noexcept;
-		Yars::VectorString              characterItemList(const Yars::Id) const noexcept;
-		bool                            characterItemRestack(const Yars::Id) noexcept;
-		bool                            characterItemRestack(const Yars::Id, const std::string&) noexcept;
+					if(index != slot_capacity)
+					{
+						return {{this, index}, false};
+					}
 
-		std::string                     characterItemSkillAttacker(const Yars::Id, const std::string&) const noexcept;
-		Yars::VectorString              characterItemSkillAttackerList(const Yars::Id, const std::string&) const noexcept;
-		std::string                     characterItemSkillDefender(const Yars::Id, const std::string&) const noexcept;
-		Yars::VectorString              characterItemSkillDefenderList(const Yars::Id, const std::string&) const noexcept;
+					index = indexInsert(hash);
 
-		Yars::Item&                     characterEquipmentItem(const Yars::Id, const std::string&) noexcept;
-		const Yars::Item&               characterEquipmentItem(const Yars::Id, const std::string&) const noexcept;
-		std::string                     characterEquipmentName(const Yars::Id, const std::string&) const noexcept;
-		bool                            characterEquipmentAdd(const Yars::Id, const std::string&, const std::string&) noexcept;
-		bool                            characterEquipmentRemove(const Yars::Id, const std::string&) noexcept;
-		bool                            characterEquipmentExists(const Yars::Id, const std::string&) const noexcept;
+					::new((void*)(slot + index)) value_type(std::piecewise_construct
+						, std::forward_as_tuple(std::forward<K>(key))
+						, std::forward_as_tuple(std::forward<Args>(args)...)
+						);
 
-		bool                            characterLevelIncrease(const Yars::Id, const uint32_t) noexcept;
-		bool                            characterLevelIncrease(const Yars::Id, const std::string&, const uint32_t) noexcept;
-		bool                            characterLevelSet(const Yars::Id, const std::string&, const uint32_t) noexcept;
+					return {{this, index}, true};
+				}
 
-		bool                            characterAffectApply(const Yars::Id, const Yars::Id) noexcept;
-		bool                            characterAffectDefend(const Yars::Id, const Yars::Id, const std::string&) noexcept;
-		bool                            characterAffectExists(const Yars::Id, const Yars::Id) const noexcept;
-		Yars::VectorId                  characterAffectList(const Yars::Id) const noexcept;
-		void                            characterAffectRemove(const Yars::Id, const Yars::Id) noexcept;
-		void                            characterAffectRevert(const Yars::Id, const Yars::Id) noexcept;
+				template <typename K, typename V>
+				std::pair<iterator, bool> emplace(K&& key, V&& value)
+				{
+					return try_emplace(std::forward<K>(key), std::forward<V>(value));
+				}
 
-	private:
-		struct CharacterConfig
-		{
-			uint32_t item_stack_max = 1;
-			bool     consolidate    = true;
-		};
+				std::pair<iterator, bool> insert(const value_type& value)
+				{
+					return try_emplace(value.first, value.second);
+				}
 
-		using MapIdCharacterConfig = std::unordered_map<Yars::Id, Yars::CharacterConfig>;
-
-		void                          characterAttributeAdd(const Yars::Id, const std::string&) noexcept;
-		void                          characterClear(const Yars::Id&) noexcept;
-		bool                          characterItemAdd(const Yars::Id, const std::string&, const Yars::Item&) noexcept;
-
-		Yars::Id                      character_id_max;
-		Yars::VectorId                character_pool;
-		Yars::MapIdCharacterConfig    character_config;
-		Yars::MapIdHealth             character_health;
-		Yars::MapIdMapStringAttribute character_attribute;
-		Yars::MapIdMapStringBool      character_data_bool;
-		Yars::MapIdMapStringFloat     character_data_float;
-		Yars::MapIdMapStringInt32     character_data_int32;
-		Yars::MapIdMapStringSkill     character_skill;
-		Yars::MapIdMapStringString    character_data_string;
-		Yars::MapIdMapStringItem      character_equipment_item;
-		Yars::MapIdMapStringString    character_equipment_name;
-		Yars::MapIdMultimapStringItem character_item;
-		Yars::MultimapIdId            character_affect;
+				size_t erase(const Key& key) noexcept
+				{
+					const size_t index = indexOf(key);
 
-	// }}}
-	// {{{ Affect
+					if(index == slot_capacity)
+					{
+						return 0;
+					}
 
-	public:
-		struct Affect
-		{
-			uint32_t             level                 = 0;
-			Yars::Id             origin_character      = 0;
-			std::string          origin_skill          = {};
-			float                experience            = 0.0;
-			int32_t              modify_health_current = 0;
-			int32_t              modify_health_maximum = 0;
-			Yars::MapStringInt32 modify_skill          = {};
-			Yars::MapStringInt32 modify_attribute      = {};
-			Yars::VectorString   defense_skill         = {};
-		};
+					eraseIndex(index);
 
-		using VectorAffect = std::vector<Affect>;
+					return 1;
+				}
 
-		Yars::Affect&       affect(const Yars::Id) noexcept;
-		const Yars::Affect& affect(const Yars::Id) const noexcept;
-		Yars::Id            affectCreate() noexcept;
-		bool                affectDelete(const Yars::Id) noexcept;
-		bool                affectExists(const Yars::Id) const noexcept;
-		bool                affectInit(const Yars::Id, const Yars::Id, const Yars::Item&, const std::string&, const int32_t = 0) noexcept;
+				iterator erase(const_iterator iter) noexcept
+				{
+					eraseIndex(iter.index);
 
-	private:
-		void affectClear(const Yars::Id) noexcept;
+					return {this, indexNextFull(iter.index + 1)};
+				}
 
-		Yars::VectorAffect affect_vector;
-		Yars::VectorId     affect_pool;
+				void clear() noexcept
+				{
+					for(size_t index = 0; index < slot_capacity; index++)
+					{
+						if(control[index] >= 0)
+						{
+							slot[index].~value_type();
+						}
+					}
+
+					std::fill(std::begin(control), std::end(control), Control_Empty);
+
+					slot_size   = 0;
+					growth_left = growthMax(slot_capacity);
+				}
 
-	// }}}
-	// {{{ Calculations
+				void reserve(const size_t count)
+				{
+					const size_t capacity = capacityFor(count);
 
-	public:
-		enum class Result : uint8_t
-		{	Error
-		,	Failure_Automatic
-		,	Failure
-		,	Chance
-		,	Success
-		,	Success_Automatic
-		};
+					if(capacity > slot_capacity)
+					{
+						rehash(capacity);
+					}
+				}
 
-		// Deprecated
-		//Yars::Result approxDifficultyCheck(const Yars::Id, const std::string&, const Yars::Id) const noexcept;
-		//Yars::Result approxDifficultyCheck(const Yars::Id, const std::string&, const std::string&, const Yars::Id, const std::string&) const noexcept;
+				void swap(FlatMap& other) noexcept
+				{
+					std::swap(control,       other.control);
+					std::swap(slot,          other.slot);
+					std::swap(slot_capacity, other.slot_capacity);
+					std::swap(slot_size,     other.slot_size);
+					std::swap(growth_left,   other.growth_left);
+				}
 
-		float calculateDifficulty(const Yars::Skill&, const Yars::Skill&) const noexcept;
-		float calculateDifficulty(const Yars::Skill&, const uint32_t) const noexcept;
-		float calculateDifficulty(const uint32_t, const uint32_t) const noexcept;
+				friend bool operator==(const FlatMap& lhs, const FlatMap& rhs) noexcept
+				{
+					if(lhs.size() != rhs.size())
+					{
+						return false;
+					}
+
+					for(const value_type& value : lhs)
+					{
+						const size_t index = rhs.indexOf(value.first);
+
+						if(index == rhs.slot_capacity
+							|| (rhs.slot[index].second == value.second) == false
+							)
+						{
+							return false;
+						}
+					}
 
-		bool  calculateIsSuccess(const Yars::Id&, const std::string&, const float) const noexcept;
-		bool  calculateIsSuccess(const Yars::Id&, const std::string&, const float, float&) const noexcept;
+					return true;
+				}
 
-		float calculateModifier(const Yars::Id, const std::string&) const noexcept;
+				friend bool operator!=(const FlatMap& lhs, const FlatMap& rhs) noexcept
+				{
+					return !(lhs == rhs);
+				}
 
-		float calculateProbability(const float) const noexcept;
+			private:
+				static constexpr size_t   Group_Width     = 8;
+				static constexpr size_t   Capacity_Min    = Group_Width;
+				static constexpr uint64_t Group_Lsb       = 0x0101010101010101ULL;
+				static constexpr uint64_t Group_Msb       = 0x8080808080808080ULL;
+				static constexpr int8_t   Control_Empty   = -128;
+				static constexpr int8_t   Control_Deleted = -2;
+
+				std::vector<int8_t> control       = {};
+				value_type*         slot          = nullptr;
+				size_t              slot_capacity = 0;
+				size_t              slot_size     = 0;
+				size_t              growth_left   = 0;
+
+				static size_t growthMax(const size_t capacity) noexcept
+				{
+					return capacity - (capacity / 8);
+				}
 
-		static Yars::Result difficultyToResult(const float) noexcept;
+				static size_t capacityFor(const size_t count) noexcept
+				{
+					size_t capacity = Capacity_Min;
 
-	private:
+					while(growthMax(capacity) < count)
+					{
+						capacity *= 2;
+					}
+
+					return capacity;
+				}
+
+				template <typename K>
+				static uint64_t hashOf(const K& key) noexcept
+				{
+					// std::hash<integer> is the identity, so mix the bits
+					uint64_t hash = (uint64_t)Hash{}(key) * 0x9e3779b97f4a7c15ULL;
+
+					return hash ^ (hash >> 32);
+				}
+
+				static int8_t hashControl(const uint64_t hash) noexcept
+				{
+					return (int8_t)(hash >> 57);
+				}
+
+				uint64_t groupLoad(const size_t index) const noexcept
+				{
+					uint64_t group = 0;
+
+					std::memcpy(&group, control.data() + index, sizeof(group));
+
+					if constexpr(std::endian::native == std::endian::big)
+					{
+						uint64_t swapped = 0;
+
+						for(size_t i = 0; i < Group_Width; i++)
+						{
+							swapped = (swapped << 8) | ((group >> (i * 8)) & 0xff);
+						}
+
+						group = swapped;
+					}
+
+					return group;
+				}
+
+				static uint64_t groupMatch(const uint64_t group, const int8_t value) noexcept
+				{
+					const uint64_t x = group ^ (Group_Lsb * (uint8_t)value);
+
+					return (x - Group_Lsb) & ~x & Group_Msb;
+				}
+
+				static uint64_t groupMatchEmpty(const uint64_t group) noexcept
+				{
+					return (group & (~group << 6)) & Group_Msb;
+				}
+
+				static uint64_t groupMatchFree(const uint64_t group) noexcept
+				{
+					return group & Group_Msb;
+				}
+
+				void controlSet(const size_t index, const int8_t value) noexcept
+				{
+					control[index] = value;
+
+					if(index < Group_Width - 1)
+					{
+						control[slot_capacity + index] = value;
+					}
+				}
+
+				size_t indexNextFull(size_t index) const noexcept
+				{
+					while(index < slot_capacity && control[index] < 0)
+					{
+						index++;
+					}
+
+					return index;
+				}
+
+				template <typename K>
+				size_t indexOf(const K& key) const noexcept
+				{
+					return indexOf(key, hashOf(key));
+				}
+
+				template <typename K>
+				size_t indexOf(const K& key, const uint64_t hash) const noexcept
+				{
+					if(slot_size == 0)
+					{
+						return slot_capacity;
+					}
+
+					const size_t mask  = slot_capacity - 1;
+					const int8_t value = hashControl(hash);
+					size_t       index = (size_t)hash & mask;
+					size_t       step  = 0;
+
+					while(true)
+					{
+						const uint64_t group = groupLoad(index);
+
+						for(uint64_t match = groupMatch(group, value); match != 0; match &= match - 1)
+						{
+							const size_t i = (index + (std::countr_zero(match) / 8)) & mask;
+
+							if(control[i] == value && KeyEqual{}(slot[i].first, key))
+							{
+								return i;
+							}
+						}
+
+						if(groupMatchEmpty(group) != 0)
+						{
+							return slot_capacity;
+						}
+
+						step  += Group_Width;
+						index  = (index + step) & mask;
+					}
+				}
+
+				size_t indexFree(const uint64_t hash) const noexcept
+				{
+					const size_t mask  = slot_capacity - 1;
+					size_t       index = (size_t)hash & mask;
+					size_t       step  = 0;
+
+					while(true)
+					{
+						const uint64_t match = groupMatchFree(groupLoad(index));
+
+						if(match != 0)
+						{
+							return (index + (std::countr_zero(match) / 8)) & mask;
+						}
+
+						step  += Group_Width;
+						index  = (index + step) & mask;
+					}
+				}
+
+				size_t indexInsert(const uint64_t hash)
+				{
+					if(slot_capacity == 0)
+					{
+						rehash(Capacity_Min);
+					}
+
+					size_t index = indexFree(hash);
+
+					if(growth_left == 0 && control[index] == Control_Empty)
+					{
+						size_t capacity = capacityFor(slot_size + 1);
+
+						if(capacity <= slot_capacity
+							&& slot_size >= growthMax(slot_capacity) / 2
+							)
+						{
+							capacity = slot_capacity * 2;
+						}
+
+						rehash(capacity);
+
+						index = indexFree(hash);
+					}
+
+					if(control[index] == Control_Empty)
+					{
+						growth_left--;
+					}
+
+					controlSet(index, hashControl(hash));
+					slot_size++;
+
+					return index;
+				}
+
+				void eraseIndex(const size_t index) noexcept
+				{
+					slot[index].~value_type();
+					slot_size--;
+
+					if(slot_size == 0)
+					{
+						std::fill(std::begin(control), std::end(control), Control_Empty);
+						growth_left = growthMax(slot_capacity);
+					}
+					else
+					{
+						controlSet(index, Control_Deleted);
+					}
+				}
+
+				void allocate(const size_t capacity)
+				{
+					control.assign(capacity + Group_Width - 1, Control_Empty);
+					slot          = std::allocator<value_type>().allocate(capacity);
+					slot_capacity = capacity;
+					slot_size     = 0;
+					growth_left   = growthMax(capacity);
+				}
+
+				void destroy() noexcept
+				{
+					if(slot == nullptr)
+					{
+						return;
+					}
+
+					for(size_t index = 0; index < slot_capacity; index++)
+					{
+						if(control[index] >= 0)
+						{
+							slot[index].~value_type();
+						}
+					}
+
+					std::allocator<value_type>().deallocate(slot, slot_capacity);
+
+					control       = {};
+					slot          = nullptr;
+					slot_capacity = 0;
+					slot_size     = 0;
+					growth_left   = 0;
+				}
+
+				void rehash(const size_t capacity)
+				{
+					FlatMap map;
+					map.allocate(capacity);
+
+					for(size_t index = 0; index < slot_capacity; index++)
+					{
+						if(control[index] < 0)
+						{
+							continue;
+						}
+
+						const uint64_t hash = hashOf(slot[index].first);
+						const size_t   i    = map.indexFree(hash);
+
+						::new((void*)(map.slot + i)) value_type(std::move(slot[index]));
+						map.controlSet(i, hashControl(hash));
+						map.slot_size++;
+						map.growth_left--;
+					}
+
+					swap(map);
+				}
+		};
 
 	// }}}
-	// {{{ To String
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+	// {{{ SmallMap
 
 	public:
-		static std::string to_string(const Yars::MapStringFloat&) noexcept;
-		static std::string to_string(const Yars::MapStringInt32&) noexcept;
-		static std::string to_string(const Yars::MapStringString&) noexcept;
-		static std::string to_string(const Yars::VectorId&) noexcept;
-		static std::string to_string(const Yars::VectorString&) noexcept;
-		static std::string to_string(const Yars::Result) noexcept;
-		static std::string to_string(const Yars::Health&) noexcept;
-		static std::string to_string(const Yars::Level&) noexcept;
-		static std::string to_string(const Yars::Attribute&) noexcept;
-		static std::string to_string(const Yars::MapStringAttribute&) noexcept;
-		static std::string to_string(const Yars::Skill&) noexcept;
-		static std::string to_string(const Yars::MapStringSkill&) noexcept;
-		static std::string to_string(const Yars::Item&) noexcept;
-		static std::string to_string(const Yars::MapStringItem&) noexcept;
-		static std::string to_string(const Yars::Affect&) noexcept;
+		template <typename Key
+			, typename Value
+			, size_t   Inline_Size
+			, typename Hash     = std::hash<Key>
+			, typename KeyEqual = std::equal_to<Key>
+			, typename Compare  = std::less<Key>
+			>
+		class SmallMap
+		{
+			public:
+				using key_type    = Key;
+				using mapped_type = Value;
+				using value_type  = std::pair<const Key, Value>;
+				using size_type   = size_t;
+				using hasher      = Hash;
+				using key_equal   = KeyEqual;
+				using key_compare = Compare;
+
+				static constexpr bool Is_Transparent = requires
+				{
+					typename Hash::is_transparent;
+					typename KeyEqual::is_transparent;
+				};
 
-#endif
-	// }}}
-	// {{{ Private Data
+			private:
+				using Spill = Yars::FlatMap<Key, Value, Hash, KeyEqual>;
 
-	private:
-		std::mt19937&  mt_engine;
+			public:
+				template <bool Is_Const>
+				class Iterator
+				{
+					public:
+						using iterator_category = std::forward_iterator_tag;
+						using value_type        = SmallMap::value_type;
+						using difference_type   = std::ptrdiff_t;
+						using pointer           = std::conditional_t<Is_Const, const value_type*, value_type*>;
+						using reference         = std::conditional_t<Is_Const, const value_type&, value_type&>;
+						using spill_iterator    = std::conditional_t<Is_Const, typename Spill::const_iterator, typename Spill::iterator>;
+
+						Iterator() noexcept = default;
+
+						Iterator(pointer item) noexcept
+							: item(item)
+						{
+						}
+
+						Iterator(spill_iterator spill) noexcept
+							: spill(spill)
+							, is_spill(true)
+						{
+						}
+
+						operator Iterator<true>() const noexcept requires (Is_Const == false)
+						{
+							if(is_spill)
+							{
+								return {typename Spill::const_iterator(spill)};
+							}
+
+							return {item};
+						}
+
+						reference operator*() const noexcept
+						{
+							return is_spill ? *spill : *item;
+						}
+
+						pointer operator->() const noexcept
+						{
+							return is_spill ? &(*spill) : item;
+						}
+
+						Iterator& operator++() noexcept
+						{
+							if(is_spill)
+							{
+								++spill;
+							}
+							else
+							{
+								++item;
+							}
+
+							return *this;
+						}
+
+						Iterator operator++(int) noexcept
+						{
+							Iterator retval = *this;
+							++(*this);
+
+							return retval;
+						}
+
+						bool operator==(const Iterator& other) const noexcept
+						{
+							return is_spill ? (spill == other.spill) : (item == other.item);
+						}
+
+						bool operator!=(const Iterator& other) const noexcept
+						{
+							return !(*this == other);
+						}
+
+					private:
+						friend class SmallMap;
+
+						pointer        item     = nullptr;
+						spill_iterator spill    = {};
+						bool           is_spill = false;
+				};
+
+				using iterator       = Iterator<false>;
+				using const_iterator = Iterator<true>;
+
+				SmallMap() noexcept
+				{
+				}
+
+				SmallMap(std::initializer_list<value_type> list)
+				{
+					for(const value_type& value : list)
+					{
+						insert(value);
+					}
+				}
+
+				SmallMap(const SmallMap& other)
+				{
+					if(other.spill)
+					{
+						spill = std::make_unique<Spill>(*other.spill);
+
+						return;
+					}
+
+					for(size_t index = 0; index < other.item_size; index++)
+					{
+						::new((void*)(item() + index)) value_type(other.item()[index]);
+					}
+
+					item_size = other.item_size;
+				}
+
+				SmallMap(SmallMap&& other) noexcept
+				{
+					moveFrom(other);
+				}
+
+				~SmallMap() noexcept
+				{
+					clear();
+				}
+
+				SmallMap& operator=(const SmallMap& other)
+				{
+					if(this != &other)
+					{
+						SmallMap copy(other);
+
+						clear();
+						moveFrom(copy);
+					}
+
+					return *this;
+				}
+
+				SmallMap& operator=(SmallMap&& other) noexcept
+				{
+					if(this != &other)
+					{
+						clear();
+						moveFrom(other);
+					}
+
+					return *this;
+				}
+
+				iterator begin() noexcept
+				{
+					if(spill)
+					{
+						return {spill->begin()};
+					}
+
+					return {item()};
+				}
+
+				const_iterator begin() const noexcept
+				{
+					if(spill)
+					{
+						return {spill->cbegin()};
+					}
+
+					return {item()};
+				}
+
+				const_iterator cbegin() const noexcept
+				{
+					return begin();
+				}
+
+				iterator end() noexcept
+				{
+					if(spill)
+					{
+						return {spill->end()};
+					}
+
+					return {item() + item_size};
+				}
+
+				const_iterator end() const noexcept
+				{
+					if(spill)
+					{
+						return {spill->cend()};
+					}
+
+					return {item() + item_size};
+				}
+
+				const_iterator cend() const noexcept
+				{
+					return end();
+				}
+
+				bool empty() const noexcept
+				{
+					return (size() == 0);
+				}
+
+				size_t size() const noexcept
+				{
+					return spill ? spill->size() : item_size;
+				}
+
+				bool is_inline() const noexcept
+				{
+					return (spill == nullptr);
+				}
+
+				Value& at(const Key& key)
+				{
+					iterator iter = find(key);
+
+					if(iter == end())
+					{
+						throw std::out_of_range("Yars::SmallMap::at");
+					}
+
+					return iter->second;
+				}
+
+				const Value& at(const Key& key) const
+				{
+					const_iterator iter = find(key);
+
+					if(iter == end())
+					{
+						throw std::out_of_range("Yars::SmallMap::at");
+					}
+
+					return iter->second;
+				}
+
+				Value& operator[](const Key& key)
+				{
+					return try_emplace(key).first->second;
+				}
+
+				Value& operator[](Key&& key)
+				{
+					return try_emplace(std::move(key)).first->second;
+				}
+
+				bool contains(const Key& key) const noexcept
+				{
+					return (find(key) != end());
+				}
+
+				size_t count(const Key& key) const noexcept
+				{
+					return contains(key) ? 1 : 0;
+				}
+
+				iterator find(const Key& key) noexcept
+				{
+					if(spill)
+					{
+						return {spill->find(key)};
+					}
+
+					return {item() + itemFind(key)};
+				}
+
+				const_iterator find(const Key& key) const noexcept
+				{
+					if(spill)
+					{
+						return {spill->find(key)};
+					}
+
+					return {item() + itemFind(key)};
+				}
+
+				template <typename K>
+				Value& at(const K& key) requires Is_Transparent
+				{
+					iterator iter = find(key);
+
+					if(iter == end())
+					{
+						throw std::out_of_range("Yars::SmallMap::at");
+					}
+
+					return iter->second;
+				}
+
+				template <typename K>
+				const Value& at(const K& key) const requires Is_Transparent
+				{
+					const_iterator iter = find(key);
+
+					if(iter == end())
+					{
+						throw std::out_of_range("Yars::SmallMap::at");
+					}
+
+					return iter->second;
+				}
+
+				template <typename K>
+				bool contains(const K& key) const noexcept requires Is_Transparent
+				{
+					return (find(key) != end());
+				}
+
+				template <typename K>
+				iterator find(const K& key) noexcept requires Is_Transparent
+				{
+					if(spill)
+					{
+						return {spill->find(key)};
+					}
+
+					return {item() + itemFind(key)};
+				}
+
+				template <typename K>
+				const_iterator find(const K& key) const noexcept requires Is_Transparent
+				{
+					if(spill)
+					{
+						return {spill->find(key)};
+					}
+
+					return {item() + itemFind(key)};
+				}
+
+				template <typename K, typename... Args>
+				std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+				{
+					if(spill == nullptr)
+					{
+						const size_t index = indexOf(key);
+
+						if(index < item_size && KeyEqual{}(item()[index].first, key))
+						{
+							return {{item() + index}, false};
+						}
+
+						if(item_size < Inline_Size)
+						{
+							itemOpen(index);
+
+							::new((void*)(item() + index)) value_type(std::piecewise_construct
+								, std::forward_as_tuple(std::forward<K>(key))
+								, std::forward_as_tuple(std::forward<Args>(args)...)
+								);
+
+							return {{item() + index}, true};
+						}
+
+						spillOut();
+					}
+
+					auto [iter, inserted] = spill->try_emplace(std::forward<K>(key), std::forward<Args>(args)...);
+
+					return {{iter}, inserted};
+				}
+
+				template <typename K, typename V>
+				std::pair<iterator, bool> emplace(K&& key, V&& value)
+				{
+					return try_emplace(std::forward<K>(key), std::forward<V>(value));
+				}
+
+				std::pair<iterator, bool> insert(const value_type& value)
+				{
+					return try_emplace(value.first, value.second);
+				}
+
+				size_t erase(const Key& key) noexcept
+				{
+					if(spill)
+					{
+						return spill->erase(key);
+					}
+
+					const size_t index = itemFind(key);
+
+					if(index == item_size)
+					{
+						return 0;
+					}
+
+					itemClose(index);
+
+					return 1;
+				}
+
+				iterator erase(const_iterator iter) noexcept
+				{
+					if(spill)
+					{
+						return {spill->erase(iter.spill)};
+					}
+
+					const size_t index = iter.item - item();
+
+					itemClose(index);
+
+					return {item() + index};
+				}
+
+				void clear() noexcept
+				{
+					for(size_t index = 0; index < item_size; index++)
+					{
+						item()[index].~value_type();
+					}
+
+					item_size = 0;
+					spill.reset();
+				}
+
+				void swap(SmallMap& other) noexcept
+				{
+					SmallMap temp(std::move(other));
+
+					other = std::move(*this);
+					*this = std::move(temp);
+				}
+
+				friend bool operator==(const SmallMap& lhs, const SmallMap& rhs) noexcept
+				{
+					if(lhs.size() != rhs.size())
+					{
+						return false;
+					}
+
+					for(const value_type& value : lhs)
+					{
+						const auto iter = rhs.find(value.first);
+
+						if(iter == rhs.end()
+							|| (iter->second == value.second) == false
+							)
+						{
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+				friend bool operator!=(const SmallMap& lhs, const SmallMap& rhs) noexcept
+				{
+					return !(lhs == rhs);
+				}
+
+			private:
+				alignas(value_type) std::byte item_buffer[Inline_Size * sizeof(value_type)];
+				size_t                        item_size = 0;
+				std::unique_ptr<Spill>        spill     = {};
+
+				value_type* item() noexcept
+				{
+					return std::launder(reinterpret_cast<value_type*>(item_buffer));
+				}
+
+				const value_type* item() const noexcept
+				{
+					return std::launder(reinterpret_cast<const value_type*>(item_buffer));
+				}
+
+				template <typename K>
+				size_t itemFind(const K& key) const noexcept
+				{
+					// A linear scan is faster than a binary search for 
+					// the few entries that fit inline
+					const value_type* list = item();
+
+					for(size_t index = 0; index < item_size; index++)
+					{
+						if(KeyEqual{}(list[index].first, key))
+						{
+							return index;
+						}
+					}
+
+					return item_size;
+				}
+
+				template <typename K>
+				size_t indexOf(const K& key) const noexcept
+				{
+					const value_type* first = item();
+					const value_type* iter  = std::lower_bound(first, first + item_size, key
+						, [](const value_type& value, const K& key)
+						{
+							return Compare{}(value.first, key);
+						});
+
+					return (size_t)(iter - first);
+				}
+
+				void itemOpen(const size_t index) noexcept
+				{
+					value_type* list = item();
+
+					for(size_t i = item_size; i > index; i--)
+					{
+						::new((void*)(list + i)) value_type(std::move(list[i - 1]));
+						list[i - 1].~value_type();
+					}
+
+					item_size++;
+				}
+
+				void itemClose(const size_t index) noexcept
+				{
+					value_type* list = item();
+
+					list[index].~value_type();
+
+					for(size_t i = index + 1; i < item_size; i++)
+					{
+						::new((void*)(list + i - 1)) value_type(std::move(list[i]));
+						list[i].~value_type();
+					}
+
+					item_size--;
+				}
+
+				void moveFrom(SmallMap& other) noexcept
+				{
+					if(other.spill)
+					{
+						spill = std::move(other.spill);
+
+						return;
+					}
+
+					for(size_t index = 0; index < other.item_size; index++)
+					{
+						::new((void*)(item() + index)) value_type(std::move(other.item()[index]));
+					}
+
+					item_size = other.item_size;
+
+					other.clear();
+				}
+
+				void spillOut()
+				{
+					spill = std::make_unique<Spill>();
+					spill->reserve(Inline_Size + 1);
+
+					for(size_t index = 0; index < item_size; index++)
+					{
+						spill->try_emplace(item()[index].first, std::move(item()[index].second));
+						item()[index].~value_type();
+					}
+
+					item_size = 0;
+				}
+		};
+
+	// }}}
+	// {{{ FrozenMap
+
+	public:
+		template <typename Key
+			, typename Value
+			, typename Hash     = std::hash<Key>
+			, typename KeyEqual = std::equal_to<Key>
+			>
+		class FrozenMap
+		{
+			public:
+				using key_type       = Key;
+				using mapped_type    = Value;
+				using value_type     = std::pair<const Key, Value>;
+				using size_type      = size_t;
+				using hasher         = Hash;
+				using key_equal      = KeyEqual;
+				using iterator       = value_type*;
+				using const_iterator = const value_type*;
+
+				static constexpr bool Is_Transparent = requires
+				{
+					typename Hash::is_transparent;
+					typename KeyEqual::is_transparent;
+				};
+
+				FrozenMap() noexcept
+				{
+				}
+
+				iterator       begin() noexcept        { return slot.data(); }
+				const_iterator begin() const noexcept  { return slot.data(); }
+				const_iterator cbegin() const noexcept { return slot.data(); }
+				iterator       end() noexcept          { return slot.data() + slot.size(); }
+				const_iterator end() const noexcept    { return slot.data() + slot.size(); }
+				const_iterator cend() const noexcept   { return slot.data() + slot.size(); }
+
+				bool   empty() const noexcept { return slot.empty(); }
+				size_t size() const noexcept  { return slot.size(); }
+
+				Value& at(const Key& key)
+				{
+					const size_t index = indexOf(key);
+
+					if(index == slot.size())
+					{
+						throw std::out_of_range("Yars::FrozenMap::at");
+					}
+
+					return slot[index].second;
+				}
+
+				const Value& at(const Key& key) const
+				{
+					const size_t index = indexOf(key);
+
+					if(index == slot.size())
+					{
+						throw std::out_of_range("Yars::FrozenMap::at");
+					}
+
+					return slot[index].second;
+				}
+
+				value_type& atIndex(const size_t index) noexcept
+				{
+					return slot[index];
+				}
+
+				const value_type& atIndex(const size_t index) const noexcept
+				{
+					return slot[index];
+				}
+
+				bool contains(const Key& key) const noexcept
+				{
+					return (indexOf(key) != slot.size());
+				}
+
+				size_t count(const Key& key) const noexcept
+				{
+					return contains(key) ? 1 : 0;
+				}
+
+				iterator find(const Key& key) noexcept
+				{
+					return slot.data() + indexOf(key);
+				}
+
+				const_iterator find(const Key& key) const noexcept
+				{
+					return slot.data() + indexOf(key);
+				}
+
+				template <typename K>
+				Value& at(const K& key) requires Is_Transparent
+				{
+					const size_t index = indexOf(key);
+
+					if(index == slot.size())
+					{
+						throw std::out_of_range("Yars::FrozenMap::at");
+					}
+
+					return slot[index].second;
+				}
+
+				template <typename K>
+				const Value& at(const K& key) const requires Is_Transparent
+				{
+					const size_t index = indexOf(key);
+
+					if(index == slot.size())
+					{
+						throw std::out_of_range("Yars::FrozenMap::at");
+					}
+
+					return slot[index].second;
+				}
+
+				template <typename K>
+				bool contains(const K& key) const noexcept requires Is_Transparent
+				{
+					return (indexOf(key) != slot.size());
+				}
+
+				template <typename K>
+				iterator find(const K& key) noexcept requires Is_Transparent
+				{
+					return slot.data() + indexOf(key);
+				}
+
+				template <typename K>
+				const_iterator find(const K& key) const noexcept requires Is_Transparent
+				{
+					return slot.data() + indexOf(key);
+				}
+
+				template <typename K>
+				size_t indexOf(const K& key) const noexcept
+				{
+					if(slot.empty())
+					{
+						return 0;
+					}
+
+					const uint64_t hash  = hashOf(key);
+					const uint32_t index = table[slotOf(hash, seed[bucketOf(hash, seed.size())], table.size())];
+
+					if(index != Source_None
+						&& KeyEqual{}(slot[index].first, key)
+						)
+					{
+						return index;
+					}
+
+					return slot.size();
+				}
+
+				template <typename Map>
+				bool build(Map& map)
+				{
+					clear();
+
+					const size_t count = map.size();
+
+					if(count == 0)
+					{
+						return true;
+					}
+
+					std::vector<typename Map::value_type*> source;
+					std::vector<uint64_t>                  source_hash;
+
+					source.reserve(count);
+					source_hash.reserve(count);
+
+					for(auto& value : map)
+					{
+						source.push_back(&value);
+						source_hash.push_back(hashOf(value.first));
+					}
+
+					const size_t bucket_count = std::bit_ceil((count + Bucket_Load - 1) / Bucket_Load);
+
+					std::vector<std::vector<uint32_t>> bucket(bucket_count);
+
+					for(uint32_t i = 0; i < count; i++)
+					{
+						bucket[bucketOf(source_hash[i], bucket_count)].push_back(i);
+					}
+
+					// Place the largest buckets first, while most of the 
+					// slots are still free
+					std::vector<uint32_t> bucket_order(bucket_count);
+					std::iota(std::begin(bucket_order), std::end(bucket_order), 0);
+					std::stable_sort(std::begin(bucket_order), std::end(bucket_order)
+						, [&](const uint32_t lhs, const uint32_t rhs)
+						{
+							return bucket[lhs].size() > bucket[rhs].size();
+						});
+
+					std::vector<uint32_t> bucket_seed(bucket_count, 0);
+					std::vector<uint32_t> table_source;
+
+					// The table has free slots so that the last buckets 
+					// can still find room.  If a bucket runs out of seeds 
+					// the table is made larger and the buckets are placed 
+					// again.
+					size_t table_size = count + (count / 4) + 1;
+					bool   is_placed  = false;
+
+					for(size_t attempt = 0; attempt < Build_Attempt_Max && is_placed == false; attempt++)
+					{
+						is_placed  = place(bucket, bucket_order, source_hash, table_size, bucket_seed, table_source);
+						table_size = table_size + (table_size / 2);
+					}
+
+					if(is_placed == false)
+					{
+						// Only happens when keys have the same hash
+						return false;
+					}
+
+					slot.reserve(count);
+					table.assign(table_source.size(), Source_None);
+
+					for(size_t index = 0; index < table_source.size(); index++)
+					{
+						const uint32_t i = table_source[index];
+
+						if(i == Source_None)
+						{
+							continue;
+						}
+
+						table[index] = (uint32_t)slot.size();
+						slot.emplace_back(source[i]->first, std::move(source[i]->second));
+					}
+
+					seed = std::move(bucket_seed);
+
+					map.clear();
+
+					return true;
+				}
+
+				template <typename Map>
+				void release(Map& map)
+				{
+					for(value_type& value : slot)
+					{
+						map.try_emplace(value.first, std::move(value.second));
+					}
+
+					clear();
+				}
+
+				void clear() noexcept
+				{
+					slot.clear();
+					seed.clear();
+					table.clear();
+				}
+
+			private:
+				static constexpr size_t   Build_Attempt_Max = 8;
+				static constexpr size_t   Bucket_Load       = 4;
+				static constexpr uint32_t Seed_Max          = 1 << 16;
+				static constexpr uint32_t Source_None       = std::numeric_limits<uint32_t>::max();
+
+				std::vector<value_type> slot  = {};
+				std::vector<uint32_t>   seed  = {};
+				std::vector<uint32_t>   table = {};
+
+				static bool place(const std::vector<std::vector<uint32_t>>& bucket
+					, const std::vector<uint32_t>& bucket_order
+					, const std::vector<uint64_t>& source_hash
+					, const size_t                 table_size
+					, std::vector<uint32_t>&       bucket_seed
+					, std::vector<uint32_t>&       table_source
+					)
+				{
+					table_source.assign(table_size, Source_None);
+
+					std::vector<size_t> slot_list;
+
+					for(const uint32_t b : bucket_order)
+					{
+						const std::vector<uint32_t>& list = bucket[b];
+
+						if(list.empty())
+						{
+							break;
+						}
+
+						bool is_placed = false;
+
+						for(uint32_t s = 0; s < Seed_Max && is_placed == false; s++)
+						{
+							slot_list.clear();
+
+							for(const uint32_t i : list)
+							{
+								const size_t index = slotOf(source_hash[i], s, table_size);
+
+								if(table_source[index] != Source_None
+									|| std::find(std::begin(slot_list), std::end(slot_list), index) != std::end(slot_list)
+									)
+								{
+									break;
+								}
+
+								slot_list.push_back(index);
+							}
+
+							if(slot_list.size() == list.size())
+							{
+								for(size_t i = 0; i < list.size(); i++)
+								{
+									table_source[slot_list[i]] = list[i];
+								}
+
+								bucket_seed[b] = s;
+								is_placed      = true;
+							}
+						}
+
+						if(is_placed == false)
+						{
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+				template <typename K>
+				static uint64_t hashOf(const K& key) noexcept
+				{
+					uint64_t hash = (uint64_t)Hash{}(key) * 0x9e3779b97f4a7c15ULL;
+
+					return hash ^ (hash >> 32);
+				}
+
+				static size_t bucketOf(const uint64_t hash, const size_t bucket_count) noexcept
+				{
+					return (size_t)(hash >> 32) & (bucket_count - 1);
+				}
+
+				static size_t slotOf(const uint64_t hash, const uint32_t seed, const size_t table_size) noexcept
+				{
+					uint64_t x = hash ^ ((uint64_t)seed * 0xc2b2ae3d27d4eb4fULL);
+
+					x ^= x >> 33;
+					x *= 0xff51afd7ed558ccdULL;
+					x ^= x >> 33;
+
+					return (size_t)(((x & 0xffffffffULL) * table_size) >> 32);
+				}
+		};
+
+	// }}}
+	// {{{ SharedMap
+
+	public:
+		template <typename Key
+			, typename Value
+			>
+		class SharedMap
+		{
+			public:
+				using key_type    = Key;
+				using mapped_type = Value;
+				using size_type   = size_t;
+				using pointer     = std::shared_ptr<Value>;
+
+			private:
+				using Map = Yars::FlatMap<Key, pointer>;
+
+			public:
+				template <bool Is_Const>
+				class Iterator
+				{
+					public:
+						using base_iterator = std::conditional_t<Is_Const, typename Map::const_iterator, typename Map::iterator>;
+						using reference     = std::conditional_t<Is_Const, const Value&, Value&>;
+
+						struct Entry
+						{
+							const Key& first;
+							reference  second;
+
+							const Entry* operator->() const noexcept
+							{
+								return this;
+							}
+						};
+
+						Iterator(base_iterator iter) noexcept
+							: iter(iter)
+						{
+						}
+
+						Entry operator*() const noexcept
+						{
+							return {iter->first, *iter->second};
+						}
+
+						Entry operator->() const noexcept
+						{
+							return {iter->first, *iter->second};
+						}
+
+						Iterator& operator++() noexcept
+						{
+							++iter;
+
+							return *this;
+						}
+
+						bool operator==(const Iterator& other) const noexcept
+						{
+							return (iter == other.iter);
+						}
+
+						bool operator!=(const Iterator& other) const noexcept
+						{
+							return (iter != other.iter);
+						}
+
+					private:
+						base_iterator iter;
+				};
+
+				using iterator       = Iterator<false>;
+				using const_iterator = Iterator<true>;
+
+				SharedMap() noexcept
+				{
+				}
+
+				iterator       begin() noexcept       { return {map.begin()}; }
+				const_iterator begin() const noexcept { return {map.begin()}; }
+				iterator       end() noexcept         { return {map.end()}; }
+				const_iterator end() const noexcept   { return {map.end()}; }
+
+				bool   empty() const noexcept { return map.empty(); }
+				size_t size() const noexcept  { return map.size(); }
+
+				Value& at(const Key& key)
+				{
+					pointer& value = map.at(key);
+
+					detach(value);
+
+					return *value;
+				}
+
+				const Value& at(const Key& key) const
+				{
+					return *map.at(key);
+				}
+
+				Value& operator[](const Key& key)
+				{
+					pointer& value = map[key];
+
+					if(value == nullptr)
+					{
+						value = std::make_shared<Value>();
+					}
+					else
+					{
+						detach(value);
+					}
+
+					return *value;
+				}
+
+				bool contains(const Key& key) const noexcept
+				{
+					return map.contains(key);
+				}
+
+				size_t count(const Key& key) const noexcept
+				{
+					return map.count(key);
+				}
+
+				iterator find(const Key& key) noexcept
+				{
+					auto iter = map.find(key);
+
+					if(iter != map.end())
+					{
+						detach(iter->second);
+					}
+
+					return {iter};
+				}
+
+				const_iterator find(const Key& key) const noexcept
+				{
+					return {map.find(key)};
+				}
+
+				template <typename V>
+				void assign(const Key& key, V&& value)
+				{
+					pointer& current = map[key];
+
+					if(current != nullptr && current.use_count() == 1)
+					{
+						*current = std::forward<V>(value);
+					}
+					else
+					{
+						current = std::make_shared<Value>(std::forward<V>(value));
+					}
+				}
+
+				void share(const Key& key, const pointer& value)
+				{
+					map[key] = value;
+				}
+
+				bool isShared(const Key& key) const noexcept
+				{
+					const auto iter = map.find(key);
+
+					return (iter != map.end() && iter->second.use_count() > 1);
+				}
+
+				size_t erase(const Key& key) noexcept
+				{
+					return map.erase(key);
+				}
+
+				void clear() noexcept
+				{
+					map.clear();
+				}
+
+				void reserve(const size_t count)
+				{
+					map.reserve(count);
+				}
+
+			private:
+				Map map = {};
+
+				static void detach(pointer& value)
+				{
+					if(value.use_count() > 1)
+					{
+						value = std::make_shared<Value>(std::as_const(*value));
+					}
+				}
+		};
+
+	// }}}
+	// {{{ Name
+
+	public:
+		static constexpr uint64_t nameHash(const std::string_view name) noexcept
+		{
+			// FNV-1a, so that the same hash can be made at compile-time
+			uint64_t hash = 0xcbf29ce484222325ULL;
+
+			for(const char c : name)
+			{
+				hash ^= (uint8_t)c;
+				hash *= 0x100000001b3ULL;
+			}
+
+			return hash;
+		}
+
+		class Name
+		{
+			public:
+				explicit consteval Name(const std::string_view name) noexcept
+					: name(name)
+					, hash(Yars::nameHash(name))
+				{
+				}
+
+				constexpr operator std::string_view() const noexcept
+				{
+					return name;
+				}
+
+				constexpr std::string_view view() const noexcept
+				{
+					return name;
+				}
+
+				constexpr uint64_t value() const noexcept
+				{
+					return hash;
+				}
+
+				std::string string() const noexcept
+				{
+					return std::string(name);
+				}
+
+			private:
+				std::string_view name;
+				uint64_t         hash;
+		};
+
+		struct NameHash
+		{
+			using is_transparent = void;
+
+			size_t operator()(const std::string_view name) const noexcept
+			{
+				return (size_t)Yars::nameHash(name);
+			}
+
+			size_t operator()(const Yars::Name& name) const noexcept
+			{
+				return (size_t)name.value();
+			}
+		};
+
+		struct NameEqual
+		{
+			using is_transparent = void;
+
+			template <typename Lhs, typename Rhs>
+			bool operator()(const Lhs& lhs, const Rhs& rhs) const noexcept
+			{
+				return (std::string_view(lhs) == std::string_view(rhs));
+			}
+		};
+
+		template <size_t Count>
+		struct NameSchema
+		{
+			std::array<std::string_view, Count> name_list = {};
+
+			consteval Yars::Name operator()(const std::string_view name) const
+			{
+				if(std::find(std::begin(name_list), std::end(name_list), name) == std::end(name_list))
+				{
+					throw std::invalid_argument("Yars::NameSchema: Unknown name");
+				}
+
+				return Yars::Name(name);
+			}
+		};
+
+		template <typename Value, size_t Inline_Size>
+		using SmallMapName = Yars::SmallMap<std::string, Value, Inline_Size, Yars::NameHash, Yars::NameEqual>;
+
+		template <typename Value>
+		using FlatMapName = Yars::FlatMap<std::string, Value, Yars::NameHash, Yars::NameEqual>;
+
+		template <typename Value>
+		using FrozenMapName = Yars::FrozenMap<std::string, Value, Yars::NameHash, Yars::NameEqual>;
+
+	// }}}
+	// {{{ Config
+
+	public:
+		enum class Math : uint8_t
+		{	Float
+		,	Table
+		,	Fixed
+		};
+
+		struct Config
+		{
+			bool       safe_mode       = false;
+			bool       id_shuffle      = false;
+			bool       clear_on_delete = false;
+			Yars::Math math            = Yars::Math::Float;
+		};
+
+		static Yars::Config configDefault() noexcept;
+
+		const Yars::Config& config() const noexcept;
+
+	// }}}
+	// {{{ Ctor / Dtor
+
+	public:
+		Yars();
+		explicit Yars(std::mt19937&);
+		explicit Yars(const Yars::Config&);
+		Yars(std::mt19937&, const Yars::Config&);
+
+	// }}}
+	// {{{ Data Types
+
+	public:
+		using Handle               = uint32_t;
+		using Id                   = uint64_t;
+		using MapStringBool        = Yars::SmallMapName<bool, 4>;
+		using MapStringFloat       = Yars::SmallMapName<float, 4>;
+		using MapStringHandle      = Yars::FlatMapName<Yars::Handle>;
+		using MapStringInt32       = Yars::SmallMapName<int32_t, 4>;
+		using MapStringModifier    = Yars::FlatMapName<int32_t>;
+		using MapStringString      = Yars::SmallMapName<std::string, 4>;
+		using MapStringUint32      = Yars::SmallMapName<uint32_t, 4>;
+		using MapIdMapStringBool   = Yars::FlatMap<Yars::Id, Yars::MapStringBool>;
+		using MapIdMapStringFloat  = Yars::FlatMap<Yars::Id, Yars::MapStringFloat>;
+		using MapIdMapStringInt32  = Yars::FlatMap<Yars::Id, Yars::MapStringInt32>;
+		using MapIdMapStringString = Yars::FlatMap<Yars::Id, Yars::MapStringString>;
+		using MultimapIdId         = std::unordered_multimap<Yars::Id, Yars::Id>;
+		using VectorFloat          = std::vector<float>;
+		using VectorId             = std::vector<Yars::Id>;
+		using VectorInt32          = std::vector<int32_t>;
+		using VectorString         = std::vector<std::string>;
+		using MapIdVectorId        = Yars::FlatMap<Yars::Id, Yars::VectorId>;
+
+		static constexpr Yars::Handle Handle_Invalid = std::numeric_limits<Yars::Handle>::max();
+
+	private:
+		static Yars::Handle handleIntern(Yars::MapStringHandle&, Yars::VectorString&, const std::string&) noexcept;
+
+	// }}}
+	// {{{ Health
+
+	public:
+		struct Health
+		{
+			uint32_t current          = 0;
+			uint32_t maximum          = 0;
+			uint32_t maximum_base     = 0;
+			int32_t  maximum_modifier = 0;
+		};
+
+		using MapIdHealth  = Yars::FlatMap<Yars::Id, Yars::Health>;
+		using VectorHealth = std::vector<Yars::Health>;
+
+		static constexpr int32_t Health_Max = std::numeric_limits<int32_t>::max();
+		static constexpr int32_t Health_Min = std::numeric_limits<int32_t>::min();
+
+		static void healthSet(Yars::Health&, const uint32_t, const uint32_t) noexcept;
+		static void healthModifierSet(Yars::Health&, const int32_t) noexcept;
+
+		static void healthAdjust(Yars::Health&, const int32_t) noexcept;
+		static void healthMaximumAdjust(Yars::Health&, const int32_t) noexcept;
+		static void healthModifierAdjust(Yars::Health&, const int32_t) noexcept;
+
+		static void healthIncreaseToMaximum(Yars::Health&) noexcept;
+
+	private:
+		static void healthUpdate(Yars::Health&) noexcept;
+
+	// }}}
+	// {{{ Level
+
+	public:
+		struct Level
+		{
+			float   partial    = 0;
+			int32_t modifier   = 0;
+			int32_t value      = 0;
+			int32_t value_base = 0;
+		};
+
+		static constexpr int32_t Level_Max = std::numeric_limits<int32_t>::max();
+		static constexpr int32_t Level_Min = std::numeric_limits<int32_t>::min();
+
+		static uint32_t levelIncrease(Yars::Level&, const float) noexcept;
+		static uint32_t levelDecrease(Yars::Level&, const float) noexcept;
+		static void     levelModifierAdjust(Yars::Level&, const int32_t) noexcept;
+		static void     levelSet(Yars::Level&, const int32_t, const float = 0) noexcept;
+	
+	private:
+		static void     levelUpdate(Yars::Level&) noexcept;
+
+	// }}}
+	// {{{ Histogram
+
+	public:
+		static constexpr size_t Histogram_Size = 32;
+
+		struct Histogram
+		{
+			std::array<uint32_t, Yars::Histogram_Size> count = {};
+			uint32_t                                   total = 0;
+		};
+
+		static void    histogramAdjust(Yars::Histogram&, const int32_t, const int32_t) noexcept;
+		static size_t  histogramBucket(const int32_t) noexcept;
+		static int32_t histogramBucketMin(const size_t) noexcept;
+
+	// }}}
+	// {{{ Attribute
+
+	public:
+		struct Attribute
+		{
+			Yars::Level level = {};
+		};
+
+		using MapStringAttribute      = Yars::SmallMapName<Yars::Attribute, 8>;
+		using MapIdMapStringAttribute = Yars::SharedMap<Yars::Id, Yars::MapStringAttribute>;
+
+		Yars::Attribute&       attribute(const std::string&) noexcept;
+		const Yars::Attribute& attribute(const std::string&) const noexcept;
+		const Yars::Attribute& attribute(const Yars::Name&) const noexcept;
+		bool                   attributeAdd(const std::string&) noexcept;
+		bool                   attributeExists(const std::string&) const noexcept;
+		bool                   attributeExists(const Yars::Name&) const noexcept;
+		Yars::Handle           attributeHandle(const std::string&) const noexcept;
+		std::string            attributeHandleName(const Yars::Handle) const noexcept;
+
+	private:
+		MapStringAttribute attribute_map;
+		MapStringHandle    attribute_handle;
+		VectorString       attribute_handle_name;
+
+	// }}}
+	// {{{ Skill
+
+	public:
+		struct SkillWeight
+		{
+			Yars::MapStringInt32 contribution = {};
+			Yars::VectorString   attribute    = {};
+			Yars::VectorFloat    weight       = {};
+		};
+
+		using SkillWeightPtr = std::shared_ptr<const Yars::SkillWeight>;
+
+		struct Skill
+		{
+			Yars::MapStringInt32 attribute_contribution = {};
+			Yars::Level          level                  = {};
+			Yars::SkillWeightPtr attribute_weight       = {};
+		};
+
+		struct SkillSet
+		{
+			std::vector<uint64_t> bit   = {};
+			size_t                count = 0;
+			uint64_t              hash  = 0;
+		};
+
+		using MapStringSkill      = Yars::FlatMapName<Yars::Skill>;
+		using MapIdMapStringSkill = Yars::SharedMap<Yars::Id, Yars::MapStringSkill>;
+		using MapIdSkillSet       = Yars::FlatMap<Yars::Id, Yars::SkillSet>;
+
+		Yars::Skill&       skill(const std::string&) noexcept;
+		const Yars::Skill& skill(const std::string&) const noexcept;
+		const Yars::Skill& skill(const Yars::Name&) const noexcept;
+		bool               skillAdd(const std::string&, const Yars::Skill&) noexcept;
+		bool               skillRemove(const std::string&) noexcept;
+		bool               skillExists(const std::string&) const noexcept;
+		bool               skillExists(const Yars::Name&) const noexcept;
+		Yars::VectorString skillList() const noexcept;
+		Yars::Handle       skillHandle(const std::string&) const noexcept;
+		std::string        skillHandleName(const Yars::Handle) const noexcept;
+
+		static void        skillWeightUpdate(Yars::Skill&) noexcept;
+
+		Yars::SkillSet     skillSet(const Yars::VectorString&) noexcept;
+		static bool        skillSetContains(const Yars::SkillSet&, const Yars::Handle) noexcept;
+		static void        skillSetErase(Yars::SkillSet&, const Yars::Handle) noexcept;
+		static void        skillSetInsert(Yars::SkillSet&, const Yars::Handle) noexcept;
+		static bool        skillSetIntersects(const Yars::SkillSet&, const Yars::SkillSet&) noexcept;
+
+	private:
+		static const Yars::SkillWeight& skillWeight(const Yars::Skill&, Yars::SkillWeight&) noexcept;
+		static void                     skillWeightCalculate(const Yars::MapStringInt32&, Yars::SkillWeight&) noexcept;
+		static bool                     skillSetAny(const Yars::SkillSet*, const Yars::MapStringSkill&, const Yars::VectorString&, const Yars::SkillSet&) noexcept;
+		static uint64_t                 skillSetHash(const Yars::VectorString&) noexcept;
+
+		MapStringSkill  skill_map;
+		MapStringHandle skill_handle;
+		VectorString    skill_handle_name;
+
+	// }}}
+	// {{{ Item
+
+	public:
+		struct Item
+		{
+			Yars::MapStringModifier affect_attribute      = {};
+			Yars::MapStringModifier affect_skill          = {};
+			Yars::MapStringModifier modify_attribute      = {};
+			Yars::MapStringModifier modify_skill          = {};
+			Yars::VectorString      skill_attacker        = {};
+			Yars::VectorString      skill_defender        = {};
+			uint32_t                count                 = 0;
+			int32_t                 affect_health_current = 0;
+			int32_t                 affect_health_maximum = 0;
+			int32_t                 modify_health_current = 0;
+			int32_t                 modify_health_maximum = 0;
+			Yars::SkillSet          skill_attacker_set    = {};
+			Yars::SkillSet          skill_defender_set    = {};
+		};
+
+		using VectorItem              = std::vector<Yars::Item>;
+		using MapStringItem           = Yars::FlatMapName<Yars::Item>;
+		using MultimapStringItem      = std::unordered_multimap<std::string, Yars::Item>;
+		using MapIdMapStringItem      = Yars::SharedMap<Yars::Id, Yars::MapStringItem>;
+		using MapIdMultimapStringItem = Yars::FlatMap<Yars::Id, Yars::MultimapStringItem>;
+
+		Yars::Item&        item(const std::string&) noexcept;
+		const Yars::Item&  item(const std::string&) const noexcept;
+		const Yars::Item&  item(const Yars::Name&) const noexcept;
+		bool               itemAdd(const std::string&, const Yars::Item&) noexcept;
+		bool               itemRemove(const std::string&) noexcept;
+		void               itemSkillSetUpdate(Yars::Item&) noexcept;
+		bool               itemExists(const std::string&) const noexcept;
+		bool               itemExists(const Yars::Name&) const noexcept;
+		bool               itemIsUsable(const std::string&) const noexcept;
+		bool               itemIsUsableByAttacker(const std::string&) const noexcept;
+		bool               itemIsUsableByDefender(const std::string&) const noexcept;
+		Yars::VectorString itemList() const noexcept;
+
+	private:
+		MapStringItem item_map;
+
+	// }}}
+	// {{{ Catalog
+
+	public:
+		using CatalogIndex     = uint32_t;
+		using CatalogAttribute = Yars::FrozenMapName<Yars::Attribute>;
+		using CatalogSkill     = Yars::FrozenMapName<Yars::Skill>;
+		using CatalogItem      = Yars::FrozenMapName<Yars::Item>;
+
+		static constexpr Yars::CatalogIndex CatalogIndex_Invalid = std::numeric_limits<Yars::CatalogIndex>::max();
+
+		bool                   catalogFreeze() noexcept;
+		void                   catalogUnfreeze() noexcept;
+		bool                   catalogIsFrozen() const noexcept;
+		const Yars::Attribute& catalogAttribute(const Yars::CatalogIndex) const noexcept;
+		Yars::CatalogIndex     catalogAttributeIndex(const std::string&) const noexcept;
+		const Yars::Skill&     catalogSkill(const Yars::CatalogIndex) const noexcept;
+		Yars::CatalogIndex     catalogSkillIndex(const std::string&) const noexcept;
+		const Yars::Item&      catalogItem(const Yars::CatalogIndex) const noexcept;
+		Yars::CatalogIndex     catalogItemIndex(const std::string&) const noexcept;
+
+	private:
+		template <typename K> Yars::Attribute*       attributeFind(const K&) noexcept;
+		template <typename K> const Yars::Attribute* attributeFind(const K&) const noexcept;
+		template <typename K> Yars::Skill*           skillFind(const K&) noexcept;
+		template <typename K> const Yars::Skill*     skillFind(const K&) const noexcept;
+		template <typename K> Yars::Item*            itemFind(const K&) noexcept;
+		template <typename K> const Yars::Item*      itemFind(const K&) const noexcept;
+
+		template <typename Catalog>
+		static Yars::CatalogIndex catalogIndex(const Catalog&, const std::string&) noexcept;
+
+		Yars::CatalogAttribute catalog_attribute;
+		Yars::CatalogSkill     catalog_skill;
+		Yars::CatalogItem      catalog_item;
+		bool                   catalog_is_frozen;
+
+	// }}}
+	// {{{ Ledger
+
+	public:
+		enum class LedgerSource : uint8_t
+		{	Equipment
+		,	Affect
+		};
+
+		struct LedgerModifier
+		{
+			Yars::Handle handle = Yars::Handle_Invalid;
+			int32_t      amount = 0;
+		};
+
+		using VectorLedgerModifier = std::vector<Yars::LedgerModifier>;
+
+		struct LedgerEntry
+		{
+			Yars::VectorLedgerModifier attribute      = {};
+			Yars::VectorLedgerModifier skill          = {};
+			int32_t                    health_maximum = 0;
+		};
+
+		using MapIdLedgerEntry     = Yars::FlatMap<Yars::Id, Yars::LedgerEntry>;
+		using MapStringLedgerEntry = Yars::FlatMap<std::string, Yars::LedgerEntry>;
+
+		struct Ledger
+		{
+			Yars::VectorInt32          attribute      = {};
+			Yars::VectorInt32          skill          = {};
+			int32_t                    health_maximum = 0;
+			Yars::MapStringLedgerEntry equipment      = {};
+			Yars::MapIdLedgerEntry     affect         = {};
+		};
+
+		using MapIdLedger = Yars::FlatMap<Yars::Id, Yars::Ledger>;
+
+		struct LedgerContribution
+		{
+			Yars::LedgerSource source    = Yars::LedgerSource::Equipment;
+			std::string        location  = {};
+			Yars::Id           affect_id = 0;
+			int32_t            amount    = 0;
+		};
+
+		using VectorLedgerContribution = std::vector<Yars::LedgerContribution>;
+
+	private:
+		static void ledgerAdjust(Yars::Ledger&, const Yars::LedgerEntry&, const int32_t) noexcept;
+
+		Yars::LedgerEntry ledgerEntry(const Yars::MapStringModifier&, const Yars::MapStringModifier&, const int32_t) noexcept;
+
+		static Yars::VectorLedgerContribution ledgerContributionList(const Yars::Ledger&, Yars::VectorLedgerModifier Yars::LedgerEntry::*, const Yars::Handle) noexcept;
+
+	// }}}
+	// {{{ Modifier Cache
+
+	public:
+		struct ModifierCacheEntry
+		{
+			uint64_t generation = 0;
+			float    modifier   = 0;
+		};
+
+		using VectorModifierCacheEntry = std::vector<Yars::ModifierCacheEntry>;
+
+		struct ModifierCache
+		{
+			Yars::VectorModifierCacheEntry entry      = {};
+			uint64_t                       generation = 0;
+		};
+
+		using MapIdModifierCache = Yars::FlatMap<Yars::Id, Yars::ModifierCache>;
+
+		struct ModifierCacheStats
+		{
+			uint64_t hit        = 0;
+			uint64_t miss       = 0;
+			uint64_t invalidate = 0;
+		};
+
+		void                            modifierCacheInvalidate() noexcept;
+		const Yars::ModifierCacheStats& modifierCacheStats() const noexcept;
+		void                            modifierCacheStatsReset() noexcept;
+
+	private:
+		template <typename K>
+		float modifierCacheCalculate(const Yars::Id, const K&) const noexcept;
+
+		mutable Yars::MapIdModifierCache modifier_cache;
+		mutable Yars::ModifierCacheStats modifier_cache_stats;
+		mutable uint64_t                 modifier_cache_generation;
+		uint64_t                         modifier_cache_floor;
+
+	// }}}
+	// {{{ Layer
+
+	public:
+		struct Layer
+		{
+			Yars::MapStringInt32 modify_attribute = {};
+			Yars::MapStringInt32 modify_skill     = {};
+			bool                 is_global        = false;
+		};
+
+		using MapStringLayer = Yars::FlatMap<std::string, Yars::Layer>;
+
+		const Yars::Layer& layer(const std::string&) const noexcept;
+		bool               layerAdd(const std::string&, const Yars::Layer&) noexcept;
+		bool               layerExists(const std::string&) const noexcept;
+		Yars::VectorString layerList() const noexcept;
+		bool               layerRemove(const std::string&) noexcept;
+
+	private:
+		Yars::MapStringLayer layer_map;
+		uint64_t             layer_version;
+
+	// }}}
+	// {{{ Character
+
+	public:
+		Yars::Id                        characterCreate() noexcept;
+		bool                            characterDelete(const Yars::Id) noexcept;
+		bool                            characterExists(const Yars::Id) const noexcept;
+		bool                            characterConfigItemStackMax(const Yars::Id, const uint32_t) noexcept;
+
+		Yars::Health&                   characterHealth(const Yars::Id) noexcept;
+		const Yars::Health&             characterHealth(const Yars::Id) const noexcept;
+
+		Yars::Attribute&                characterAttribute(const Yars::Id, const std::string&) noexcept;
+		const Yars::Attribute&          characterAttribute(const Yars::Id, const std::string&) const noexcept;
+		Yars::Attribute&                characterAttribute(const Yars::Id, const Yars::Name&) noexcept;
+		const Yars::Attribute&          characterAttribute(const Yars::Id, const Yars::Name&) const noexcept;
+		bool                            characterAttributeExists(const Yars::Id, const std::string&) const noexcept;
+		bool                            characterAttributeExists(const Yars::Id, const Yars::Name&) const noexcept;
+		Yars::MapStringAttribute&       characterAttributeMap(const Yars::Id) noexcept;
+		const Yars::MapStringAttribute& characterAttributeMap(const Yars::Id) const noexcept;
+
+		bool                            characterDataClear(const Yars::Id) noexcept;
+		bool                            characterDataErase(const Yars::Id, const std::string&) noexcept;
+		bool                            characterDataGet(const Yars::Id, const std::string&, bool&) const noexcept;
+		bool                            characterDataGet(const Yars::Id, const std::string&, float&) const noexcept;
+		bool                            characterDataGet(const Yars::Id, const std::string&, int32_t&) const noexcept;
+		bool                            characterDataGet(const Yars::Id, const std::string&, std::string&) const noexcept;
+		bool                            characterDataSet(const Yars::Id, const std::string&, const bool) noexcept;
+		bool                            characterDataSet(const Yars::Id, const std::string&, const float) noexcept;
+		bool                            characterDataSet(const Yars::Id, const std::string&, const int32_t) noexcept;
+		bool                            characterDataSet(const Yars::Id, const std::string&, const std::string&) noexcept;
+		bool                            characterDataGet(const Yars::Id, Yars::MapStringBool&) const noexcept;
+		bool                            characterDataGet(const Yars::Id, Yars::MapStringFloat&) const noexcept;
+		bool                            characterDataGet(const Yars::Id, Yars::MapStringInt32&) const noexcept;
+		bool                            characterDataGet(const Yars::Id, Yars::MapStringString&) const noexcept;
+		bool                            characterDataSet(const Yars::Id, const Yars::MapStringBool&) noexcept;
+		bool                            characterDataSet(const Yars::Id, const Yars::MapStringFloat&) noexcept;
+		bool                            characterDataSet(const Yars::Id, const Yars::MapStringInt32&) noexcept;
+		bool                            characterDataSet(const Yars::Id, const Yars::MapStringString&) noexcept;
+
+		Yars::Skill&                    characterSkill(const Yars::Id, const std::string&) noexcept;
+		const Yars::Skill&              characterSkill(const Yars::Id, const std::string&) const noexcept;
+		Yars::Skill&                    characterSkill(const Yars::Id, const Yars::Name&) noexcept;
+		const Yars::Skill&              characterSkill(const Yars::Id, const Yars::Name&) const noexcept;
+		bool                            characterSkillAdd(const Yars::Id, const std::string&) noexcept;
+		bool                            characterSkillRemove(const Yars::Id, const std::string&) noexcept;
+		bool                            characterSkillIncrease(const Yars::Id, const std::string&, const float) noexcept;
+		bool                            characterSkillExists(const Yars::Id, const std::string&) const noexcept;
+		bool                            characterSkillExists(const Yars::Id, const Yars::Name&) const noexcept;
+		Yars::VectorString              characterSkillList(const Yars::Id) const noexcept;
+		Yars::MapStringSkill&           characterSkillMap(const Yars::Id) noexcept;
+		const Yars::MapStringSkill&     characterSkillMap(const Yars::Id) const noexcept;
+
+		Yars::Item&                     characterItem(const Yars::Id, const std::string&, const uint32_t = 0) noexcept;
+		const Yars::Item&               characterItem(const Yars::Id, const std::string&, const uint32_t = 0) const noexcept;
+		bool                            characterItemAdd(const Yars::Id, const std::string&, const uint32_t = 1) noexcept;
+		bool                            characterItemRemove(const Yars::Id, const std::string&, const uint32_t = 1) noexcept;
+		Yars::Item                      characterItemTake(const Yars::Id, const std::string&) noexcept;
+		bool                            characterItemTransfer(const Yars::Id, const Yars::Id, const std::string&, const uint32_t = 1) noexcept;
+		bool                            characterTrade(const Yars::Id, const Yars::MapStringUint32&, const Yars::Id, const Yars::MapStringUint32&) noexcept;
+		bool                            characterItemExists(const Yars::Id, const std::string&) const noexcept;
+		uint32_t                        characterItemCount(const Yars::Id, const std::string&) const noexcept;
+		uint32_t                        characterItemCount(const Yars::Id, const std::string&, uint32_t&) const noexcept;
+		bool                            characterItemIsUsable(const Yars::Id, const std::string&) const noexcept;
+		bool                            characterItemIsUsableByAttacker(const Yars::Id, const std::string&) const noexcept;
+		bool                            characterItemIsUsableByAttacker(const Yars::Id, const std::string&, const std::string&) const noexcept;
+		bool                            characterItemIsUsableByAttacker(const Yars::Id, const Yars::Item&) const noexcept;
+		bool                            characterItemIsUsableByDefender(const Yars::Id, const std::string&) const noexcept;
+		bool                            characterItemIsUsableByDefender(const Yars::Id, const std::string&, const std::string&) const noexcept;
+		bool                            characterItemIsUsableByDefender(const Yars::Id, const Yars::Item&) const noexcept;
+		Yars::VectorString              characterItemList(const Yars::Id) const noexcept;
+		Yars::VectorString              characterItemListUsableByAttacker(const Yars::Id) const noexcept;
+		Yars::VectorString              characterItemListUsableByDefender(const Yars::Id) const noexcept;
+		bool                            characterItemRestack(const Yars::Id) noexcept;
+		bool                            characterItemRestack(const Yars::Id, const std::string&) noexcept;
+
+		std::string                     characterItemSkillAttacker(const Yars::Id, const std::string&) const noexcept;
+		Yars::VectorString              characterItemSkillAttackerList(const Yars::Id, const std::string&) const noexcept;
+		std::string                     characterItemSkillDefender(const Yars::Id, const std::string&) const noexcept;
+		Yars::VectorString              characterItemSkillDefenderList(const Yars::Id, const std::string&) const noexcept;
+
+		Yars::Item&                     characterEquipmentItem(const Yars::Id, const std::string&) noexcept;
+		const Yars::Item&               characterEquipmentItem(const Yars::Id, const std::string&) const noexcept;
+		std::string                     characterEquipmentName(const Yars::Id, const std::string&) const noexcept;
+		bool                            characterEquipmentAdd(const Yars::Id, const std::string&, const std::string&) noexcept;
+		bool                            characterEquipmentRemove(const Yars::Id, const std::string&) noexcept;
+		bool                            characterEquipmentExists(const Yars::Id, const std::string&) const noexcept;
+
+		bool                            characterLevelIncrease(const Yars::Id, const uint32_t) noexcept;
+		bool                            characterLevelIncrease(const Yars::Id, const std::string&, const uint32_t) noexcept;
+		bool                            characterLevelSet(const Yars::Id, const std::string&, const uint32_t) noexcept;
+		void                            characterLevelChanged(const Yars::Id) noexcept;
+
+		bool                            characterAffectApply(const Yars::Id, const Yars::Id) noexcept;
+		bool                            characterAffectDefend(const Yars::Id, const Yars::Id) noexcept;
+		bool                            characterAffectDefend(const Yars::Id, const Yars::Id, const std::string&) noexcept;
+		bool                            characterAffectExists(const Yars::Id, const Yars::Id) const noexcept;
+		Yars::VectorId                  characterAffectList(const Yars::Id) const noexcept;
+		void                            characterAffectRemove(const Yars::Id, const Yars::Id) noexcept;
+		void                            characterAffectRevert(const Yars::Id, const Yars::Id) noexcept;
+
+		const Yars::Ledger&             characterLedger(const Yars::Id) const noexcept;
+		bool                            characterLedgerEnable(const Yars::Id, const bool = true) noexcept;
+		bool                            characterLedgerIsEnabled(const Yars::Id) const noexcept;
+		bool                            characterLedgerRebuild(const Yars::Id) noexcept;
+		int32_t                         characterLedgerAttribute(const Yars::Id, const std::string&) const noexcept;
+		int32_t                         characterLedgerAttribute(const Yars::Id, const Yars::Handle) const noexcept;
+		Yars::VectorLedgerContribution  characterLedgerAttributeSource(const Yars::Id, const std::string&) const noexcept;
+		int32_t                         characterLedgerHealthMaximum(const Yars::Id) const noexcept;
+		Yars::VectorLedgerContribution  characterLedgerHealthMaximumSource(const Yars::Id) const noexcept;
+		int32_t                         characterLedgerSkill(const Yars::Id, const std::string&) const noexcept;
+		int32_t                         characterLedgerSkill(const Yars::Id, const Yars::Handle) const noexcept;
+		Yars::VectorLedgerContribution  characterLedgerSkillSource(const Yars::Id, const std::string&) const noexcept;
+
+		bool                            characterModifierCacheEnable(const Yars::Id, const bool = true) noexcept;
+		bool                            characterModifierCacheIsEnabled(const Yars::Id) const noexcept;
+		void                            characterModifierCacheInvalidate(const Yars::Id) noexcept;
+
+		bool                            characterLayerAdd(const Yars::Id, const std::string&) noexcept;
+		bool                            characterLayerExists(const Yars::Id, const std::string&) const noexcept;
+		Yars::VectorString              characterLayerList(const Yars::Id) const noexcept;
+		bool                            characterLayerRemove(const Yars::Id, const std::string&) noexcept;
+		void                            characterLayerSync(const Yars::Id) noexcept;
+
+	private:
+		struct CharacterLayer
+		{
+			Yars::VectorString   layer     = {};
+			Yars::MapStringInt32 attribute = {};
+			Yars::MapStringInt32 skill     = {};
+			uint64_t             version   = 0;
+		};
+
+		using MapIdCharacterLayer = Yars::FlatMap<Yars::Id, Yars::CharacterLayer>;
+
+		using DataValue = std::variant<bool, float, int32_t, std::string>;
+
+		struct CharacterData
+		{
+			Yars::DataValue value  = {};
+			Yars::Handle    handle = Yars::Handle_Invalid;
+		};
+
+		using VectorCharacterData      = std::vector<Yars::CharacterData>;
+		using MapIdVectorCharacterData = Yars::SharedMap<Yars::Id, Yars::VectorCharacterData>;
+
+		struct CharacterConfig
+		{
+			uint32_t item_stack_max = 1;
+			bool     consolidate    = true;
+		};
+
+		using MapIdCharacterConfig = Yars::FlatMap<Yars::Id, Yars::CharacterConfig>;
+
+		struct CharacterItem
+		{
+			Yars::VectorItem stack = {};
+			uint32_t         count = 0;
+		};
+
+		using MapStringCharacterItem      = Yars::FlatMap<std::string, Yars::CharacterItem>;
+		using MapIdMapStringCharacterItem = Yars::SharedMap<Yars::Id, Yars::MapStringCharacterItem>;
+
+		void                              characterAttributeAdd(const Yars::Id, const std::string&) noexcept;
+		bool                              characterAffectDefendSkill(const Yars::Id, const Yars::Id, const std::string&, const Yars::Skill*) noexcept;
+		const Yars::Skill*                characterSkillBest(const Yars::Id, const Yars::VectorString&, const std::string*&) const noexcept;
+		const Yars::SkillSet*             characterSkillSet(const Yars::Id) const noexcept;
+		void                              characterSkillSetChange(const Yars::Id, const std::string&, const bool) noexcept;
+		void                              characterLayerChanged(const Yars::Id) noexcept;
+		void                              characterLayerReset(const Yars::Id, Yars::MapStringInt32 Yars::CharacterLayer::*, const std::string&) noexcept;
+		void                              characterLayerSyncAll(const std::string&, const bool) noexcept;
+		template <typename M>
+		void                              characterLayerApply(M&, Yars::MapStringInt32&, const Yars::MapStringInt32&, Yars::VectorString&) const noexcept;
+		Yars::VectorString                characterItemListUsable(const Yars::Id, Yars::VectorString Yars::Item::*, Yars::SkillSet Yars::Item::*) const noexcept;
+		template <typename T>
+		bool                              characterDataGetValue(const Yars::VectorCharacterData&, const std::string&, T&) const noexcept;
+		template <typename T>
+		void                              characterDataSetValue(Yars::VectorCharacterData&, const std::string&, const T&) noexcept;
+		template <typename M>
+		bool                              characterDataGetMap(const Yars::Id, M&) const noexcept;
+		template <typename M>
+		bool                              characterDataSetMap(const Yars::Id, const M&) noexcept;
+		static bool                       characterDataLess(const Yars::CharacterData&, const Yars::Handle) noexcept;
+		void                              characterClear(const Yars::Id&) noexcept;
+		bool                              characterItemAdd(const Yars::Id, const std::string&, const Yars::Item&) noexcept;
+		void                              characterItemErase(const Yars::Id, const std::string&) noexcept;
+		void                              characterItemMove(const Yars::Id, const Yars::Id, const std::string&, const uint32_t) noexcept;
+		void                              characterLedgerAffectAdd(const Yars::Id, const Yars::Id) noexcept;
+		void                              characterLedgerAffectRemove(const Yars::Id, const Yars::Id) noexcept;
+		void                              characterLedgerEquipmentAdd(const Yars::Id, const std::string&, const Yars::Item&) noexcept;
+		void                              characterLedgerEquipmentRemove(const Yars::Id, const std::string&) noexcept;
+
+		Yars::Id                              character_id_max;
+		Yars::VectorId                        character_pool;
+		Yars::MapIdCharacterConfig            character_config;
+		Yars::VectorHealth                    character_health;
+		Yars::MapIdMapStringAttribute         character_attribute;
+		Yars::MapIdVectorCharacterData        character_data;
+		Yars::MapIdMapStringSkill             character_skill;
+		Yars::MapIdMapStringItem              character_equipment_item;
+		Yars::MapIdMapStringString            character_equipment_name;
+		Yars::MapIdMapStringCharacterItem     character_item;
+		Yars::MapIdVectorId                   character_affect;
+		Yars::MapIdLedger                     character_ledger;
+		Yars::MapIdSkillSet                   character_skill_set;
+		Yars::MapIdCharacterLayer             character_layer;
+		Yars::MapStringHandle                 data_handle;
+		Yars::VectorString                    data_handle_name;
+
+	// }}}
+	// {{{ Archetype
+
+	public:
+		struct Archetype
+		{
+			Yars::CharacterConfig        config          = {};
+			Yars::Health                 health          = {};
+			Yars::MapStringAttribute     attribute       = {};
+			Yars::VectorCharacterData    data            = {};
+			Yars::VectorString           data_name       = {};
+			Yars::MapStringSkill         skill           = {};
+			Yars::MapStringItem          equipment_item  = {};
+			Yars::MapStringString        equipment_name  = {};
+			Yars::MapStringCharacterItem item            = {};
+			Yars::SkillSet               skill_set       = {};
+			Yars::CharacterLayer         layer           = {};
+			Yars::Ledger                 ledger          = {};
+			bool                         ledger_enable   = false;
+			bool                         modifier_cache  = false;
+		};
+
+		bool               archetypeAdd(const std::string&, const Yars::Id) noexcept;
+		bool               archetypeExists(const std::string&) const noexcept;
+		Yars::VectorString archetypeList() const noexcept;
+		bool               archetypeRemove(const std::string&) noexcept;
+
+		bool               characterClone(const Yars::Id, Yars::Id&) noexcept;
+		bool               characterExport(const Yars::Id, Yars::Archetype&) const noexcept;
+		bool               characterImport(const Yars::Archetype&, Yars::Id&) noexcept;
+		bool               characterIsShared(const Yars::Id) const noexcept;
+		bool               characterSpawn(const std::string&, const size_t, Yars::VectorId&) noexcept;
+
+	private:
+		struct ArchetypeShared
+		{
+			Yars::Archetype                               archetype      = {};
+			std::shared_ptr<Yars::MapStringAttribute>     attribute      = {};
+			std::shared_ptr<Yars::VectorCharacterData>    data           = {};
+			std::shared_ptr<Yars::MapStringSkill>         skill          = {};
+			std::shared_ptr<Yars::MapStringItem>          equipment_item = {};
+			std::shared_ptr<Yars::MapStringCharacterItem> item           = {};
+		};
+
+		using MapStringArchetype = Yars::FlatMap<std::string, Yars::ArchetypeShared>;
+
+		Yars::Archetype characterArchetype(const Yars::Id) const noexcept;
+		template <typename A>
+		void            characterCopy(const Yars::Id, A&&, const Yars::ArchetypeShared* = nullptr) noexcept;
+		Yars::Id        characterIdNext() noexcept;
+
+		Yars::MapStringArchetype archetype_map;
+
+	// }}}
+	// {{{ Tick
+
+	public:
+		struct Tick
+		{
+			int32_t              health          = 0;
+			Yars::MapStringFloat decay_attribute = {};
+			Yars::MapStringFloat decay_skill     = {};
+		};
+
+		struct TickEvent
+		{
+			Yars::VectorId died        = {};
+			Yars::VectorId health_full = {};
+		};
+
+		void tick(const Yars::Tick&, Yars::TickEvent&) noexcept;
+		bool tick(const Yars::Tick&, const Yars::VectorId&, Yars::TickEvent&) noexcept;
+
+		bool characterFastForward(const Yars::Id, const Yars::Tick&, const uint64_t, Yars::TickEvent&) noexcept;
+
+	private:
+		static constexpr size_t Tick_Block_Size = 64;
+
+		static uint32_t tickHealth(const Yars::Health&, const uint32_t, const uint32_t) noexcept;
+		static void     tickHealthEvent(const Yars::Id, const uint32_t, const Yars::Health&, Yars::TickEvent&) noexcept;
+		void            tickDecay(const Yars::Id, const Yars::Tick&, const uint64_t = 1) noexcept;
+
+	// }}}
+	// {{{ Index
+
+	public:
+		bool           indexDataAdd(const std::string&) noexcept;
+		bool           indexDataExists(const std::string&) const noexcept;
+		bool           indexDataRemove(const std::string&) noexcept;
+		Yars::VectorId indexDataRange(const std::string&, const int32_t, const int32_t) const noexcept;
+
+		bool           indexItemAdd(const std::string&) noexcept;
+		bool           indexItemExists(const std::string&) const noexcept;
+		bool           indexItemRemove(const std::string&) noexcept;
+		Yars::VectorId indexItemRange(const std::string&, const int32_t = 1, const int32_t = std::numeric_limits<int32_t>::max()) const noexcept;
+
+		bool           indexSkillAdd(const std::string&) noexcept;
+		bool           indexSkillExists(const std::string&) const noexcept;
+		bool           indexSkillRemove(const std::string&) noexcept;
+		Yars::VectorId indexSkillRange(const std::string&, const int32_t, const int32_t = Yars::Level_Max) const noexcept;
+
+	private:
+		using IndexEntry    = std::pair<int32_t, Yars::Id>;
+		using SetIndexEntry = std::set<Yars::IndexEntry>;
+		using IndexValue    = bool (Yars::*)(const Yars::Id, const std::string&, int32_t&) const noexcept;
+
+		struct Index
+		{
+			Yars::SetIndexEntry                entry     = {};
+			Yars::FlatMap<Yars::Id, int32_t>   value     = {};
+			Yars::FlatMap<uint64_t, uint32_t>  rank      = {};
+			Yars::Histogram                    histogram = {};
+			Yars::VectorId                     dirty     = {};
+			std::vector<bool>                  is_dirty  = {};
+		};
+
+		using MapStringIndex = Yars::FlatMap<std::string, Yars::Index>;
+
+		struct IndexGroup
+		{
+			Yars::MapStringIndex index     = {};
+			Yars::IndexValue     value     = nullptr;
+			bool                 rank      = false;
+			bool                 histogram = false;
+		};
+
+		bool           indexAdd(Yars::IndexGroup&, const std::string&) noexcept;
+		void           indexBuild(const Yars::IndexGroup&, const std::string&, Yars::Index&) const noexcept;
+		static void    indexChanged(Yars::IndexGroup&, const Yars::Id) noexcept;
+		static void    indexChanged(Yars::IndexGroup&, const Yars::Id, const std::string&) noexcept;
+		static void    indexMark(Yars::Index&, const Yars::Id) noexcept;
+		void           indexCharacterChanged(const Yars::Id) noexcept;
+		static void    indexErase(const Yars::IndexGroup&, Yars::Index&, const Yars::Id, const int32_t) noexcept;
+		static void    indexInsert(const Yars::IndexGroup&, Yars::Index&, const Yars::Id, const int32_t) noexcept;
+		Yars::VectorId indexRange(Yars::IndexGroup&, const std::string&, const int32_t, const int32_t) const noexcept;
+		void           indexSync(const Yars::IndexGroup&, const std::string&, Yars::Index&) const noexcept;
+		void           indexUpdate(const Yars::IndexGroup&, const std::string&, Yars::Index&, const Yars::Id) const noexcept;
+		bool           indexValueData(const Yars::Id, const std::string&, int32_t&) const noexcept;
+		bool           indexValueItem(const Yars::Id, const std::string&, int32_t&) const noexcept;
+		bool           indexValueAttribute(const Yars::Id, const std::string&, int32_t&) const noexcept;
+		bool           indexValueSkill(const Yars::Id, const std::string&, int32_t&) const noexcept;
+
+		mutable Yars::IndexGroup index_data;
+		mutable Yars::IndexGroup index_item;
+		mutable Yars::IndexGroup index_skill;
+
+	// }}}
+	// {{{ Leaderboard
+
+	public:
+		bool           leaderboardAttributeAdd(const std::string&) noexcept;
+		bool           leaderboardAttributeExists(const std::string&) const noexcept;
+		size_t         leaderboardAttributeRank(const std::string&, const Yars::Id) const noexcept;
+		bool           leaderboardAttributeRemove(const std::string&) noexcept;
+		Yars::VectorId leaderboardAttributeTop(const std::string&, const size_t) const noexcept;
+
+		bool           leaderboardSkillAdd(const std::string&) noexcept;
+		bool           leaderboardSkillExists(const std::string&) const noexcept;
+		size_t         leaderboardSkillRank(const std::string&, const Yars::Id) const noexcept;
+		bool           leaderboardSkillRemove(const std::string&) noexcept;
+		Yars::VectorId leaderboardSkillTop(const std::string&, const size_t) const noexcept;
+
+	private:
+		static uint64_t leaderboardKey(const int32_t) noexcept;
+		size_t          leaderboardRank(Yars::IndexGroup&, const std::string&, const Yars::Id) const noexcept;
+		static void     leaderboardRankAdjust(Yars::Index&, const int32_t, const int32_t) noexcept;
+		static uint32_t leaderboardRankCount(const Yars::Index&, const uint64_t) noexcept;
+		Yars::VectorId  leaderboardTop(Yars::IndexGroup&, const std::string&, const size_t) const noexcept;
+
+		mutable Yars::IndexGroup leaderboard_attribute;
+		mutable Yars::IndexGroup leaderboard_skill;
+
+	// }}}
+	// {{{ Telemetry
+
+	public:
+		Yars::Histogram telemetryAffect() const noexcept;
+		bool            telemetryAffectDisable() noexcept;
+		bool            telemetryAffectEnable() noexcept;
+		bool            telemetryAffectIsEnabled() const noexcept;
+
+		Yars::Histogram telemetryHealth() const noexcept;
+		bool            telemetryHealthDisable() noexcept;
+		bool            telemetryHealthEnable() noexcept;
+		bool            telemetryHealthIsEnabled() const noexcept;
+
+		Yars::Histogram telemetryItem(const std::string&) const noexcept;
+		bool            telemetryItemAdd(const std::string&) noexcept;
+		bool            telemetryItemExists(const std::string&) const noexcept;
+		bool            telemetryItemRemove(const std::string&) noexcept;
+
+		Yars::Histogram telemetrySkill(const std::string&) const noexcept;
+		bool            telemetrySkillAdd(const std::string&) noexcept;
+		bool            telemetrySkillExists(const std::string&) const noexcept;
+		bool            telemetrySkillRemove(const std::string&) noexcept;
+
+	private:
+		Yars::Histogram telemetryHistogram(Yars::IndexGroup&, const std::string&) const noexcept;
+		bool            telemetryValueAffect(const Yars::Id, const std::string&, int32_t&) const noexcept;
+		bool            telemetryValueHealth(const Yars::Id, const std::string&, int32_t&) const noexcept;
+
+		mutable Yars::IndexGroup telemetry_affect;
+		mutable Yars::IndexGroup telemetry_health;
+		mutable Yars::IndexGroup telemetry_item;
+		mutable Yars::IndexGroup telemetry_skill;
+
+	// }}}
+	// {{{ Item Owner
+
+	public:
+		uint32_t       itemHolderAmount(const std::string&, const Yars::Id) const noexcept;
+		size_t         itemHolderCount(const std::string&) const noexcept;
+		Yars::VectorId itemHolderList(const std::string&) const noexcept;
+		uint64_t       itemSupply(const std::string&) const noexcept;
+
+	private:
+		struct ItemOwner
+		{
+			Yars::FlatMap<Yars::Id, uint32_t> holder = {};
+			uint64_t                          supply = 0;
+		};
+
+		using MapStringItemOwner = Yars::FlatMapName<Yars::ItemOwner>;
+
+		void itemOwnerAdjust(const Yars::Id, const std::string&, const int64_t) noexcept;
+		void itemOwnerCharacterAdd(const Yars::Id) noexcept;
+		void itemOwnerCharacterRemove(const Yars::Id) noexcept;
+
+		Yars::MapStringItemOwner item_owner;
+
+	// }}}
+	// {{{ Loot
+
+	public:
+		struct LootEntry
+		{
+			std::string item      = {};
+			std::string table     = {};
+			uint32_t    weight    = 1;
+			uint32_t    count_min = 1;
+			uint32_t    count_max = 1;
+		};
+
+		using VectorLootEntry = std::vector<Yars::LootEntry>;
+
+		bool                  lootAdd(const std::string&, const Yars::VectorLootEntry&) noexcept;
+		bool                  lootExists(const std::string&) const noexcept;
+		bool                  lootGrant(const Yars::Id, const std::string&, const uint32_t = 1) noexcept;
+		bool                  lootGrant(const Yars::Id, const std::string&, Yars::MapStringUint32&, const uint32_t = 1) noexcept;
+		Yars::VectorString    lootList() const noexcept;
+		bool                  lootRemove(const std::string&) noexcept;
+		Yars::MapStringUint32 lootRoll(const std::string&, const uint32_t = 1) const noexcept;
+
+	private:
+		struct Loot
+		{
+			Yars::VectorLootEntry entry       = {};
+			std::vector<uint64_t> probability = {};
+			std::vector<uint32_t> alias       = {};
+			uint64_t              weight      = 0;
+		};
+
+		using MapStringLoot = Yars::FlatMapName<Yars::Loot>;
+
+		static void lootAliasBuild(Yars::Loot&) noexcept;
+		void        lootRollInto(const Yars::Loot&, const uint32_t, Yars::MapStringUint32&) const noexcept;
+
+		Yars::MapStringLoot loot_map;
+
+	// }}}
+	// {{{ Affect
+
+	public:
+		struct Affect
+		{
+			uint32_t                level                 = 0;
+			Yars::Id                origin_character      = 0;
+			std::string             origin_skill          = {};
+			float                   experience            = 0.0;
+			int32_t                 modify_health_current = 0;
+			int32_t                 modify_health_maximum = 0;
+			Yars::MapStringModifier modify_skill          = {};
+			Yars::MapStringModifier modify_attribute      = {};
+			Yars::VectorString      defense_skill         = {};
+		};
+
+		using VectorAffect = std::vector<Affect>;
+
+		Yars::Affect&       affect(const Yars::Id) noexcept;
+		const Yars::Affect& affect(const Yars::Id) const noexcept;
+		Yars::Id            affectCreate() noexcept;
+		bool                affectDelete(const Yars::Id) noexcept;
+		bool                affectExists(const Yars::Id) const noexcept;
+		bool                affectInit(const Yars::Id, const Yars::Id, const Yars::Item&, const std::string&, const int32_t = 0) noexcept;
+
+	private:
+		void affectClear(const Yars::Id) noexcept;
+		bool affectInitSkill(const Yars::Id, const Yars::Id, const Yars::Item&, const std::string&, const Yars::Skill&, const int32_t) noexcept;
+
+		Yars::VectorAffect affect_vector;
+		Yars::VectorId     affect_pool;
+
+	// }}}
+	// {{{ Calculations
+
+	public:
+		enum class Result : uint8_t
+		{	Error
+		,	Failure_Automatic
+		,	Failure
+		,	Chance
+		,	Success
+		,	Success_Automatic
+		};
+
+		// Deprecated
+		//Yars::Result approxDifficultyCheck(const Yars::Id, const std::string&, const Yars::Id) const noexcept;
+		//Yars::Result approxDifficultyCheck(const Yars::Id, const std::string&, const std::string&, const Yars::Id, const std::string&) const noexcept;
+
+		float calculateDifficulty(const Yars::Skill&, const Yars::Skill&) const noexcept;
+		float calculateDifficulty(const Yars::Skill&, const uint32_t) const noexcept;
+		float calculateDifficulty(const uint32_t, const uint32_t) const noexcept;
+
+		bool  calculateIsSuccess(const Yars::Id&, const std::string&, const float) const noexcept;
+		bool  calculateIsSuccess(const Yars::Id&, const std::string&, const float, float&) const noexcept;
+
+		float calculateModifier(const Yars::Id, const std::string&) const noexcept;
+		float calculateModifier(const Yars::Id, const Yars::Name&) const noexcept;
+
+		float calculateProbability(const float) const noexcept;
+
+		static Yars::Result difficultyToResult(const float) noexcept;
+
+		static constexpr int32_t Fixed_Shift = 16;
+		static constexpr int32_t Fixed_One   = (1 << Fixed_Shift);
+
+		static int64_t fixedDifficulty(const uint32_t, const uint32_t) noexcept;
+		static int64_t fixedProbability(const int64_t) noexcept;
+		static int64_t fixedFromFloat(const float) noexcept;
+		static float   fixedToFloat(const int64_t) noexcept;
+		static int64_t tableProbability(const int64_t) noexcept;
+
+	private:
+		bool  calculateIsSuccessModifier(const float, const float, float&) const noexcept;
+		float calculateModifierSkill(const Yars::Id, const Yars::Skill&) const noexcept;
+		float calculateModifierSkill(const Yars::Id, const std::string&, const Yars::Skill&) const noexcept;
+
+	// }}}
+	// {{{ Prepared Action
+
+	public:
+		struct PreparedAction
+		{
+			Yars::Id           attacker             = 0;
+			Yars::Item         item                 = {};
+			std::string        skill_name           = {};
+			const Yars::Skill* skill                = nullptr;
+			uint64_t           character_generation = 0;
+			uint64_t           skill_generation     = 0;
+		};
+
+		using MapIdGeneration = Yars::FlatMap<Yars::Id, uint64_t>;
+
+		bool actionExecute(Yars::PreparedAction&, const Yars::Id, Yars::Id&, const int32_t = 0) noexcept;
+		bool actionIsValid(const Yars::PreparedAction&) const noexcept;
+		bool actionPrepare(Yars::PreparedAction&, const Yars::Id, const std::string&, const std::string& = {}) noexcept;
+
+	private:
+		void actionCharacterChanged(const Yars::Id) noexcept;
+
+		Yars::MapIdGeneration action_character_generation;
+		uint64_t              action_generation;
+		uint64_t              action_skill_generation;
+
+	// }}}
+	// {{{ To String
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+
+	public:
+		static std::string to_string(const Yars::MapStringFloat&) noexcept;
+		static std::string to_string(const Yars::MapStringInt32&) noexcept;
+		static std::string to_string(const Yars::MapStringString&) noexcept;
+		static std::string to_string(const Yars::VectorId&) noexcept;
+		static std::string to_string(const Yars::VectorString&) noexcept;
+		static std::string to_string(const Yars::Result) noexcept;
+		static std::string to_string(const Yars::Health&) noexcept;
+		static std::string to_string(const Yars::Level&) noexcept;
+		static std::string to_string(const Yars::Attribute&) noexcept;
+		static std::string to_string(const Yars::MapStringAttribute&) noexcept;
+		static std::string to_string(const Yars::Skill&) noexcept;
+		static std::string to_string(const Yars::MapStringSkill&) noexcept;
+		static std::string to_string(const Yars::Item&) noexcept;
+		static std::string to_string(const Yars::MapStringItem&) noexcept;
+		static std::string to_string(const Yars::Affect&) noexcept;
+
+#endif
+	// }}}
+	// {{{ Private Data
+
+	private:
+		bool safeMode() const noexcept;
+
+		std::mt19937&  mt_engine;
+		Yars::Config   yars_config;
+
+	// }}}
+};
+
+consteval Yars::Name operator""_yars(const char* name, const size_t length) noexcept
+{
+	return Yars::Name(std::string_view(name, length));
+}
+};
+
+// {{{ Operator
+
+bool operator==(const zakero::Yars::Item&, const zakero::Yars::Item&);
+bool operator!=(const zakero::Yars::Item&, const zakero::Yars::Item&);
+
+// }}}
+
+#if defined (ZAKERO_YARS_IMPLEMENTATION)
+
+namespace zakero
+{
+
+// {{{ Defines
+
+#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE) && defined (ZAKERO_YARS_DISABLE_SAFE_MODE)
+#error "ZAKERO_YARS_ENABLE_SAFE_MODE and ZAKERO_YARS_DISABLE_SAFE_MODE can not both be defined"
+#endif
+
+/**
+ * \page page_Define Define Customization
+ *
+ * It is possible to add compile time customizations to \yars by adding the 
+ * following `#define`'s before including the \yars header.
+ *
+ * The `ZAKERO_YARS_ENABLE_ID_SHUFFLE`, `ZAKERO_YARS_ENABLE_CLEAR_ON_DELETE`, 
+ * and `ZAKERO_YARS_ENABLE_SAFE_MODE` macros only set the default values of 
+ * Yars::Config.  Every %Yars instance can be created with a different 
+ * configuration, so these features can be enabled for one instance and 
+ * disabled for another in the same program.
+ *
+ *
+ *
+ * \par ZAKERO_YARS_ENABLE_DEBUG
+ *
+ * Enabled debugging messages to be written to `stderr`.  These messages are 
+ * written by using `ZAKERO_YARS_DEBUG` macro which is also enabled by the 
+ * `ZAKERO_YARS_ENABLE_DEBUG` macro.  This macro mostly only useful if 
+ * `ZAKERO_YARS_ENABLE_SAFE_MODE` is also enabled.
+ *
+ * \code
+ * #define ZAKERO_YARS_ENABLE_DEBUG
+ * \endcode
+ *
+ *
+ *
+ * \par ZAKERO_YARS_ENABLE_ID_SHUFFLE
+ *
+ * When possible, YARS will reuse previously used memory.  The order in which 
+ * the memory is reused is predicable.  If this is potentially a problem, 
+ * enabling this macro will randomize the reuse order.
+ *
+ * For (some value of) high amounts of unused memory, this feature can 
+ * introduce noticeable overhead.  Experiment to find out if the performance 
+ * hit is acceptable in your project.
+ *
+ * For maximum "data paranoia", enabled both `ZAKERO_YARS_ENABLE_ID_SHUFFLE` 
+ * and `ZAKERO_YARS_ENABLE_CLEAR_ON_DELETE`.
+ *
+ * Sets the default value of Yars::Config::id_shuffle.
+ *
+ * \code
+ * #define ZAKERO_YARS_ENABLE_ID_SHUFFLE
+ * \endcode
+ *
+ *
+ *
+ * \par ZAKERO_YARS_ENABLE_CLEAR_ON_DELETE
+ *
+ * Some data objects can be "deleted".  These objects are really placed in an 
+ * "unused" pool to be reused later.  This means that they objects could still 
+ * be used, much like using free'ed memory.
+ * 
+ * Defining this macro will cause the objects to be initialized to a clean 
+ * state before going into the "unused" pool.  While this can be useful for 
+ * debugging it will result in some over-head.
+ *
+ * \note The data will always be cleared when it is pulled out of the "unused" 
+ * pool.
+ *
+ * For maximum "data paranoia", enabled both `ZAKERO_YARS_ENABLE_ID_SHUFFLE` 
+ * and `ZAKERO_YARS_ENABLE_CLEAR_ON_DELETE`.
+ *
+ * Sets the default value of Yars::Config::clear_on_delete.
+ *
+ * \code
+ * #define ZAKERO_YARS_ENABLE_CLEAR_ON_DELETE
+ * \endcode
+ *
+ *
+ *
+ * \par ZAKERO_YARS_ENABLE_SAFE_MODE
+ *
+ * Before a method executes, it should validate the argument values that it 
+ * receives.  This is useful while developing code but adds overhead.  If the 
+ * calling code can guarantee that all argument data is valid, this macro can 
+ * be enabled to reduce the validation checks and overhead.
+ *
+ * Sets the default value of Yars::Config::safe_mode.
+ *
+ * \code
+ * #define ZAKERO_YARS_ENABLE_SAFE_MODE
+ * \endcode
+ *
+ *
+ *
+ * \par ZAKERO_YARS_DISABLE_SAFE_MODE
+ *
+ * Checking Yars::Config::safe_mode costs a branch in every method that 
+ * validates its arguments, which is measurable in small look-ups such as 
+ * characterItemCount().  If no %Yars instance in the program needs safe mode, 
+ * defining this macro removes the validation code at compile time and 
+ * Yars::Config::safe_mode is always `false`.
+ *
+ * This macro can not be used with `ZAKERO_YARS_ENABLE_SAFE_MODE`.
+ *
+ * \code
+ * #define ZAKERO_YARS_DISABLE_SAFE_MODE
+ * \endcode
+ *
+ *
+ *
+ * \par ZAKERO_YARS_ENABLE_TO_STRING
+ *
+ * Some data structures have a corresponding [Yars::to_string()](\ref 
+ * group_ToString) method to help make debugging easier.  The output of these 
+ * methods is a JSON formatted object or array.  This was done to be agnostic 
+ * to all the available JSON libraries.  Enabling the 
+ * `ZAKERO_YARS_ENABLE_TO_STRING` will make those methods available.
+ *
+ * \code
+ * #define ZAKERO_YARS_ENABLE_TO_STRING
+ * \endcode
+ */
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \defgroup group_ToString ZAKERO_YARS_ENABLE_TO_STRING
+ *
+ * \brief Functionality that is only available when \yars is compiled with the 
+ * [ZAKERO_YARS_ENABLE_TO_STRING](\ref page_Define) macro.
+ *
+ * Most of \yars objects and custom data types have conversion to JSON 
+ * formatted string support.  These methods will create a std::string object 
+ * with all the data and return it.  Creating the std::string can be an 
+ * expensive operation and considering the generated strings are mostly only 
+ * useful for debugging, the %to_string() methods are disabled by default.
+ */
+#endif
+
+#if defined (ZAKERO_YARS_DEBUG)
+/**
+ * \defgroup group_Debugging ZAKERO_YARS_DEBUG
+ *
+ * \brief Functionality that is only available when \yars is compiled with the 
+ * [ZAKERO_YARS_ENABLE_DEBUG](\ref page_Define) macro.
+ *
+ * These macros are available to help make debugging easier.
+ */
+
+/**
+ * \ingroup group_Debugging
+ *
+ * \def ZAKERO_YARS__DEBUG_DISABLED
+ *
+ * \brief Internal Use Only
+ *
+ * The inverse of ZAKERO_YARS_DEBUG_ENABLED and is used to enable or disable 
+ * the debugging messages.
+ */
+
+/**
+ * \ingroup group_Debugging
+ *
+ * \def ZAKERO_YARS_DEBUG
+ *
+ * \brief Write debugging message.
+ *
+ * If the `ZAKERO_YARS_ENABLE_DEBUG` macro is enabled, this macro will write to 
+ * the `std::cerr` stream.  Nothing will happen when the macro is disabled.
+ *
+ * \example
+ * ZAKERO_YARS_DEBUG << "Insert debugging message here.\n";
+ * \endexample
+ */
+
+/**
+ * \ingroup group_Debugging
+ *
+ * \def ZAKERO_YARS_DEBUG_VAR(var_)
+ *
+ * \brief Write debugging message.
+ *
+ * Does the samething as `ZAKERO_YARS_DEBUG` but is specialized to work with 
+ * std::ostream compatible objects.
+ *
+ * \example
+ * uint64_t foo = 42;
+ * ZAKERO_YARS_DEBUG_VAR(foo);
+ * \endexample
+ *
+ * \param var_ The variable to write.
+ */
+#endif
+
+// }}}
+// {{{ Anonymous Namespace
+
+namespace
+{
+	std::mt19937 zakero_yars_mt19937(
+		std::chrono::system_clock::now().time_since_epoch().count()
+		);
+
+	std::uniform_real_distribution<float> zakero_yars_distribution_(-1.0f, 1.0f);
+
+	constexpr int64_t zakero_yars_fixed_probability_(const int64_t ratio
+		) noexcept
+	{
+		constexpr int64_t Fixed_One = zakero::Yars::Fixed_One;
+		constexpr int64_t Limit     = 32 * Fixed_One;
+		constexpr int64_t Half      = Fixed_One / 2;
+
+		const int64_t r1 = std::min((ratio < 0) ? -ratio : ratio, Limit);
+		const int64_t r2 = ((r1 * r1) + Half) >> zakero::Yars::Fixed_Shift;
+		const int64_t r3 = ((r2 * r1) + Half) >> zakero::Yars::Fixed_Shift;
+		const int64_t r5 = ((r3 * r2) + Half) >> zakero::Yars::Fixed_Shift;
+
+		const int64_t probability = (r1 + r3 + r5 + 1) / 3;
+
+		if(ratio < 0)
+		{
+			return -probability;
+		}
+
+		return probability;
+	}
+
+	constexpr int32_t zakero_yars_table_shift_ = 9;
+	constexpr int32_t zakero_yars_table_size_  = (zakero::Yars::Fixed_One >> zakero_yars_table_shift_) + 1;
+
+	constexpr std::array<int32_t, zakero_yars_table_size_> zakero_yars_probability_table_ = []()
+	{
+		std::array<int32_t, zakero_yars_table_size_> table = {};
+
+		for(int32_t index = 0; index < zakero_yars_table_size_; index++)
+		{
+			const int64_t ratio = ((int64_t)index << zakero_yars_table_shift_);
+
+			table[index] = (int32_t)zakero_yars_fixed_probability_(ratio);
+		}
+
+		return table;
+	}();
+};
+
+// }}}
+
+/**
+ * \todo{Doxygen} Add Doxygen support
+ * \todo{STLAllocator} Expose the containers so that custom STL Allocators can 
+ * be used.
+ * \todo{Events} Add Event: Health.Current.Changed
+ * \todo{Events} Add Event: Health.Maximum.Changed
+ * \todo{Events} Add Event: Attribute.Added
+ * \todo{Events} Add Event: Attribute.Decreased
+ * \todo{Events} Add Event: Attribute.Increased
+ * \todo{Events} Add Event: Skill.Added
+ * \todo{Events} Add Event: Skill.Decreased
+ * \todo{Events} Add Event: Skill.Increased
+ * \todo{Events} Add Event: Item.Added
+ * \todo{Events} Add Event: Item.Removed
+ * \todo{Events} Add Event: Level.Up
+ * \todo{Events} Add Event: Died
+ * \todo{Config} Config.ItemAutoStack[bool] See: characterItemAdd()
+ * - Per Character config?
+ * .
+ * \todo{Config} Config.EventThread
+ * - [time in milliseconds to flush the event queue]
+ * - Compile Time?
+ * .
+ * \todo{Config} Config.CharacterCountMax
+ * - Compile Time?
+ * .
+ * \todo{Config} Config.ItemStackCountMax
+ * - Compile Time?
+ * - Per Character config?
+ * .
+ * \todo{Config} Config.InventoryItemCountMax
+ * - Per Character config
+ * .
+ * \todo Thread-Safety
+ * \todo Damage Over Time
+ * \todo Add "Affect Data" support like "Character Data"
+ * - "Affect Data" is based on the Affect Id, not per-instance
+ * .
+ * \todo Data Storage?
+ * \todo What if damage was scaled to success?
+ * - Automatic success : %100 damage
+ * - Automatic failure : %0 damage
+ * - Chance: 1 - ((rand - mod) / 2)
+ * - --- Maybe a bad idea ---
+ * - This would remove the need for (chance to hit).  A chance to hit 
+ * for %10 of max damage is not fun.  If an enemy has a 100% chance to 
+ * hit, regardless of damage, then that may not be fun.
+ * - This effectively reduces the average damage by 50%.
+ *
+ * \class Yars
+ *
+ * \brief Y.A.R.S.
+ *
+ * The %Yars class embodies the core RPG Rule System.  The \yars contains all 
+ * the basic objects needed in RPG's such as characters and items, plus how all 
+ * parts can interact with each other.  Wars of magic, swords, and words can be 
+ * done by using Affects that impose changes on the characters.
+ *
+ * Almost everything revolves around the Character.  Characters are made up of 
+ * Skills and Skills are made up of Attributes.  Attributes, Characters, and 
+ * Skills all have Levels.  Characters also have Health.  Items are used to 
+ * create Affects and those Affects can be applied to Characters.
+ *
+ * While it is encouraged to change the values of data objects using the 
+ * methods, all values are public to make it easier to modify if needed.
+ *
+ * \par Debugging
+ *
+ * If you would like the ability to send debugging output to Standard Error, 
+ * enable the [ZAKERO_YARS_ENABLE_DEBUG](\ref page_Define) macro when building 
+ * \yars.  This will in turn enable the debugging macros \ref ZAKERO_YARS_DEBUG 
+ * and \ref ZAKERO_YARS_DEBUG_VAR.
+ *
+ * \par Data Lifespan
+ *
+ * \yars stores data in maps and vectors.  When new data is added to maps and 
+ * vectors, it can cause those containers to another area in memory.  This is 
+ * important to realize because all the Yars methods return a reference to a 
+ * data item.  __This means that holding on to a reference and adding data of 
+ * the same type can invalidate that reference.__
+ *
+ * The intent of using references was to allow the caller to have direct access 
+ * to the internal data structures so that they can read (and write if 
+ * necessary) directly without going through any indirection.  This also allows 
+ * the C++ STL to manage the memory resource reducing the possibility of memory 
+ * leaks to almost 0.
+ *
+ * \par Thread Safety
+ *
+ * \yars does not use any locks, so a Yars object must not be changed while 
+ * another thread is using it.  Reading a Character through a `const Yars&` 
+ * never changes the Character, but a few const methods do update internal 
+ * caches:
+ * - Yars::calculateModifier() when the Character has the Modifier Cache 
+ *   enabled
+ * - The Index, Leaderboard, and Telemetry queries
+ * .
+ * Those methods must not be called at the same time from more than one 
+ * thread.  All the other const methods can be.
+ */
+
+// {{{ Utility
+
+/**
+ * \defgroup group_Utility Utility
+ *
+ * \brief Utility functions.
+ *
+ * A collection of utility methods within the Yars class that improve the 
+ * Quality-Of-Life.
+ */
+
+/**
+ * \ingroup group_Utility
+ *
+ * \fn static std::vector<typename Map::key_type> Yars::mapKeyList(const Map& map) noexcept
+ *
+ * \brief Get all the keys in a map.
+ *
+ * This function template will collect all the keys of the provided \p map and 
+ * return them in a vector.
+ *
+ * \return A std::vector of keys.
+ *
+ * \tparam Map The container type
+ *
+ * \param  map The map container
+ */
+
+/**
+ * \ingroup group_Utility
+ *
+ * \fn static bool Yars::multimapContains(const Map& map, const typename Map::key_type key, const typename Map::mapped_type value) noexcept
+ *
+ * \brief Check the contents of a MultiMap.
+ * 
+ * Checking the contents of a multimap for a key/value pair requires a lot of 
+ * boiler-plate code.  This function template provides the needed generic 
+ * boiler-plate.
+ *
+ * \retval true  The key/value pair was found.
+ * \retval false The key/value pair was __not__ found.
+ *
+ * \tparam Map The multimap
+ *
+ * \param map   The multimap to check
+ * \param key   The key in the multimap
+ * \param value The value in the multimap
+ */
+
+/**
+ * \ingroup group_Utility
+ *
+ * \fn static void Yars::multimapErase(Map& map, const typename Map::key_type key, const typename Map::mapped_type value) noexcept
+ *
+ * \brief Remove a value from MultiMap.
+ *
+ * Removing a specific key/value pair from a MulitMap is an easy thing to do 
+ * but it does require excessive amounts of code.  This function template 
+ * provides the needed generic boiler-plate code.
+ *
+ * \tparam Map The multimap
+ *
+ * \param map   The multimap to check
+ * \param key   The key in the multimap
+ * \param value The value in the multimap
+ */
+
+/**
+ * \ingroup group_Utility
+ *
+ * \fn static bool Yars::vectorContains(const std::vector<Type>& vector, const Type& value) noexcept
+ *
+ * \brief Check if a vector contains a value
+ *
+ * Searching a vector just to find out if a value is present can be done by 
+ * using `std::find()`.  However, littering your code with calls to `std::find() 
+ * == std::end()` is excessively ugly.  Using this template function to simplify 
+ * your code.
+ *
+ * \tparam Type The content type of the vector
+ *
+ * \retval true  The value was found
+ * \retval false The value was not found
+ *
+ * \param vector The vector to search
+ * \param value  The value to look for
+ */
+
+/**
+ * \ingroup group_Utility
+ *
+ * \fn static bool Yars::vectorContains(InputIter first, InputIter last, const Type& value) noexcept
+ *
+ * \brief Check if a vector contains a value
+ *
+ * Searching a vector just to find out if a value is present can be done by 
+ * using `std::find()`.  However, littering your code with calls to `std::find() 
+ * == std::end()` is excessively ugly.  Using this template function to simplify 
+ * your code.
+ *
+ * \tparam InputIter The vector iterator type
+ * \tparam Type      The content type of the vector
+ *
+ * \retval true  The value was found
+ * \retval false The value was not found
+ *
+ * \param first The starting location for the search
+ * \param last  The ending location for the search
+ * \param value  The value to look for
+ */
+
+// }}}
+// {{{ FlatMap
+
+/**
+ * \class Yars::FlatMap
+ *
+ * \brief An open-addressing hash map.
+ *
+ * The look-up tables in %Yars are small, read often, and written rarely.  A 
+ * node based map, like `std::unordered_map`, allocates every entry on its own 
+ * and each look-up has to chase at least two pointers.  The FlatMap stores 
+ * all the entries in a single array with a parallel array of one-byte control 
+ * values.
+ *
+ * Each control byte is either _Empty_, _Deleted_, or the top 7 bits of the 
+ * hash of the key in that slot.  A look-up loads 8 control bytes at a time 
+ * and compares them all at once, so the key itself is only compared when the 
+ * 7-bit hash already matches.  The table grows when it is 7/8 full.
+ *
+ * The interface is a subset of `std::unordered_map` and can be used as a 
+ * replacement for it, with one important difference: __Adding an entry may 
+ * move all the other entries__.  Like `std::vector`, all iterators, pointers, 
+ * and references are invalidated when an entry is added.  Removing an entry 
+ * does not move the other entries.
+ *
+ * \tparam Key      The key type
+ * \tparam Value    The mapped type
+ * \tparam Hash     The hash function for the \p Key
+ * \tparam KeyEqual The comparison function for the \p Key
+ */
+
+// }}}
+// {{{ SmallMap
+
+/**
+ * \class Yars::SmallMap
+ *
+ * \brief A map that stores a few entries without allocating.
+ *
+ * Most characters only have a handful of skills, attributes, and data values. 
+ * Giving each of them a hash table costs more memory and time than the 
+ * entries themselves.  The SmallMap keeps up to \p Inline_Size entries in an 
+ * array, sorted by key, inside the SmallMap object.  Once more entries are 
+ * added, all the entries are moved into a FlatMap and the SmallMap behaves 
+ * like a FlatMap until it is cleared.
+ *
+ * While the entries are inline, iterating the SmallMap visits them in key 
+ * order.
+ *
+ * Like the FlatMap, adding an entry invalidates all iterators, pointers, and 
+ * references.  Unlike the FlatMap, removing an inline entry will also move 
+ * the entries after it.
+ *
+ * \tparam Key         The key type
+ * \tparam Value       The mapped type
+ * \tparam Inline_Size The maximum number of entries stored inline
+ * \tparam Hash        The hash function for the \p Key
+ * \tparam KeyEqual    The comparison function for the \p Key
+ * \tparam Compare     The ordering of the \p Key
+ */
+
+// }}}
+// {{{ FrozenMap
+
+/**
+ * \class Yars::FrozenMap
+ *
+ * \brief An immutable map with a perfect hash.
+ *
+ * The FrozenMap is built once from another map by build(), which moves all 
+ * the entries into a single array.  Each key is assigned its own slot in a 
+ * table by a "hash and displace" perfect hash: The keys are split into small 
+ * buckets and each bucket has a seed that was chosen so that all of its keys 
+ * land in table slots that no other key is using.  The table slot holds the 
+ * index of the entry in the array.
+ *
+ * The table has about 25% more slots than there are keys, so that the last 
+ * buckets to be placed can still find free slots.  If a bucket can not be 
+ * placed, build() tries again with a larger table.  build() only fails when 
+ * two different keys have the same hash.
+ *
+ * A look-up hashes the key, reads the seed of the bucket, and compares the 
+ * key in the one entry it can be.  There are no collision chains and a 
+ * missing key costs the same as a found one.
+ *
+ * The index of an entry does not change until the FrozenMap is rebuilt or 
+ * cleared.  Entries can not be added or removed, but their values can be 
+ * changed.
+ *
+ * \tparam Key      The key type
+ * \tparam Value    The mapped type
+ * \tparam Hash     The hash function for the \p Key
+ * \tparam KeyEqual The comparison function for the \p Key
+ */
+
+// }}}
+// {{{ SharedMap
+
+/**
+ * \class Yars::SharedMap
+ *
+ * \brief A map whose values can be shared, copy-on-write.
+ *
+ * Each value is kept in its own allocation and several keys, or several 
+ * SharedMaps, can point to the same value with share().  A shared value is 
+ * never changed: every non-const access, at(), find(), and `operator[]`, 
+ * first gives the key its own copy of the value if anyone else is still 
+ * using it.  Const access never copies.
+ *
+ * Because the copy is made when the reference is handed out, not when it is 
+ * written to, a value that is only read from a non-const SharedMap is copied 
+ * as well.  Read from a const SharedMap to keep the value shared.
+ *
+ * Iterators return an entry with a \c first and \c second, like a 
+ * `std::pair`, but by value.  Use `auto iter` or `const auto&` instead of 
+ * `auto&` to hold one.
+ *
+ * \tparam Key   The key type
+ * \tparam Value The mapped type
+ */
+
+// }}}
+// {{{ Name
+
+/**
+ * \class Yars::Name
+ *
+ * \brief A name that was hashed at compile-time.
+ *
+ * Looking up an Attribute, Skill, or Item by a `std::string` has to create 
+ * the string and hash it every time.  When the name is known at 
+ * compile-time, a Name can be used instead.  A Name keeps a view of the 
+ * string and its hash, both of which are made by the compiler.
+ *
+ * All the maps that use a string as the key use the Yars::NameHash, so the 
+ * hash of a Name and the hash of a `std::string` with the same characters 
+ * are the same.
+ *
+ * A Name can only be created at compile-time:
+ * \code
+ * using namespace zakero;
+ *
+ * constexpr Yars::Name Swords = "Swords"_yars;
+ *
+ * yars.characterSkill(bubba, Swords);
+ * yars.characterAttribute(bubba, "Strength"_yars);
+ * \endcode
+ *
+ * To catch typos, the valid names can be listed in a Yars::NameSchema.  
+ * Using a name that is not in the schema will fail to compile.
+ * \code
+ * constexpr Yars::NameSchema<2> Skill = {{ "Swords", "Bows" }};
+ *
+ * yars.characterSkill(bubba, Skill("Swords"));
+ * yars.characterSkill(bubba, Skill("Sword")); // Compile error
+ * \endcode
+ */
+
+/**
+ * \fn Yars::nameHash(const std::string_view)
+ *
+ * \brief The hash used for all names.
+ *
+ * \return The hash of the \p name
+ */
+
+/**
+ * \struct Yars::NameHash
+ *
+ * \brief Hash a `std::string`, `std::string_view`, or Name.
+ *
+ * The hash of a Name is not calculated again.
+ */
+
+/**
+ * \struct Yars::NameEqual
+ *
+ * \brief Compare a `std::string`, `std::string_view`, or Name.
+ */
+
+/**
+ * \struct Yars::NameSchema
+ *
+ * \brief A list of all the valid names.
+ *
+ * \tparam Count The number of names
+ */
+
+/**
+ * \typedef Yars::SmallMapName
+ *
+ * \brief A SmallMap that can be searched with a Name.
+ */
+
+/**
+ * \typedef Yars::FlatMapName
+ *
+ * \brief A FlatMap that can be searched with a Name.
+ */
+
+/**
+ * \typedef Yars::FrozenMapName
+ *
+ * \brief A FrozenMap that can be searched with a Name.
+ */
+
+// }}}
+// {{{ Config
+
+/**
+ * \struct Yars::Config
+ *
+ * \brief Per-instance configuration.
+ *
+ * Each %Yars instance has its own configuration, which means that a fully 
+ * checked %Yars (for example, one that is used by a player-facing world) can 
+ * be used in the same program as an unchecked one that is used for fast 
+ * off-line simulations.
+ *
+ * The configuration can only be set when the %Yars instance is created.  The 
+ * default configuration comes from the \ref page_Define "Define 
+ * Customization" macros, see Yars::configDefault().
+ *
+ * \example
+ * Yars::Config config = Yars::configDefault();
+ * config.safe_mode = false;
+ *
+ * Yars checked;
+ * Yars unchecked(config);
+ * \endexample
+ */
+
+/**
+ * \var Yars::Config::safe_mode
+ *
+ * \brief Validate arguments before using them.
+ *
+ * See `ZAKERO_YARS_ENABLE_SAFE_MODE` and `ZAKERO_YARS_DISABLE_SAFE_MODE` in 
+ * \ref page_Define.
+ */
+
+/**
+ * \var Yars::Config::id_shuffle
+ *
+ * \brief Randomize the order that Ids are reused.
+ *
+ * See `ZAKERO_YARS_ENABLE_ID_SHUFFLE` in \ref page_Define.
+ */
+
+/**
+ * \var Yars::Config::clear_on_delete
+ *
+ * \brief Clear data when it is deleted.
+ *
+ * See `ZAKERO_YARS_ENABLE_CLEAR_ON_DELETE` in \ref page_Define.
+ */
+
+/**
+ * \var Yars::Config::math
+ *
+ * \brief How difficulty and probability are calculated.
+ *
+ * See Yars::Math.
+ */
+
+/**
+ * \enum Yars::Math
+ *
+ * \brief The math used by Yars::calculateDifficulty() and 
+ * Yars::calculateProbability().
+ *
+ * The `Float` math is the reference implementation.  Depending on the 
+ * compiler and its flags (for example, if multiply-add operations are 
+ * contracted into FMA instructions) the results may differ in the last bits, 
+ * which is a problem when several programs must agree on the outcome of 
+ * every check.
+ *
+ * The `Table` and `Fixed` math only use integer operations on fixed-point 
+ * values with #Yars::Fixed_Shift fractional bits, so every build will produce 
+ * bit-identical results.
+ */
+
+/**
+ * \var Yars::Math::Float
+ *
+ * \brief Use `float` math.
+ */
+
+/**
+ * \var Yars::Math::Table
+ *
+ * \brief Interpolate the probability from a table.
+ *
+ * Ratios in the range [-1, 1] are interpolated from a table of 129 entries.  The error compared to the `Float` math is less 
+ * than `0.0001`.  Ratios outside of that range use the `Fixed` math.
+ *
+ * The difficulty is calculated with the `Fixed` math.
+ */
+
+/**
+ * \var Yars::Math::Fixed
+ *
+ * \brief Use fixed-point integer math.
+ *
+ * The error compared to the `Float` math is less than `0.0001` in the range 
+ * [-1, 1].  The ratio is limited to the range [-32, 32], which is far beyond 
+ * the range where the result of a check could change.
+ */
+
+/**
+ * \brief The default configuration.
+ *
+ * The values of the default configuration are controlled by the \ref 
+ * page_Define "Define Customization" macros that were used when the \yars 
+ * implementation was compiled.
+ *
+ * \return The default configuration.
+ */
+Yars::Config Yars::configDefault() noexcept
+{
+	Yars::Config config;
+
+#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
+	config.safe_mode = true;
+#endif
+
+#if defined (ZAKERO_YARS_ENABLE_ID_SHUFFLE)
+	config.id_shuffle = true;
+#endif
+
+#if defined (ZAKERO_YARS_ENABLE_CLEAR_ON_DELETE)
+	config.clear_on_delete = true;
+#endif
+
+	return config;
+}
+
+
+/**
+ * \brief The configuration of this instance.
+ *
+ * \example
+ * Yars yars;
+ * if(yars.config().safe_mode)
+ * {
+ * 	std::cout << "Safe Mode is enabled\n";
+ * }
+ * \endexample
+ *
+ * \return The configuration.
+ */
+const Yars::Config& Yars::config() const noexcept
+{
+	return yars_config;
+}
+
+
+/**
+ * \brief Check if the arguments should be validated.
+ *
+ * When `ZAKERO_YARS_DISABLE_SAFE_MODE` is defined this is always `false`, so 
+ * the compiler removes the validation code instead of branching over it.
+ *
+ * \retval true  Validate the arguments.
+ * \retval false Trust the arguments.
+ */
+inline bool Yars::safeMode() const noexcept
+{
+#if defined (ZAKERO_YARS_DISABLE_SAFE_MODE)
+	return false;
+#else
+	return yars_config.safe_mode;
+#endif
+}
+
+// }}}
+// {{{ Ctor / Dtor
+
+/**
+ * \brief Default Constructor
+ *
+ * Create a new instance using the default random number generator and the 
+ * default configuration.
+ */
+Yars::Yars()
+	: Yars(zakero_yars_mt19937, Yars::configDefault())
+{
+}
+
+
+/**
+ * \brief Constructor
+ *
+ * Create a new instance using the provided random number generator and the 
+ * default configuration.  For the life-time of the new %Yars instance, it 
+ * will keep a reference to the \p mt19937 object.
+ */
+Yars::Yars(std::mt19937& mt19937 ///< The random number generator
+	)
+	: Yars(mt19937, Yars::configDefault())
+{
+}
+
+
+/**
+ * \brief Constructor
+ *
+ * Create a new instance using the default random number generator and the 
+ * provided configuration.
+ */
+Yars::Yars(const Yars::Config& config ///< The configuration
+	)
+	: Yars(zakero_yars_mt19937, config)
+{
+}
+
+
+/**
+ * \brief Constructor
+ *
+ * Create a new instance using the provided random number generator and 
+ * configuration.  For the life-time of the new %Yars instance, it will keep a 
+ * reference to the \p mt19937 object.
+ *
+ * \todo Find a way to support other random number generators. Maybe via 
+ * template parameters.
+ */
+Yars::Yars(std::mt19937& mt19937 ///< The random number generator
+	, const Yars::Config& config ///< The configuration
+	)
+	: attribute_map()
+	, attribute_handle()
+	, attribute_handle_name()
+	, skill_map()
+	, skill_handle()
+	, skill_handle_name()
+	, item_map()
+	, catalog_attribute()
+	, catalog_skill()
+	, catalog_item()
+	, catalog_is_frozen(false)
+	, modifier_cache()
+	, modifier_cache_stats()
+	, modifier_cache_generation(0)
+	, modifier_cache_floor(0)
+	, layer_map()
+	, layer_version(0)
+	, character_id_max(0)
+	, character_pool()
+	, character_config()
+	, character_health()
+	, character_attribute()
+	, character_data()
+	, character_skill()
+	, character_equipment_item()
+	, character_equipment_name()
+	, character_item()
+	, character_affect()
+	, character_ledger()
+	, character_skill_set()
+	, character_layer()
+	, data_handle()
+	, data_handle_name()
+	, archetype_map()
+	, index_data({ .value = &Yars::indexValueData })
+	, index_item({ .value = &Yars::indexValueItem })
+	, index_skill({ .value = &Yars::indexValueSkill })
+	, leaderboard_attribute({ .value = &Yars::indexValueAttribute, .rank = true })
+	, leaderboard_skill({ .value = &Yars::indexValueSkill, .rank = true })
+	, telemetry_affect({ .value = &Yars::telemetryValueAffect, .histogram = true })
+	, telemetry_health({ .value = &Yars::telemetryValueHealth, .histogram = true })
+	, telemetry_item({ .value = &Yars::indexValueItem, .histogram = true })
+	, telemetry_skill({ .value = &Yars::indexValueSkill, .histogram = true })
+	, item_owner()
+	, loot_map()
+	, affect_vector()
+	, affect_pool()
+	, action_character_generation()
+	, action_generation(0)
+	, action_skill_generation(0)
+	, mt_engine(mt19937)
+	, yars_config(config)
+{
+#if defined (ZAKERO_YARS_DISABLE_SAFE_MODE)
+	yars_config.safe_mode = false;
+#endif
+}
+
+// }}}
+// {{{ Data Types
+
+/**
+ * \typedef Yars::Id
+ *
+ * \brief Used for unique IDs
+ */
+
+/**
+ * \typedef Yars::MapStringBool
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::MapStringFloat
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::MapStringInt32
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::MapStringModifier
+ *
+ * \brief The modifiers of an Item or Affect.
+ *
+ * Items are copied in to every inventory stack, Equipment slot, Prepared 
+ * Action, and Archetype, so their maps are kept out of line instead of 
+ * using the inline storage of Yars::MapStringInt32.
+ */
+
+/**
+ * \typedef Yars::MapStringString
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::MapIdMapStringBool
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::MapIdMapStringFloat
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::MapIdMapStringInt32
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::MapIdMapStringString
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::MultimapIdId
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::VectorId
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::VectorString
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::MapIdVectorId
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::Handle
+ *
+ * \brief An interned name.
+ *
+ * Names that are used often, like Attribute and Skill names, can be converted 
+ * into a Handle.  A Handle is a small integer that can be used as an index 
+ * into an array, which is much faster than using the name as a key in a map.
+ *
+ * Handles are never reused or removed, so once a name has a Handle it will 
+ * always be the same Handle for the life-time of the %Yars object.
+ */
+
+/**
+ * \var Yars::Handle_Invalid
+ *
+ * \brief The value of a Handle that does not refer to any name.
+ */
+
+/**
+ * \typedef Yars::MapStringHandle
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::VectorInt32
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::VectorFloat
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \brief Get or create a Handle
+ *
+ * If the \p name already has a Handle in the \p handle_map, that Handle will 
+ * be returned.  Otherwise a new Handle will be created and the \p name will 
+ * be added to the \p name_vector so that the Handle can be converted back to 
+ * the name.
+ *
+ * \return The Handle of the \p name.
+ */
+Yars::Handle Yars::handleIntern(Yars::MapStringHandle& handle_map ///< Name to Handle
+	, Yars::VectorString& name_vector ///< Handle to Name
+	, const std::string&  name        ///< The name
+	) noexcept
+{
+	const auto iter = handle_map.find(name);
+
+	if(iter != std::end(handle_map))
+	{
+		return iter->second;
+	}
+
+	const Yars::Handle handle = (Yars::Handle)name_vector.size();
+
+	handle_map[name] = handle;
+	name_vector.push_back(name);
+
+	return handle;
+}
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::MapStringFloat to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::MapStringFloat& map ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	bool first = true;
+	for(const auto& iter : map)
+	{
+		if(first == true)
+		{
+			first = false;
+			oss << "{";
+		}
+		else
+		{
+			oss << ",";
+		}
+
+		const std::string& name  = iter.first;
+		const float&       value = iter.second;
+
+		oss << " \"" << name << "\": " << std::to_string(value);
+	}
+
+	oss << " }";
+	
+	return oss.str();
+}
+#endif
+
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::MapStringInt32 to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::MapStringInt32& map ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	bool first = true;
+	for(const auto& iter : map)
+	{
+		if(first == true)
+		{
+			first = false;
+			oss << "{";
+		}
+		else
+		{
+			oss << ",";
+		}
+
+		const std::string& name  = iter.first;
+		const float&       value = iter.second;
+
+		oss << " \"" << name << "\": " << std::to_string(value);
+	}
+
+	oss << " }";
+	
+	return oss.str();
+}
+#endif
+
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::MapStringString to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::MapStringString& map ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	bool first = true;
+	for(const auto& iter : map)
+	{
+		if(first == true)
+		{
+			first = false;
+			oss << "{";
+		}
+		else
+		{
+			oss << ",";
+		}
+
+		const std::string& name  = iter.first;
+		const std::string& value = iter.second;
+
+		oss << " \"" << name << "\": \"" << value << "\"";
+	}
+
+	oss << " }";
+	
+	return oss.str();
+}
+#endif
+
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::VectorId to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::VectorId& vector ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	oss << "[";
+
+	bool first = true;
+	for(const auto& value : vector)
+	{
+		if(first == false)
+		{
+			oss << ",";
+		}
+
+		oss << " " << std::to_string(value);
+
+		first = false;
+	}
+
+	oss << " ]";
+	
+	return oss.str();
+}
+#endif
+
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::VectorString to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::VectorString& vector ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	oss << "[";
+
+	if(vector.empty() == false)
+	{
+		oss << " \"";
+
+		std::copy(std::begin(vector), std::end(vector) - 1
+			, std::ostream_iterator<std::string>(oss, "\" ,\"")
+			);
+
+		oss << vector.back();
+		oss << "\"";
+	}
+
+	oss << " ]";
+	
+	return oss.str();
+}
+#endif
+
+// }}}
+// {{{ Health
+
+/**
+ * \defgroup group_Health Health
+ *
+ * \brief Health data and manipulation
+ *
+ * The main components of Health in \yars is Yars::Health.current and 
+ * Yars::Health.maximum.  The Yars::Health.current value can not be greater 
+ * than the Yars::Health.maximum level.  Also, the Yars::Health.current value 
+ * and the Yars::Health.maximum value can not be less than `0`.
+ *
+ * If the Yars::Health.current reaches a value of `0` that is to be considered 
+ * as character death, or an Item is either broken or unusable.  If 
+ * Yars::Health.maximum is `0` then it that character can not be healed or that 
+ * item can not be repaired.
+ *
+ * \bug Yars::Item does not have Yars::Health.  Determine if Yars::Health 
+ * should be added to Yars::Item or if the documentation needs to be updated.
+ *
+ * If at any point the maximum health value is reduced to be below the current 
+ * health value (using the health methods), the current health value will be 
+ * automatically reduced.  This means that __order matters__.  For example:
+ * 1. Bad order
+ *   - health modifier is set to a large negative value
+ *     - health maximum value is reduced to `0`
+ *     - health current value is reduced to `0`
+ *     - considered dead
+ *   - health maximum base increased
+ *     - health maximum value is > `0`
+ *     - health current value is still `0`
+ *     - still considered dead
+ * 2. Good order
+ *   - health maximum base increased
+ *     - health maximum value is > `0`
+ *     - health current value is > `0`
+ *     - not dead
+ *   - health modifier is set to a large negative value
+ *     - health maximum value is still > `0`
+ *     - health current value is still > `0`
+ *     - still not dead
+ *
+ *
+ * There is no concern of overflowing the Yars::Health values because they they 
+ * are promoted to 64-bit values before any calculations are preformed.  The 
+ * 64-bit values are then clamped to the valid range of values, then finally 
+ * demoted back to 32-bit values.
+ *
+ * Using the health related methods is highly recommended.  Any value in 
+ * Yars::Health that is modified to be outside a valid range will be reset the 
+ * next time one of the health methods are called.
+ *
+ * __Value Ranges__
+ *
+ * \f$Health.current=(0<=Health.current<=Health.maximum)\f$
+ *
+ * \f$Health.maximum=(0<=(Health.maximum\_base+Health.maximum\_modifier)<=Health\_Max)\f$
+ *
+ * \f$Health.maximum\_base=(0<=Health.maximum\_base<=Health\_Max)\f$
+ *
+ * \f$Health.maximum\_modifier=(Health\_Min<=Health.maximum\_modifier<=Health\_Max)\f$
+ *
+ * \see Yars::Health_Max
+ * \see Yars::Health_Min
+ */
+
+/**
+ * \ingroup group_Health
+ *
+ * \struct Yars::Health
+ *
+ * \brief Health Data
+ */
+
+/**
+ * \var Yars::Health::current
+ *
+ * \brief The current amount of health
+ */
+
+/**
+ * \var Yars::Health::maximum
+ *
+ * \brief The calculated value for the maximum amount of health
+ */
+
+/**
+ * \var Yars::Health::maximum_base
+ *
+ * \brief The base value of maximum health
+ */
+
+/**
+ * \var Yars::Health::maximum_modifier
+ *
+ * \brief The maximum health modifier
+ */
+
+/**
+ * \typedef Yars::MapIdHealth
+ *
+ * \brief A convenience type.
+ */
+
+/**
+ * \typedef Yars::VectorHealth
+ *
+ * \brief A convenience type.
+ */
+
+/**
+ * \ingroup group_Health
+ *
+ * \var Yars::Health_Max
+ *
+ * \brief The maximum health value.
+ */
+
+/**
+ * \ingroup group_Health
+ *
+ * \var Yars::Health_Min
+ *
+ * \brief The minimum health value.
+ */
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::Health to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::Health& health ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	oss	<< "{ \"current\": "          << std::to_string(health.current)
+		<< ", \"maximum\": "          << std::to_string(health.maximum)
+		<< ", \"maximum_base\": "     << std::to_string(health.maximum_base)
+		<< ", \"maximum_modifier\": " << std::to_string(health.maximum_modifier)
+		<< " }"
+		;
+	
+	return oss.str();
+}
+#endif
+
+
+/**
+ * \ingroup group_Health
+ *
+ * \brief Set health values.
+ *
+ * The current health will be set as well as the maximum base value.
+ *
+ * \example
+ * Yars::Health health;
+ * Yars::healthSet(health, 200, 200);
+ * // health.current == 200
+ * // health.maximum == 200
+ * \endexample
+ */
+void Yars::healthSet(Yars::Health& health ///< The health data to modify.
+	, const uint32_t current          ///< The new current value.
+	, const uint32_t maximum          ///< The new maximum value.
+	) noexcept
+{
+	health.current      = current;
+	health.maximum_base = std::min(maximum, (uint32_t)Yars::Health_Max);
+
+	healthUpdate(health);
+}
+
+
+/**
+ * \ingroup group_Health
+ *
+ * \brief Set the maximum modifier value.
+ *
+ * The current health will be set as well as the maximum base value.
+ *
+ * \example
+ * Yars::Health health;
+ * Yars::healthSet(health, 200, 200);
+ * Yars::healthModifierSet(health, -100);
+ * // health.current == 100
+ * // health.maximum == 100
+ * \endexample
+ */
+void Yars::healthModifierSet(Yars::Health& health ///< The health data to modify.
+	, const int32_t modifier                  ///< The new modifier value
+	) noexcept
+{
+	health.maximum_modifier = modifier;
+
+	healthUpdate(health);
+}
+
+
+/**
+ * \ingroup group_Health
+ *
+ * \brief Adjust the current health value.
+ *
+ * The current health value will be adjusted by the provided \p amount.
+ *
+ * \example
+ * Yars::Health health;
+ * Yars::healthSet(health, 200, 200);
+ * Yars::healthAdjust(health, -10);
+ * // health.current == 190
+ * // health.maximum == 200
+ * \endexample
+ */
+void Yars::healthAdjust(Yars::Health& health ///< The health data to modify.
+	, const int32_t amount               ///< The amount to change the current health
+	) noexcept
+{
+	const int64_t value = (int64_t)health.current + (int64_t)amount;
+
+	health.current = (uint32_t)std::clamp(value
+		, (int64_t)0
+		, (int64_t)Yars::Health_Max
+		);
+
+	healthUpdate(health);
+}
+
+
+/**
+ * \ingroup group_Health
+ *
+ * \brief Adjust the maximum health value.
+ *
+ * The maximum health value will be adjusted by the provided \p amount.
+ *
+ * \example
+ * Yars::Health health;
+ * Yars::healthSet(health, 200, 200);
+ * Yars::healthMaximumAdjust(health, -10);
+ * // health.current == 190
+ * // health.maximum == 190
+ * \endexample
+ */
+void Yars::healthMaximumAdjust(Yars::Health& health ///< The health data to modify.
+	, const int32_t amount                      ///< The amount to change the current health
+	) noexcept
+{
+	const int64_t value = (int64_t)health.maximum_base + (int64_t)amount;
+
+	health.maximum_base = (uint32_t)std::clamp(value
+		, (int64_t)0
+		, (int64_t)Yars::Health_Max
+		);
+
+	healthUpdate(health);
+}
+
+
+/**
+ * \ingroup group_Health
+ *
+ * \brief Adjust the modifier health value.
+ *
+ * The maximum health modifier value will be adjusted by the provided \p 
+ * amount.
+ *
+ * \example
+ * Yars::Health health;
+ * Yars::healthSet(health, 200, 200);
+ * Yars::healthModifierAdjust(health, -10);
+ * // health.current == 190
+ * // health.maximum == 190
+ * \endexample
+ */
+void Yars::healthModifierAdjust(Yars::Health& health ///< The health data to modify.
+	, const int32_t amount                       ///< The amount to change the current health
+	) noexcept
+{
+	const int64_t value = (int64_t)health.maximum_modifier + (int64_t)amount;
+
+	health.maximum_modifier = (uint32_t)std::clamp(value
+		, (int64_t)Yars::Health_Min
+		, (int64_t)Yars::Health_Max
+		);
+
+	healthUpdate(health);
+}
+
+
+/**
+ * \ingroup group_Health
+ *
+ * \brief Increase the current health value.
+ *
+ * The current health value will be increased to the maximum value.
+ *
+ * \example
+ * Yars::Health health;
+ * Yars::healthSet(health, 200, 200);
+ * Yars::healthAdjust(health, -90);
+ * Yars::healthIncreaseToMaximum(health);
+ * // health.current == 200
+ * // health.maximum == 200
+ * \endexample
+ */
+void Yars::healthIncreaseToMaximum(Yars::Health& health ///< The health data to modify.
+	) noexcept
+{
+	health.current = health.maximum;
+
+	healthUpdate(health);
+}
+
+
+/**
+ * \ingroup group_Health
+ *
+ * \brief Update the current and maximum values
+ */
+void Yars::healthUpdate(Yars::Health& health ///< The health data to modify.
+	) noexcept
+{
+	int64_t value = (int64_t)health.maximum_base + (int64_t)health.maximum_modifier;
+
+	health.maximum = (uint32_t)std::clamp(value
+		, (int64_t)0
+		, (int64_t)Yars::Health_Max
+		);
+
+	health.current = std::clamp(health.current
+		, (uint32_t)0
+		, health.maximum
+		);
+}
+
+// }}}
+// {{{ Level
+
+/**
+ * \todo Determine if Level value can be negative without any problems.
+ *
+ * \defgroup group_Level Level
+ *
+ * \brief Level data and manipulation
+ *
+ * Level plays an important role in \yars because it determines how strong the 
+ * character's attributes and skills are.  The following aspects make up a 
+ * Level:
+ * - __Value__<br>
+ *   This is the raw value of a Level, such as "Skill is Level 5".  When a 
+ *   Yars::Skill or an Yars::Attribute refers to a Level, this is the value 
+ *   that is used.
+ *   <br><br>
+ * - __Partial__<br>
+ *   When a Level increases, the amount of the increase is a floating point 
+ *   number.  The partial values accumulate the level increases until the 
+ *   amount reaches the threshold to increase the __value__.
+ *   <br><br>
+ * - __Modifier__<br>
+ *   The modifier is a bonus or penalty that is applied to the __value__.
+ *
+ * The requirements for a level increase is: 
+ * \f$Level.partial>=Level.value\_base\f$
+ * When the requirements are satisfied, Level.partial is decreased by 
+ * Level.value_base then the Level.value_base is increased by 1.  Finally, the 
+ * Level.modifier is applied and the result is stored in Level.value.
+ *
+ * The reason that the Level.modifier is applied to Level.value_base and not 
+ * Level.partial is to maintain the effectiveness of the modifier.  The higher 
+ * the Level.value is, the less likely it is that an increase to Level.partial 
+ * will matter.  Applying the modifier to the value, a +1 is useful to all 
+ * levels.
+ *
+ * The Level.modifier only takes affect when the Level.value_base is greater 
+ * than `0`.  The Level.value will never go below `0`, regardless of the 
+ * Level.modifier value.
+ */
+
+/**
+ * \ingroup group_Level
+ *
+ * \struct Yars::Level
+ *
+ * \brief %Level Data
+ */
+
+/**
+ * \bug Create a partial_base that tracks the uint32_t partial value.  The 
+ * partial will still collect the increases and for each whole number above 
+ * zero, that value will be added to partial_base.  __Avoid rounding errors in 
+ * higher floating point values.__
+ *
+ * \var Yars::Level::partial
+ *
+ * \brief %Level increase accumulator.
+ */
+
+/**
+ * \var Yars::Level::modifier
+ *
+ * \brief Modify the %Level value
+ */
+
+/**
+ * \var Yars::Level::value
+ *
+ * \brief %Level value.
+ */
+
+/**
+ * \var Yars::Level::value_base
+ *
+ * \brief The raw %Level value.
+ */
+
+/**
+ * \ingroup group_Level
+ *
+ * \var Yars::Level_Max
+ *
+ * \brief The maximum level value.
+ */
+
+/**
+ * \ingroup group_Level
+ *
+ * \var Yars::Level_Min
+ *
+ * \brief The minimum level value.
+ */
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::Level to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::Level& level ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	oss	<< "{ \"value_base\": " << level.value_base
+		<< ", \"value\": "      << level.value
+		<< ", \"partial\": "    << std::to_string(level.partial)
+		<< ", \"modifier\": "   << level.modifier
+		<< " }"
+		;
+	
+	return oss.str();
+}
+#endif
+
+
+/**
+ * \ingroup group_Level
+ *
+ * \brief Increase the Level
+ *
+ * Increase the provided \p level with the specified \p amount.  If \p amount 
+ * is less than `0`, then the method will just return `0`.
+ *
+ * \example
+ * Yars::Level level;
+ * Yars::levelIncrease(level, 1.5f);
+ * // level.modifier   == 0
+ * // level.partial    == 0.5
+ * // level.value_base == 1
+ * // level.value      == 1
+ * \endexample
+ *
+ * \return The number of levels gained
+ */
+uint32_t Yars::levelIncrease(Yars::Level& level ///< The Level to increase
+	, const float amount                    ///< The amount to increase
+	) noexcept
+{
+	if(amount < 0)
+	{
+		return 0;
+	}
+
+	level.partial += amount;
+
+	uint32_t level_up = 0;
+
+	if(level.partial >= 1)
+	{
+		if(level.value_base == 0)
+		{
+			level.value_base = 1;
+			level.partial -= 1.0f;
+			level_up++;
+		}
+
+		while(level.partial >= level.value_base)
+		{
+			level.partial -= level.value_base;
+			level.value_base++;
+			level_up++;
+		}
+	}
+
+	levelUpdate(level);
+
+	return level_up;
+}
+
+
+/**
+ * \ingroup group_Level
+ *
+ * \brief Decrease the Level
+ *
+ * Decrease the provided \p level by the specified \p amount.  This is the 
+ * reverse of Yars::levelIncrease(): when Level.partial drops below `0`, 
+ * Level.value_base is decreased and Level.partial is given the amount that was 
+ * needed to reach that level.  Level.value_base will not go below `0`.  If 
+ * \p amount is less than `0`, then the method will just return `0`.
+ *
+ * \example
+ * Yars::Level level;
+ * Yars::levelSet(level, 2, 0.5f);
+ * Yars::levelDecrease(level, 1.0f);
+ * // level.modifier   == 0
+ * // level.partial    == 0.5
+ * // level.value_base == 1
+ * // level.value      == 1
+ * \endexample
+ *
+ * \return The number of levels lost
+ */
+uint32_t Yars::levelDecrease(Yars::Level& level ///< The Level to decrease
+	, const float amount                    ///< The amount to decrease
+	) noexcept
+{
+	if(amount < 0)
+	{
+		return 0;
+	}
+
+	level.partial -= amount;
+
+	uint32_t level_down = 0;
+
+	while(level.partial < 0)
+	{
+		if(level.value_base <= 0)
+		{
+			level.value_base = 0;
+			level.partial    = 0;
+			break;
+		}
+
+		level.value_base--;
+		level.partial += (level.value_base == 0) ? 1.0f : level.value_base;
+		level_down++;
+	}
+
+	levelUpdate(level);
+
+	return level_down;
+}
+
+
+/**
+ * \ingroup group_Level
+ *
+ * \brief Adjust the modifier value
+ *
+ * Apply the \p amount to the Level modifier.
+ *
+ * \example
+ * Yars::Level level;
+ * Yars::levelIncrease(level, 1.5f);
+ * Yars::levelModifierAdjust(level, 2);
+ * // level.modifier   == 2
+ * // level.partial    == 0.5
+ * // level.value_base == 1
+ * // level.value      == 3
+ * \endexample
+ */
+void Yars::levelModifierAdjust(Yars::Level& level ///< The Level modifier to increase
+	, const int32_t amount                    ///< The amount to increase
+	) noexcept
+{
+	int64_t modifier = (int64_t)level.modifier + (int64_t)amount;
+
+	level.modifier = (int32_t)std::clamp(modifier
+		, (int64_t)Yars::Level_Min
+		, (int64_t)Yars::Level_Max
+		);
+
+	levelUpdate(level);
+}
+
+
+/**
+ * \ingroup group_Level
+ *
+ * \brief Set the Level
+ *
+ * The Level value and partial will be set as specified.  If the partial value 
+ * is large enough, the level value will be adjusted accordingly.
+ *
+ * \example
+ * Yars::Level level;
+ * Yars::levelSet(level, 1, 0.5f);
+ * // level.modifier   == 0
+ * // level.partial    == 0.5
+ * // level.value_base == 1
+ * // level.value      == 1
+ * \endexample
+ */
+void Yars::levelSet(Yars::Level& level ///< The Level to set
+	, const int32_t value          ///< The new Level value
+	, const float partial          ///< The new Level partial value
+	) noexcept
+{
+	level.value_base = value;
+	level.partial    = 0;
+
+	levelIncrease(level, partial);
+}
+
+
+/**
+ * \ingroup group_Level
+ *
+ * \brief Update the Level value
+ *
+ */
+void Yars::levelUpdate(Yars::Level& level
+	) noexcept
+{
+	// Level modifiers only apply if the base value is not 0
+	if(level.value_base == 0)
+	{
+		level.value = 0;
+	}
+	else
+	{
+		int64_t value = (int64_t)level.value_base + (int64_t)level.modifier;
+		level.value = (int32_t)std::clamp(value
+			, (int64_t)0
+			, (int64_t)std::numeric_limits<int32_t>::max()
+			);
+	}
+}
+
+// }}}
+// {{{ Histogram
+
+/**
+ * \defgroup group_Histogram Histogram
+ *
+ * \brief Count values in logarithmic buckets.
+ *
+ * A Histogram counts how many values fall in to each bucket.  Each bucket 
+ * covers twice the range of the bucket before it: 
+ * - Bucket 0: Zero and negative values 
+ * - Bucket 1: 1 
+ * - Bucket 2: 2 to 3 
+ * - Bucket 3: 4 to 7 
+ * - Bucket N: \f$2^{N-1}\f$ to \f$2^N-1\f$
+ *
+ * Only Yars::Histogram_Size counters are needed to cover every \c int32_t 
+ * value, so a Histogram is cheap to copy.
+ *
+ * \example
+ * Yars::Histogram histogram;
+ * Yars::histogramAdjust(histogram, 5, +1);
+ *
+ * // histogram.count[Yars::histogramBucket(5)] == 1
+ * // histogram.total == 1
+ * \endexample
+ */
+
+/**
+ * \ingroup group_Histogram
+ *
+ * \struct Yars::Histogram
+ *
+ * \brief %Histogram Data
+ */
+
+/**
+ * \ingroup group_Histogram
+ *
+ * \var Yars::Histogram_Size
+ *
+ * \brief The number of buckets in a Histogram.
+ */
+
+/**
+ * \ingroup group_Histogram
+ *
+ * \brief Add to a bucket.
+ *
+ * The bucket that holds \p value will be changed by \p amount.
+ *
+ * \example
+ * Yars::histogramAdjust(histogram, old_value, -1);
+ * Yars::histogramAdjust(histogram, new_value, +1);
+ * \endexample
+ */
+void Yars::histogramAdjust(Yars::Histogram& histogram ///< The Histogram
+	, const int32_t value  ///< The value to count
+	, const int32_t amount ///< The change in count
+	) noexcept
+{
+	histogram.count[histogramBucket(value)] += amount;
+	histogram.total += amount;
+}
+
+
+/**
+ * \ingroup group_Histogram
+ *
+ * \brief Get the bucket of a value.
+ *
+ * \example
+ * size_t bucket = Yars::histogramBucket(100); // bucket == 7
+ * \endexample
+ *
+ * \return The bucket.
+ */
+size_t Yars::histogramBucket(const int32_t value ///< The value
+	) noexcept
+{
+	if(value <= 0)
+	{
+		return 0;
+	}
+
+	return std::bit_width((uint32_t)value);
+}
+
+
+/**
+ * \ingroup group_Histogram
+ *
+ * \brief Get the lowest value in a bucket.
+ *
+ * \example
+ * for(size_t bucket = 0; bucket < Yars::Histogram_Size; bucket++)
+ * {
+ * 	std::cout << Yars::histogramBucketMin(bucket)
+ * 		<< ": " << histogram.count[bucket]
+ * 		<< "\n";
+ * }
+ * \endexample
+ *
+ * \return The lowest value.  Bucket 0 will return Yars::Level_Min.
+ */
+int32_t Yars::histogramBucketMin(const size_t bucket ///< The bucket
+	) noexcept
+{
+	if(bucket == 0)
+	{
+		return Yars::Level_Min;
+	}
+
+	return (int32_t)((uint32_t)1 << (bucket - 1));
+}
+
+// }}}
+// {{{ Attribute
+
+/**
+ * \defgroup group_Attribute Attribute
+ *
+ * \brief Attributes
+ *
+ * Attributes are optional elements of Skills and if present, they provide 
+ * additional bonus to the Skill.
+ *
+ * Creating Attributes is automatic but if Attributes needs to be added 
+ * manually, they only have two parts:
+ * - __Level__<br>
+ *   The Level of a Attribute represents how much it can influence a Skill.
+ *   <br><br>
+ * - __Name__<br>
+ *   All Attributes must have a name.  No two Attributes may have the same 
+ *   name.
+ *
+ * Attributes can not be used directly in \yars.  When Skills are used, they 
+ * will used the Attributes Level as needed.
+ *
+ * Attributes that are added directly to the Yars class are treated as the 
+ * baseline Attributes.  This means that if an Attribute is added to Yars and 
+ * it is set to have a Level value of 10, then when that same Attribute is 
+ * added to a Character the Attribute for Yars is copied into the Character.
+ *
+ * Currently, Attributes can not be removed.  The reason is that Skills can be 
+ * added and removed which could cause the Attribute to be added right back.  
+ * And adding some type of "count" to the Attribute to track the number of 
+ * dependencies to determine when to "clean" unused Attributes does not out 
+ * weigh the overhead.  Yet.
+ */
+
+/**
+ * \ingroup group_Attribute
+ *
+ * \struct Yars::Attribute
+ *
+ * \brief Attribute data
+ */
+
+/**
+ * \var Yars::Attribute::level
+ *
+ * \brief The level of the Attribute.
+ */
+
+/**
+ * \typedef Yars::MapStringAttribute
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::MapIdMapStringAttribute
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \var Yars::attribute_map
+ *
+ * \brief A collection of Attributes
+ */
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::Attribute to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::Attribute& attribute ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	oss	<< "{ \"level\": "
+		<< Yars::to_string(attribute.level)
+		<< " }"
+		;
+	
+	return oss.str();
+}
+#endif
+
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::MapStringAttribute to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::MapStringAttribute& attribute_map ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	oss << "{";
+
+	bool first = true;
+	for(const auto& iter : attribute_map)
+	{
+		if(first == false)
+		{
+			oss << ",";
+		}
+
+		const std::string&     name      = iter.first;
+		const Yars::Attribute& attribute = iter.second;
+
+		oss	<< " \""
+			<< name
+			<< "\": "
+			<< Yars::to_string(attribute)
+			;
+
+		first = false;
+	}
+
+	oss << " }";
+
+	return oss.str();
+}
+#endif
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Attribute
+ *
+ * \brief Get an Attribute
+ *
+ * Access an Attribute.
+ *
+ * A frozen catalog can not add a missing Attribute.  Without safe mode, 
+ * asking a frozen catalog for an unknown Attribute will terminate the 
+ * program the same way that the <code>const</code> version does.
+ *
+ * \example
+ * Yars yars;
+ * yars.attributeAdd("Attr");
+ * Yars::Attribute& attr = yars.attribute("Attr");
+ * \endexample
+ *
+ * \return An Attribute
+ */
+Yars::Attribute& Yars::attribute(const std::string& attribute_name ///< The Attribute name
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(attribute_name.empty())
+		{
+			//ZAKERO_YARS_DEBUG << "Bad Name" << std::endl;
+			Attribute* retval = nullptr;
+			return *retval;
+		}
+
+		if(attributeExists(attribute_name) == false)
+		{
+			//ZAKERO_YARS_DEBUG << "Does Not Exist" << std::endl;
+			Attribute* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	if(catalog_is_frozen)
+	{
+		return catalog_attribute.at(attribute_name);
+	}
+
+	return attribute_map[attribute_name];
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Attribute
+ *
+ * \brief Get an Attribute
+ *
+ * Access an Attribute.
+ *
+ * \example
+ * Yars yars;
+ * yars.attributeAdd("Attr");
+ * const Yars& y = yars;
+ * const Yars::Attribute& attr = y.attribute("Attr");
+ * \endexample
+ */
+const Yars::Attribute& Yars::attribute(const std::string& attribute_name ///< The Attribute name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(attribute_name.empty())
+		{
+			//ZAKERO_YARS_DEBUG << "Bad Name" << std::endl;
+			Attribute* retval = nullptr;
+			return *retval;
+		}
+
+		if(attributeExists(attribute_name) == false)
+		{
+			//ZAKERO_YARS_DEBUG << "Does Not Exist" << std::endl;
+			Attribute* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	if(catalog_is_frozen)
+	{
+		return catalog_attribute.at(attribute_name);
+	}
+
+	return attribute_map.at(attribute_name);
+}
+
+
+/**
+ * \ingroup group_Attribute
+ *
+ * \brief Get an Attribute
+ *
+ * Access an Attribute using a Name that was hashed at compile-time.
+ *
+ * \example
+ * Yars yars;
+ * yars.attributeAdd("Attr");
+ * const Yars& y = yars;
+ * const Yars::Attribute& attr = y.attribute("Attr"_yars);
+ * \endexample
+ *
+ * \return An Attribute
+ */
+const Yars::Attribute& Yars::attribute(const Yars::Name& attribute_name ///< The Attribute name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(attributeFind(attribute_name) == nullptr)
+		{
+			Yars::Attribute* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	if(catalog_is_frozen)
+	{
+		return catalog_attribute.at(attribute_name);
+	}
+
+	return attribute_map.at(attribute_name);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Attribute
+ *
+ * \brief Add an Attribute
+ *
+ * Add a new Attribute.
+ *
+ * \example
+ * Yars yars;
+ * yars.attributeAdd("Attr");
+ * \endexample
+ *
+ * \retval true  The Attribute was added
+ * \retval false Failed to add the Attribute
+ */
+bool Yars::attributeAdd(const std::string& attribute_name ///< The Attribute name
+	) noexcept
+{
+	if(catalog_is_frozen)
+	{
+		return false;
+	}
+
+	if(safeMode())
+	{
+		if(attribute_name.empty())
+		{
+			//ZAKERO_YARS_DEBUG << "Bad Name" << std::endl;
+			return false;
+		}
+
+		if(attributeExists(attribute_name))
+		{
+			//ZAKERO_YARS_DEBUG << "Already Exists" << std::endl;
+			return false;
+		}
+	}
+
+	attribute_map[attribute_name] = {};
+
+	Yars::handleIntern(attribute_handle, attribute_handle_name, attribute_name);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Attribute
+ *
+ * \brief Check if an Attribute already exists
+ *
+ * \example
+ * Yars yars;
+ * yars.attributeAdd("Attr");
+ * if(yars.attributeExists("Attr"))
+ * {
+ * 	std::cout << "Woot!\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Attribute was added
+ * \retval false Failed to add the Attribute
+ */
+bool Yars::attributeExists(const std::string& attribute_name ///< The Attribute name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(attribute_name.empty())
+		{
+			//ZAKERO_YARS_DEBUG << "Bad Name" << std::endl;
+			return false;
+		}
+	}
+
+	return (attributeFind(attribute_name) != nullptr);
+}
+
+
+/**
+ * \ingroup group_Attribute
+ *
+ * \brief Check if an Attribute already exists
+ *
+ * \example
+ * if(yars.attributeExists("Attr"_yars))
+ * {
+ * 	std::cout << "Woot!\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Attribute exists
+ * \retval false The Attribute does not exist
+ */
+bool Yars::attributeExists(const Yars::Name& attribute_name ///< The Attribute name
+	) const noexcept
+{
+	return (attributeFind(attribute_name) != nullptr);
+}
+
+
+/**
+ * \ingroup group_Attribute
+ *
+ * \brief Get the Handle of an Attribute.
+ *
+ * All Attributes that have been added have a Handle.  Attributes that are 
+ * only used by Characters get a Handle when the \ref group_CharacterLedger 
+ * "Ledger" first needs one.
+ *
+ * \example
+ * Yars yars;
+ * yars.attributeAdd("Attr");
+ * Yars::Handle handle = yars.attributeHandle("Attr");
+ * \endexample
+ *
+ * \return The Handle or Yars::Handle_Invalid if the Attribute does not have a 
+ * Handle.
+ */
+Yars::Handle Yars::attributeHandle(const std::string& attribute_name ///< The Attribute name
+	) const noexcept
+{
+	const auto iter = attribute_handle.find(attribute_name);
+
+	if(iter == std::end(attribute_handle))
+	{
+		return Yars::Handle_Invalid;
+	}
+
+	return iter->second;
+}
+
+
+/**
+ * \ingroup group_Attribute
+ *
+ * \brief Get the name of an Attribute Handle.
+ *
+ * \example
+ * Yars yars;
+ * yars.attributeAdd("Attr");
+ * Yars::Handle handle = yars.attributeHandle("Attr");
+ * std::string  name   = yars.attributeHandleName(handle);
+ * \endexample
+ *
+ * \return The Attribute name or an empty string if the Handle is not valid.
+ */
+std::string Yars::attributeHandleName(const Yars::Handle handle ///< The Handle
+	) const noexcept
+{
+	if(handle >= attribute_handle_name.size())
+	{
+		return {};
+	}
+
+	return attribute_handle_name[handle];
+}
+
+// }}}
+// {{{ Skill
+
+/**
+ * \defgroup group_Skill Skill
+ *
+ * \brief Skills
+ *
+ * Skills are the core of \yars.  For anything to interact with anything else 
+ * there must be a Skill that allows the interaction.  Most methods in the Yars 
+ * class only require the name of the Skill.
+ *
+ * Creating Skills is very easy and consists of three parts:
+ * - __Attributes__<br>
+ *   This defines which Attributes will apply when the Skill is used.  These 
+ *   Attribute will automatically be added to a Character if the Character does 
+ *   not have them.
+ *   <br><br>
+ * - __Level__<br>
+ *   The Level of a Skill represents how effective it is.  This effectiveness 
+ *   is relative however.  If an attacker is using a Skill with a Level of 10 
+ *   and the defender is using a Skill with a Level of 8, then the attacker's 
+ *   Skill Level is actually 2.  (attacker - defender = 10 - 8 = 2).
+ *   <br><br>
+ * - __Name__<br>
+ *   All Skills must have a name.  No two Skills may have the same name.
+ *
+ * The main use of Skills is with [Affects](\ref group_Affect).
+ *
+ * Skills must be added to the Yars class before they can be added to a 
+ * Character.  When added to a Character, the Skill is copied from the Yars 
+ * class into the Character.  If the Skill is changed in the Yars class after 
+ * it was added to a Character, the Character will __not__ see the changes.
+ *
+ * To learn how the Yars::Skill.attribute_contribution is used, refer to 
+ * Yars::calculateModifier().
+ */
+
+/**
+ * \ingroup group_Skill
+ *
+ * \struct Yars::Skill
+ *
+ * \brief Skill data
+ */
+
+/**
+ * \var Yars::Skill::attribute_contribution
+ *
+ * \brief Attribute names and how much they contribute.
+ */
+
+/**
+ * \var Yars::Skill::level
+ *
+ * \brief The Skill level.
+ */
+
+/**
+ * \var Yars::Skill::attribute_weight
+ *
+ * \brief The normalized Attribute contributions.
+ *
+ * The weights are immutable and shared by every copy of the Skill, so giving 
+ * a Skill to a Character does not copy them.
+ *
+ * \see Yars::skillWeightUpdate()
+ */
+
+/**
+ * \struct Yars::SkillWeight
+ *
+ * \brief Normalized Attribute contributions.
+ *
+ * The Attribute at each index in \p attribute has the weight at the same 
+ * index in \p weight.  All the weights add up to 1, unless the total of the 
+ * contributions is 0, in which case all the weights are 0.
+ *
+ * The weights are only used while \p contribution is the same as the 
+ * Yars::Skill::attribute_contribution of the Skill.
+ */
+
+/**
+ * \var Yars::SkillWeight::contribution
+ *
+ * \brief The contributions that the weights were calculated from.
+ */
+
+/**
+ * \var Yars::SkillWeight::attribute
+ *
+ * \brief The Attribute names.
+ */
+
+/**
+ * \var Yars::SkillWeight::weight
+ *
+ * \brief The weight of each Attribute.
+ */
+
+/**
+ * \typedef Yars::SkillWeightPtr
+ *
+ * \brief A convenience type.
+ */
+
+/**
+ * \typedef Yars::MapStringSkill
+ *
+ * \brief A convenience type.
+ *
+ * A Yars::Skill is too large to be stored inline by a Yars::SmallMap, eight
+ * of them would make every Character's map over 2KB.  The Skills are kept in
+ * a Yars::FlatMap instead so that the map itself stays small.
+ */
+
+/**
+ * \typedef Yars::MapIdMapStringSkill
+ *
+ * \brief A convenience type.
+ */
+
+/**
+ * \struct Yars::SkillSet
+ *
+ * \brief A set of Skill Handles.
+ *
+ * Each Skill Handle is a bit in \p bit, which makes checking if two sets 
+ * have a Skill in common a few bitwise operations instead of a name lookup 
+ * for each Skill.
+ *
+ * \see Yars::skillHandle()
+ */
+
+/**
+ * \var Yars::SkillSet::bit
+ *
+ * \brief The Skill Handle bits.
+ */
+
+/**
+ * \var Yars::SkillSet::count
+ *
+ * \brief The number of Skill names in the set.
+ *
+ * This value is used to detect when the Skill names that the set was made 
+ * from have changed.
+ */
+
+/**
+ * \var Yars::SkillSet::hash
+ *
+ * \brief The hash of the Skill names in the set.
+ *
+ * Together with Yars::SkillSet::count, this detects a Skill name that was 
+ * replaced in the list that the set was made from.  A Character's set does 
+ * not use the hash, Yars::characterSkillMap() drops that set instead.
+ */
+
+/**
+ * \typedef Yars::MapIdSkillSet
+ *
+ * \brief A convenience type.
+ */
+
+/**
+ * \var Yars::skill_map
+ *
+ * \brief A collection of Skills.
+ */
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::Skill to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::Skill& skill ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	oss	<< "{ \"level\": "
+		<< Yars::to_string(skill.level)
+		<< ", \"attribute_contribution\": " << Yars::to_string(skill.attribute_contribution)
+		<< " }"
+		;
+	
+	return oss.str();
+}
+#endif
+
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::MapStringSkill to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::MapStringSkill& skill_map ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	oss << "{";
+
+	bool first = true;
+	for(const auto& iter : skill_map)
+	{
+		if(first == false)
+		{
+			oss << ",";
+		}
+
+		const std::string& name  = iter.first;
+		const Yars::Skill& skill = iter.second;
+
+		oss	<< " \""
+			<< name
+			<< "\": "
+			<< Yars::to_string(skill)
+			;
+
+		first = false;
+	}
+
+	oss << " }";
+	
+	return oss.str();
+}
+#endif
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Skill
+ *
+ * \brief Get an Skill
+ *
+ * Access a Skill.
+ *
+ * A frozen catalog can not add a missing Skill.  Without safe mode, asking a 
+ * frozen catalog for an unknown Skill will terminate the program the same 
+ * way that the <code>const</code> version does.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * Yars::Skill& skill = yars.skill("Skill");
+ * \endexample
+ *
+ * \return A Skill
+ */
+Yars::Skill& Yars::skill(const std::string& skill_name ///< The Skill name
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(skill_name.empty())
+		{
+			Skill* retval = nullptr;
+			return *retval;
+		}
+
+		if(skillExists(skill_name) == false)
+		{
+			Skill* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	if(catalog_is_frozen)
+	{
+		return catalog_skill.at(skill_name);
+	}
+
+	return skill_map[skill_name];
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Skill
+ *
+ * \brief Get an Skill
+ *
+ * Access a Skill.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * const Yars& y = yars;
+ * const Yars::Skill& skill = y.skill("Skill");
+ * \endexample
+ *
+ * \return A Skill
+ */
+const Yars::Skill& Yars::skill(const std::string& skill_name ///< The Skill name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(skill_name.empty())
+		{
+			Skill* retval = nullptr;
+			return *retval;
+		}
+
+		if(skillExists(skill_name) == false)
+		{
+			Skill* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	if(catalog_is_frozen)
+	{
+		return catalog_skill.at(skill_name);
+	}
+
+	return skill_map.at(skill_name);
+}
+
+
+/**
+ * \ingroup group_Skill
+ *
+ * \brief Get an Skill
+ *
+ * Access a Skill using a Name that was hashed at compile-time.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * const Yars& y = yars;
+ * const Yars::Skill& skill = y.skill("Skill"_yars);
+ * \endexample
+ *
+ * \return A Skill
+ */
+const Yars::Skill& Yars::skill(const Yars::Name& skill_name ///< The Skill name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(skillFind(skill_name) == nullptr)
+		{
+			Yars::Skill* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	if(catalog_is_frozen)
+	{
+		return catalog_skill.at(skill_name);
+	}
+
+	return skill_map.at(skill_name);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Skill
+ *
+ * \brief Add a Skill
+ *
+ * Add a new Skill.  If the Attributes named in the 
+ * <code>attribute_contribution</code> do not exist in the Yars class, they 
+ * will be added.
+ *
+ * \see attributeAdd()
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Foo", {});
+ * yars.skillAdd("Bar",
+ * 	{	.attribute_contribution =
+ * 		{	{ "Attr_1", 1 }
+ * 		,	{ "Attr_2", 1 }
+ * 		}
+ * 	,	.level =
+ * 		{	.value      = 1
+ * 		,	.value_base = 1
+ * 		}
+ * 	});
+ * \endexample
+ *
+ * \retval true  The Skill was added
+ * \retval false Failed to add the Skill
+ */
+bool Yars::skillAdd(const std::string& skill_name ///< The Skill name
+	, const Yars::Skill& skill                ///< The Skill to add
+	) noexcept
+{
+	if(catalog_is_frozen)
+	{
+		return false;
+	}
+
+	if(safeMode())
+	{
+		if(skill_name.empty())
+		{
+			return false;
+		}
+
+		if(skillExists(skill_name))
+		{
+			return false;
+		}
+	}
+
+	for(const auto& iter : skill.attribute_contribution)
+	{
+		const std::string& attribute_name        = iter.first;
+		//const int32_t&   modifier_contribution = iter.second;
+
+		attributeAdd(attribute_name);
+	}
+
+	Yars::Skill& new_skill = skill_map[skill_name];
+
+	new_skill = skill;
+	Yars::skillWeightUpdate(new_skill);
+
+	Yars::handleIntern(skill_handle, skill_handle_name, skill_name);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Skill
+ *
+ * \brief Remove a Skill
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Foo", {});
+ * // Do stuff
+ * yars.skillRemove("Foo");
+ * \endexample
+ *
+ * \retval true  The Skill was removed
+ * \retval false Failed to remove the Skill
+ */
+bool Yars::skillRemove(const std::string& skill_name ///< The Skill name
+	) noexcept
+{
+	if(catalog_is_frozen)
+	{
+		return false;
+	}
+
+	if(safeMode())
+	{
+		if(skill_name.empty())
+		{
+			return false;
+		}
+
+		if(skillExists(skill_name) == false)
+		{
+			return false;
+		}
+	}
+
+	skill_map.erase(skill_name);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ *
+ * \ingroup group_Skill
+ *
+ * \brief Check if an Skill already exists
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill");
+ * if(yars.skillExists("Skill"))
+ * {
+ * 	std::cout << "Woot!\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Skill was added
+ * \retval false Failed to add the Skill
+ */
+bool Yars::skillExists(const std::string& skill_name ///< The Skill name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(skill_name.empty())
+		{
+			return false;
+		}
+	}
+
+	return (skillFind(skill_name) != nullptr);
+}
+
+
+/**
+ * \ingroup group_Skill
+ *
+ * \brief Check if an Skill already exists
+ *
+ * \example
+ * if(yars.skillExists("Skill"_yars))
+ * {
+ * 	std::cout << "Woot!\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Skill exists
+ * \retval false The Skill does not exist
+ */
+bool Yars::skillExists(const Yars::Name& skill_name ///< The Skill name
+	) const noexcept
+{
+	return (skillFind(skill_name) != nullptr);
+}
+
+
+/**
+ * \ingroup group_Skill
+ *
+ * \brief Get a list of Skills.
+ *
+ * Provides a vector of all the Skill names in the Yars class.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * Yars::VectorString skill_list = yars.skillList();
+ * \endexample
+ *
+ * \return A vector of Skill names.
+ */
+Yars::VectorString Yars::skillList() const noexcept
+{
+	if(catalog_is_frozen)
+	{
+		return Yars::mapKeyList(catalog_skill);
+	}
+
+	return Yars::mapKeyList(skill_map);
+}
+
+
+/**
+ * \ingroup group_Skill
+ *
+ * \brief Get the Handle of a Skill.
+ *
+ * All Skills that have been added have a Handle, even if the Skill has been 
+ * removed.  Skills that are only used by Characters get a Handle when the 
+ * \ref group_CharacterLedger "Ledger" first needs one.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * Yars::Handle handle = yars.skillHandle("Skill");
+ * \endexample
+ *
+ * \return The Handle or Yars::Handle_Invalid if the Skill does not have a 
+ * Handle.
+ */
+Yars::Handle Yars::skillHandle(const std::string& skill_name ///< The Skill name
+	) const noexcept
+{
+	const auto iter = skill_handle.find(skill_name);
+
+	if(iter == std::end(skill_handle))
+	{
+		return Yars::Handle_Invalid;
+	}
+
+	return iter->second;
+}
+
+
+/**
+ * \ingroup group_Skill
+ *
+ * \brief Get the name of a Skill Handle.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * Yars::Handle handle = yars.skillHandle("Skill");
+ * std::string  name   = yars.skillHandleName(handle);
+ * \endexample
+ *
+ * \return The Skill name or an empty string if the Handle is not valid.
+ */
+std::string Yars::skillHandleName(const Yars::Handle handle ///< The Handle
+	) const noexcept
+{
+	if(handle >= skill_handle_name.size())
+	{
+		return {};
+	}
+
+	return skill_handle_name[handle];
+}
+
+
+/**
+ * \ingroup group_Skill
+ *
+ * \brief Update the Attribute weights of a Skill.
+ *
+ * The Yars::Skill::attribute_weight is a copy of the 
+ * Yars::Skill::attribute_contribution where each contribution has already 
+ * been divided by the total of all the contributions.  This is done once so 
+ * that calculateModifier(), characterLevelIncrease(), and characterLevelSet() 
+ * do not have to.
+ *
+ * Skills added with skillAdd() are updated automatically.  If the 
+ * <code>attribute_contribution</code> of a Skill is changed directly, the 
+ * change is noticed and the weights will be calculated every time they are 
+ * used until this method is called.
+ *
+ * \example
+ * Yars::Skill& skill = yars.characterSkill(bubba, "Skill");
+ * skill.attribute_contribution["Attr"] = 5;
+ * Yars::skillWeightUpdate(skill);
+ * \endexample
+ */
+void Yars::skillWeightUpdate(Yars::Skill& skill ///< The Skill to update
+	) noexcept
+{
+	auto skill_weight = std::make_shared<Yars::SkillWeight>();
+
+	Yars::skillWeightCalculate(skill.attribute_contribution, *skill_weight);
+
+	skill.attribute_weight = std::move(skill_weight);
+}
+
+
+/**
+ * \ingroup group_Skill
+ *
+ * \brief Create a set of Skills.
+ *
+ * All the Skill names will be given a Skill Handle, if they do not already 
+ * have one.
+ *
+ * \example
+ * Yars yars;
+ * Yars::SkillSet set = yars.skillSet({ "Skill_1", "Skill_2" });
+ * \endexample
+ *
+ * \return The set of Skills.
+ */
+Yars::SkillSet Yars::skillSet(const Yars::VectorString& skill_list ///< The Skill names
+	) noexcept
+{
+	Yars::SkillSet skill_set = {};
+
+	for(const auto& skill_name : skill_list)
+	{
+		skillSetInsert(skill_set
+			, Yars::handleIntern(skill_handle, skill_handle_name, skill_name)
+			);
+	}
+
+	skill_set.count = skill_list.size();
+	skill_set.hash  = skillSetHash(skill_list);
+
+	return skill_set;
+}
+
+
+/**
+ * \ingroup group_Skill
+ *
+ * \brief Check if a set has a Skill.
+ *
+ * \retval true  The Skill is in the set
+ * \retval false The Skill is not in the set
+ */
+bool Yars::skillSetContains(const Yars::SkillSet& skill_set ///< The set
+	, const Yars::Handle handle ///< The Skill Handle
+	) noexcept
+{
+	const size_t index = handle / 64;
+
+	if(index >= skill_set.bit.size())
+	{
+		return false;
+	}
+
+	return (skill_set.bit[index] & ((uint64_t)1 << (handle % 64))) != 0;
+}
+
+
+/**
+ * \ingroup group_Skill
+ *
+ * \brief Remove a Skill from a set.
+ *
+ * The Yars::SkillSet::count is not changed.
+ */
+void Yars::skillSetErase(Yars::SkillSet& skill_set ///< The set
+	, const Yars::Handle handle ///< The Skill Handle
+	) noexcept
+{
+	const size_t index = handle / 64;
+
+	if(index >= skill_set.bit.size())
+	{
+		return;
+	}
+
+	skill_set.bit[index] &= ~((uint64_t)1 << (handle % 64));
+}
+
+
+/**
+ * \ingroup group_Skill
+ *
+ * \brief Add a Skill to a set.
+ *
+ * The Yars::SkillSet::count is not changed.
+ */
+void Yars::skillSetInsert(Yars::SkillSet& skill_set ///< The set
+	, const Yars::Handle handle ///< The Skill Handle
+	) noexcept
+{
+	const size_t index = handle / 64;
+
+	if(index >= skill_set.bit.size())
+	{
+		skill_set.bit.resize(index + 1, 0);
+	}
+
+	skill_set.bit[index] |= ((uint64_t)1 << (handle % 64));
+}
+
+
+/**
+ * \ingroup group_Skill
+ *
+ * \brief Check if two sets have a Skill in common.
+ *
+ * \example
+ * Yars yars;
+ * Yars::SkillSet a = yars.skillSet({ "Skill_1", "Skill_2" });
+ * Yars::SkillSet b = yars.skillSet({ "Skill_2", "Skill_3" });
+ *
+ * if(Yars::skillSetIntersects(a, b))
+ * {
+ * 	std::cout << "Found a common Skill\n";
+ * }
+ * \endexample
+ *
+ * \retval true  At least one Skill is in both sets
+ * \retval false The sets have no Skills in common
+ */
+bool Yars::skillSetIntersects(const Yars::SkillSet& lhs ///< A set
+	, const Yars::SkillSet& rhs ///< A set
+	) noexcept
+{
+	const size_t size = std::min(lhs.bit.size(), rhs.bit.size());
+
+	for(size_t index = 0; index < size; index++)
+	{
+		if((lhs.bit[index] & rhs.bit[index]) != 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+/**
+ * \brief Check if a Character has one of the Skills.
+ *
+ * The sets are used when both are up-to-date, otherwise each name in \p 
+ * skill_list is looked-up in \p skill_map.  The \p skill_set is up-to-date 
+ * when it was made from the same names as \p skill_list, so a name that was 
+ * changed in place is also found.
+ *
+ * \retval true  At least one of the Skills was found
+ * \retval false None of the Skills were found
+ */
+bool Yars::skillSetAny(const Yars::SkillSet* character_set ///< The Character's set or nullptr
+	, const Yars::MapStringSkill& skill_map  ///< The Character's Skills
+	, const Yars::VectorString&   skill_list ///< The Skill names
+	, const Yars::SkillSet&       skill_set  ///< The set of \p skill_list
+	) noexcept
+{
+	if(character_set != nullptr
+		&& skill_set.count == skill_list.size()
+		&& skill_set.hash  == skillSetHash(skill_list)
+		)
+	{
+		return skillSetIntersects(*character_set, skill_set);
+	}
+
+	for(const auto& skill_name : skill_list)
+	{
+		if(skill_map.contains(skill_name))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+/**
+ * \brief Hash a list of Skill names.
+ *
+ * The names are hashed in order, the same as Yars::nameHash() with a `0` 
+ * between each name.
+ *
+ * \return The hash.
+ */
+uint64_t Yars::skillSetHash(const Yars::VectorString& skill_list ///< The Skill names
+	) noexcept
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+
+	for(const auto& skill_name : skill_list)
+	{
+		for(const char c : skill_name)
+		{
+			hash ^= (uint8_t)c;
+			hash *= 0x100000001b3ULL;
+		}
+
+		hash *= 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+
+/**
+ * \brief Get the Attribute weights of a Skill.
+ *
+ * If the Yars::Skill::attribute_weight was not made from the current 
+ * Yars::Skill::attribute_contribution, the weights are calculated in to \p 
+ * stale.
+ *
+ * \return The Attribute weights
+ */
+const Yars::SkillWeight& Yars::skillWeight(const Yars::Skill& skill ///< The Skill
+	, Yars::SkillWeight& stale ///< Storage for calculated weights
+	) noexcept
+{
+	if(skill.attribute_weight != nullptr
+		&& skill.attribute_weight->contribution == skill.attribute_contribution
+		)
+	{
+		return *skill.attribute_weight;
+	}
+
+	Yars::skillWeightCalculate(skill.attribute_contribution, stale);
+
+	return stale;
+}
+
+
+/**
+ * \brief Calculate the Attribute weights of the contributions.
+ */
+void Yars::skillWeightCalculate(const Yars::MapStringInt32& contribution ///< The Attribute contributions
+	, Yars::SkillWeight& skill_weight ///< Where to put the weights
+	) noexcept
+{
+	skill_weight.contribution = contribution;
+	skill_weight.attribute.clear();
+	skill_weight.weight.clear();
+
+	skill_weight.attribute.reserve(contribution.size());
+	skill_weight.weight.reserve(contribution.size());
+
+	float contribution_total = 0;
+
+	for(const auto& iter : contribution)
+	{
+		contribution_total += iter.second;
+	}
+
+	for(const auto& iter : contribution)
+	{
+		const std::string& attribute_name      = iter.first;
+		const int32_t&     contribution_amount = iter.second;
+
+		skill_weight.attribute.push_back(attribute_name);
+		skill_weight.weight.push_back((contribution_total == 0)
+			? 0
+			: contribution_amount / contribution_total
+			);
+	}
+}
+
+// }}}
+// {{{ Item
+
+/**
+ * \todo{ExtendedData} Add data support, like what Character has
+ *
+ * \todo{InventoryRewrite} Re-evaluate the need for a "global" item list
+ * 
+ * \todo{InventoryRewrite} All items added to a character must have a unique Id
+ * 
+ * \todo{InventoryRewrite} Add "Policy" support.  Each policy would be 
+ * responsible for a single aspect of inventory management.  The following are 
+ * the currently planned "Policies"
+ * - Stacking
+ *   - Maximum count (global) is configurable
+ *   - Maximum count (per item) is configurable via ExtendedData
+ * - Weight
+ *   - Each Item is given an abstract weight via ExtendedData
+ *   - Maximum total weight is configurable
+ * - Packing 2D
+ *   - Each Item is given a cell-pattern which must fit onto a grid via 
+ *   ExtendedData
+ *
+ * \defgroup group_Item Item
+ *
+ * \brief Item
+ *
+ * Items are the most complicated aspect of \yars because they:
+ * - Provide modifiers to health, attributes, and skills when equipped
+ * - Can only be used with certain skills by an attacker
+ * - Can only be used with certain skills by a defender
+ *
+ * The fields of Item are:
+ *
+ * - \header{Item.count}
+ *   The number of items in the stack
+ *   <br><br>
+ * - \header{Item.affect_attribute}
+ * - \header{Item.affect_skill}
+ * - \header{Item.affect_health_current}
+ * - \header{Item.affect_health_maximum}
+ *   These values determine what an Affect will do when an Affect is created 
+ *   using this Item.
+ *   <br><br>
+ * - \header{Item.modify_attribute}
+ * - \header{Item.modify_skill}
+ * - \header{Item.modify_health_current}
+ * - \header{Item.modify_health_maximum}
+ *   When an Item is equipped, these values will be applied to the Character.
+ *   The modifiers will be removed once the Item is unequipped.
+ *   <br><br>
+ * - \header{Item.skill_attacker}
+ *   A list of Skills that allow the Item to be used.
+ *   <br><br>
+ * - \header{Item.skill_defender}
+ *   A list of Skills that allow the Item to be defended against.
+ *
+ * When an Item is added to a Character, it will just be in their inventory.
+ * However, when a Character equips an Item from their inventory, the 
+ * `modify_*` data will be applied to that Character.
+ *
+ * To use an Item, the Attacker must have a compatible Skill in 
+ * `skill_attacker`.  For a Character to defend against an Item, they must have 
+ * a compatible Skill in `skill_defender`.
+ *
+ * Affects created from Items will use the `affect_*` data items.
+ *
+ * Fortunately, all of this complication only applies to the creation of an 
+ * Item.  The \yars game mechanics will use the appropriate data in the Item 
+ * automatically.
+ *
+ * \anchor feature_InventoryRewrite
+ * \par The Inventory Rewrite
+ *
+ * All items will be located in the Yars class.  When an Item is added to a 
+ * character, that Item is actually copied in the Yars class and the character 
+ * is given a handle (the vector index) to the copied Item.  If the character 
+ * "restacks" the Items which results in Items no longer being valid, those 
+ * Item indexes will be returned to the Yars class
+ *
+ * Character Equipment Items will be kept separate from Inventory Items.
+ *
+ * The Item will be split into 4 parts, where each part is a separate vector.  
+ * A single index will be used by the 4 vectors to "combine/merge" the Item 
+ * into a cohesive whole.  The following named parts are grouped by access 
+ * patterns:
+ * - Data
+ *   - name
+ *   - custom data
+ * - Triggers
+ *   - skill_attacker
+ * - Affect Properties
+ *   - affect_attribute
+ *   - affect_skill
+ *   - affect_health_current
+ *   - affect_health_maximum
+ *   - skill_defender
+ * - Equipped Properties
+ *   - modify_attribute
+ *   - modify_skill
+ *   - modify_health_current
+ *   - modify_health_maximum
+ *
+ * \anchor feature_InventoryPolicy
+ * \par Inventory Policies
+ *
+ * Describe the intent of this feature.
+ */
+
+/**
+ * \ingroup group_Item
+ *
+ * \struct Yars::Item
+ *
+ * \brief Item data
+ */
+
+/**
+ * \var Yars::Item::affect_attribute
+ *
+ * \brief Attributes that will have an Affect.
+ *
+ * When an Affect is created, that Affect can modify the values of Attributes.  
+ * This container holds the Attribute name and how much it will modify a 
+ * Character's attribute.
+ */
+
+/**
+ * \var Yars::Item::affect_skill
+ *
+ * \brief Skills that will have an Affect.
+ *
+ * When an Affect is created, that Affect can modify the values of Skills.  
+ * This container holds the Skill name and how much it will modify a 
+ * Character's skill.
+ */
+
+/**
+ * \var Yars::Item::affect_health_current
+ *
+ * \brief The Affect on Health.
+ *
+ * An Affect created from an Item can change a Character's current health.  
+ * This value will be added to the Character's current health.
+ */
+
+/**
+ * \var Yars::Item::affect_health_maximum
+ *
+ * \brief The Affect on Health.
+ *
+ * An Affect created from an Item can change a Character's maximum health.  
+ * This value will be added to the Character's maximum health.
+ */
+
+/**
+ * \var Yars::Item::count
+ *
+ * \brief The number of items in the stack.
+ */
+
+/**
+ * \var Yars::Item::modify_attribute
+ *
+ * \brief Attribute changes when equipped.
+ *
+ * When an Item is equipped, it can change Attribute values.  This container 
+ * contains the names of the Attributes to modify and by how much.
+ */
+
+/**
+ * \var Yars::Item::modify_skill
+ *
+ * \brief Skill changes when equipped.
+ *
+ * When an Item is equipped, it can change Skill values.  This container 
+ * contains the names of the Skills to modify and by how much.
+ */
+
+/**
+ * \var Yars::Item::modify_health_current
+ *
+ * \brief Health changes when equipped.
+ *
+ * When an Item is equipped, this value will change current health value.  
+ */
+
+/**
+ * \var Yars::Item::modify_health_maximum
+ *
+ * \brief Health changes when equipped.
+ *
+ * When an Item is equipped, this value will change maximum health value.  
+ */
+
+/**
+ * \var Yars::Item::skill_attacker_set
+ *
+ * \brief The Yars::Item::skill_attacker as a set.
+ *
+ * \see Yars::itemSkillSetUpdate()
+ */
+
+/**
+ * \var Yars::Item::skill_defender_set
+ *
+ * \brief The Yars::Item::skill_defender as a set.
+ *
+ * \see Yars::itemSkillSetUpdate()
+ */
+
+/**
+ * \var Yars::Item::skill_attacker
+ *
+ * \brief Required skills to use this Item.
+ *
+ * In order for a Character to use this Item, they must have one of the Skills 
+ * in this list.  If not, they can't use this Item.
+ */
+
+/**
+ * \var Yars::Item::skill_defender
+ *
+ * \brief Required skills to defend against this Item.
+ *
+ * After an Affect has been created from this Item, a Character must have one 
+ * of the Skills in this list to be able to defend against the Affect.
+ */
+
+/**
+ * \ingroup group_Item
+ *
+ * \typedef Yars::VectorItem
+ *
+ * \brief A convenience type.
+ */
+
+/**
+ * \ingroup group_Item
+ *
+ * \typedef Yars::MapStringItem
+ *
+ * \brief A convenience type.
+ */
+
+/**
+ * \ingroup group_Item
+ *
+ * \typedef Yars::MultimapStringItem
+ *
+ * \brief A convenience type.
+ */
+
+/**
+ * \ingroup group_Item
+ *
+ * \typedef Yars::MapIdMapStringItem
+ *
+ * \brief A convenience type.
+ */
+
+/**
+ * \ingroup group_Item
+ *
+ * \typedef Yars::MapIdMultimapStringItem
+ *
+ * \brief A convenience type.
+ */
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::Item to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::Item& item ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	oss	<< "{ \"count\": "                 << std::to_string( item.count)
+		<< ", \"affect_attribute\": "      << Yars::to_string(item.affect_attribute)
+		<< ", \"affect_skill\": "          << Yars::to_string(item.affect_skill)
+		<< ", \"modify_attribute\": "      << Yars::to_string(item.modify_attribute)
+		<< ", \"modify_skill\": "          << Yars::to_string(item.modify_skill)
+		<< ", \"skill_attacker\": "        << Yars::to_string(item.skill_attacker)
+		<< ", \"skill_defender\": "        << Yars::to_string(item.skill_defender)
+		<< ", \"affect_health_current\": " << std::to_string( item.affect_health_current)
+		<< ", \"affect_health_maximum\": " << std::to_string( item.affect_health_maximum)
+		<< ", \"modify_health_current\": " << std::to_string( item.modify_health_current)
+		<< ", \"modify_health_maximum\": " << std::to_string( item.modify_health_maximum)
+		<< " }"
+		;
+	
+	return oss.str();
+}
+#endif
+
+
+#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
+/**
+ * \ingroup group_ToString
+ *
+ * \brief Yars::MapStringItem to JSON formatted string
+ *
+ * \return A JSON formatted string
+ */
+std::string Yars::to_string(const Yars::MapStringItem& item_map ///< Object to convert
+	) noexcept
+{
+	std::stringstream oss;
+
+	oss << "{";
+
+	bool first = true;
+	for(const auto& iter : item_map)
+	{
+		if(first == false)
+		{
+			oss << ",";
+		}
+
+		const std::string& name = iter.first;
+		const Yars::Item&  item = iter.second;
+
+		oss	<< " \""
+			<< name
+			<< "\": "
+			<< Yars::to_string(item)
+			;
+
+		first = false;
+	}
+
+	oss << " }";
+	
+	return oss.str();
+}
+#endif
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Item
+ *
+ * \brief Access an Item.
+ *
+ * Calling this method will provide access to an Item with a matching \p 
+ * item_name.
+ *
+ * A frozen catalog can not add a missing Item.  Without safe mode, asking a 
+ * frozen catalog for an unknown Item will terminate the program the same 
+ * way that the <code>const</code> version does.
+ *
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ * Yars::Item& item = yars.item("Item");
+ * \endexample
+ *
+ * \return A reference to an Item.
+ */
+Yars::Item& Yars::item(const std::string& item_name ///< The name of the Item
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(item_name.empty())
+		{
+			//ZAKERO_YARS_DEBUG << "Bad Name" << std::endl;
+			Item* retval = nullptr;
+			return *retval;
+		}
+
+		if(itemExists(item_name) == false)
+		{
+			//ZAKERO_YARS_DEBUG << "Already Exists" << std::endl;
+			Item* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	if(catalog_is_frozen)
+	{
+		return catalog_item.at(item_name);
+	}
+
+	return item_map[item_name];
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Item
+ *
+ * \brief Access an Item.
+ *
+ * Calling this method will provide access to an Item with a matching \p 
+ * item_name.
+ *
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ * const Yars& y = yars;
+ * const Yars::Item& item = y.item("Item");
+ * \endexample
+ *
+ * \return A reference to an Item.
+ */
+const Yars::Item& Yars::item(const std::string& item_name ///< The name of the Item
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(item_name.empty())
+		{
+			//ZAKERO_YARS_DEBUG << "Bad Name" << std::endl;
+			Item* retval = nullptr;
+			return *retval;
+		}
+
+		if(itemExists(item_name) == false)
+		{
+			//ZAKERO_YARS_DEBUG << "Already Exists" << std::endl;
+			Item* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	if(catalog_is_frozen)
+	{
+		return catalog_item.at(item_name);
+	}
+
+	return item_map.at(item_name);
+}
+
+
+/**
+ * \ingroup group_Item
+ *
+ * \brief Access an Item.
+ *
+ * Access an Item using a Name that was hashed at compile-time.
+ *
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ * const Yars& y = yars;
+ * const Yars::Item& item = y.item("Item"_yars);
+ * \endexample
+ *
+ * \return A reference to an Item.
+ */
+const Yars::Item& Yars::item(const Yars::Name& item_name ///< The name of the Item
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(itemFind(item_name) == nullptr)
+		{
+			Yars::Item* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	if(catalog_is_frozen)
+	{
+		return catalog_item.at(item_name);
+	}
+
+	return item_map.at(item_name);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Item
+ *
+ * \brief Add a new Item.
+ *
+ * Add a new Item.
+ *
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Foo", {});
+ * yars.itemAdd("Bar",
+ * 	{	.affect_attribute =
+ * 		{	{ "Attr_1", 1 }
+ * 		,	{ "Attr_2", 1 }
+ * 		}
+ * 	,	.affect_skill =
+ * 		{	{ "Skill_1", 1 }
+ * 		,	{ "Skill_2", 1 }
+ * 		}
+ * 	,	.modify_attribute =
+ * 		{	{ "Attr_1", 1 }
+ * 		,	{ "Attr_2", 1 }
+ * 		}
+ * 	,	.modify_skill =
+ * 		{	{ "Skill_1", 1 }
+ * 		,	{ "Skill_2", 1 }
+ * 		}
+ * 	,	.skill_attacker = { "Skill_1", "Skill_3" }
+ * 	,	.skill_defender = { "Skill_2", "Skill_4" }
+ *      ,	.count = 1
+ *      ,	.affect_health_current = -5
+ *      ,	.affect_health_maximum =  0
+ *      ,	.modify_health_current =  0
+ *      ,	.modify_health_maximum = 10
+ *      });
+ * \endexample
+ *
+ * \retval true  The Item was added
+ * \retval false Failed to add the Item
+ */
+bool Yars::itemAdd(const std::string& item_name ///< The name of the Item
+	, const Yars::Item& item                ///< The Item data
+	) noexcept
+{
+	if(catalog_is_frozen)
+	{
+		return false;
+	}
+
+	if(safeMode())
+	{
+		if(item_name.empty())
+		{
+			return false;
+		}
+
+		if(itemExists(item_name))
+		{
+			return false;
+		}
+	}
+
+	Yars::Item& new_item = item_map[item_name];
+
+	new_item = item;
+	itemSkillSetUpdate(new_item);
+
+	return true;
+}
+
+
+/**
+ * \ingroup group_Item
+ *
+ * \brief Update the Skill sets of an Item.
+ *
+ * The Yars::Item::skill_attacker_set and Yars::Item::skill_defender_set allow 
+ * checking if a Character can use an Item without looking-up each Skill name.
+ *
+ * Items added with itemAdd() are updated automatically.  If the 
+ * <code>skill_attacker</code> or <code>skill_defender</code> of an Item is 
+ * changed directly, this method should be called.  If a Skill name was 
+ * added, removed, or replaced and this method was not called, the Skill names 
+ * will be looked-up every time they are used.
+ *
+ * \example
+ * Yars::Item& item = yars.characterItem(bubba, "Item");
+ * item.skill_attacker.push_back("Skill");
+ * yars.itemSkillSetUpdate(item);
+ * \endexample
+ */
+void Yars::itemSkillSetUpdate(Yars::Item& item ///< The Item to update
+	) noexcept
+{
+	item.skill_attacker_set = skillSet(item.skill_attacker);
+	item.skill_defender_set = skillSet(item.skill_defender);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Item
+ *
+ * \brief Remove an Item.
+ *
+ * Remove an Item.  An Item that is used by a Loot table can not be removed, 
+ * remove the Loot table first.
+ *
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ * // Do stuff
+ * yars.itemRemove("Item");
+ * \endexample
+ *
+ * \retval true  The Item was removed
+ * \retval false Failed to remove the Item
+ */
+bool Yars::itemRemove(const std::string& item_name ///< The name of the Item
+	) noexcept
+{
+	if(catalog_is_frozen)
+	{
+		return false;
+	}
+
+	if(safeMode())
+	{
+		if(item_name.empty())
+		{
+			return false;
+		}
+
+		if(itemExists(item_name) == false)
+		{
+			return false;
+		}
+	}
+
+	for(const auto& [name, loot] : loot_map)
+	{
+		for(const Yars::LootEntry& entry : loot.entry)
+		{
+			if(entry.item == item_name)
+			{
+				return false;
+			}
+		}
+	}
+
+	item_map.erase(item_name);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Item
+ *
+ * \brief Check if an Item exists
+ *
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item");
+ * if(yars.itemExists("Item"))
+ * {
+ * 	std::cout << "Woot!\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Item was removed
+ * \retval false Failed to remove the Item
+ */
+bool Yars::itemExists(const std::string& item_name ///< The Item name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(item_name.empty())
+		{
+			return false;
+		}
+	}
+
+	return (itemFind(item_name) != nullptr);
+}
+
+
+/**
+ * \ingroup group_Item
+ *
+ * \brief Check if an Item exists
+ *
+ * \example
+ * if(yars.itemExists("Item"_yars))
+ * {
+ * 	std::cout << "Woot!\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Item exists
+ * \retval false The Item does not exist
+ */
+bool Yars::itemExists(const Yars::Name& item_name ///< The Item name
+	) const noexcept
+{
+	return (itemFind(item_name) != nullptr);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Item
+ *
+ * \brief Check if an Item is usable
+ *
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item");
+ * if(yars.itemExists("Item"))
+ * {
+ * 	std::cout << "Woot!\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Item was removed
+ * \retval false Failed to remove the Item
+ */
+bool Yars::itemIsUsable(const std::string& item_name ///< The Item name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(item_name.empty())
+		{
+			return false;
+		}
+
+		if(itemExists(item_name) == false)
+		{
+			return false;
+		}
+	}
+
+	const Yars::Item* item = itemFind(item_name);
+
+	if(item == nullptr)
+	{
+		return false;
+	}
+
+	bool is_usable = (item->skill_attacker.size() > 0)
+ 		|| (item->skill_defender.size() > 0)
+		;
+
+	return is_usable;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Item
+ *
+ * \brief Check if an attacker can use the Item
+ *
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ * if(yars.itemIsUsableByAttacker("Item") == false)
+ * {
+ * 	std::cout << "Its useless\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Item can be used by an attacker
+ * \retval false An attacker can not use the Item
+ */
+bool Yars::itemIsUsableByAttacker(const std::string& item_name ///< The Item name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(item_name.empty())
+		{
+			return false;
+		}
+
+		if(itemExists(item_name) == false)
+		{
+			return false;
+		}
+	}
+
+	const Yars::Item* item = itemFind(item_name);
+
+	if(item == nullptr)
+	{
+		return false;
+	}
+
+	bool is_usable = (item->skill_attacker.size() > 0);
+
+	return is_usable;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Item
+ *
+ * \brief Check if an defender can use the Item
+ *
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ * if(yars.itemIsUsableByDefender("Item") == false)
+ * {
+ * 	std::cout << "Its useless\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Item can be used by an defender
+ * \retval false An defender can not use the Item
+ */
+bool Yars::itemIsUsableByDefender(const std::string& item_name ///< The Item name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(item_name.empty())
+		{
+			return false;
+		}
+
+		if(itemExists(item_name) == false)
+		{
+			return false;
+		}
+	}
+
+	const Yars::Item* item = itemFind(item_name);
+
+	if(item == nullptr)
+	{
+		return false;
+	}
+
+	bool is_usable = (item->skill_defender.size() > 0);
+
+	return is_usable;
+}
+
+
+/**
+ * \ingroup group_Item
+ *
+ * \brief Get a list of Items
+ *
+ * This method will provide a list of all the Item names that are currently in 
+ * \yars.
+ *
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ * Yars::VectorString list = yars.itemList();
+ * \endexample
+ *
+ * \return A vector of Item names
+ */
+Yars::VectorString Yars::itemList() const noexcept
+{
+	if(catalog_is_frozen)
+	{
+		return Yars::mapKeyList(catalog_item);
+	}
+
+	return Yars::mapKeyList(item_map);
+}
+
+// }}}
+// {{{ Catalog
+
+/**
+ * \defgroup group_Catalog Catalog
+ *
+ * \brief A read-only snapshot of the Attributes, Skills, and Items.
+ *
+ * The Attributes, Skills, and Items are usually created once when the game 
+ * starts and then never change.  Calling catalogFreeze() moves all of them 
+ * into a FrozenMap, which finds any name with one hash and one key compare.
+ *
+ * While frozen, Yars::attributeAdd(), Yars::skillAdd(), Yars::skillRemove(), 
+ * Yars::itemAdd(), and Yars::itemRemove() will fail.  The values of the 
+ * existing Attributes, Skills, and Items can still be changed.  Use 
+ * catalogUnfreeze() to be able to add or remove them again.
+ *
+ * The non-const Yars::attribute(), Yars::skill(), and Yars::item() also can 
+ * not create an entry for an unknown name while frozen.  If unknown names are 
+ * possible, enable Yars::Config::safe_mode.
+ *
+ * Every name in a frozen catalog also has a CatalogIndex which can be used 
+ * to skip the name look-up entirely.  A CatalogIndex is only valid until the 
+ * catalog is unfrozen.
+ */
+
+/**
+ * \typedef Yars::CatalogIndex
+ *
+ * \brief The location of an entry in a frozen catalog.
+ */
+
+/**
+ * \var Yars::CatalogIndex_Invalid
+ *
+ * \brief The value of a CatalogIndex that does not refer to any entry.
+ */
+
+/**
+ * \typedef Yars::CatalogAttribute
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::CatalogSkill
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \typedef Yars::CatalogItem
+ *
+ * \brief A convenience type
+ */
+
+/**
+ * \ingroup group_Catalog
+ *
+ * \brief Freeze the catalog.
+ *
+ * All the Attributes, Skills, and Items are moved into the frozen catalog.  
+ * References to Attributes, Skills, and Items that were taken before calling 
+ * this method are no longer valid.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item", {});
+ * yars.catalogFreeze();
+ * \endexample
+ *
+ * If two names of the same kind have the same hash, the catalog can not be 
+ * frozen and is left as it was.
+ *
+ * \retval true  The catalog is frozen
+ * \retval false The catalog was already frozen or two names have the same 
+ * hash
+ */
+bool Yars::catalogFreeze() noexcept
+{
+	if(catalog_is_frozen)
+	{
+		return false;
+	}
+
+	if(catalog_attribute.build(attribute_map) == false)
+	{
+		return false;
+	}
+
+	if(catalog_skill.build(skill_map) == false)
+	{
+		catalog_attribute.release(attribute_map);
+
+		return false;
+	}
+
+	if(catalog_item.build(item_map) == false)
+	{
+		catalog_attribute.release(attribute_map);
+		catalog_skill.release(skill_map);
+
+		return false;
+	}
+
+	catalog_is_frozen = true;
+
+	return true;
+}
+
+
+/**
+ * \ingroup group_Catalog
+ *
+ * \brief Unfreeze the catalog.
+ *
+ * All the Attributes, Skills, and Items are moved out of the frozen catalog 
+ * so that they can be added and removed again.  All CatalogIndex values and 
+ * references that were taken while frozen are no longer valid.
+ *
+ * \example
+ * Yars yars;
+ * yars.catalogFreeze();
+ * yars.catalogUnfreeze();
+ * yars.skillAdd("Skill", {});
+ * \endexample
+ */
+void Yars::catalogUnfreeze() noexcept
+{
+	if(catalog_is_frozen == false)
+	{
+		return;
+	}
+
+	catalog_attribute.release(attribute_map);
+	catalog_skill.release(skill_map);
+	catalog_item.release(item_map);
+
+	catalog_is_frozen = false;
+}
+
+
+/**
+ * \ingroup group_Catalog
+ *
+ * \brief Check if the catalog is frozen.
+ *
+ * \retval true  The catalog is frozen
+ * \retval false The catalog is not frozen
+ */
+bool Yars::catalogIsFrozen() const noexcept
+{
+	return catalog_is_frozen;
+}
+
+
+/**
+ * \ingroup group_Catalog
+ *
+ * \brief Get an Attribute by its CatalogIndex.
+ *
+ * The catalog must be frozen and the \p index must be valid.
+ *
+ * \example
+ * Yars::CatalogIndex index = yars.catalogAttributeIndex("Attr");
+ * const Yars::Attribute& attr = yars.catalogAttribute(index);
+ * \endexample
+ *
+ * \return The Attribute.
+ */
+const Yars::Attribute& Yars::catalogAttribute(const Yars::CatalogIndex index ///< The CatalogIndex
+	) const noexcept
+{
+	return catalog_attribute.atIndex(index).second;
+}
+
+
+/**
+ * \ingroup group_Catalog
+ *
+ * \brief Get the CatalogIndex of an Attribute.
+ *
+ * \return The CatalogIndex or Yars::CatalogIndex_Invalid if the catalog is 
+ * not frozen or the Attribute does not exist.
+ */
+Yars::CatalogIndex Yars::catalogAttributeIndex(const std::string& attribute_name ///< The Attribute name
+	) const noexcept
+{
+	return Yars::catalogIndex(catalog_attribute, attribute_name);
+}
+
+
+/**
+ * \ingroup group_Catalog
+ *
+ * \brief Get a Skill by its CatalogIndex.
+ *
+ * The catalog must be frozen and the \p index must be valid.
+ *
+ * \example
+ * Yars::CatalogIndex index = yars.catalogSkillIndex("Skill");
+ * const Yars::Skill& skill = yars.catalogSkill(index);
+ * \endexample
+ *
+ * \return The Skill.
+ */
+const Yars::Skill& Yars::catalogSkill(const Yars::CatalogIndex index ///< The CatalogIndex
+	) const noexcept
+{
+	return catalog_skill.atIndex(index).second;
+}
+
+
+/**
+ * \ingroup group_Catalog
+ *
+ * \brief Get the CatalogIndex of a Skill.
+ *
+ * \return The CatalogIndex or Yars::CatalogIndex_Invalid if the catalog is 
+ * not frozen or the Skill does not exist.
+ */
+Yars::CatalogIndex Yars::catalogSkillIndex(const std::string& skill_name ///< The Skill name
+	) const noexcept
+{
+	return Yars::catalogIndex(catalog_skill, skill_name);
+}
+
+
+/**
+ * \ingroup group_Catalog
+ *
+ * \brief Get an Item by its CatalogIndex.
+ *
+ * The catalog must be frozen and the \p index must be valid.
+ *
+ * \example
+ * Yars::CatalogIndex index = yars.catalogItemIndex("Item");
+ * const Yars::Item& item = yars.catalogItem(index);
+ * \endexample
+ *
+ * \return The Item.
+ */
+const Yars::Item& Yars::catalogItem(const Yars::CatalogIndex index ///< The CatalogIndex
+	) const noexcept
+{
+	return catalog_item.atIndex(index).second;
+}
+
+
+/**
+ * \ingroup group_Catalog
+ *
+ * \brief Get the CatalogIndex of an Item.
+ *
+ * \return The CatalogIndex or Yars::CatalogIndex_Invalid if the catalog is 
+ * not frozen or the Item does not exist.
+ */
+Yars::CatalogIndex Yars::catalogItemIndex(const std::string& item_name ///< The Item name
+	) const noexcept
+{
+	return Yars::catalogIndex(catalog_item, item_name);
+}
+
+
+/**
+ * \brief Get the CatalogIndex of a name.
+ *
+ * \return The CatalogIndex or Yars::CatalogIndex_Invalid.
+ */
+template <typename Catalog>
+Yars::CatalogIndex Yars::catalogIndex(const Catalog& catalog ///< The catalog
+	, const std::string& name ///< The name
+	) noexcept
+{
+	const size_t index = catalog.indexOf(name);
+
+	if(index == catalog.size())
+	{
+		return Yars::CatalogIndex_Invalid;
+	}
+
+	return (Yars::CatalogIndex)index;
+}
+
+
+/**
+ * \brief Find an Attribute.
+ *
+ * Looks in the frozen catalog if it is frozen.
+ *
+ * \return A pointer to the Attribute or `nullptr`.
+ */
+template <typename K>
+Yars::Attribute* Yars::attributeFind(const K& attribute_name ///< The Attribute name
+	) noexcept
+{
+	return const_cast<Yars::Attribute*>(std::as_const(*this).attributeFind(attribute_name));
+}
+
+
+/**
+ * \brief Find an Attribute.
+ *
+ * Looks in the frozen catalog if it is frozen.
+ *
+ * \return A pointer to the Attribute or `nullptr`.
+ */
+template <typename K>
+const Yars::Attribute* Yars::attributeFind(const K& attribute_name ///< The Attribute name
+	) const noexcept
+{
+	if(catalog_is_frozen)
+	{
+		const auto iter = catalog_attribute.find(attribute_name);
+
+		return (iter == std::end(catalog_attribute)) ? nullptr : &iter->second;
+	}
+
+	const auto iter = attribute_map.find(attribute_name);
+
+	return (iter == std::end(attribute_map)) ? nullptr : &iter->second;
+}
+
+
+/**
+ * \brief Find a Skill.
+ *
+ * Looks in the frozen catalog if it is frozen.
+ *
+ * \return A pointer to the Skill or `nullptr`.
+ */
+template <typename K>
+Yars::Skill* Yars::skillFind(const K& skill_name ///< The Skill name
+	) noexcept
+{
+	return const_cast<Yars::Skill*>(std::as_const(*this).skillFind(skill_name));
+}
+
+
+/**
+ * \brief Find a Skill.
+ *
+ * Looks in the frozen catalog if it is frozen.
+ *
+ * \return A pointer to the Skill or `nullptr`.
+ */
+template <typename K>
+const Yars::Skill* Yars::skillFind(const K& skill_name ///< The Skill name
+	) const noexcept
+{
+	if(catalog_is_frozen)
+	{
+		const auto iter = catalog_skill.find(skill_name);
+
+		return (iter == std::end(catalog_skill)) ? nullptr : &iter->second;
+	}
+
+	const auto iter = skill_map.find(skill_name);
+
+	return (iter == std::end(skill_map)) ? nullptr : &iter->second;
+}
+
+
+/**
+ * \brief Find an Item.
+ *
+ * Looks in the frozen catalog if it is frozen.
+ *
+ * \return A pointer to the Item or `nullptr`.
+ */
+template <typename K>
+Yars::Item* Yars::itemFind(const K& item_name ///< The Item name
+	) noexcept
+{
+	return const_cast<Yars::Item*>(std::as_const(*this).itemFind(item_name));
+}
+
+
+/**
+ * \brief Find an Item.
+ *
+ * Looks in the frozen catalog if it is frozen.
+ *
+ * \return A pointer to the Item or `nullptr`.
+ */
+template <typename K>
+const Yars::Item* Yars::itemFind(const K& item_name ///< The Item name
+	) const noexcept
+{
+	if(catalog_is_frozen)
+	{
+		const auto iter = catalog_item.find(item_name);
+
+		return (iter == std::end(catalog_item)) ? nullptr : &iter->second;
+	}
+
+	const auto iter = item_map.find(item_name);
+
+	return (iter == std::end(item_map)) ? nullptr : &iter->second;
+}
+
+// }}}
+// {{{ Ledger
+
+/**
+ * \defgroup group_Ledger Ledger
+ *
+ * \brief Where modifiers come from.
+ *
+ * Equipment and Affects change the modifiers of a Character's Attributes, 
+ * Skills, and maximum Health.  Once applied, those modifiers are just numbers 
+ * and there is no way to know which Item or Affect was responsible for them.
+ *
+ * A Ledger keeps track of the contribution of every source.  The totals are 
+ * kept in integer arrays that are indexed by the \ref Yars::Handle "Handle" 
+ * of the Attribute or Skill, and every equipment location and Affect has a 
+ * LedgerEntry which records what it contributed.  Equipping an Item or 
+ * applying an Affect only updates the values that the Item or Affect 
+ * changes.
+ *
+ * Ledgers are optional and are enabled per-Character, see 
+ * Yars::characterLedgerEnable().
+ */
+
+/**
+ * \enum Yars::LedgerSource
+ *
+ * \brief The type of a source in the Ledger.
+ */
+
+/**
+ * \var Yars::LedgerSource::Equipment
+ *
+ * \brief An equipped Item.
+ */
+
+/**
+ * \var Yars::LedgerSource::Affect
+ *
+ * \brief An applied Affect.
+ */
+
+/**
+ * \struct Yars::LedgerModifier
+ *
+ * \brief A single modifier.
+ */
+
+/**
+ * \var Yars::LedgerModifier::handle
+ *
+ * \brief The Attribute or Skill Handle.
+ */
+
+/**
+ * \var Yars::LedgerModifier::amount
+ *
+ * \brief The modifier value.
+ */
+
+/**
+ * \typedef Yars::VectorLedgerModifier
+ *
+ * \brief A container.
+ */
+
+/**
+ * \struct Yars::LedgerEntry
+ *
+ * \brief The contribution of a single source.
+ */
+
+/**
+ * \var Yars::LedgerEntry::attribute
+ *
+ * \brief The Attribute modifiers.
+ */
+
+/**
+ * \var Yars::LedgerEntry::skill
+ *
+ * \brief The Skill modifiers.
+ */
+
+/**
+ * \var Yars::LedgerEntry::health_maximum
+ *
+ * \brief The maximum Health modifier.
+ */
+
+/**
+ * \typedef Yars::MapIdLedgerEntry
+ *
+ * \brief A container.
+ */
+
+/**
+ * \typedef Yars::MapStringLedgerEntry
+ *
+ * \brief A container.
+ */
+
+/**
+ * \struct Yars::Ledger
+ *
+ * \brief The modifiers of a Character and where they came from.
+ *
+ * The \p attribute and \p skill arrays are indexed by Handle.  A Handle that 
+ * is larger than the array has a total of `0`.
+ */
+
+/**
+ * \var Yars::Ledger::attribute
+ *
+ * \brief The total Attribute modifiers, indexed by Handle.
+ */
+
+/**
+ * \var Yars::Ledger::skill
+ *
+ * \brief The total Skill modifiers, indexed by Handle.
+ */
+
+/**
+ * \var Yars::Ledger::health_maximum
+ *
+ * \brief The total maximum Health modifier.
+ */
+
+/**
+ * \var Yars::Ledger::equipment
+ *
+ * \brief The contribution of each equipment location.
+ */
+
+/**
+ * \var Yars::Ledger::affect
+ *
+ * \brief The contribution of each Affect.
+ */
+
+/**
+ * \typedef Yars::MapIdLedger
+ *
+ * \brief A container.
+ */
+
+/**
+ * \struct Yars::LedgerContribution
+ *
+ * \brief How much a single source contributed.
+ *
+ * When the \p source is Yars::LedgerSource::Equipment, the \p location will 
+ * have the equipment location.  When the \p source is 
+ * Yars::LedgerSource::Affect, the \p affect_id will have the Affect Id.
+ */
+
+/**
+ * \var Yars::LedgerContribution::source
+ *
+ * \brief The source type.
+ */
+
+/**
+ * \var Yars::LedgerContribution::location
+ *
+ * \brief The equipment location.
+ */
+
+/**
+ * \var Yars::LedgerContribution::affect_id
+ *
+ * \brief The Affect Id.
+ */
+
+/**
+ * \var Yars::LedgerContribution::amount
+ *
+ * \brief The amount contributed.
+ */
+
+/**
+ * \typedef Yars::VectorLedgerContribution
+ *
+ * \brief A container.
+ */
+
+/**
+ * \brief Add or subtract a LedgerEntry.
+ *
+ * All the modifiers in the \p entry are multiplied by the \p sign and then 
+ * added to the totals in the \p ledger.  The total arrays will grow as needed.
+ */
+void Yars::ledgerAdjust(Yars::Ledger& ledger ///< The Ledger to update
+	, const Yars::LedgerEntry& entry ///< The source contribution
+	, const int32_t            sign  ///< `+1` to add, `-1` to subtract
+	) noexcept
+{
+	for(const Yars::LedgerModifier& modifier : entry.attribute)
+	{
+		if(modifier.handle >= ledger.attribute.size())
+		{
+			ledger.attribute.resize(modifier.handle + 1, 0);
+		}
+
+		ledger.attribute[modifier.handle] += sign * modifier.amount;
+	}
+
+	for(const Yars::LedgerModifier& modifier : entry.skill)
+	{
+		if(modifier.handle >= ledger.skill.size())
+		{
+			ledger.skill.resize(modifier.handle + 1, 0);
+		}
+
+		ledger.skill[modifier.handle] += sign * modifier.amount;
+	}
+
+	ledger.health_maximum += sign * entry.health_maximum;
+}
+
+
+/**
+ * \brief Create a LedgerEntry.
+ *
+ * The Attribute and Skill names will be converted into Handles.
+ *
+ * \return The LedgerEntry.
+ */
+Yars::LedgerEntry Yars::ledgerEntry(const Yars::MapStringModifier& attribute ///< The Attribute modifiers
+	, const Yars::MapStringModifier& skill          ///< The Skill modifiers
+	, const int32_t                  health_maximum ///< The maximum Health modifier
+	) noexcept
+{
+	Yars::LedgerEntry entry =
+	{	.attribute      = {}
+	,	.skill          = {}
+	,	.health_maximum = health_maximum
+	};
+
+	entry.attribute.reserve(attribute.size());
+	for(const auto& iter : attribute)
+	{
+		const Yars::Handle handle = Yars::handleIntern(attribute_handle
+			, attribute_handle_name
+			, iter.first
+			);
+
+		entry.attribute.push_back({handle, iter.second});
+	}
+
+	entry.skill.reserve(skill.size());
+	for(const auto& iter : skill)
+	{
+		const Yars::Handle handle = Yars::handleIntern(skill_handle
+			, skill_handle_name
+			, iter.first
+			);
+
+		entry.skill.push_back({handle, iter.second});
+	}
+
+	return entry;
+}
+
+
+/**
+ * \brief Collect the contributions to a single Handle.
+ *
+ * The \p modifier_list selects which modifiers of each LedgerEntry will be 
+ * searched, either LedgerEntry::attribute or LedgerEntry::skill.
+ *
+ * \return A list of contributions.
+ */
+Yars::VectorLedgerContribution Yars::ledgerContributionList(const Yars::Ledger& ledger ///< The Ledger
+	, Yars::VectorLedgerModifier Yars::LedgerEntry::* modifier_list ///< The modifiers to search
+	, const Yars::Handle                              handle        ///< The Handle
+	) noexcept
+{
+	Yars::VectorLedgerContribution retval;
+
+	if(handle == Yars::Handle_Invalid)
+	{
+		return retval;
+	}
+
+	auto find = [&](const Yars::LedgerEntry& entry) -> const Yars::LedgerModifier*
+	{
+		for(const Yars::LedgerModifier& modifier : entry.*modifier_list)
+		{
+			if(modifier.handle == handle)
+			{
+				return &modifier;
+			}
+		}
+
+		return nullptr;
+	};
+
+	for(const auto& iter : ledger.equipment)
+	{
+		const Yars::LedgerModifier* modifier = find(iter.second);
+
+		if(modifier != nullptr)
+		{
+			retval.push_back(
+				{	.source    = Yars::LedgerSource::Equipment
+				,	.location  = iter.first
+				,	.affect_id = 0
+				,	.amount    = modifier->amount
+				});
+		}
+	}
+
+	for(const auto& iter : ledger.affect)
+	{
+		const Yars::LedgerModifier* modifier = find(iter.second);
+
+		if(modifier != nullptr)
+		{
+			retval.push_back(
+				{	.source    = Yars::LedgerSource::Affect
+				,	.location  = {}
+				,	.affect_id = iter.first
+				,	.amount    = modifier->amount
+				});
+		}
+	}
+
+	return retval;
+}
+
+// }}}
+// {{{ Modifier Cache
+
+/**
+ * \defgroup group_ModifierCache Modifier Cache
+ *
+ * \brief Remember the results of Yars::calculateModifier().
+ *
+ * Calculating the modifier of a Skill has to look at every Attribute that 
+ * contributes to that Skill.  In a simulation, the same Character will often 
+ * use the same Skills many times before any of its Attributes or Skills 
+ * change, so the same modifier gets calculated over and over again.
+ *
+ * The Modifier Cache stores the result of Yars::calculateModifier() for each 
+ * Skill, indexed by the \ref Yars::Handle "Handle" of the Skill.  Every 
+ * cache has a generation number and each stored result remembers the 
+ * generation that it was calculated in.  When a Character's Attributes or 
+ * Skills may have changed, the generation is increased and all the stored 
+ * results become stale without having to touch them.
+ *
+ * The Modifier Cache is optional and is enabled per-Character, see 
+ * Yars::characterModifierCacheEnable().
+ *
+ * The cache is invalidated by the methods that change a Character's Levels, 
+ * such as Yars::characterLevelIncrease(), Yars::characterSkillIncrease(), 
+ * Yars::characterSkillAdd(), equipping Items, and applying Affects.
+ *
+ * \note Using the non-const version of Yars::characterAttribute(), 
+ * Yars::characterSkill(), or their Map variants will invalidate the 
+ * Character's cache because the returned reference could be used to change 
+ * the data.  Read the data from a `const Yars&` to keep the cache valid.
+ */
+
+/**
+ * \struct Yars::ModifierCacheEntry
+ *
+ * \brief A single stored modifier.
+ */
+
+/**
+ * \var Yars::ModifierCacheEntry::generation
+ *
+ * \brief The generation of the cache when the modifier was calculated.
+ */
+
+/**
+ * \var Yars::ModifierCacheEntry::modifier
+ *
+ * \brief The modifier.
+ */
+
+/**
+ * \struct Yars::ModifierCache
+ *
+ * \brief A Character's stored modifiers.
+ */
+
+/**
+ * \var Yars::ModifierCache::entry
+ *
+ * \brief The modifiers, indexed by the Skill Handle.
+ */
+
+/**
+ * \var Yars::ModifierCache::generation
+ *
+ * \brief The current generation of the cache.
+ */
+
+/**
+ * \struct Yars::ModifierCacheStats
+ *
+ * \brief How well the Modifier Cache is working.
+ */
+
+/**
+ * \var Yars::ModifierCacheStats::hit
+ *
+ * \brief The number of modifiers that were found in a cache.
+ */
+
+/**
+ * \var Yars::ModifierCacheStats::miss
+ *
+ * \brief The number of modifiers that had to be calculated.
+ */
+
+/**
+ * \var Yars::ModifierCacheStats::invalidate
+ *
+ * \brief The number of times that a cache was invalidated.
+ */
+
+/**
+ * \ingroup group_ModifierCache
+ *
+ * \brief Invalidate every Character's Modifier Cache.
+ *
+ * This is useful after making changes that the Modifier Cache can not see, 
+ * such as writing to references that were acquired earlier.  No memory is 
+ * touched, all the stored modifiers simply become stale.
+ *
+ * \example
+ * yars.modifierCacheInvalidate();
+ * \endexample
+ */
+void Yars::modifierCacheInvalidate() noexcept
+{
+	modifier_cache_floor = modifier_cache_generation;
+
+	modifier_cache_stats.invalidate++;
+}
+
+
+/**
+ * \ingroup group_ModifierCache
+ *
+ * \brief Get the Modifier Cache statistics.
+ *
+ * The statistics include every Character that has the Modifier Cache 
+ * enabled.
+ *
+ * \example
+ * const Yars::ModifierCacheStats& stats = yars.modifierCacheStats();
+ * float hit_rate = float(stats.hit) / float(stats.hit + stats.miss);
+ * \endexample
+ *
+ * \return The statistics.
+ */
+const Yars::ModifierCacheStats& Yars::modifierCacheStats() const noexcept
+{
+	return modifier_cache_stats;
+}
+
+
+/**
+ * \ingroup group_ModifierCache
+ *
+ * \brief Reset the Modifier Cache statistics.
+ *
+ * \example
+ * yars.modifierCacheStatsReset();
+ * \endexample
+ */
+void Yars::modifierCacheStatsReset() noexcept
+{
+	modifier_cache_stats = {};
+}
+
+
+/**
+ * \brief Calculate a modifier using the Modifier Cache.
+ *
+ * If the Character does not have a Modifier Cache or the Skill does not have 
+ * a Handle, the modifier will be calculated without the cache.
+ *
+ * \return The modifier
+ */
+template <typename K>
+float Yars::modifierCacheCalculate(const Yars::Id character_id ///< The Character Id
+	, const K& skill_name ///< The Skill name
+	) const noexcept
+{
+	const auto cache = modifier_cache.find(character_id);
+
+	if(cache == std::end(modifier_cache))
+	{
+		return calculateModifierSkill(character_id, characterSkill(character_id, skill_name));
+	}
+
+	const auto handle = skill_handle.find(skill_name);
+
+	if(handle == std::end(skill_handle))
+	{
+		return calculateModifierSkill(character_id, characterSkill(character_id, skill_name));
+	}
+
+	Yars::ModifierCache& modifier = cache->second;
+
+	if(modifier.generation <= modifier_cache_floor)
+	{
+		modifier.generation = ++modifier_cache_generation;
+	}
+
+	if(handle->second >= modifier.entry.size())
+	{
+		modifier.entry.resize(handle->second + 1);
+	}
+
+	Yars::ModifierCacheEntry& entry = modifier.entry[handle->second];
+
+	if(entry.generation == modifier.generation)
+	{
+		modifier_cache_stats.hit++;
+
+		return entry.modifier;
+	}
+
+	modifier_cache_stats.miss++;
+
+	entry.generation = modifier.generation;
+	entry.modifier   = calculateModifierSkill(character_id, characterSkill(character_id, skill_name));
+
+	return entry.modifier;
+}
+
+// }}}
+// {{{ Layer
+
+/**
+ * \defgroup group_Layer Layer
+ *
+ * \brief Modifiers that are shared by many Characters.
+ *
+ * A Layer is a collection of Attribute and Skill modifiers, like an Affect, 
+ * that is applied to a group of Characters.  Characters are put in to a 
+ * group with Yars::characterLayerAdd().  A Layer that is global, see 
+ * Yars::Layer::is_global, applies to every Character.
+ *
+ * Adding or removing a Layer only updates the Characters that the Layer 
+ * affects: every Character for a global Layer, otherwise only the Characters 
+ * in the group.  Each of those Characters has its Level modifiers updated 
+ * with the difference between what the Layers want and what was already 
+ * applied.  The modifiers are applied right away so that reading a Character 
+ * from a `const Yars&` never has to change it.
+ *
+ * \note Layers are not applied lazily.  Adding or removing a Layer visits 
+ * every Character, so the cost grows with the population: a global Layer 
+ * changes the Levels of every Character, and a group Layer still has to look 
+ * at every Character to find the ones in the group.  This is the same order 
+ * of work as applying an Affect to every Character, but it is done in one 
+ * call and is undone by removing the Layer.  Add and remove Layers between 
+ * ticks instead of inside one.
+ *
+ * The Layer modifiers are only applied to the Attributes and Skills that a 
+ * Character has, a Layer will not add an Attribute or Skill to a Character.
+ *
+ * \note Layer modifiers are not recorded in the \ref group_CharacterLedger
+ * "Ledger".
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Craft.Smith", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Craft.Smith");
+ *
+ * // Server-wide event
+ * yars.layerAdd("Event.Crafting",
+ * 	{	.modify_skill = { { "Craft.Smith", 2 } }
+ * 	,	.is_global    = true
+ * 	});
+ *
+ * // Only the Characters in the Forge zone
+ * yars.layerAdd("Zone.Forge", { .modify_skill = { { "Craft.Smith", 1 } } });
+ * yars.characterLayerAdd(bubba, "Zone.Forge");
+ *
+ * // Event is over
+ * yars.layerRemove("Event.Crafting");
+ * \endexample
+ */
+
+/**
+ * \struct Yars::Layer
+ *
+ * \brief Modifiers for a group of Characters.
+ */
+
+/**
+ * \var Yars::Layer::modify_attribute
+ *
+ * \brief Attribute modifiers.
+ */
+
+/**
+ * \var Yars::Layer::modify_skill
+ *
+ * \brief Skill modifiers.
+ */
+
+/**
+ * \var Yars::Layer::is_global
+ *
+ * \brief Apply to all Characters.
+ *
+ * When `true`, the Layer will apply to every Character.  When `false`, the 
+ * Layer will only apply to the Characters that have been added to the Layer 
+ * with Yars::characterLayerAdd().
+ */
+
+/**
+ * \typedef Yars::MapStringLayer
+ *
+ * \brief A convenience type.
+ */
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Layer
+ *
+ * \brief Access a Layer.
+ *
+ * \example
+ * Yars yars;
+ * yars.layerAdd("Layer", {});
+ * const Yars::Layer& layer = yars.layer("Layer");
+ * \endexample
+ *
+ * \return A reference to the Layer.
+ */
+const Yars::Layer& Yars::layer(const std::string& layer_name ///< The Layer name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(layerExists(layer_name) == false)
+		{
+			Yars::Layer* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	return layer_map.at(layer_name);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Layer
+ *
+ * \brief Add a Layer.
+ *
+ * The Layer's modifiers are applied to the Characters that it affects.  To 
+ * change a Layer, remove it and add it again.
+ *
+ * This visits every Character, see \ref group_Layer.
+ *
+ * \example
+ * Yars yars;
+ * yars.layerAdd("Event",
+ * 	{	.modify_skill = { { "Skill", 2 } }
+ * 	,	.is_global    = true
+ * 	});
+ * \endexample
+ *
+ * \retval true  The Layer was added
+ * \retval false Failed to add the Layer
+ */
+bool Yars::layerAdd(const std::string& layer_name ///< The Layer name
+	, const Yars::Layer& layer ///< The Layer data
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(layer_name.empty())
+		{
+			return false;
+		}
+
+		if(layerExists(layer_name))
+		{
+			return false;
+		}
+	}
+
+	layer_map[layer_name] = layer;
+
+	characterLayerSyncAll(layer_name, layer.is_global);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ *
+ * \ingroup group_Layer
+ *
+ * \brief Check if a Layer exists.
+ *
+ * \example
+ * if(yars.layerExists("Layer"))
+ * {
+ * 	std::cout << "Layer found\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Layer exists
+ * \retval false The Layer does not exist
+ */
+bool Yars::layerExists(const std::string& layer_name ///< The Layer name
+	) const noexcept
+{
+	return layer_map.contains(layer_name);
+}
+
+
+/**
+ * \ingroup group_Layer
+ *
+ * \brief Get a list of Layer names.
+ *
+ * \example
+ * Yars::VectorString list = yars.layerList();
+ * \endexample
+ *
+ * \return A vector of Layer names.
+ */
+Yars::VectorString Yars::layerList() const noexcept
+{
+	return Yars::mapKeyList(layer_map);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Layer
+ *
+ * \brief Remove a Layer.
+ *
+ * The Layer's modifiers are removed from the Characters that it affected.  
+ * Characters that were added to the Layer stay in the group, so adding the 
+ * Layer again will apply to them.
+ *
+ * This visits every Character, see \ref group_Layer.
+ *
+ * \example
+ * Yars yars;
+ * yars.layerAdd("Layer", {});
+ * // Do stuff
+ * yars.layerRemove("Layer");
+ * \endexample
+ *
+ * \retval true  The Layer was removed
+ * \retval false Failed to remove the Layer
+ */
+bool Yars::layerRemove(const std::string& layer_name ///< The Layer name
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(layerExists(layer_name) == false)
+		{
+			return false;
+		}
+	}
+
+	const bool is_global = layer_map[layer_name].is_global;
+
+	layer_map.erase(layer_name);
+
+	characterLayerSyncAll(layer_name, is_global);
+
+	return true;
+}
+
+// }}}
+// {{{ Character
+
+/**
+ * \defgroup group_Character Character
+ * 
+ * \brief A Character
+ *
+ * A character in \yars is more than just a PC (Player Character) or a NPC 
+ * (Non-Player Character).  Anything that can be interacted with is considered 
+ * a Character.
+ *
+ * In addition to having a collection of Items and Skill, a Character has 
+ * Health to track it physical state.  Characters also have support for 
+ * free-form data that can be added and changed when ever necessary to enable 
+ * the Character be used in unforeseen ways.
+ *
+ * An example would be a PC attempting to lock-pick a safe. The PC interacts 
+ * with the lock with a lock-pick skill. It is this interaction that makes the 
+ * `lock` is a Character (a "Lock Character"). The "Lock Character" could have 
+ * addition information such as the "Make and Model" or "Is Broken". As Once 
+ * the "Lock Character" has been defeated by the PC, the PC can "trade" with 
+ * the "Safe Character" to get the Items.
+ *
+ * Since Characters can do many things, this section has the largest 
+ * collections of methods in all of \yars.
+ */
+
+/**
+ * \deprecated{InventoryPolicy}
+ *
+ * \struct Yars::CharacterConfig
+ *
+ * \brief Configuration data for each Character
+ *
+ * The data in this structure will be replaced by the future Inventory Policy 
+ * objects.
+ */
+
+/**
+ * \deprecated{InventoryPolicy}
+ *
+ * \typedef Yars::MapIdCharacterConfig
+ *
+ * \brief A container.
+ */
+
+/**
+ * \struct Yars::CharacterItem
+ *
+ * \brief All the Items of one type that a Character has.
+ *
+ * A Character's inventory has one CharacterItem for each Item name.  The 
+ * Items are kept in a contiguous array of stacks and the total number of 
+ * Items in all the stacks is cached so that it does not need to be counted 
+ * every time it is requested.
+ *
+ * The order of the stacks is guaranteed: new stacks are always appended to 
+ * the end, Items are always added to the first stack that is not full, and 
+ * Items are always removed from the last stack.  This means that the index of 
+ * a stack will not change until that stack, or a stack before it, has been 
+ * removed.
+ */
+
+/**
+ * \var Yars::CharacterItem::stack
+ *
+ * \brief The Item stacks.
+ */
+
+/**
+ * \var Yars::CharacterItem::count
+ *
+ * \brief The total number of Items in all the stacks.
+ */
+
+/**
+ * \typedef Yars::MapStringCharacterItem
+ *
+ * \brief A container.
+ */
+
+/**
+ * \typedef Yars::MapIdMapStringCharacterItem
+ *
+ * \brief A container.
+ */
+
+// {{{ Character: Util
+
+/**
+ * \ingroup group_Character
+ *
+ * \brief Create a new Character
+ *
+ * Create a new Character.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * \endexample
+ *
+ * \return A Character ID
+ */
+Yars::Id Yars::characterCreate() noexcept
+{
+	const Yars::Id character_id = characterIdNext();
+
+	characterClear(character_id);
+
+	return character_id;
+}
+
+
+/**
+ * \brief Allocate a Character Id.
+ *
+ * \return The Character Id
+ */
+Yars::Id Yars::characterIdNext() noexcept
+{
+	Yars::Id character_id;
+
+	if(character_pool.empty())
+	{
+		character_id = this->character_id_max;
+		this->character_id_max++;
+
+		character_health.resize(character_id_max);
+	}
+	else
+	{
+		if(yars_config.id_shuffle)
+		{
+			std::random_shuffle(std::begin(character_pool)
+				, std::end(character_pool)
+				);
+		}
+
+		character_id = character_pool.back();
+		character_pool.pop_back();
+	}
+
+	return character_id;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Character
+ *
+ * \brief Delete a Character
+ *
+ * Delete the request Character.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * // Do stuff
+ * yars.characterDelete(bubba);
+ * \endexample
+ *
+ * \retval true  The Character was deleted
+ * \retval false Failed to delete the Character
+ */
+bool Yars::characterDelete(const Yars::Id character_id ///< The Character Id
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	if(yars_config.clear_on_delete)
+	{
+		characterClear(character_id);
+	}
+
+	itemOwnerCharacterRemove(character_id);
+
+	actionCharacterChanged(character_id);
+	indexCharacterChanged(character_id);
+
+	character_pool.push_back(character_id);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_Character
+ *
+ * \brief Check if a Character exists
+ *
+ * Check if a Character exists with the provided Id.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * if(yars.characterExists(bubba))
+ * {
+ * 	std::cout << "Hey, I found Bubba!\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Character was found
+ * \retval false The Character does not exists
+ */
+bool Yars::characterExists(const Yars::Id character_id ///< The Character Id
+	) const noexcept
+{
+	if(character_id >= this->character_id_max)
+	{
+		return false;
+	}
+
+	return (Yars::vectorContains(character_pool, character_id) == false);
+}
+
+
+/**
+ * \ingroup group_Character
+ *
+ * \brief Delete Character data
+ *
+ * All data associated with the specified Character Id is cleared.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterClear(bubba);
+ * \endexample
+ */
+void Yars::characterClear(const Yars::Id& character_id ///< The Character Id
+	) noexcept
+{
+	if(character_affect.contains(character_id))
+	{
+		character_affect.erase(character_id);
+	}
+
+	itemOwnerCharacterRemove(character_id);
+
+	character_attribute.assign(character_id,      Yars::MapStringAttribute{});
+	character_data.assign(character_id,           Yars::VectorCharacterData{});
+	character_equipment_item.assign(character_id, Yars::MapStringItem{});
+	character_item.assign(character_id,           Yars::MapStringCharacterItem{});
+	character_skill.assign(character_id,          Yars::MapStringSkill{});
+
+	character_config[character_id]         = {};
+	character_equipment_name[character_id] = {};
+	character_health[character_id]         = {};
+
+	character_skill_set[character_id] = {};
+	character_layer[character_id]     = {};
+
+	character_ledger.erase(character_id);
+	modifier_cache.erase(character_id);
+
+	actionCharacterChanged(character_id);
+	indexCharacterChanged(character_id);
+	action_skill_generation++;
+}
+
+
+/**
+ * \deprecated{InventoryPolicy}
+ *
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Character
+ *
+ * \brief Change the staking value
+ *
+ * Control the maximum number of Item that can be stacked.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterConfigItemStackMax(bubba, 10);
+ * \endexample
+ *
+ * \retval true  Configuration has been updated
+ * \retval false Failed to update the configuration
+ */
+bool Yars::characterConfigItemStackMax(const Yars::Id character_id ///< The Character Id
+	, const uint32_t item_stack_max ///< New stack max value
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+
+		if(item_stack_max == 0)
+		{
+			return false;
+		}
+	}
+
+	character_config[character_id].item_stack_max = item_stack_max;
+
+	return true;
+}
+
+// }}}
+// {{{ Character: Health
+
+/**
+ * \ingroup group_Character
+ *
+ * \defgroup group_CharacterHealth Health
+ *
+ * \brief A Character's Health.
+ *
+ * Every Character has Health.  The following methods allow you to access the 
+ * Health object.
+ *
+ * \see \ref group_Health
+ */
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterHealth
+ *
+ * \brief Get the Character's Health
+ *
+ * Access the Health data of a Character.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * Yars::Health& health = yars.characterHealth(bubba);
+ * \endexample
+ *
+ * \return The Character's Health
+ */
+Yars::Health& Yars::characterHealth(const Yars::Id character_id ///< The Character Id
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			Yars::Health* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	indexChanged(telemetry_health, character_id);
+
+	return character_health[character_id];
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterHealth
+ *
+ * \brief Get the Character's Health
+ *
+ * Access the Health data of a Character.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ *
+ * const Yars& y = yars;
+ * const Yars::Health& health = y.characterHealth(bubba);
+ * \endexample
+ *
+ * \return The Character's Health
+ */
+const Yars::Health& Yars::characterHealth(const Yars::Id character_id ///< The Character Id
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			Yars::Health* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	return character_health.at(character_id);
+}
+
+// }}}
+// {{{ Character: Attribute
+
+/**
+ * \ingroup group_Character
+ *
+ * \defgroup group_CharacterAttribute Attribute
+ *
+ * \brief A Character's Attributes.
+ *
+ * A Character has no control over the Attributes that they have but Attribute 
+ * can have an affect on everything they do.  Attributes are acquired as Skills 
+ * are learned.  And even if a Skill is lost to the Character, the Attributes 
+ * from that Skill will remain.
+ *
+ * This group of methods allow you to access the Health object.
+ *
+ * \see \ref group_Attribute
+ */
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterAttribute
+ *
+ * \brief Access an Attribute
+ *
+ * Provides a way to access a Character's Attribute.  The returned reference can 
+ * change the Attribute, so the Character's Levels are treated as changed, see 
+ * Yars::characterLevelChanged().  Use a `const Yars&` to only read the Attribute.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill",
+ * 	{	.attribute_contribution =
+ * 		{	{ "Attr_1", 1 }
+ * 		,	{ "Attr_2", 1 }
+ * 		}
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ *
+ * Yars::Attribute& attribute = yars.characterAttribute(bubba, "Attr_1");
+ * \endexample
+ *
+ * \return A reference to an Attribute
+ */
+Yars::Attribute& Yars::characterAttribute(const Yars::Id character_id ///< The Character Id
+	, const std::string& attribute_name ///< The Attribute Name
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			Yars::Attribute* retval = nullptr;
+			return *retval;
+		}
+
+		if(characterAttributeExists(character_id, attribute_name) == false)
+		{
+			Yars::Attribute* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	characterLevelChanged(character_id);
+	characterLayerSync(character_id);
+
+	return character_attribute[character_id][attribute_name];
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterAttribute
+ *
+ * \brief Access an Attribute
+ *
+ * Provides a way to access a Character's Attribute.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill",
+ * 	{	.attribute_contribution =
+ * 		{	{ "Attr_1", 1 }
+ * 		,	{ "Attr_2", 1 }
+ * 		}
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ *
+ * const Yars& y = yars;
+ * const Yars::Attribute& attribute = y.characterAttribute(bubba, "Attr_1");
+ * \endexample
+ *
+ * \return A reference to an Attribute
+ */
+const Yars::Attribute& Yars::characterAttribute(const Yars::Id character_id ///< The Character Id
+	, const std::string& attribute_name ///< The Attribute Name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			Yars::Attribute* retval = nullptr;
+			return *retval;
+		}
+
+		if(characterAttributeExists(character_id, attribute_name) == false)
+		{
+			Yars::Attribute* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	return character_attribute.at(character_id).at(attribute_name);
+}
+
+
+/**
+ * \ingroup group_CharacterAttribute
+ *
+ * \brief Access an Attribute
+ *
+ * Provides a way to access a Character's Attribute using a Name that was 
+ * hashed at compile-time.  Unlike the `std::string` version, the Attribute 
+ * will not be created if the Character does not have it.
+ *
+ * \example
+ * Yars::Attribute& attribute = yars.characterAttribute(bubba, "Attr_1"_yars);
+ * \endexample
+ *
+ * \return A reference to an Attribute
+ */
+Yars::Attribute& Yars::characterAttribute(const Yars::Id character_id ///< The Character Id
+	, const Yars::Name& attribute_name ///< The Attribute Name
+	) noexcept
+{
+	characterLevelChanged(character_id);
+
+	return const_cast<Yars::Attribute&>(std::as_const(*this).characterAttribute(character_id, attribute_name));
+}
+
+
+/**
+ * \ingroup group_CharacterAttribute
+ *
+ * \brief Access an Attribute
+ *
+ * Provides a way to access a Character's Attribute using a Name that was 
+ * hashed at compile-time.
+ *
+ * \example
+ * const Yars& y = yars;
+ * const Yars::Attribute& attribute = y.characterAttribute(bubba, "Attr_1"_yars);
+ * \endexample
+ *
+ * \return A reference to an Attribute
+ */
+const Yars::Attribute& Yars::characterAttribute(const Yars::Id character_id ///< The Character Id
+	, const Yars::Name& attribute_name ///< The Attribute Name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterAttributeExists(character_id, attribute_name) == false)
+		{
+			Yars::Attribute* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	return character_attribute.at(character_id).at(attribute_name);
+}
+
+
+/**
+ * \ingroup group_CharacterAttribute
+ *
+ * \brief Add an Attribute to a Character.
+ *
+ * Adds an Attribute to a Character if it does not already exists.
+ *
+ * \example
+ * Yars yars;
+ * yars.attributeAdd("Attribute");
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterAttributeAdd(bubba, "Attribute");
+ * \endexample
+ */
+void Yars::characterAttributeAdd(const Yars::Id character_id ///< The Character Id
+	, const std::string& attribute_name ///< The Attribute Name
+	) noexcept
+{
+	if(characterAttributeExists(character_id, attribute_name))
+	{
+		return;
+	}
+
+	characterLevelChanged(character_id);
+
+	if(catalog_is_frozen)
+	{
+		const Yars::Attribute* attribute = attributeFind(attribute_name);
+
+		character_attribute[character_id][attribute_name] = (attribute == nullptr)
+			? Yars::Attribute{}
+			: *attribute
+			;
+	}
+	else
+	{
+		character_attribute[character_id][attribute_name] = attribute_map[attribute_name];
+	}
+
+	characterLayerReset(character_id, &Yars::CharacterLayer::attribute, attribute_name);
+
+	return;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterAttribute
+ *
+ * \brief Check if a Character has an Attribute
+ *
+ * Check if a Character has an Attribute
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill",
+ * 	{	.attribute_contribution =
+ * 		{	{ "Attr_1", 1 }
+ * 		,	{ "Attr_2", 1 }
+ * 		}
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ *
+ * if(yars.characterAttributeExists(bubba, "Attr_1"))
+ * {
+ * 	std::cout << "Bubba has Attr_1\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Character does have the Attribute.
+ * \retval false The Character does not have the Attribute.
+ */
+bool Yars::characterAttributeExists(const Yars::Id character_id ///< The Character Id
+	, const std::string& attribute_name ///< The Attribute Name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	const auto& attribute_map = character_attribute.at(character_id);
+
+	return attribute_map.contains(attribute_name);
+}
+
+
+/**
+ * \ingroup group_CharacterAttribute
+ *
+ * \brief Check if a Character has an Attribute
+ *
+ * \example
+ * if(yars.characterAttributeExists(bubba, "Attr_1"_yars))
+ * {
+ * 	std::cout << "Bubba has Attr_1\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Character does have the Attribute.
+ * \retval false The Character does not have the Attribute.
+ */
+bool Yars::characterAttributeExists(const Yars::Id character_id ///< The Character Id
+	, const Yars::Name& attribute_name ///< The Attribute Name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return character_attribute.at(character_id).contains(attribute_name);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterAttribute
+ *
+ * \brief Get all of the Character's Attributes
+ *
+ * Access to all of the Attributes a Character has will be provided in the 
+ * returned map.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill",
+ * 	{	.attribute_contribution =
+ * 		{	{ "Attr_1", 1 }
+ * 		,	{ "Attr_2", 1 }
+ * 		}
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ *
+ * Yars::MapStringAttribute& map = yars.charecterAttributeMap(bubba);
+ * \endexample
+ *
+ * \return A reference to a map of Attributes
+ */
+Yars::MapStringAttribute& Yars::characterAttributeMap(const Yars::Id character_id ///< The Character Id
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			Yars::MapStringAttribute* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	characterLevelChanged(character_id);
+	characterLayerSync(character_id);
+	characterLayerChanged(character_id);
+
+	auto& attribute = character_attribute[character_id];
+
+	return attribute;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterAttribute
+ *
+ * \brief Get all of the Character's Attributes
+ *
+ * Access to all of the Attributes a Character has will be provided in the 
+ * returned map.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill",
+ * 	{	.attribute_contribution =
+ * 		{	{ "Attr_1", 1 }
+ * 		,	{ "Attr_2", 1 }
+ * 		}
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ *
+ * const Yars& y = yars;
+ * const Yars::MapStringAttribute& map = y.charecterAttributeMap(bubba);
+ * \endexample
+ *
+ * \return A reference to a map of Attributes
+ */
+const Yars::MapStringAttribute& Yars::characterAttributeMap(const Yars::Id character_id ///< The Character Id
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			Yars::MapStringAttribute* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	const auto& attribute = character_attribute.at(character_id);
+
+	return attribute;
+}
+
+
+// }}}
+// {{{ Character: Data
+
+/**
+ * \ingroup group_Character
+ *
+ * \defgroup group_CharacterData User Data
+ *
+ * \brief Custom User Data
+ *
+ * As a generic RPG Rule System, it is impossible to anticipate all the 
+ * different kinds of data that will need to be associated with a Character.  
+ * However, it is possible to predict the type of data and that is where this 
+ * group of methods come into play.
+ *
+ * Using these methods, most types of data can be associated with a Character 
+ * in a free-form manner.
+ *
+ * All the data of a Character is kept in a single vector that is sorted by 
+ * the Handle of the data name.  Each data name is only stored once per Yars 
+ * instance and the same name can hold a value of each type.  Scripts that 
+ * need many values at once can use the batched versions of 
+ * Yars::characterDataGet() and Yars::characterDataSet() which take a map of 
+ * names and values.
+ *
+ * \example
+ * Yars::MapStringBool flag =
+ * {	{ "Quest.Rat.Started",  false }
+ * ,	{ "Quest.Rat.Finished", false }
+ * };
+ * yars.characterDataGet(bubba, flag);
+ * \endexample
+ */
+
+/**
+ * \typedef Yars::DataValue
+ *
+ * \brief The value of Character data.
+ */
+
+/**
+ * \struct Yars::CharacterData
+ *
+ * \brief A Character data value and the Handle of its name.
+ */
+
+/**
+ * \typedef Yars::VectorCharacterData
+ *
+ * \brief A convenience type.
+ */
+
+/**
+ * \typedef Yars::MapIdVectorCharacterData
+ *
+ * \brief A convenience type.
+ */
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Clear all Character data.
+ *
+ * All custom user data will be removed from the specified Character.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterDataClear(bubba);
+ * \endexample
+ *
+ * \retval true  All data has been cleared
+ * \retval false Failed to clear the data
+ */
+bool Yars::characterDataClear(const Yars::Id character_id ///< The Character Id
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	character_data[character_id].clear();
+
+	indexChanged(index_data, character_id);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Remove Character data.
+ *
+ * The named data will be removed from the Character regardless of the type of 
+ * data.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterDataSet(bubba, "Height", 1.5f);
+ * yars.characterDataSet(bubba, "Height", "m");
+ * yars.characterDataSet(bubba, "Name",   "Bubba");
+ * // Do Stuff
+ * yars.characterDataErase(bubba, "Height");
+ * // Both "Height"/1.5f and "Height"/"m" have been erased.
+ * \endexample
+ *
+ * \retval true  The data has been erased
+ * \retval false Failed to erase the data
+ */
+bool Yars::characterDataErase(const Yars::Id character_id ///< The Character Id
+	, const std::string& name ///< The data name
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	const auto handle = data_handle.find(name);
+
+	if(handle == std::end(data_handle))
+	{
+		return false;
+	}
+
+	Yars::VectorCharacterData& data = character_data.at(character_id);
+
+	auto first = std::lower_bound(std::begin(data), std::end(data)
+		, handle->second
+		, Yars::characterDataLess
+		);
+
+	auto last = first;
+
+	while(last != std::end(data) && last->handle == handle->second)
+	{
+		last++;
+	}
+
+	if(first == last)
+	{
+		return false;
+	}
+
+	data.erase(first, last);
+
+	indexChanged(index_data, character_id);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Get Character data.
+ *
+ * The named data will be removed from the Character regardless of the type of 
+ * data.  The value will be placed in \p value but if the data name is not 
+ * valid or the requested data type is not available, the original contents of 
+ * the \p value will not be changed.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterDataSet(bubba, "key", true);
+ * // Do Stuff
+ * bool value = false;
+ * yars.characterDataGet(bubba, "key", value);
+ * \endexample
+ *
+ * \retval true  The data was retrieved
+ * \retval false Failed to retrieve the data
+ */
+bool Yars::characterDataGet(const Yars::Id character_id ///< The Character Id
+	, const std::string& name  ///< The data name
+	, bool&              value ///< The data value
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return characterDataGetValue(character_data.at(character_id), name, value);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Get Character data.
+ *
+ * The named data will be removed from the Character regardless of the type of 
+ * data.  The value will be placed in \p value but if the data name is not 
+ * valid or the requested data type is not available, the original contents of 
+ * the \p value will not be changed.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterDataSet(bubba, "key", 42.0f);
+ * // Do Stuff
+ * float value = 0.0f;
+ * yars.characterDataGet(bubba, "key", value);
+ * \endexample
+ *
+ * \retval true  The data was retrieved
+ * \retval false Failed to retrieve the data
+ */
+bool Yars::characterDataGet(const Yars::Id character_id ///< The Character Id
+	, const std::string& name  ///< The data name
+	, float&             value ///< The data value
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return characterDataGetValue(character_data.at(character_id), name, value);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Get Character data.
+ *
+ * The named data will be removed from the Character regardless of the type of 
+ * data.  The value will be placed in \p value but if the data name is not 
+ * valid or the requested data type is not available, the original contents of 
+ * the \p value will not be changed.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterDataSet(bubba, "key", 42);
+ * // Do Stuff
+ * int32_t value = false;
+ * yars.characterDataGet(bubba, "key", value);
+ * \endexample
+ *
+ * \retval true  The data was retrieved
+ * \retval false Failed to retrieve the data
+ */
+bool Yars::characterDataGet(const Yars::Id character_id ///< The Character Id
+	, const std::string& name  ///< The data name
+	, int32_t&           value ///< The data value
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return characterDataGetValue(character_data.at(character_id), name, value);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Get Character data.
+ *
+ * The named data will be removed from the Character regardless of the type of 
+ * data.  The value will be placed in \p value but if the data name is not 
+ * valid or the requested data type is not available, the original contents of 
+ * the \p value will not be changed.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterDataSet(bubba, "key", "value");
+ * // Do Stuff
+ * std::string value = "";
+ * yars.characterDataGet(bubba, "key", value);
+ * \endexample
+ *
+ * \retval true  The data was retrieved
+ * \retval false Failed to retrieve the data
+ */
+bool Yars::characterDataGet(const Yars::Id character_id ///< The Character Id
+	, const std::string& name  ///< The data name
+	, std::string&       value ///< The data value
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return characterDataGetValue(character_data.at(character_id), name, value);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Set Character data.
+ *
+ * The named data will be removed from the Character regardless of the type of 
+ * data.  The value will be placed in \p value but if the data name is not 
+ * valid or the requested data type is not available, the original contents of 
+ * the \p value will not be changed.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterDataSet(bubba, "key", true);
+ * \endexample
+ *
+ * \retval true  The data was stored
+ * \retval false Failed to store the data
+ */
+bool Yars::characterDataSet(const Yars::Id character_id ///< The Character Id
+	, const std::string& name  ///< The data name
+	, const bool         value ///< The data value
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	characterDataSetValue(character_data[character_id], name, value);
+
+	indexChanged(index_data, character_id);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Set Character data.
+ *
+ * The named data will be removed from the Character regardless of the type of 
+ * data.  The value will be placed in \p value but if the data name is not 
+ * valid or the requested data type is not available, the original contents of 
+ * the \p value will not be changed.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterDataSet(bubba, "key", 42.0f);
+ * \endexample
+ *
+ * \retval true  The data was stored
+ * \retval false Failed to store the data
+ */
+bool Yars::characterDataSet(const Yars::Id character_id ///< The Character Id
+	, const std::string& name  ///< The data name
+	, const float        value ///< The data value
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	characterDataSetValue(character_data[character_id], name, value);
+
+	indexChanged(index_data, character_id);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Set Character data.
+ *
+ * The named data will be removed from the Character regardless of the type of 
+ * data.  The value will be placed in \p value but if the data name is not 
+ * valid or the requested data type is not available, the original contents of 
+ * the \p value will not be changed.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterDataSet(bubba, "key", 42);
+ * \endexample
+ *
+ * \retval true  The data was stored
+ * \retval false Failed to store the data
+ */
+bool Yars::characterDataSet(const Yars::Id character_id ///< The Character Id
+	, const std::string& name  ///< The data name
+	, const int32_t      value ///< The data value
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	characterDataSetValue(character_data[character_id], name, value);
+
+	indexChanged(index_data, character_id);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Set Character data.
+ *
+ * The named data will be removed from the Character regardless of the type of 
+ * data.  The value will be placed in \p value but if the data name is not 
+ * valid or the requested data type is not available, the original contents of 
+ * the \p value will not be changed.
+ *
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterDataSet(bubba, "key", "value");
+ * \endexample
+ *
+ * \retval true  The data was stored
+ * \retval false Failed to store the data
+ */
+bool Yars::characterDataSet(const Yars::Id character_id ///< The Character Id
+	, const std::string& name  ///< The data name
+	, const std::string& value ///< The data value
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	characterDataSetValue(character_data[character_id], name, value);
+
+	indexChanged(index_data, character_id);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Get many Character data values.
+ *
+ * Every name in \p map will have its value replaced with the Character's 
+ * data.  If a name is not valid or does not have a value of the requested 
+ * type, that value in the \p map will not be changed.
+ *
+ * \example
+ * Yars::MapStringBool data = { { "Door.Open", false }, { "Door.Locked", false } };
+ * yars.characterDataGet(bubba, data);
+ * \endexample
+ *
+ * \retval true  All the data was retrieved
+ * \retval false Failed to retrieve some of the data
+ */
+bool Yars::characterDataGet(const Yars::Id character_id ///< The Character Id
+	, Yars::MapStringBool& map ///< The data names and values
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return characterDataGetMap(character_id, map);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Get many Character data values.
+ *
+ * Every name in \p map will have its value replaced with the Character's 
+ * data.  If a name is not valid or does not have a value of the requested 
+ * type, that value in the \p map will not be changed.
+ *
+ * \example
+ * Yars::MapStringFloat data = { { "Height", 0.0f }, { "Weight", 0.0f } };
+ * yars.characterDataGet(bubba, data);
+ * \endexample
+ *
+ * \retval true  All the data was retrieved
+ * \retval false Failed to retrieve some of the data
+ */
+bool Yars::characterDataGet(const Yars::Id character_id ///< The Character Id
+	, Yars::MapStringFloat& map ///< The data names and values
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return characterDataGetMap(character_id, map);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Get many Character data values.
+ *
+ * Every name in \p map will have its value replaced with the Character's 
+ * data.  If a name is not valid or does not have a value of the requested 
+ * type, that value in the \p map will not be changed.
+ *
+ * \example
+ * Yars::MapStringInt32 data = { { "Quest.Rat", 0 }, { "Quest.Bat", 0 } };
+ * yars.characterDataGet(bubba, data);
+ * \endexample
+ *
+ * \retval true  All the data was retrieved
+ * \retval false Failed to retrieve some of the data
+ */
+bool Yars::characterDataGet(const Yars::Id character_id ///< The Character Id
+	, Yars::MapStringInt32& map ///< The data names and values
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return characterDataGetMap(character_id, map);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Get many Character data values.
+ *
+ * Every name in \p map will have its value replaced with the Character's 
+ * data.  If a name is not valid or does not have a value of the requested 
+ * type, that value in the \p map will not be changed.
+ *
+ * \example
+ * Yars::MapStringString data = { { "Name", "" }, { "Title", "" } };
+ * yars.characterDataGet(bubba, data);
+ * \endexample
+ *
+ * \retval true  All the data was retrieved
+ * \retval false Failed to retrieve some of the data
+ */
+bool Yars::characterDataGet(const Yars::Id character_id ///< The Character Id
+	, Yars::MapStringString& map ///< The data names and values
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return characterDataGetMap(character_id, map);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Set many Character data values.
+ *
+ * Every name and value in \p map will be stored in the Character's data.
+ *
+ * \example
+ * yars.characterDataSet(bubba, Yars::MapStringBool{ { "Door.Open", true }, { "Door.Locked", false } });
+ * \endexample
+ *
+ * \retval true  The data was stored
+ * \retval false Failed to store the data
+ */
+bool Yars::characterDataSet(const Yars::Id character_id ///< The Character Id
+	, const Yars::MapStringBool& map ///< The data names and values
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return characterDataSetMap(character_id, map);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Set many Character data values.
+ *
+ * Every name and value in \p map will be stored in the Character's data.
+ *
+ * \example
+ * yars.characterDataSet(bubba, Yars::MapStringFloat{ { "Height", 1.8f }, { "Weight", 90.0f } });
+ * \endexample
+ *
+ * \retval true  The data was stored
+ * \retval false Failed to store the data
+ */
+bool Yars::characterDataSet(const Yars::Id character_id ///< The Character Id
+	, const Yars::MapStringFloat& map ///< The data names and values
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return characterDataSetMap(character_id, map);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Set many Character data values.
+ *
+ * Every name and value in \p map will be stored in the Character's data.
+ *
+ * \example
+ * yars.characterDataSet(bubba, Yars::MapStringInt32{ { "Quest.Rat", 2 }, { "Quest.Bat", 1 } });
+ * \endexample
+ *
+ * \retval true  The data was stored
+ * \retval false Failed to store the data
+ */
+bool Yars::characterDataSet(const Yars::Id character_id ///< The Character Id
+	, const Yars::MapStringInt32& map ///< The data names and values
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return characterDataSetMap(character_id, map);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_CharacterData
+ *
+ * \brief Set many Character data values.
+ *
+ * Every name and value in \p map will be stored in the Character's data.
+ *
+ * \example
+ * yars.characterDataSet(bubba, Yars::MapStringString{ { "Name", "Bubba" }, { "Title", "Smith" } });
+ * \endexample
+ *
+ * \retval true  The data was stored
+ * \retval false Failed to store the data
+ */
+bool Yars::characterDataSet(const Yars::Id character_id ///< The Character Id
+	, const Yars::MapStringString& map ///< The data names and values
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return characterDataSetMap(character_id, map);
+}
+
+
+/**
+ * \brief Get a Character data value.
+ *
+ * The \p value will only be changed if the data \p name has a value of 
+ * type \p T.
+ *
+ * \retval true  The data was retrieved
+ * \retval false Failed to retrieve the data
+ */
+template <typename T>
+bool Yars::characterDataGetValue(const Yars::VectorCharacterData& data ///< The Character data
+	, const std::string& name  ///< The data name
+	, T&                 value ///< The data value
+	) const noexcept
+{
+	const auto handle = data_handle.find(name);
+
+	if(handle == std::end(data_handle))
+	{
+		return false;
+	}
+
+	auto iter = std::lower_bound(std::begin(data), std::end(data)
+		, handle->second
+		, Yars::characterDataLess
+		);
+
+	while(iter != std::end(data) && iter->handle == handle->second)
+	{
+		if(std::holds_alternative<T>(iter->value))
+		{
+			value = std::get<T>(iter->value);
+
+			return true;
+		}
+
+		iter++;
+	}
+
+	return false;
+}
+
+
+/**
+ * \brief Set a Character data value.
+ *
+ * If the data \p name already has a value of type \p T it is replaced, 
+ * otherwise the value is inserted so that \p data stays sorted.
+ */
+template <typename T>
+void Yars::characterDataSetValue(Yars::VectorCharacterData& data ///< The Character data
+	, const std::string& name  ///< The data name
+	, const T&           value ///< The data value
+	) noexcept
+{
+	const Yars::Handle handle = Yars::handleIntern(data_handle, data_handle_name, name);
+
+	auto iter = std::lower_bound(std::begin(data), std::end(data)
+		, handle
+		, Yars::characterDataLess
+		);
+
+	while(iter != std::end(data) && iter->handle == handle)
+	{
+		if(std::holds_alternative<T>(iter->value))
+		{
+			std::get<T>(iter->value) = value;
+
+			return;
+		}
+
+		iter++;
+	}
+
+	data.insert(iter,
+		{	.value  = Yars::DataValue(std::in_place_type<T>, value)
+		,	.handle = handle
+		});
+}
+
+
+/**
+ * \brief Get many Character data values.
+ *
+ * \retval true  All the data was retrieved
+ * \retval false Failed to retrieve some of the data
+ */
+template <typename M>
+bool Yars::characterDataGetMap(const Yars::Id character_id ///< The Character Id
+	, M& map ///< The data names and values
+	) const noexcept
+{
+	const Yars::VectorCharacterData& data = character_data.at(character_id);
+
+	bool retval = true;
+
+	for(auto& iter : map)
+	{
+		if(characterDataGetValue(data, iter.first, iter.second) == false)
+		{
+			retval = false;
+		}
+	}
+
+	return retval;
+}
+
+
+/**
+ * \brief Set many Character data values.
+ *
+ * \retval true  The data was stored
+ */
+template <typename M>
+bool Yars::characterDataSetMap(const Yars::Id character_id ///< The Character Id
+	, const M& map ///< The data names and values
+	) noexcept
+{
+	Yars::VectorCharacterData& data = character_data[character_id];
+
+	data.reserve(data.size() + map.size());
+
+	for(const auto& iter : map)
+	{
+		characterDataSetValue(data, iter.first, iter.second);
+	}
+
+	indexChanged(index_data, character_id);
+
+	return true;
+}
+
+
+/**
+ * \brief Compare Character data by Handle.
+ *
+ * Used to search the sorted Character data.
+ *
+ * \retval true  The \p data Handle is less than \p handle
+ * \retval false The \p data Handle is not less than \p handle
+ */
+bool Yars::characterDataLess(const Yars::CharacterData& data ///< The Character data
+	, const Yars::Handle handle ///< The Handle
+	) noexcept
+{
+	return (data.handle < handle);
+}
+
+// }}}
+// {{{ Character: Skill
+
+/**
+ * \ingroup group_Character
+ *
+ * \defgroup group_CharacterSkill Skill
+ *
+ * \brief A Character's Skills
+ *
+ * Anything that a Character can do must be done using Skills.  When a 
+ * Character gains Skills, those skills will guide how the Character evolves.
+ *
+ * \see \ref group_Skill
+ */
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterSkill
+ *
+ * \brief Access a Skill
+ *
+ * Provides a way to access a Character's Skill.  The returned reference can 
+ * change the Skill, so the Character's Levels are treated as changed, see 
+ * Yars::characterLevelChanged().  Use a `const Yars&` to only read the Skill.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ *
+ * Yars::Skill& skill = yars.characterSkill(bubba, "Skill");
+ * \endexample
+ *
+ * \return A reference to a Skill
+ */
+Yars::Skill& Yars::characterSkill(const Yars::Id character_id ///< The Character Id
+	, const std::string& skill_name ///< The Skill name
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			Yars::Skill* retval = nullptr;
+			return *retval;
+		}
+
+		if(characterSkillExists(character_id, skill_name) == false)
+		{
+			Yars::Skill* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	characterLevelChanged(character_id);
+	characterLayerSync(character_id);
+
+	auto [iter, is_new] = character_skill[character_id].try_emplace(skill_name);
+
+	if(is_new)
+	{
+		// Adding a Skill may move the others
+		action_skill_generation++;
+	}
+
+	return iter->second;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterSkill
+ *
+ * \brief Access a Skill
+ *
+ * Provides a way to access a Character's Skill.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ *
+ * const Yars& y = yars;
+ * const Yars::Skill& skill = y.characterSkill(bubba, "Skill");
+ * \endexample
+ *
+ * \return A reference to a Skill
+ */
+const Yars::Skill& Yars::characterSkill(const Yars::Id character_id ///< The Character Id
+	, const std::string& skill_name ///< The Skill name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			Yars::Skill* retval = nullptr;
+			return *retval;
+		}
+
+		if(characterSkillExists(character_id, skill_name) == false)
+		{
+			Yars::Skill* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	return character_skill.at(character_id).at(skill_name);
+}
+
+
+/**
+ * \ingroup group_CharacterSkill
+ *
+ * \brief Access a Skill
+ *
+ * Provides a way to access a Character's Skill using a Name that was hashed 
+ * at compile-time.  Unlike the `std::string` version, the Skill will not be 
+ * created if the Character does not have it.
+ *
+ * \example
+ * Yars::Skill& skill = yars.characterSkill(bubba, "Skill"_yars);
+ * \endexample
+ *
+ * \return A reference to a Skill
+ */
+Yars::Skill& Yars::characterSkill(const Yars::Id character_id ///< The Character Id
+	, const Yars::Name& skill_name ///< The Skill name
+	) noexcept
+{
+	characterLevelChanged(character_id);
+
+	return const_cast<Yars::Skill&>(std::as_const(*this).characterSkill(character_id, skill_name));
+}
+
+
+/**
+ * \ingroup group_CharacterSkill
+ *
+ * \brief Access a Skill
+ *
+ * Provides a way to access a Character's Skill using a Name that was hashed 
+ * at compile-time.
+ *
+ * \example
+ * const Yars& y = yars;
+ * const Yars::Skill& skill = y.characterSkill(bubba, "Skill"_yars);
+ * \endexample
+ *
+ * \return A reference to a Skill
+ */
+const Yars::Skill& Yars::characterSkill(const Yars::Id character_id ///< The Character Id
+	, const Yars::Name& skill_name ///< The Skill name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterSkillExists(character_id, skill_name) == false)
+		{
+			Yars::Skill* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	return character_skill.at(character_id).at(skill_name);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterSkill
+ *
+ * \brief Add a Skill to a Character.
+ *
+ * Adds a Skill to a Character if it does not already exists.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill");
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * \endexample
+ *
+ * \retval true  The Skill was added
+ * \retval false Failed to add the Skill
+ */
+bool Yars::characterSkillAdd(const Yars::Id character_id ///< The Character Id
+	, const std::string& skill_name ///< The Skill name
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+
+		if(skillExists(skill_name) == false)
+		{
+			return false;
+		}
+
+		if(characterSkillExists(character_id, skill_name) == true)
+		{
+			return false;
+		}
+	}
+
+	characterLevelChanged(character_id);
+	action_skill_generation++;
+
+	Yars::MapStringSkill& skill = character_skill[character_id];
+
+	if(catalog_is_frozen)
+	{
+		const Yars::Skill* prototype = skillFind(skill_name);
+
+		skill[skill_name] = (prototype == nullptr)
+			? Yars::Skill{}
+			: *prototype
+			;
+	}
+	else
+	{
+		skill[skill_name] = skill_map[skill_name];
+	}
+
+	characterLayerReset(character_id, &Yars::CharacterLayer::skill, skill_name);
+
+	for(const auto& iter : skill[skill_name].attribute_contribution)
+	{
+		const std::string& attribute_name        = iter.first;
+		//const int32_t&   modifier_contirbution = iter.second;
+
+		characterAttributeAdd(character_id, attribute_name);
+	}
+
+	characterSkillSetChange(character_id, skill_name, true);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterSkill
+ *
+ * \brief Remove a Skill from a Character.
+ *
+ * Remove a Skill from a Character if it exists.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill");
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * \endexample
+ *
+ * \retval true  The Skill was removed
+ * \retval false Failed to remove the Skill
+ */
+bool Yars::characterSkillRemove(const Yars::Id character_id ///< The Character Id
+	, const std::string& skill_name ///< The Skill name
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+
+		if(characterSkillExists(character_id, skill_name) == false)
+		{
+			return false;
+		}
+	}
+
+	characterLevelChanged(character_id);
+	action_skill_generation++;
+
+	Yars::MapStringSkill& skill = character_skill[character_id];
+	skill.erase(skill_name);
+
+	characterSkillSetChange(character_id, skill_name, false);
+	characterLayerReset(character_id, &Yars::CharacterLayer::skill, skill_name);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterSkill
+ *
+ * \brief Increase the Skill Level.
+ *
+ * As a Character uses a Skill, that Skill Level will eventually increase.  
+ * This method give the Skill that opportunity.  Calling this method is not 
+ * necessary because it will be automatically invoked when needed.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ *
+ * yars.characterSkillIncrease(bubba, "Skill", 0.25f);
+ * \endexample
+ *
+ * \retval true  The Skill increased in a Level
+ * \retval false The Skill increase was not enough to increase the Level
+ */
+bool Yars::characterSkillIncrease(const Yars::Id character_id ///< The Character Id
+	, const std::string& skill_name ///< The Skill name
+	, const float        amount     ///< How much to increase the Skill
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+
+		if(characterSkillExists(character_id, skill_name) == false)
+		{
+			return false;
+		}
+	}
 
-	// }}}
-};
-};
+	characterLevelChanged(character_id);
 
-// {{{ Operator
+	auto [iter, is_new] = character_skill[character_id].try_emplace(skill_name);
 
-bool operator==(const zakero::Yars::Item&, const zakero::Yars::Item&);
-bool operator!=(const zakero::Yars::Item&, const zakero::Yars::Item&);
+	if(is_new)
+	{
+		// Adding a Skill may move the others
+		action_skill_generation++;
+	}
 
-// }}}
+	levelIncrease(iter->second.level, amount);
 
-#if defined (ZAKERO_YARS_IMPLEMENTATION)
+	// If skill level increased, Event: Level_Up, character_id skill_name
 
-namespace zakero
-{
+	return true;
+}
 
-// {{{ Defines
 
 /**
- * \page page_Define Define Customization
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * It is possible to add compile time customizations to \yars by adding the 
- * following `#define`'s before including the \yars header.
+ * \ingroup group_CharacterSkill
  *
+ * \brief Check if a Character has a Skill
  *
+ * Check if a Character has a Skill
  *
- * \par ZAKERO_YARS_ENABLE_DEBUG
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
  *
- * Enabled debugging messages to be written to `stderr`.  These messages are 
- * written by using `ZAKERO_YARS_DEBUG` macro which is also enabled by the 
- * `ZAKERO_YARS_ENABLE_DEBUG` macro.  This macro mostly only useful if 
- * `ZAKERO_YARS_ENABLE_SAFE_MODE` is also enabled.
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
  *
- * \code
- * #define ZAKERO_YARS_ENABLE_DEBUG
- * \endcode
+ * if(yars.characterSkillExists(bubba, "Skill"))
+ * {
+ * 	std::cout << "Bubba has Skill\n";
+ * }
+ * \endexample
  *
+ * \retval true  The Character does have the Skill.
+ * \retval false The Character does not have the Skill.
+ */
+bool Yars::characterSkillExists(const Yars::Id character_id ///< The Character Id
+	, const std::string& skill_name ///< The Skill name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	const Yars::MapStringSkill& skill_map = character_skill.at(character_id);
+
+	return skill_map.contains(skill_name);
+}
+
+
+/**
+ * \ingroup group_CharacterSkill
  *
+ * \brief Check if a Character has a Skill
  *
- * \par ZAKERO_YARS_ENABLE_ID_SHUFFLE
+ * \example
+ * if(yars.characterSkillExists(bubba, "Skill"_yars))
+ * {
+ * 	std::cout << "Bubba has Skill\n";
+ * }
+ * \endexample
  *
- * When possible, YARS will reuse previously used memory.  The order in which 
- * the memory is reused is predicable.  If this is potentially a problem, 
- * enabling this macro will randomize the reuse order.
+ * \retval true  The Character does have the Skill.
+ * \retval false The Character does not have the Skill.
+ */
+bool Yars::characterSkillExists(const Yars::Id character_id ///< The Character Id
+	, const Yars::Name& skill_name ///< The Skill name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	return character_skill.at(character_id).contains(skill_name);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * For (some value of) high amounts of unused memory, this feature can 
- * introduce noticeable overhead.  Experiment to find out if the performance 
- * hit is acceptable in your project.
+ * \ingroup group_CharacterSkill
  *
- * For maximum "data paranoia", enabled both `ZAKERO_YARS_ENABLE_ID_SHUFFLE` 
- * and `ZAKERO_YARS_ENABLE_CLEAN_ON_DELETE`.
+ * \brief Get a list of Skills.
  *
- * \code
- * #define ZAKERO_YARS_ENABLE_ID_SHUFFLE
- * \endcode
+ * All the Skill names of the Character will be collected and returned.
  *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
  *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
  *
- * \par ZAKERO_YARS_ENABLE_CLEAR_ON_DELETE
+ * Yars::VectorString list = yars.characterSkillList(bubba);
+ * \endexample
  *
- * Some data objects can be "deleted".  These objects are really placed in an 
- * "unused" pool to be reused later.  This means that they objects could still 
- * be used, much like using free'ed memory.
- * 
- * Defining this macro will cause the objects to be initialized to a clean 
- * state before going into the "unused" pool.  While this can be useful for 
- * debugging it will result in some over-head.
+ * \return A vector of Skill names
+ */
+Yars::VectorString Yars::characterSkillList(const Yars::Id character_id ///< The Character Id
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return {};
+		}
+	}
+
+	const Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
+
+	return Yars::mapKeyList(skill_map);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \note The data will always be cleared when it is pulled out of the "unused" 
- * pool.
+ * \ingroup group_CharacterSkill
  *
- * For maximum "data paranoia", enabled both `ZAKERO_YARS_ENABLE_ID_SHUFFLE` 
- * and `ZAKERO_YARS_ENABLE_CLEAN_ON_DELETE`.
+ * \brief Get a map of Skills.
  *
- * \code
- * #define ZAKERO_YARS_CLEAR_ON_DELETE
- * \endcode
+ * All the Skills of the Character will be accessible via the returned map.
  *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
  *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
  *
- * \par ZAKERO_YARS_ENABLE_SAFE_MODE
+ * Yars::MapStringSkill& list = yars.characterSkillMap(bubba);
+ * \endexample
  *
- * Before a method executes, it should validate the argument values that it 
- * receives.  This is useful while developing code but adds overhead.  If the 
- * calling code can guarantee that all argument data is valid, this macro can 
- * be enabled to reduce the validation checks and overhead.
+ * \return A map of Skills
+ */
+Yars::MapStringSkill& Yars::characterSkillMap(const Yars::Id character_id ///< The Character Id
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			Yars::MapStringSkill* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	characterLevelChanged(character_id);
+	action_skill_generation++;
+
+	character_skill_set.erase(character_id);
+
+	characterLayerSync(character_id);
+	characterLayerChanged(character_id);
+
+	auto& skill = character_skill[character_id];
+
+	return skill;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \code
- * #define ZAKERO_YARS_ENABLE_SAFE_MODE
- * \endcode
+ * \ingroup group_CharacterSkill
  *
+ * \brief Get a map of Skills.
  *
+ * All the Skills of the Character will be accessible via the returned map.
  *
- * \par ZAKERO_YARS_ENABLE_TO_STRING
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
  *
- * Some data structures have a corresponding [Yars::to_string()](\ref 
- * group_ToString) method to help make debugging easier.  The output of these 
- * methods is a JSON formatted object or array.  This was done to be agnostic 
- * to all the available JSON libraries.  Enabling the 
- * `ZAKERO_YARS_ENABLE_TO_STRING` will make those methods available.
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
  *
- * \code
- * #define ZAKERO_YARS_ENABLE_TO_STRING
- * \endcode
+ * const Yars& y = yars;
+ * const Yars::MapStringSkill& list = y.characterSkillMap(bubba);
+ * \endexample
+ *
+ * \return A map of Skills
  */
+const Yars::MapStringSkill& Yars::characterSkillMap(const Yars::Id character_id ///< The Character Id
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			Yars::MapStringSkill* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	const auto& skill = character_skill.at(character_id);
+
+	return skill;
+}
+
+
+// }}}
+// {{{ Character: Item
 
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
 /**
- * \defgroup group_ToString ZAKERO_YARS_ENABLE_TO_STRING
+ * \todo{InventoryRewrite} Should Items be able to contain other Items?
+ * - No. Use the custom data to define the "container".
  *
- * \brief Functionality that is only available when \yars is compiled with the 
- * [ZAKERO_YARS_ENABLE_TO_STRING](\ref page_Define) macro.
+ * \todo{InventoryRewrite} The description of the Character Item is not 
+ * supported by the code.  AffectInit() allows for any usable Item.  This can 
+ * be fixed by adding `characterItemUse()` and characterEquipmentUse()`.
  *
- * Most of \yars objects and custom data types have conversion to JSON 
- * formatted string support.  These methods will create a std::string object 
- * with all the data and return it.  Creating the std::string can be an 
- * expensive operation and considering the generated strings are mostly only 
- * useful for debugging, the %to_string() methods are disabled by default.
- */
-#endif
-
-#if defined (ZAKERO_YARS_DEBUG)
-/**
- * \defgroup group_Debugging ZAKERO_YARS_DEBUG
+ * \todo{InventoryRewrite} Item is broken.  Consider the following approaches:
+ * - Items should contain their own name
+ * - Items have their own "data"
+ * - Items match only if all "data" matches
+ *   - What about `count`?
+ * - Missing "familiarity" by the user of the Item
+ *   - Could this be handled by `Custom Data`?
+ * - Add Policy controller support
+ *   - Policy Stacking
+ *     - Set Default Stacking value
+ *     - Data Key: "Yars.ItemPolicy.Stacking.MaxCount"
+ *   - Policy Weight
+ *   - Policy Packing
+ *   - Policy uses data "Yars.ItemPolicy.Stacking.KEY"
  *
- * \brief Functionality that is only available when \yars is compiled with the 
- * [ZAKERO_YARS_ENABLE_DEBUG](\ref page_Define) macro.
+ * \ingroup group_Character
  *
- * These macros are available to help make debugging easier.
- */
-
-/**
- * \ingroup group_Debugging
+ * \defgroup group_CharacterItem Item
  *
- * \def ZAKERO_YARS__DEBUG_DISABLED
+ * \brief The Character's Items.
  *
- * \brief Internal Use Only
+ * Items allow a Character to use their Skills.  A Character must have the 
+ * Skill to use Item as well as having that Item in their possession.  The 
+ * outcome of using an Item is in Affect is created.  The Affect can then be 
+ * applied to a Character.
  *
- * The inverse of ZAKERO_YARS_DEBUG_ENABLED and is used to enable or disable 
- * the debugging messages.
+ * \see \ref group_Affect
  */
 
 /**
- * \ingroup group_Debugging
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \def ZAKERO_YARS_DEBUG
+ * \ingroup group_CharacterItem
  *
- * \brief Write debugging message.
+ * \brief Access a Character's Item.
  *
- * If the `ZAKERO_YARS_ENABLE_DEBUG` macro is enabled, this macro will write to 
- * the `std::cerr` stream.  Nothing will happen when the macro is disabled.
+ * Provides access to an Item that the Character possesses.  The \p offset 
+ * selects which stack of Items to access, see Yars::CharacterItem for the 
+ * order of the stacks.
+ *
+ * \note The Item::count must not be changed using the returned reference.  
+ * Use characterItemAdd() and characterItemRemove() instead.
  *
  * \example
- * ZAKERO_YARS_DEBUG << "Insert debugging message here.\n";
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * Yars::Item& item = yars.characterItem(bubba, "Item");
  * \endexample
+ *
+ * \return A reference to an Item.
  */
+Yars::Item& Yars::characterItem(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	, const uint32_t     offset    ///< Which Item to access
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			Yars::Item* retval = nullptr;
+			return *retval;
+		}
+
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			Yars::Item* retval = nullptr;
+			return *retval;
+		}
+
+		if(character_item.at(character_id).at(item_name).stack.size() <= offset)
+		{
+			Yars::Item* retval = nullptr;
+			return *retval;
+		}
+	}
+
+	return character_item[character_id][item_name].stack[offset];
+}
+
 
 /**
- * \ingroup group_Debugging
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \def ZAKERO_YARS_DEBUG_VAR(var_)
+ * \ingroup group_CharacterItem
  *
- * \brief Write debugging message.
+ * \brief Access a Character's Item.
  *
- * Does the samething as `ZAKERO_YARS_DEBUG` but is specialized to work with 
- * std::ostream compatible objects.
+ * Provides access to an Item that the Character possesses.  The \p offset 
+ * selects which stack of Items to access, see Yars::CharacterItem for the 
+ * order of the stacks.
+ *
+ * \note The Item::count must not be changed using the returned reference.  
+ * Use characterItemAdd() and characterItemRemove() instead.
  *
  * \example
- * uint64_t foo = 42;
- * ZAKERO_YARS_DEBUG_VAR(foo);
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * const Yars& y = yars;
+ * const Yars::Item& item = y.characterItem(bubba, "Item");
  * \endexample
  *
- * \param var_ The variable to write.
+ * \return A reference to an Item.
  */
-#endif
+const Yars::Item& Yars::characterItem(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	, const uint32_t     offset    ///< Which Item to access
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			Yars::Item* retval = nullptr;
+			return *retval;
+		}
 
-// }}}
-// {{{ Anonymous Namespace
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			Yars::Item* retval = nullptr;
+			return *retval;
+		}
 
-namespace
-{
-	std::mt19937 zakero_yars_mt19937(
-		std::chrono::system_clock::now().time_since_epoch().count()
-		);
+		if(character_item.at(character_id).at(item_name).stack.size() <= offset)
+		{
+			Yars::Item* retval = nullptr;
+			return *retval;
+		}
+	}
 
-	std::uniform_real_distribution<float> zakero_yars_distribution_(-1.0f, 1.0f);
-};
+	return character_item.at(character_id).at(item_name).stack[offset];
+}
 
-// }}}
 
 /**
- * \todo{Doxygen} Add Doxygen support
- * \todo{STLAllocator} Expose the containers so that custom STL Allocators can 
- * be used.
- * \todo{Events} Add Event: Health.Current.Changed
- * \todo{Events} Add Event: Health.Maximum.Changed
- * \todo{Events} Add Event: Attribute.Added
- * \todo{Events} Add Event: Attribute.Decreased
- * \todo{Events} Add Event: Attribute.Increased
- * \todo{Events} Add Event: Skill.Added
- * \todo{Events} Add Event: Skill.Decreased
- * \todo{Events} Add Event: Skill.Increased
- * \todo{Events} Add Event: Item.Added
- * \todo{Events} Add Event: Item.Removed
- * \todo{Events} Add Event: Level.Up
- * \todo{Events} Add Event: Died
- * \todo{Config} Config.ItemAutoStack[bool] See: characterItemAdd()
- * - Per Character config?
- * .
- * \todo{Config} Config.EventThread
- * - [time in milliseconds to flush the event queue]
- * - Compile Time?
- * .
- * \todo{Config} Config.CharacterCountMax
- * - Compile Time?
- * .
- * \todo{Config} Config.ItemStackCountMax
- * - Compile Time?
- * - Per Character config?
- * .
- * \todo{Config} Config.InventoryItemCountMax
- * - Per Character config
- * .
- * \todo Thread-Safety
- * \todo Damage Over Time
- * \todo Add "Affect Data" support like "Character Data"
- * - "Affect Data" is based on the Affect Id, not per-instance
- * .
- * \todo Data Storage?
- * \todo What if damage was scaled to success?
- * - Automatic success : %100 damage
- * - Automatic failure : %0 damage
- * - Chance: 1 - ((rand - mod) / 2)
- * - --- Maybe a bad idea ---
- * - This would remove the need for (chance to hit).  A chance to hit 
- * for %10 of max damage is not fun.  If an enemy has a 100% chance to 
- * hit, regardless of damage, then that may not be fun.
- * - This effectively reduces the average damage by 50%.
- *
- * \class Yars
- *
- * \brief Y.A.R.S.
- *
- * The %Yars class embodies the core RPG Rule System.  The \yars contains all 
- * the basic objects needed in RPG's such as characters and items, plus how all 
- * parts can interact with each other.  Wars of magic, swords, and words can be 
- * done by using Affects that impose changes on the characters.
- *
- * Almost everything revolves around the Character.  Characters are made up of 
- * Skills and Skills are made up of Attributes.  Attributes, Characters, and 
- * Skills all have Levels.  Characters also have Health.  Items are used to 
- * create Affects and those Affects can be applied to Characters.
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * While it is encouraged to change the values of data objects using the 
- * methods, all values are public to make it easier to modify if needed.
+ * \ingroup group_CharacterItem
  *
- * \par Debugging
+ * \brief Add an Item to a Character
  *
- * If you would like the ability to send debugging output to Standard Error, 
- * enable the [ZAKERO_YARS_ENABLE_DEBUG](\ref page_Define) macro when building 
- * \yars.  This will in turn enable the debugging macros \ref ZAKERO_YARS_DEBUG 
- * and \ref ZAKERO_YARS_DEBUG_VAR.
+ * The specified Item will be added to the Character.  Optionally, the number 
+ * of Items can also be provided.
  *
- * \par Data Lifespan
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
  *
- * \yars stores data in maps and vectors.  When new data is added to maps and 
- * vectors, it can cause those containers to another area in memory.  This is 
- * important to realize because all the Yars methods return a reference to a 
- * data item.  __This means that holding on to a reference and adding data of 
- * the same type can invalidate that reference.__
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
+ * \endexample
  *
- * The intent of using references was to allow the caller to have direct access 
- * to the internal data structures so that they can read (and write if 
- * necessary) directly without going through any indirection.  This also allows 
- * the C++ STL to manage the memory resource reducing the possibility of memory 
- * leaks to almost 0.
+ * \retval true  The Item was added
+ * \retval false Failed to add the Item
  */
+bool Yars::characterItemAdd(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	, const uint32_t     amount    ///< The number of Items to add
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 
-// {{{ Utility
+		if(itemExists(item_name) == false)
+		{
+			return false;
+		}
+
+		if(amount == 0)
+		{
+			return false;
+		}
+	}
+
+	indexChanged(index_item,     character_id);
+	indexChanged(telemetry_item, character_id);
+
+	itemOwnerAdjust(character_id, item_name, amount);
+
+	Yars::CharacterItem& character_item = this->character_item[character_id][item_name];
+	const uint32_t       count_max      = character_config[character_id].item_stack_max;
+	uint32_t             remaining      = amount;
+
+	character_item.count += amount;
+
+	for(Yars::Item& stack_item : character_item.stack)
+	{
+		if(stack_item.count >= count_max)
+		{
+			continue;
+		}
+
+		uint32_t count = count_max - stack_item.count;
+
+		if(count >= remaining)
+		{
+			stack_item.count += std::exchange(remaining, 0);
+			break;
+		}
+
+		stack_item.count = count_max;
+		remaining -= count;
+	}
+
+	if(remaining == 0)
+	{
+		return true;
+	}
+
+	const Yars::Item& new_item = this->item(item_name);
+
+	character_item.stack.reserve(character_item.stack.size()
+		+ ((remaining - 1) / count_max) + 1
+		);
+
+	while(remaining > 0)
+	{
+		Yars::Item& item = character_item.stack.emplace_back(new_item);
+
+		if(remaining <= count_max)
+		{
+			item.count = std::exchange(remaining, 0);
+			break;
+		}
+
+		item.count = count_max;
+		remaining -= count_max;
+	}
+
+	return true;
+}
 
-/**
- * \defgroup group_Utility Utility
- *
- * \brief Utility functions.
- *
- * A collection of utility methods within the Yars class that improve the 
- * Quality-Of-Life.
- */
 
 /**
- * \ingroup group_Utility
- *
- * \fn static std::vector<typename Map::key_type> Yars::mapKeyList(const Map& map) noexcept
- *
- * \brief Get all the keys in a map.
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * This function template will collect all the keys of the provided \p map and 
- * return them in a vector.
+ * \ingroup group_CharacterItem
  *
- * \return A std::vector of keys.
+ * \brief Add an Item to a Character
  *
- * \tparam Map The container type
+ * \note This method is private, no there are no sanity checks.
  *
- * \param  map The map container
+ * \retval true  The Item was added
+ * \retval false Failed to add the Item
  */
+bool Yars::characterItemAdd(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	, const Yars::Item&  new_item  ///< A reference to the Item
+	) noexcept
+{
+	indexChanged(index_item,     character_id);
+	indexChanged(telemetry_item, character_id);
 
-/**
- * \ingroup group_Utility
- *
- * \fn static bool Yars::multimapContains(const Map& map, const typename Map::key_type key, const typename Map::mapped_type value) noexcept
- *
- * \brief Check the contents of a MultiMap.
- * 
- * Checking the contents of a multimap for a key/value pair requires a lot of 
- * boiler-plate code.  This function template provides the needed generic 
- * boiler-plate.
- *
- * \retval true  The key/value pair was found.
- * \retval false The key/value pair was __not__ found.
- *
- * \tparam Map The multimap
- *
- * \param map   The multimap to check
- * \param key   The key in the multimap
- * \param value The value in the multimap
- */
+	itemOwnerAdjust(character_id, item_name, +1);
 
-/**
- * \ingroup group_Utility
- *
- * \fn static void Yars::multimapErase(Map& map, const typename Map::key_type key, const typename Map::mapped_type value) noexcept
- *
- * \brief Remove a value from MultiMap.
- *
- * Removing a specific key/value pair from a MulitMap is an easy thing to do 
- * but it does require excessive amounts of code.  This function template 
- * provides the needed generic boiler-plate code.
- *
- * \tparam Map The multimap
- *
- * \param map   The multimap to check
- * \param key   The key in the multimap
- * \param value The value in the multimap
- */
+	Yars::CharacterItem& character_item = this->character_item[character_id][item_name];
+	const uint32_t       count_max      = character_config[character_id].item_stack_max;
+
+	character_item.count++;
+
+	for(Yars::Item& item : character_item.stack)
+	{
+		if(item.count < count_max)
+		{
+			item.count++;
+			return true;
+		}
+	}
+	
+	Yars::Item& item = character_item.stack.emplace_back(new_item);
+	item.count = 1;
+
+	return true;
+}
 
-/**
- * \ingroup group_Utility
- *
- * \fn static bool Yars::vectorContains(const std::vector<Type>& vector, const Type& value) noexcept
- *
- * \brief Check if a vector contains a value
- *
- * Searching a vector just to find out if a value is present can be done by 
- * using `std::find()`.  However, littering your code with calls to `std::find() 
- * == std::end()` is excessively ugly.  Using this template function to simplify 
- * your code.
- *
- * \tparam Type The content type of the vector
- *
- * \retval true  The value was found
- * \retval false The value was not found
- *
- * \param vector The vector to search
- * \param value  The value to look for
- */
 
 /**
- * \ingroup group_Utility
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \fn static bool Yars::vectorContains(InputIter first, InputIter last, const Type& value) noexcept
+ * \ingroup group_CharacterItem
  *
- * \brief Check if a vector contains a value
+ * \brief Remove an Item from a Character
  *
- * Searching a vector just to find out if a value is present can be done by 
- * using `std::find()`.  However, littering your code with calls to `std::find() 
- * == std::end()` is excessively ugly.  Using this template function to simplify 
- * your code.
+ * The specified Item will be removed from the Character.  If an amount is 
+ * specified then that many Items will be removed, if possible.
  *
- * \tparam InputIter The vector iterator type
- * \tparam Type      The content type of the vector
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
  *
- * \retval true  The value was found
- * \retval false The value was not found
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
+ * // Do Stuff
+ * yars.characterItemRemove(bubba, "Item");
+ * \endexample
  *
- * \param first The starting location for the search
- * \param last  The ending location for the search
- * \param value  The value to look for
+ * \retval true  The Item was removed
+ * \retval false Failed to remove the Item
  */
+bool Yars::characterItemRemove(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	, const uint32_t     amount    ///< The number of Items to remove
+	) noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 
-// }}}
-// {{{ Ctor / Dtor
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return false;
+		}
+	}
 
-/**
- * \brief Default Constructor
- *
- * Create a new instance using the default random number generator.
- */
-Yars::Yars()
-	: Yars(zakero_yars_mt19937)
-{
-}
+	indexChanged(index_item,     character_id);
+	indexChanged(telemetry_item, character_id);
 
+	Yars::MapStringCharacterItem& inventory      = this->character_item[character_id];
+	Yars::CharacterItem&          character_item = inventory[item_name];
 
-/**
- * \brief Constructor
- *
- * Create a new instance using the provided random number generator.  For the 
- * life-time of the new %Yars instance, it will keep a reference to the \p 
- * mt19937 object.
- *
- * \todo Find a way to support other random number generators. Maybe via 
- * template parameters.
- */
-Yars::Yars(std::mt19937& mt19937 ///< The random number generator
-	)
-	: attribute_map()
-	, skill_map()
-	, item_map()
-	, character_id_max(0)
-	, character_pool()
-	, character_config()
-	, character_health()
-	, character_attribute()
-	, character_data_bool()
-	, character_data_float()
-	, character_data_int32()
-	, character_skill()
-	, character_data_string()
-	, character_equipment_item()
-	, character_equipment_name()
-	, character_item()
-	, character_affect()
-	, affect_vector()
-	, affect_pool()
-	, mt_engine(mt19937)
-{
-}
+	if(character_item.count <= amount)
+	{
+		itemOwnerAdjust(character_id, item_name, -(int64_t)character_item.count);
 
-// }}}
-// {{{ Data Types
+		characterItemErase(character_id, item_name);
 
-/**
- * \typedef Yars::Id
- *
- * \brief Used for unique IDs
- */
+		return true;
+	}
 
-/**
- * \typedef Yars::MapStringBool
- *
- * \brief A convenience type
- */
+	itemOwnerAdjust(character_id, item_name, -(int64_t)amount);
 
-/**
- * \typedef Yars::MapStringFloat
- *
- * \brief A convenience type
- */
+	character_item.count -= amount;
 
-/**
- * \typedef Yars::MapStringInt32
- *
- * \brief A convenience type
- */
+	uint32_t amount_to_remove = amount;
 
-/**
- * \typedef Yars::MapStringString
- *
- * \brief A convenience type
- */
+	while(amount_to_remove > 0)
+	{
+		Yars::Item& item = character_item.stack.back();
 
-/**
- * \typedef Yars::MapIdMapStringBool
- *
- * \brief A convenience type
- */
+		if(item.count > amount_to_remove)
+		{
+			item.count -= amount_to_remove;
 
-/**
- * \typedef Yars::MapIdMapStringFloat
- *
- * \brief A convenience type
- */
+			break;
+		}
 
-/**
- * \typedef Yars::MapIdMapStringInt32
- *
- * \brief A convenience type
- */
+		amount_to_remove -= item.count;
 
-/**
- * \typedef Yars::MapIdMapStringString
- *
- * \brief A convenience type
- */
+		character_item.stack.pop_back();
+	}
 
-/**
- * \typedef Yars::MultimapIdId
- *
- * \brief A convenience type
- */
+	return true;
+}
 
-/**
- * \typedef Yars::VectorId
- *
- * \brief A convenience type
- */
 
 /**
- * \typedef Yars::VectorString
+ * \todo{InventoryRewrite} Should this method be private?
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ *
+ * \ingroup group_CharacterItem
  *
- * \brief A convenience type
- */
-
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
-/**
- * \ingroup group_ToString
+ * \brief Remove an Item from a Character
  *
- * \brief Yars::MapStringFloat to JSON formatted string
+ * The specified Item will be removed from the Character.  This method differs 
+ * from Yars::characterItemRemove() by returning a copy of the removed Item.  
+ * And only one Item can be taken at a time.
  *
- * \return A JSON formatted string
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
+ * // Do Stuff
+ * yars.characterItemRemove(bubba, "Item");
+ * \endexample
+ *
+ * \retval true  The Item was removed
+ * \retval false Failed to remove the Item
  */
-std::string Yars::to_string(const Yars::MapStringFloat& map ///< Object to convert
+Yars::Item Yars::characterItemTake(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
 	) noexcept
 {
-	std::stringstream oss;
-
-	bool first = true;
-	for(const auto& iter : map)
+	if(safeMode())
 	{
-		if(first == true)
+		if(characterExists(character_id) == false)
 		{
-			first = false;
-			oss << "{";
+			return {};
 		}
-		else
+
+		if(characterItemExists(character_id, item_name) == false)
 		{
-			oss << ",";
+			return {};
 		}
+	}
 
-		const std::string& name  = iter.first;
-		const float&       value = iter.second;
+	indexChanged(index_item,     character_id);
+	indexChanged(telemetry_item, character_id);
 
-		oss << " \"" << name << "\": " << std::to_string(value);
+	Yars::MapStringCharacterItem& inventory      = this->character_item[character_id];
+	Yars::CharacterItem&          character_item = inventory[item_name];
+	Yars::Item&                   item           = character_item.stack.back();
+
+	Yars::Item taken_item = item;
+	taken_item.count = 1;
+
+	itemOwnerAdjust(character_id, item_name, -1);
+
+	if(character_item.count == 1)
+	{
+		characterItemErase(character_id, item_name);
+
+		return taken_item;
 	}
 
-	oss << " }";
-	
-	return oss.str();
+	character_item.count--;
+
+	if(item.count == 1)
+	{
+		character_item.stack.pop_back();
+	}
+	else
+	{
+		item.count--;
+	}
+
+	return taken_item;
 }
-#endif
 
 
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
 /**
- * \ingroup group_ToString
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \brief Yars::MapStringInt32 to JSON formatted string
+ * \ingroup group_CharacterItem
  *
- * \return A JSON formatted string
+ * \brief Give Items to another Character
+ *
+ * The Items are moved from one Character's Inventory to the other.  Unlike 
+ * Yars::characterItemTake() followed by Yars::characterItemAdd(), whole 
+ * stacks are moved without copying the Item and everything is checked before 
+ * any changes are made.  Either all the Items are moved or nothing is 
+ * changed.
+ *
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Gold Coin", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * Yars::Id jimbo = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Gold Coin", 100);
+ *
+ * yars.characterItemTransfer(bubba, jimbo, "Gold Coin", 25);
+ * \endexample
+ *
+ * \retval true  The Items were moved
+ * \retval false Nothing was changed
  */
-std::string Yars::to_string(const Yars::MapStringInt32& map ///< Object to convert
+bool Yars::characterItemTransfer(const Yars::Id from_id ///< The Character giving the Items
+	, const Yars::Id     to_id     ///< The Character getting the Items
+	, const std::string& item_name ///< The Item name
+	, const uint32_t     amount    ///< The number of Items
 	) noexcept
 {
-	std::stringstream oss;
-
-	bool first = true;
-	for(const auto& iter : map)
+	if(characterExists(from_id) == false
+		|| characterExists(to_id) == false
+		)
 	{
-		if(first == true)
-		{
-			first = false;
-			oss << "{";
-		}
-		else
-		{
-			oss << ",";
-		}
+		return false;
+	}
 
-		const std::string& name  = iter.first;
-		const float&       value = iter.second;
+	if(from_id == to_id || amount == 0)
+	{
+		return false;
+	}
 
-		oss << " \"" << name << "\": " << std::to_string(value);
+	if(characterItemExists(from_id, item_name) == false
+		|| characterItemCount(from_id, item_name) < amount
+		)
+	{
+		return false;
 	}
 
-	oss << " }";
-	
-	return oss.str();
+	characterItemMove(from_id, to_id, item_name, amount);
+
+	return true;
 }
-#endif
 
 
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
 /**
- * \ingroup group_ToString
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \brief Yars::MapStringString to JSON formatted string
+ * \ingroup group_CharacterItem
  *
- * \return A JSON formatted string
+ * \brief Exchange Items between two Characters
+ *
+ * Each Character gives the other the Items listed for them.  Every Item on 
+ * both sides is checked first, if any Character does not have enough of an 
+ * Item then nothing is changed.
+ *
+ * \example
+ * yars.characterTrade(bubba, { { "Gold Coin", 50 } }
+ * 	, jimbo, { { "Sword", 1 }, { "Shield", 1 } }
+ * 	);
+ * \endexample
+ *
+ * \retval true  The Items were exchanged
+ * \retval false Nothing was changed
  */
-std::string Yars::to_string(const Yars::MapStringString& map ///< Object to convert
+bool Yars::characterTrade(const Yars::Id first_id ///< The first Character
+	, const Yars::MapStringUint32& first_item  ///< What the first Character gives
+	, const Yars::Id               second_id   ///< The second Character
+	, const Yars::MapStringUint32& second_item ///< What the second Character gives
 	) noexcept
 {
-	std::stringstream oss;
+	if(characterExists(first_id) == false
+		|| characterExists(second_id) == false
+		)
+	{
+		return false;
+	}
 
-	bool first = true;
-	for(const auto& iter : map)
+	if(first_id == second_id)
 	{
-		if(first == true)
-		{
-			first = false;
-			oss << "{";
-		}
-		else
+		return false;
+	}
+
+	const auto has_items = [&](const Yars::Id character_id, const Yars::MapStringUint32& item_map)
+	{
+		for(const auto& iter : item_map)
 		{
-			oss << ",";
+			if(iter.second == 0
+				|| characterItemExists(character_id, iter.first) == false
+				|| characterItemCount(character_id, iter.first) < iter.second
+				)
+			{
+				return false;
+			}
 		}
 
-		const std::string& name  = iter.first;
-		const std::string& value = iter.second;
+		return true;
+	};
 
-		oss << " \"" << name << "\": \"" << value << "\"";
+	if(has_items(first_id, first_item) == false
+		|| has_items(second_id, second_item) == false
+		)
+	{
+		return false;
 	}
 
-	oss << " }";
-	
-	return oss.str();
+	for(const auto& iter : first_item)
+	{
+		characterItemMove(first_id, second_id, iter.first, iter.second);
+	}
+
+	for(const auto& iter : second_item)
+	{
+		characterItemMove(second_id, first_id, iter.first, iter.second);
+	}
+
+	return true;
 }
-#endif
 
 
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
 /**
- * \ingroup group_ToString
+ * \brief Remove an Item from an Inventory
  *
- * \brief Yars::VectorId to JSON formatted string
+ * Every Item of \p item_name is removed.  A Prepared Action may be using one 
+ * of them, so the Character's Prepared Actions are invalidated.
  *
- * \return A JSON formatted string
+ * \note This method is private, there are no sanity checks.
  */
-std::string Yars::to_string(const Yars::VectorId& vector ///< Object to convert
+void Yars::characterItemErase(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
 	) noexcept
 {
-	std::stringstream oss;
+	character_item[character_id].erase(item_name);
 
-	oss << "[";
+	actionCharacterChanged(character_id);
+}
 
-	bool first = true;
-	for(const auto& value : vector)
+
+/**
+ * \brief Move Items between Inventories
+ *
+ * Partial stacks in the destination are filled first.  After that, stacks 
+ * are moved whole when they fit, only a stack that must be split is copied.
+ *
+ * \note This method is private, there are no sanity checks.
+ */
+void Yars::characterItemMove(const Yars::Id from_id ///< The Character giving the Items
+	, const Yars::Id     to_id     ///< The Character getting the Items
+	, const std::string& item_name ///< The Item name
+	, const uint32_t     amount    ///< The number of Items
+	) noexcept
+{
+	indexChanged(index_item,     from_id);
+	indexChanged(index_item,     to_id);
+	indexChanged(telemetry_item, from_id);
+	indexChanged(telemetry_item, to_id);
+
+	itemOwnerAdjust(from_id, item_name, -(int64_t)amount);
+	itemOwnerAdjust(to_id,   item_name, +(int64_t)amount);
+
+	Yars::MapStringCharacterItem& inventory = character_item[from_id];
+	Yars::CharacterItem&          source    = inventory[item_name];
+	Yars::CharacterItem&          target    = character_item[to_id][item_name];
+	const uint32_t                count_max = character_config[to_id].item_stack_max;
+
+	source.count -= amount;
+	target.count += amount;
+
+	uint32_t remaining = amount;
+	size_t   slot      = 0;
+
+	while(remaining > 0 && source.stack.empty() == false)
 	{
-		if(first == false)
+		Yars::Item& item = source.stack.back();
+
+		while(slot < target.stack.size() && target.stack[slot].count >= count_max)
 		{
-			oss << ",";
+			slot++;
 		}
 
-		oss << " " << std::to_string(value);
+		uint32_t count = std::min(remaining, item.count);
 
-		first = false;
+		if(slot < target.stack.size())
+		{
+			count = std::min(count, count_max - target.stack[slot].count);
+
+			target.stack[slot].count += count;
+			item.count               -= count;
+		}
+		else if(count == item.count && count <= count_max)
+		{
+			target.stack.push_back(std::move(item));
+			item.count = 0;
+		}
+		else
+		{
+			count = std::min(count, count_max);
+
+			target.stack.push_back(item);
+			target.stack.back().count = count;
+			item.count -= count;
+		}
+
+		if(item.count == 0)
+		{
+			source.stack.pop_back();
+		}
+
+		remaining -= count;
 	}
 
-	oss << " ]";
-	
-	return oss.str();
+	if(source.count == 0)
+	{
+		characterItemErase(from_id, item_name);
+	}
 }
-#endif
 
 
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
 /**
- * \ingroup group_ToString
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \brief Yars::VectorString to JSON formatted string
+ * \ingroup group_CharacterItem
  *
- * \return A JSON formatted string
+ * \brief Check if a Character has an Item
+ *
+ * Find out if a Character has the requested Item.
+ *
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * if(yars.characterItemExists(bubba, "Item"))
+ * {
+ * 	std::cout << "Bubba has an Item!\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The Character does have the Item
+ * \retval false The Character does not have the Item.
  */
-std::string Yars::to_string(const Yars::VectorString& vector ///< Object to convert
-	) noexcept
+bool Yars::characterItemExists(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	) const noexcept
 {
-	std::stringstream oss;
-
-	oss << "[";
-
-	if(vector.empty() == false)
+	if(safeMode())
 	{
-		oss << " \"";
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
 
-		std::copy(std::begin(vector), std::end(vector) - 1
-			, std::ostream_iterator<std::string>(oss, "\" ,\"")
-			);
+	const Yars::MapStringCharacterItem& inventory = character_item.at(character_id);
 
-		oss << vector.back();
-		oss << "\"";
+	if(inventory.contains(item_name))
+	{
+		return true;
 	}
 
-	oss << " ]";
-	
-	return oss.str();
+	return false;
 }
-#endif
 
-// }}}
-// {{{ Health
 
 /**
- * \defgroup group_Health Health
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \brief Health data and manipulation
+ * \ingroup group_CharacterItem
  *
- * The main components of Health in \yars is Yars::Health.current and 
- * Yars::Health.maximum.  The Yars::Health.current value can not be greater 
- * than the Yars::Health.maximum level.  Also, the Yars::Health.current value 
- * and the Yars::Health.maximum value can not be less than `0`.
+ * \brief Get the number of Items
  *
- * If the Yars::Health.current reaches a value of `0` that is to be considered 
- * as character death, or an Item is either broken or unusable.  If 
- * Yars::Health.maximum is `0` then it that character can not be healed or that 
- * item can not be repaired.
+ * Get a count of the number if instances of the specified Item.
  *
- * \bug Yars::Item does not have Yars::Health.  Determine if Yars::Health 
- * should be added to Yars::Item or if the documentation needs to be updated.
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
  *
- * If at any point the maximum health value is reduced to be below the current 
- * health value (using the health methods), the current health value will be 
- * automatically reduced.  This means that __order matters__.  For example:
- * 1. Bad order
- *   - health modifier is set to a large negative value
- *     - health maximum value is reduced to `0`
- *     - health current value is reduced to `0`
- *     - considered dead
- *   - health maximum base increased
- *     - health maximum value is > `0`
- *     - health current value is still `0`
- *     - still considered dead
- * 2. Good order
- *   - health maximum base increased
- *     - health maximum value is > `0`
- *     - health current value is > `0`
- *     - not dead
- *   - health modifier is set to a large negative value
- *     - health maximum value is still > `0`
- *     - health current value is still > `0`
- *     - still not dead
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item", 100);
  *
+ * uint32_t count = yars.characterItemCount(bubba, "Item");
+ * \endexample
  *
- * There is no concern of overflowing the Yars::Health values because they they 
- * are promoted to 64-bit values before any calculations are preformed.  The 
- * 64-bit values are then clamped to the valid range of values, then finally 
- * demoted back to 32-bit values.
+ * \return The number of Items
+ */
+uint32_t Yars::characterItemCount(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return 0;
+		}
+
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return 0;
+		}
+	}
+
+	uint32_t stacks = 0;
+
+	return this->characterItemCount(character_id, item_name, stacks);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * Using the health related methods is highly recommended.  Any value in 
- * Yars::Health that is modified to be outside a valid range will be reset the 
- * next time one of the health methods are called.
+ * \ingroup group_CharacterItem
  *
- * __Value Ranges__
+ * \brief Get the number of Items
  *
- * \f$Health.current=(0<=Health.current<=Health.maximum)\f$
+ * Get a count of the number if instances of the specified Item.  This method 
+ * will also provide the number of Item stacks.
  *
- * \f$Health.maximum=(0<=(Health.maximum\_base+Health.maximum\_modifier)<=Health\_Max)\f$
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
  *
- * \f$Health.maximum\_base=(0<=Health.maximum\_base<=Health\_Max)\f$
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item", 100);
  *
- * \f$Health.maximum\_modifier=(Health\_Min<=Health.maximum\_modifier<=Health\_Max)\f$
+ * uint32_t stacks = 0;
+ * uint32_t count = yars.characterItemCount(bubba, "Item", stacks);
+ * \endexample
  *
- * \see Yars::Health_Max
- * \see Yars::Health_Min
+ * \return The number of Items
  */
+uint32_t Yars::characterItemCount(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	, uint32_t&          stacks    ///< Store the number of Item stacks
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return 0;
+		}
 
-/**
- * \ingroup group_Health
- *
- * \struct Yars::Health
- *
- * \brief Health Data
- */
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return 0;
+		}
+	}
 
-/**
- * \var Yars::Health::current
- *
- * \brief The current amount of health
- */
+	const Yars::CharacterItem& character_item = this->character_item.at(character_id).at(item_name);
 
-/**
- * \var Yars::Health::maximum
- *
- * \brief The calculated value for the maximum amount of health
- */
+	stacks = character_item.stack.size();
 
-/**
- * \var Yars::Health::maximum_base
- *
- * \brief The base value of maximum health
- */
+	return character_item.count;
+}
 
-/**
- * \var Yars::Health::maximum_modifier
- *
- * \brief The maximum health modifier
- */
 
 /**
- * \typedef Yars::MapIdHealth
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \brief A convenience type.
- */
-
-/**
- * \ingroup group_Health
+ * \ingroup group_CharacterItem
  *
- * \var Yars::Health_Max
+ * \brief Get a list of Item names
  *
- * \brief The maximum health value.
- */
-
-/**
- * \ingroup group_Health
+ * Calling this method will provide a list of all the Item names that the 
+ * Character currently has.
  *
- * \var Yars::Health_Min
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
  *
- * \brief The minimum health value.
- */
-
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
-/**
- * \ingroup group_ToString
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
  *
- * \brief Yars::Health to JSON formatted string
+ * Yars::VectorString list = yars.characterItemList(bubba);
+ * \endexample
  *
- * \return A JSON formatted string
+ * \return A vector of Item names.
  */
-std::string Yars::to_string(const Yars::Health& health ///< Object to convert
-	) noexcept
+Yars::VectorString Yars::characterItemList(const Yars::Id character_id ///< The Character Id
+	) const noexcept
 {
-	std::stringstream oss;
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return {};
+		}
+	}
 
-	oss	<< "{ \"current\": "          << std::to_string(health.current)
-		<< ", \"maximum\": "          << std::to_string(health.maximum)
-		<< ", \"maximum_base\": "     << std::to_string(health.maximum_base)
-		<< ", \"maximum_modifier\": " << std::to_string(health.maximum_modifier)
-		<< " }"
-		;
-	
-	return oss.str();
+	const Yars::MapStringCharacterItem& inventory = character_item.at(character_id);
+
+	return Yars::mapKeyList(inventory);
 }
-#endif
 
 
 /**
- * \ingroup group_Health
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \brief Set health values.
+ * \ingroup group_CharacterItem
  *
- * The current health will be set as well as the maximum base value.
+ * \brief Get a list of Items usable by an Attacker
+ *
+ * Calling this method will provide a list of all the Item names that the 
+ * Character currently has and can use as an Attacker.
  *
  * \example
- * Yars::Health health;
- * Yars::healthSet(health, 200, 200);
- * // health.current == 200
- * // health.maximum == 200
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item", { .skill_attacker = { "Skill" } });
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * Yars::VectorString list = yars.characterItemListUsableByAttacker(bubba);
  * \endexample
+ *
+ * \see Yars::characterItemIsUsableByAttacker()
+ *
+ * \return A vector of Item names.
  */
-void Yars::healthSet(Yars::Health& health ///< The health data to modify.
-	, const uint32_t current          ///< The new current value.
-	, const uint32_t maximum          ///< The new maximum value.
-	) noexcept
+Yars::VectorString Yars::characterItemListUsableByAttacker(const Yars::Id character_id ///< The Character Id
+	) const noexcept
 {
-	health.current      = current;
-	health.maximum_base = std::min(maximum, (uint32_t)Yars::Health_Max);
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return {};
+		}
+	}
 
-	healthUpdate(health);
+	return characterItemListUsable(character_id
+		, &Yars::Item::skill_attacker
+		, &Yars::Item::skill_attacker_set
+		);
 }
 
 
 /**
- * \ingroup group_Health
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \brief Set the maximum modifier value.
+ * \ingroup group_CharacterItem
  *
- * The current health will be set as well as the maximum base value.
+ * \brief Get a list of Items usable by a Defender
+ *
+ * Calling this method will provide a list of all the Item names that the 
+ * Character currently has and can use as a Defender.
  *
  * \example
- * Yars::Health health;
- * Yars::healthSet(health, 200, 200);
- * Yars::healthModifierSet(health, -100);
- * // health.current == 100
- * // health.maximum == 100
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item", { .skill_defender = { "Skill" } });
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * Yars::VectorString list = yars.characterItemListUsableByDefender(bubba);
  * \endexample
+ *
+ * \see Yars::characterItemIsUsableByDefender()
+ *
+ * \return A vector of Item names.
  */
-void Yars::healthModifierSet(Yars::Health& health ///< The health data to modify.
-	, const int32_t modifier                  ///< The new modifier value
-	) noexcept
+Yars::VectorString Yars::characterItemListUsableByDefender(const Yars::Id character_id ///< The Character Id
+	) const noexcept
 {
-	health.maximum_modifier = modifier;
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return {};
+		}
+	}
 
-	healthUpdate(health);
+	return characterItemListUsable(character_id
+		, &Yars::Item::skill_defender
+		, &Yars::Item::skill_defender_set
+		);
 }
 
 
 /**
- * \ingroup group_Health
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \brief Adjust the current health value.
+ * \ingroup group_CharacterItem
  *
- * The current health value will be adjusted by the provided \p amount.
+ * \brief Check if an Item is usable.
+ *
+ * This method will determine if a Character has use the requested Item.
  *
  * \example
- * Yars::Health health;
- * Yars::healthSet(health, 200, 200);
- * Yars::healthAdjust(health, -10);
- * // health.current == 190
- * // health.maximum == 200
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.skill_defender = { "Skill" }
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * if(yars.characterItemIsUsable(bubba, "Item"))
+ * {
+ * 	std::cout << "Bubba can use Item!\n";
+ * }
  * \endexample
+ *
+ * \see Yars::itemIsUsable()
+ *
+ * \retval true  The Item is usable
+ * \retval false The Item is not usable
  */
-void Yars::healthAdjust(Yars::Health& health ///< The health data to modify.
-	, const int32_t amount               ///< The amount to change the current health
-	) noexcept
+bool Yars::characterItemIsUsable(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	) const noexcept
 {
-	const int64_t value = (int64_t)health.current + (int64_t)amount;
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 
-	health.current = (uint32_t)std::clamp(value
-		, (int64_t)0
-		, (int64_t)Yars::Health_Max
-		);
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return false;
+		}
+	}
 
-	healthUpdate(health);
+	const Yars::MapStringCharacterItem& inventory = character_item.at(character_id);
+
+	const Yars::Item& item = inventory.at(item_name).stack.front();
+
+	if(this->characterItemIsUsableByAttacker(character_id, item) == true)
+	{
+		return true;
+	}
+
+	if(this->characterItemIsUsableByDefender(character_id, item) == true)
+	{
+		return true;
+	}
+
+	return false;
 }
 
 
 /**
- * \ingroup group_Health
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \brief Adjust the maximum health value.
+ * \ingroup group_CharacterItem
  *
- * The maximum health value will be adjusted by the provided \p amount.
+ * \brief Check if an Item is usable.
+ *
+ * This method will determine if a Character has use the requested Item as an 
+ * "Attacker".
  *
  * \example
- * Yars::Health health;
- * Yars::healthSet(health, 200, 200);
- * Yars::healthMaximumAdjust(health, -10);
- * // health.current == 190
- * // health.maximum == 190
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.skill_defender = { "Skill" }
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * if(yars.characterItemIsUsableByAttacker(bubba, "Item"))
+ * {
+ * 	std::cout << "Bubba can use Item as an Attacker!\n";
+ * }
  * \endexample
+ *
+ * \see Yars::itemIsUsableByAttacker()
+ *
+ * \retval true  The Item is usable
+ * \retval false The Item is not usable
  */
-void Yars::healthMaximumAdjust(Yars::Health& health ///< The health data to modify.
-	, const int32_t amount                      ///< The amount to change the current health
-	) noexcept
+bool Yars::characterItemIsUsableByAttacker(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	) const noexcept
 {
-	const int64_t value = (int64_t)health.maximum_base + (int64_t)amount;
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 
-	health.maximum_base = (uint32_t)std::clamp(value
-		, (int64_t)0
-		, (int64_t)Yars::Health_Max
-		);
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return false;
+		}
+	}
 
-	healthUpdate(health);
+	const Yars::MapStringCharacterItem& inventory = character_item.at(character_id);
+
+	const Yars::Item& item = inventory.at(item_name).stack.front();
+
+	return characterItemIsUsableByAttacker(character_id, item);
 }
 
 
 /**
- * \ingroup group_Health
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \brief Adjust the modifier health value.
+ * \ingroup group_CharacterItem
  *
- * The maximum health modifier value will be adjusted by the provided \p 
- * amount.
+ * \brief Check if an Item is usable.
+ *
+ * This method will determine if a Character has use the requested Item with 
+ * the specified Skill as an "Attacker".
  *
  * \example
- * Yars::Health health;
- * Yars::healthSet(health, 200, 200);
- * Yars::healthModifierAdjust(health, -10);
- * // health.current == 190
- * // health.maximum == 190
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.skill_defender = { "Skill" }
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * if(yars.characterItemIsUsableByAttacker(bubba, "Item", "Skill"))
+ * {
+ * 	std::cout << "Bubba can use Item as an Attacker!\n";
+ * }
  * \endexample
+ *
+ * \see Yars::itemIsUsableByAttacker()
+ *
+ * \retval true  The Item is usable
+ * \retval false The Item is not usable
  */
-void Yars::healthModifierAdjust(Yars::Health& health ///< The health data to modify.
-	, const int32_t amount                       ///< The amount to change the current health
-	) noexcept
+bool Yars::characterItemIsUsableByAttacker(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name  ///< The Item name
+	, const std::string& skill_name ///< The Skill name
+	) const noexcept
 {
-	const int64_t value = (int64_t)health.maximum_modifier + (int64_t)amount;
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 
-	health.maximum_modifier = (uint32_t)std::clamp(value
-		, (int64_t)Yars::Health_Min
-		, (int64_t)Yars::Health_Max
-		);
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return false;
+		}
+	}
 
-	healthUpdate(health);
+	const Yars::MapStringCharacterItem& inventory = character_item.at(character_id);
+
+	const Yars::Item& item = inventory.at(item_name).stack.front();
+
+	if(Yars::vectorContains(item.skill_attacker, skill_name) == false)
+	{
+		return false;
+	}
+
+	return true;
 }
 
 
 /**
- * \ingroup group_Health
+ * \todo{InventoryRewrite} Should this method be private?
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \brief Increase the current health value.
+ * \ingroup group_CharacterItem
  *
- * The current health value will be increased to the maximum value.
+ * \brief Check if an Item is usable.
+ *
+ * This method will determine if a Character has use the requested Item.
  *
  * \example
- * Yars::Health health;
- * Yars::healthSet(health, 200, 200);
- * Yars::healthAdjust(health, -90);
- * Yars::healthIncreaseToMaximum(health);
- * // health.current == 200
- * // health.maximum == 200
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.skill_defender = { "Skill" }
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * if(yars.characterItemIsUsableByAttacker(bubba, yars.characterItem("Item")))
+ * {
+ * 	std::cout << "Bubba can use Item as an Attacker!\n";
+ * }
  * \endexample
- */
-void Yars::healthIncreaseToMaximum(Yars::Health& health ///< The health data to modify.
-	) noexcept
-{
-	health.current = health.maximum;
-
-	healthUpdate(health);
-}
-
-
-/**
- * \ingroup group_Health
  *
- * \brief Update the current and maximum values
+ * \see Yars::itemIsUsableByAttacker()
+ *
+ * \retval true  The Item is usable
+ * \retval false The Item is not usable
  */
-void Yars::healthUpdate(Yars::Health& health ///< The health data to modify.
-	) noexcept
+bool Yars::characterItemIsUsableByAttacker(const Yars::Id character_id ///< The Character Id
+	, const Yars::Item& item ///< The Item
+	) const noexcept
 {
-	int64_t value = (int64_t)health.maximum_base + (int64_t)health.maximum_modifier;
-
-	health.maximum = (uint32_t)std::clamp(value
-		, (int64_t)0
-		, (int64_t)Yars::Health_Max
-		);
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
 
-	health.current = std::clamp(health.current
-		, (uint32_t)0
-		, health.maximum
+	return skillSetAny(characterSkillSet(character_id)
+		, character_skill.at(character_id)
+		, item.skill_attacker
+		, item.skill_attacker_set
 		);
 }
 
-// }}}
-// {{{ Level
 
 /**
- * \todo Determine if Level value can be negative without any problems.
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \defgroup group_Level Level
+ * \ingroup group_CharacterItem
  *
- * \brief Level data and manipulation
+ * \brief Check if an Item is usable.
  *
- * Level plays an important role in \yars because it determines how strong the 
- * character's attributes and skills are.  The following aspects make up a 
- * Level:
- * - __Value__<br>
- *   This is the raw value of a Level, such as "Skill is Level 5".  When a 
- *   Yars::Skill or an Yars::Attribute refers to a Level, this is the value 
- *   that is used.
- *   <br><br>
- * - __Partial__<br>
- *   When a Level increases, the amount of the increase is a floating point 
- *   number.  The partial values accumulate the level increases until the 
- *   amount reaches the threshold to increase the __value__.
- *   <br><br>
- * - __Modifier__<br>
- *   The modifier is a bonus or penalty that is applied to the __value__.
+ * This method will determine if a Character has use the requested Item as an 
+ * "Defender".
  *
- * The requirements for a level increase is: 
- * \f$Level.partial>=Level.value\_base\f$
- * When the requirements are satisfied, Level.partial is decreased by 
- * Level.value_base then the Level.value_base is increased by 1.  Finally, the 
- * Level.modifier is applied and the result is stored in Level.value.
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.skill_defender = { "Skill" }
+ * 	});
  *
- * The reason that the Level.modifier is applied to Level.value_base and not 
- * Level.partial is to maintain the effectiveness of the modifier.  The higher 
- * the Level.value is, the less likely it is that an increase to Level.partial 
- * will matter.  Applying the modifier to the value, a +1 is useful to all 
- * levels.
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
  *
- * The Level.modifier only takes affect when the Level.value_base is greater 
- * than `0`.  The Level.value will never go below `0`, regardless of the 
- * Level.modifier value.
- */
-
-/**
- * \ingroup group_Level
+ * if(yars.characterItemIsUsableByDefender(bubba, "Item"))
+ * {
+ * 	std::cout << "Bubba can use Item as a Defender!\n";
+ * }
+ * \endexample
  *
- * \struct Yars::Level
+ * \see Yars::itemIsUsableByDefender()
  *
- * \brief %Level Data
+ * \retval true  The Item is usable
+ * \retval false The Item is not usable
  */
+bool Yars::characterItemIsUsableByDefender(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 
-/**
- * \bug Create a partial_base that tracks the uint32_t partial value.  The 
- * partial will still collect the increases and for each whole number above 
- * zero, that value will be added to partial_base.  __Avoid rounding errors in 
- * higher floating point values.__
- *
- * \var Yars::Level::partial
- *
- * \brief %Level increase accumulator.
- */
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return false;
+		}
+	}
 
-/**
- * \var Yars::Level::modifier
- *
- * \brief Modify the %Level value
- */
+	const Yars::MapStringCharacterItem& inventory = character_item.at(character_id);
 
-/**
- * \var Yars::Level::value
- *
- * \brief %Level value.
- */
+	const Yars::Item& item = inventory.at(item_name).stack.front();
+
+	return characterItemIsUsableByDefender(character_id, item);
+}
 
-/**
- * \var Yars::Level::value_base
- *
- * \brief The raw %Level value.
- */
 
 /**
- * \ingroup group_Level
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \var Yars::Level_Max
+ * \ingroup group_CharacterItem
  *
- * \brief The maximum level value.
- */
-
-/**
- * \ingroup group_Level
+ * \brief Check if an Item is usable.
  *
- * \var Yars::Level_Min
+ * This method will determine if a Character has use the requested Item with 
+ * the specified Skill as an "Defender".
  *
- * \brief The minimum level value.
- */
-
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
-/**
- * \ingroup group_ToString
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.skill_defender = { "Skill" }
+ * 	});
  *
- * \brief Yars::Level to JSON formatted string
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
  *
- * \return A JSON formatted string
+ * if(yars.characterItemIsUsableByDefender(bubba, "Item", "Skill"))
+ * {
+ * 	std::cout << "Bubba can use Item as a Defender!\n";
+ * }
+ * \endexample
+ *
+ * \see Yars::itemIsUsableByDefender()
+ *
+ * \retval true  The Item is usable
+ * \retval false The Item is not usable
  */
-std::string Yars::to_string(const Yars::Level& level ///< Object to convert
-	) noexcept
+bool Yars::characterItemIsUsableByDefender(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name  ///< The Item name
+	, const std::string& skill_name ///< The Skill name
+	) const noexcept
 {
-	std::stringstream oss;
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 
-	oss	<< "{ \"value_base\": " << level.value_base
-		<< ", \"value\": "      << level.value
-		<< ", \"partial\": "    << std::to_string(level.partial)
-		<< ", \"modifier\": "   << level.modifier
-		<< " }"
-		;
-	
-	return oss.str();
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return false;
+		}
+	}
+
+	const Yars::MapStringCharacterItem& inventory = character_item.at(character_id);
+
+	const Yars::Item& item = inventory.at(item_name).stack.front();
+
+	if(Yars::vectorContains(item.skill_defender, skill_name) == false)
+	{
+		return false;
+	}
+
+	return true;
 }
-#endif
 
 
 /**
- * \ingroup group_Level
+ * \todo{InventoryRewrite} Should this method be private?
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \brief Increase the Level
+ * \ingroup group_CharacterItem
  *
- * Increase the provided \p level with the specified \p amount.  If \p amount 
- * is less than `0`, then the method will just return `0`.
+ * \brief Check if an Item is usable.
+ *
+ * This method will determine if a Character has use the requested Item.
  *
  * \example
- * Yars::Level level;
- * Yars::levelIncrease(level, 1.5f);
- * // level.modifier   == 0
- * // level.partial    == 0.5
- * // level.value_base == 1
- * // level.value      == 1
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.skill_defender = { "Skill" }
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * if(yars.characterItemIsUsableByDefender(bubba, yars.characterItem("Item")))
+ * {
+ * 	std::cout << "Bubba can use Item as a Defender!\n";
+ * }
  * \endexample
  *
- * \return The number of levels gained
+ * \see Yars::itemIsUsableByDefender()
+ *
+ * \retval true  The Item is usable
+ * \retval false The Item is not usable
  */
-uint32_t Yars::levelIncrease(Yars::Level& level ///< The Level to increase
-	, const float amount                    ///< The amount to increase
-	) noexcept
+bool Yars::characterItemIsUsableByDefender(const Yars::Id character_id ///< The Character Id
+	, const Yars::Item& item ///< The Item
+	) const noexcept
 {
-	if(amount < 0)
-	{
-		return 0;
-	}
-
-	level.partial += amount;
-
-	uint32_t level_up = 0;
-
-	if(level.partial >= 1)
+	if(safeMode())
 	{
-		if(level.value_base == 0)
-		{
-			level.value_base = 1;
-			level.partial -= 1.0f;
-			level_up++;
-		}
-
-		while(level.partial >= level.value_base)
+		if(characterExists(character_id) == false)
 		{
-			level.partial -= level.value_base;
-			level.value_base++;
-			level_up++;
+			return false;
 		}
 	}
 
-	levelUpdate(level);
-
-	return level_up;
+	return skillSetAny(characterSkillSet(character_id)
+		, character_skill.at(character_id)
+		, item.skill_defender
+		, item.skill_defender_set
+		);
 }
 
 
 /**
- * \ingroup group_Level
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \brief Adjust the modifier value
+ * \ingroup group_CharacterItem
  *
- * Apply the \p amount to the Level modifier.
+ * \brief Restack all Items
+ *
+ * All the Items that the Character has will be restacked in the most optimum 
+ * way possible.
  *
  * \example
- * Yars::Level level;
- * Yars::levelIncrease(level, 1.5f);
- * Yars::levelModifierAdjust(level, 2);
- * // level.modifier   == 2
- * // level.partial    == 0.5
- * // level.value_base == 1
- * // level.value      == 3
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item", 20);
+ * yars.characterItemAdd(bubba, "Item", 40);
+ * yars.characterItemRestack(bubba);
  * \endexample
+ *
+ * \retval true  Successfully restacked the Items
+ * \retval false Failed to restack the Items
  */
-void Yars::levelModifierAdjust(Yars::Level& level ///< The Level modifier to increase
-	, const int32_t amount                    ///< The amount to increase
+bool Yars::characterItemRestack(const Yars::Id character_id ///< The Character Id
 	) noexcept
 {
-	int64_t modifier = (int64_t)level.modifier + (int64_t)amount;
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
 
-	level.modifier = (int32_t)std::clamp(modifier
-		, (int64_t)Yars::Level_Min
-		, (int64_t)Yars::Level_Max
-		);
+	Yars::VectorString name_list = characterItemList(character_id);
 
-	levelUpdate(level);
+	for(const auto& item_name : name_list)
+	{
+		characterItemRestack(character_id, item_name);
+	}
+
+	return true;
 }
 
 
 /**
- * \ingroup group_Level
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \brief Set the Level
+ * \ingroup group_CharacterItem
  *
- * The Level value and partial will be set as specified.  If the partial value 
- * is large enough, the level value will be adjusted accordingly.
+ * \brief Restack Items
+ *
+ * All the Items, with a matching name, that the Character has will be 
+ * restacked in the most optimum way possible.
  *
  * \example
- * Yars::Level level;
- * Yars::levelSet(level, 1, 0.5f);
- * // level.modifier   == 0
- * // level.partial    == 0.5
- * // level.value_base == 1
- * // level.value      == 1
+ * Yars yars;
+ * yars.itemAdd("Item", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item", 20);
+ * yars.characterItemAdd(bubba, "Item", 40);
+ * yars.characterItemRestack(bubba, "Item");
  * \endexample
+ *
+ * \retval true  Successfully restacked the Items
+ * \retval false Failed to restack the Items
  */
-void Yars::levelSet(Yars::Level& level ///< The Level to set
-	, const int32_t value          ///< The new Level value
-	, const float partial          ///< The new Level partial value
+bool Yars::characterItemRestack(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
 	) noexcept
 {
-	level.value_base = value;
-	level.partial    = 0;
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 
-	levelIncrease(level, partial);
-}
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return false;
+		}
+	}
 
+	indexChanged(index_item,     character_id);
+	indexChanged(telemetry_item, character_id);
 
-/**
- * \ingroup group_Level
- *
- * \brief Update the Level value
- *
- */
-void Yars::levelUpdate(Yars::Level& level
-	) noexcept
-{
-	// Level modifiers only apply if the base value is not 0
-	if(level.value_base == 0)
+	Yars::MapStringCharacterItem& inventory      = this->character_item[character_id];
+	Yars::CharacterItem&          character_item = inventory[item_name];
+	Yars::VectorItem&             stack          = character_item.stack;
+	const uint32_t                count_max      = character_config[character_id].item_stack_max;
+
+	// The stack counts are the authority, this also re-syncs the cache
+	uint32_t remaining = 0;
+	for(const Yars::Item& item : stack)
 	{
-		level.value = 0;
+		remaining += item.count;
 	}
-	else
+
+	itemOwnerAdjust(character_id, item_name, (int64_t)remaining - character_item.count);
+
+	if(remaining == 0)
 	{
-		int64_t value = (int64_t)level.value_base + (int64_t)level.modifier;
-		level.value = (int32_t)std::clamp(value
-			, (int64_t)0
-			, (int64_t)std::numeric_limits<int32_t>::max()
-			);
+		characterItemErase(character_id, item_name);
+
+		return true;
 	}
-}
 
-// }}}
-// {{{ Attribute
+	character_item.count = remaining;
 
-/**
- * \defgroup group_Attribute Attribute
- *
- * \brief Attributes
- *
- * Attributes are optional elements of Skills and if present, they provide 
- * additional bonus to the Skill.
- *
- * Creating Attributes is automatic but if Attributes needs to be added 
- * manually, they only have two parts:
- * - __Level__<br>
- *   The Level of a Attribute represents how much it can influence a Skill.
- *   <br><br>
- * - __Name__<br>
- *   All Attributes must have a name.  No two Attributes may have the same 
- *   name.
- *
- * Attributes can not be used directly in \yars.  When Skills are used, they 
- * will used the Attributes Level as needed.
- *
- * Attributes that are added directly to the Yars class are treated as the 
- * baseline Attributes.  This means that if an Attribute is added to Yars and 
- * it is set to have a Level value of 10, then when that same Attribute is 
- * added to a Character the Attribute for Yars is copied into the Character.
- *
- * Currently, Attributes can not be removed.  The reason is that Skills can be 
- * added and removed which could cause the Attribute to be added right back.  
- * And adding some type of "count" to the Attribute to track the number of 
- * dependencies to determine when to "clean" unused Attributes does not out 
- * weigh the overhead.  Yet.
- */
+	const size_t stack_count = ((remaining - 1) / count_max) + 1;
 
-/**
- * \ingroup group_Attribute
- *
- * \struct Yars::Attribute
- *
- * \brief Attribute data
- */
+	stack.resize(stack_count, stack.front());
 
-/**
- * \var Yars::Attribute::level
- *
- * \brief The level of the Attribute.
- */
+	for(Yars::Item& item : stack)
+	{
+		item.count = std::min(remaining, count_max);
+		remaining -= item.count;
+	}
 
-/**
- * \typedef Yars::MapStringAttribute
- *
- * \brief A convenience type
- */
+	return true;
+}
 
-/**
- * \typedef Yars::MapIdMapStringAttribute
- *
- * \brief A convenience type
- */
 
 /**
- * \var Yars::attribute_map
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \brief A collection of Attributes
- */
-
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
-/**
- * \ingroup group_ToString
+ * \ingroup group_CharacterItem
  *
- * \brief Yars::Attribute to JSON formatted string
+ * \brief Select a Skill for an Item
  *
- * \return A JSON formatted string
- */
-std::string Yars::to_string(const Yars::Attribute& attribute ///< Object to convert
-	) noexcept
-{
-	std::stringstream oss;
-
-	oss	<< "{ \"level\": "
-		<< Yars::to_string(attribute.level)
-		<< " }"
-		;
-	
-	return oss.str();
-}
-#endif
-
-
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
-/**
- * \ingroup group_ToString
+ * This method to determine what the best Skill to use an Item.  Attributes are 
+ * not considered, so it is possible that another Skill may be better.  This is 
+ * intentional so that the "best" skill may not be automatically found.
  *
- * \brief Yars::MapStringAttribute to JSON formatted string
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.skill_defender = { "Skill" }
+ * 	});
  *
- * \return A JSON formatted string
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * std::string skill_name = yars.characterItemSkillAttacker(bubba, "Item");
+ * \endexample
+ *
+ * \return The Skill name
  */
-std::string Yars::to_string(const Yars::MapStringAttribute& attribute_map ///< Object to convert
-	) noexcept
+std::string Yars::characterItemSkillAttacker(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	) const noexcept
 {
-	std::stringstream oss;
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return {};
+		}
 
-	oss << "{";
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return {};
+		}
+	}
 
-	bool first = true;
-	for(const auto& iter : attribute_map)
+	const Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
+	const Yars::Item&           item      = characterItem(character_id, item_name);
+
+	int32_t     skill_level = 0;
+	std::string skill_name  = "";
+
+	for(const auto& name : item.skill_attacker)
 	{
-		if(first == false)
+		auto iter = skill_map.find(name);
+		if(iter == skill_map.end())
 		{
-			oss << ",";
+			continue;
 		}
 
-		const std::string&     name      = iter.first;
-		const Yars::Attribute& attribute = iter.second;
-
-		oss	<< " \""
-			<< name
-			<< "\": "
-			<< Yars::to_string(attribute)
-			;
+		const Yars::Skill& skill = iter->second;
 
-		first = false;
+		if(skill.level.value > skill_level)
+		{
+			skill_level = skill.level.value;
+			skill_name  = name;
+		}
 	}
 
-	oss << " }";
-
-	return oss.str();
+	return skill_name;
 }
-#endif
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
  * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \ingroup group_Attribute
+ * \ingroup group_CharacterItem
  *
- * \brief Get an Attribute
+ * \brief Get a list of usable Skills for an Item
  *
- * Access an Attribute.
+ * A list of Skill names will be created of all the Skills that a Character can 
+ * use with the specified Item.
  *
  * \example
  * Yars yars;
- * yars.attributeAdd("Attr");
- * Yars::Attribute& attr = yars.attribute("Attr");
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.skill_defender = { "Skill" }
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * Yars::VectorString list = yars.characterItemSkillAttacker(bubba, "Item");
  * \endexample
  *
- * \return An Attribute
+ * \return A vector of Skill names
  */
-Yars::Attribute& Yars::attribute(const std::string& attribute_name ///< The Attribute name
-	) noexcept
+Yars::VectorString Yars::characterItemSkillAttackerList(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(attribute_name.empty())
+	if(safeMode())
 	{
-		//ZAKERO_YARS_DEBUG << "Bad Name" << std::endl;
-		Attribute* retval = nullptr;
-		return *retval;
+		if(characterExists(character_id) == false)
+		{
+			return {};
+		}
+
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return {};
+		}
 	}
 
-	if(attributeExists(attribute_name) == false)
+	const Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
+	const Yars::Item&           item      = characterItem(character_id, item_name);
+
+	Yars::VectorString list;
+
+	for(const auto& name : item.skill_attacker)
 	{
-		//ZAKERO_YARS_DEBUG << "Does Not Exist" << std::endl;
-		Attribute* retval = nullptr;
-		return *retval;
+		if(skill_map.contains(name) == false)
+		{
+			continue;
+		}
+
+		list.push_back(name);
 	}
-#endif
 
-	return attribute_map[attribute_name];
+	return list;
 }
 
 
@@ -1942,997 +12559,928 @@ Yars::Attribute& Yars::attribute(const std::string& attribute_name ///< The Attr
  * \todo{DebugMessage} Add debugging messages
  * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \ingroup group_Attribute
+ * \ingroup group_CharacterItem
  *
- * \brief Get an Attribute
+ * \brief Select a Skill for an Item
  *
- * Access an Attribute.
+ * This method to determine what the best Skill to use an Item.  Attributes are 
+ * not considered, so it is possible that another Skill may be better.  This is 
+ * intentional so that the "best" skill may not be automatically found.
  *
  * \example
  * Yars yars;
- * yars.attributeAdd("Attr");
- * const Yars& y = yars;
- * const Yars::Attribute& attr = y.attribute("Attr");
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.skill_defender = { "Skill" }
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * std::string skill_name = yars.characterItemSkillDefender(bubba, "Item");
  * \endexample
+ *
+ * \return The Skill name
  */
-const Yars::Attribute& Yars::attribute(const std::string& attribute_name ///< The Attribute name
+std::string Yars::characterItemSkillDefender(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(attribute_name.empty())
+	if(safeMode())
 	{
-		//ZAKERO_YARS_DEBUG << "Bad Name" << std::endl;
-		Attribute* retval = nullptr;
-		return *retval;
+		if(characterExists(character_id) == false)
+		{
+			return {};
+		}
+
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return {};
+		}
 	}
 
-	if(attributeExists(attribute_name) == false)
+	const Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
+	const Yars::Item&           item      = characterItem(character_id, item_name);
+
+	int32_t     skill_level = 0;
+	std::string skill_name  = "";
+
+	for(const auto& name : item.skill_defender)
 	{
-		//ZAKERO_YARS_DEBUG << "Does Not Exist" << std::endl;
-		Attribute* retval = nullptr;
-		return *retval;
+		auto iter = skill_map.find(name);
+		if(iter == skill_map.end())
+		{
+			continue;
+		}
+
+		const Yars::Skill& skill = iter->second;
+
+		if(skill.level.value > skill_level)
+		{
+			skill_level = skill.level.value;
+			skill_name  = name;
+		}
 	}
-#endif
 
-	return attribute_map.at(attribute_name);
+	return skill_name;
 }
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \ingroup group_Attribute
+ * \ingroup group_CharacterItem
  *
- * \brief Add an Attribute
+ * \brief Get a list of usable Skills for an Item
  *
- * Add a new Attribute.
+ * A list of Skill names will be created of all the Skills that a Character can 
+ * use with the specified Item.
  *
  * \example
  * Yars yars;
- * yars.attributeAdd("Attr");
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.skill_defender = { "Skill" }
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * Yars::VectorString list = yars.characterItemSkillDefender(bubba, "Item");
  * \endexample
  *
- * \retval true  The Attribute was added
- * \retval false Failed to add the Attribute
+ * \return A vector of Skill names
  */
-bool Yars::attributeAdd(const std::string& attribute_name ///< The Attribute name
-	) noexcept
+Yars::VectorString Yars::characterItemSkillDefenderList(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(attribute_name.empty())
+	if(safeMode())
 	{
-		//ZAKERO_YARS_DEBUG << "Bad Name" << std::endl;
-		return false;
-	}
+		if(characterExists(character_id) == false)
+		{
+			return {};
+		}
 
-	if(attributeExists(attribute_name))
-	{
-		//ZAKERO_YARS_DEBUG << "Already Exists" << std::endl;
-		return false;
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return {};
+		}
 	}
-#endif
 
-	attribute_map[attribute_name] = {};
-
-	return true;
-}
+	const Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
+	const Yars::Item&           item      = characterItem(character_id, item_name);
 
+	Yars::VectorString list;
 
-/**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_Attribute
- *
- * \brief Check if an Attribute already exists
- *
- * \example
- * Yars yars;
- * yars.attributeAdd("Attr");
- * if(yars.attributeExists("Attr"))
- * {
- * 	std::cout << "Woot!\n";
- * }
- * \endexample
- *
- * \retval true  The Attribute was added
- * \retval false Failed to add the Attribute
- */
-bool Yars::attributeExists(const std::string& attribute_name ///< The Attribute name
-	) const noexcept
-{
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(attribute_name.empty())
+	for(const auto& name : item.skill_defender)
 	{
-		//ZAKERO_YARS_DEBUG << "Bad Name" << std::endl;
-		return false;
+		if(skill_map.contains(name) == false)
+		{
+			continue;
+		}
+
+		list.push_back(name);
 	}
-#endif
 
-	return attribute_map.contains(attribute_name);
+	return list;
 }
 
 // }}}
-// {{{ Skill
+// {{{ Character: Equipment
 
 /**
- * \defgroup group_Skill Skill
- *
- * \brief Skills
- *
- * Skills are the core of \yars.  For anything to interact with anything else 
- * there must be a Skill that allows the interaction.  Most methods in the Yars 
- * class only require the name of the Skill.
- *
- * Creating Skills is very easy and consists of three parts:
- * - __Attributes__<br>
- *   This defines which Attributes will apply when the Skill is used.  These 
- *   Attribute will automatically be added to a Character if the Character does 
- *   not have them.
- *   <br><br>
- * - __Level__<br>
- *   The Level of a Skill represents how effective it is.  This effectiveness 
- *   is relative however.  If an attacker is using a Skill with a Level of 10 
- *   and the defender is using a Skill with a Level of 8, then the attacker's 
- *   Skill Level is actually 2.  (attacker - defender = 10 - 8 = 2).
- *   <br><br>
- * - __Name__<br>
- *   All Skills must have a name.  No two Skills may have the same name.
- *
- * The main use of Skills is with [Affects](\ref group_Affect).
+ * \todo{Equipment} Be able to define equipment locations.
+ * - characterEquipmentLocationAdd(const Yars::Id, const std::string&)
+ * - characterEquipmentLocationAdd(const Yars::Id, const Yars::VectorString&)
+ * - characterEquipmentLocationRemove(const Yars::Id, const std::string&)
+ * - characterEquipmentLocationRemoveAll(const Yars::Id)
+ * - characterEquipmentLocationDisable(const Yars::Id, const std::string&)
+ * - characterEquipmentLocationEnable(const Yars::Id, const std::string&)
  *
- * Skills must be added to the Yars class before they can be added to a 
- * Character.  When added to a Character, the Skill is copied from the Yars 
- * class into the Character.  If the Skill is changed in the Yars class after 
- * it was added to a Character, the Character will __not__ see the changes.
+ * \ingroup group_Character
  *
- * To learn how the Yars::Skill.attribute_contribution is used, refer to 
- * Yars::calculateModifier().
- */
-
-/**
- * \ingroup group_Skill
+ * \defgroup group_CharacterEquipment Equipment
  *
- * \struct Yars::Skill
+ * \brief A Character's Equipment
  *
- * \brief Skill data
- */
-
-/**
- * \var Yars::Skill::attribute_contribution
+ * Equipment allows the passive modifiers of an Item to affect a Character.  
+ * What separates equipable items from unequipable items? Nothing in \yars 
+ * enforces that distinction, so any item can be equipped.
  *
- * \brief Attribute names and how much they contribute.
- */
-
-/**
- * \var Yars::Skill::level
+ * When an Item is equipped, the Yars::Item::modify_attribute,
+ * Yars::Item::modify_skill, Yars::Item::modify_health_current, and 
+ * Yars::Item::modify_health_maximum will be applied to the Character. Of 
+ * course unequipping the Item will reverse these affects.  However, be careful 
+ * when removing equipment! For example, if a Character has less than 5 health 
+ * and unequips an Item that with a `modify_health_current +5`, this will drop 
+ * the Character's health to `0` and kill that Character.
  *
- * \brief The Skill level.
+ * Equipment is based on location.  Locations are free-form strings that make 
+ * sense for the RPG.
  */
 
 /**
- * \typedef Yars::MapStringSkill
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{Equipment}    Rename to `characterEquipment()`
  *
- * \brief A convenience type.
- */
-
-/**
- * \typedef Yars::MapIdMapStringSkill
+ * \ingroup group_CharacterEquipment
  *
- * \brief A convenience type.
- */
-
-/**
- * \var Yars::skill_map
+ * \brief Access a piece of equipment.
  *
- * \brief A collection of Skills.
- */
-
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
-/**
- * \ingroup group_ToString
+ * Provides access to an equipped Item.
  *
- * \brief Yars::Skill to JSON formatted string
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
  *
- * \return A JSON formatted string
- */
-std::string Yars::to_string(const Yars::Skill& skill ///< Object to convert
-	) noexcept
-{
-	std::stringstream oss;
-
-	oss	<< "{ \"level\": "
-		<< Yars::to_string(skill.level)
-		<< ", \"attribute_contribution\": " << Yars::to_string(skill.attribute_contribution)
-		<< " }"
-		;
-	
-	return oss.str();
-}
-#endif
-
-
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
-/**
- * \ingroup group_ToString
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
  *
- * \brief Yars::MapStringSkill to JSON formatted string
+ * yars.characterEquipmentAdd(bubba, "Location", "Item");
+ * Yars::Item& item = yars.characterEquipmentItem(bubba, "Location");
+ * \endexample
  *
- * \return A JSON formatted string
+ * \return A reference to an Item
  */
-std::string Yars::to_string(const Yars::MapStringSkill& skill_map ///< Object to convert
+Yars::Item& Yars::characterEquipmentItem(const Yars::Id character_id ///< The Character Id
+	, const std::string& location ///< The location
 	) noexcept
 {
-	std::stringstream oss;
-
-	oss << "{";
-
-	bool first = true;
-	for(const auto& iter : skill_map)
+	if(safeMode())
 	{
-		if(first == false)
+		if(characterExists(character_id) == false)
 		{
-			oss << ",";
+			Yars::Item* item = nullptr;
+			return *item;
 		}
 
-		const std::string& name  = iter.first;
-		const Yars::Skill& skill = iter.second;
-
-		oss	<< " \""
-			<< name
-			<< "\": "
-			<< Yars::to_string(skill)
-			;
-
-		first = false;
+		if(characterEquipmentExists(character_id, location) == false)
+		{
+			Yars::Item* item = nullptr;
+			return *item;
+		}
 	}
 
-	oss << " }";
-	
-	return oss.str();
+	Yars::MapStringItem& equipment_item = character_equipment_item.at(character_id);
+
+	return equipment_item[location];
 }
-#endif
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ * \todo{Equipment}    Rename to `characterEquipment()`
  *
- * \ingroup group_Skill
+ * \ingroup group_CharacterEquipment
  *
- * \brief Get an Skill
+ * \brief Access a piece of equipment.
  *
- * Access a Skill.
+ * Provides access to an equipped Item.
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Skill", {});
- * Yars::Skill& skill = yars.skill("Skill");
+ * yars.itemAdd("Item", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * yars.characterEquipmentAdd(bubba, "Location", "Item");
+ *
+ * const Yars& y = yars;
+ * const Yars::Item& item = y.characterEquipmentItem(bubba, "Location");
  * \endexample
  *
- * \return A Skill
+ * \return A reference to an Item
  */
-Yars::Skill& Yars::skill(const std::string& skill_name ///< The Skill name
-	) noexcept
+const Yars::Item& Yars::characterEquipmentItem(const Yars::Id character_id ///< The Character Id
+	, const std::string& location ///< The location
+	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(skill_name.empty())
+	if(safeMode())
 	{
-		Skill* retval = nullptr;
-		return *retval;
-	}
+		if(characterExists(character_id) == false)
+		{
+			Yars::Item* item = nullptr;
+			return *item;
+		}
 
-	if(skillExists(skill_name) == false)
-	{
-		Skill* retval = nullptr;
-		return *retval;
+		if(characterEquipmentExists(character_id, location) == false)
+		{
+			Yars::Item* item = nullptr;
+			return *item;
+		}
 	}
-#endif
 
-	return skill_map[skill_name];
+	const Yars::MapStringItem& equipment_item = character_equipment_item.at(character_id);
+
+	return equipment_item.at(location);
 }
 
 
 /**
+ * \deprecated{InventoryRewrite}
+ *
  * \todo{DebugMessage} Add debugging messages
  * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \ingroup group_Skill
+ * \ingroup group_CharacterEquipment
  *
- * \brief Get an Skill
+ * \brief Get the name of a piece of equipment.
  *
- * Access a Skill.
+ * Get the name of the equipped Item at the specified \p location.  If the 
+ * equipment location does not have an Item, then an empty string will be 
+ * returned.
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Skill", {});
- * const Yars& y = yars;
- * const Yars::Skill& skill = y.skill("Skill");
+ * yars.itemAdd("Item", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * yars.characterEquipmentAdd(bubba, "Location", "Item");
+ * std::string item_name = yars.characterEquipmentName(bubba, "Location");
  * \endexample
  *
- * \return A Skill
+ * \return The Item name
  */
-const Yars::Skill& Yars::skill(const std::string& skill_name ///< The Skill name
+std::string Yars::characterEquipmentName(const Yars::Id character_id ///< The Character Id
+	, const std::string& location ///< The location
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(skill_name.empty())
+	if(safeMode())
 	{
-		Skill* retval = nullptr;
-		return *retval;
-	}
+		if(characterExists(character_id) == false)
+		{
+			return {};
+		}
 
-	if(skillExists(skill_name) == false)
-	{
-		Skill* retval = nullptr;
-		return *retval;
+		if(characterEquipmentExists(character_id, location) == false)
+		{
+			return {};
+		}
 	}
-#endif
 
-	return skill_map.at(skill_name);
+	const Yars::MapStringString& equipment_name = character_equipment_name.at(character_id);
+
+	return equipment_name.at(location);
 }
 
 
 /**
+ * \ingroup group_CharacterEquipment
+ *
  * \todo{DebugMessage} Add debugging messages
  * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_Skill
- *
- * \brief Add a Skill
- *
- * Add a new Skill.  If the Attributes named in the 
- * <code>attribute_contribution</code> do not exist in the Yars class, they 
- * will be added.
+ * \brief Equip an Item
  *
- * \see attributeAdd()
+ * The Character will take the Item out of its inventory and a equip it at the 
+ * specified location.  The Character must have the Item and the location must 
+ * not already be occupied, otherwise the Item can not be equipped.
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Foo", {});
- * yars.skillAdd("Bar",
- * 	{	.attribute_contribution =
- * 		{	{ "Attr_1", 1 }
- * 		,	{ "Attr_2", 1 }
- * 		}
- * 	,	.level =
- * 		{	.value      = 1
- * 		,	.value_base = 1
- * 		}
- * 	});
+ * yars.itemAdd("Item", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * yars.characterEquipmentAdd(bubba, "Location", "Item");
  * \endexample
  *
- * \retval true  The Skill was added
- * \retval false Failed to add the Skill
+ * \retval true  The Item was equipped
+ * \retval false Failed to equip the Item
  */
-bool Yars::skillAdd(const std::string& skill_name ///< The Skill name
-	, const Yars::Skill& skill                ///< The Skill to add
+bool Yars::characterEquipmentAdd(const Yars::Id character_id ///< The Character Id
+	, const std::string& location  ///< The location
+	, const std::string& item_name ///< The Item name
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(skill_name.empty())
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+
+		if(characterItemExists(character_id, item_name) == false)
+		{
+			return false;
+		}
+	}
+
+	if(itemIsUsable(item_name) == false)
+	{
+		return false;
+	}
+
+	Yars::MapStringItem&   equipment_item = character_equipment_item[character_id];
+	Yars::MapStringString& equipment_name = character_equipment_name[character_id];
+
+	if(equipment_item.contains(location) == true)
+	{
+		// Error Type: Equipment must be removed first
+		return false;
+	}
+
+	Yars::Item item = characterItemTake(character_id, item_name);
+
+	equipment_item[location] = item;
+	equipment_name[location] = item_name;
+
+	itemOwnerAdjust(character_id, item_name, +1);
+
+	characterLedgerEquipmentAdd(character_id, location, item);
+
+	Yars::Health& health = this->characterHealth(character_id);
+	healthModifierAdjust(health, item.modify_health_maximum);
+	healthAdjust(        health, item.modify_health_current);
+
+	if(health.current == 0)
 	{
-		return false;
+		// Event: Character Died
 	}
 
-	if(skillExists(skill_name))
+	characterLevelChanged(character_id);
+
+	Yars::MapStringAttribute& attr_map = characterAttributeMap(character_id);
+	for(const auto& iter : item.modify_attribute)
 	{
-		return false;
+		Yars::Attribute& attr = attr_map[iter.first];
+		Yars::levelModifierAdjust(attr.level, +iter.second);
 	}
-#endif
 
-	for(const auto& iter : skill.attribute_contribution)
+	Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
+	for(const auto& iter : item.modify_skill)
 	{
-		const std::string& attribute_name        = iter.first;
-		//const int32_t&   modifier_contribution = iter.second;
-
-		attributeAdd(attribute_name);
+		Yars::Skill& skill = skill_map[iter.first];
+		Yars::levelModifierAdjust(skill.level, +iter.second);
 	}
 
-	skill_map[skill_name] = skill;
-
 	return true;
 }
 
 
 /**
+ * \ingroup group_CharacterEquipment
+ *
  * \todo{DebugMessage} Add debugging messages
  * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_Skill
+ * \brief Unequip an Item
  *
- * \brief Remove a Skill
+ * The Character will remove an equipped Item and place it back into the 
+ * Inventory.
+ *
+ * \note In the future, \ref feature_InventoryPolicy "Inventory Policies" may 
+ * prevent Items from going back into the Inventory, so unequipping items may 
+ * not be possible until the Policy conditions have been met.
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Foo", {});
- * // Do stuff
- * yars.skillRemove("Foo");
+ * yars.itemAdd("Item", {});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
+ *
+ * yars.characterEquipmentAdd(bubba, "Location", "Item");
+ * // Do Stuff
+ * yars.characterEquipmentRemove(bubba, "Location");
  * \endexample
  *
- * \retval true  The Skill was removed
- * \retval false Failed to remove the Skill
+ * \retval true  The Item was equipped
+ * \retval false Failed to equip the Item
  */
-bool Yars::skillRemove(const std::string& skill_name ///< The Skill name
+bool Yars::characterEquipmentRemove(const Yars::Id character_id ///< The Character Id
+	, const std::string& location ///< The location
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(skill_name.empty())
+	if(safeMode())
 	{
-		return false;
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 	}
 
-	if(skillExists(skill_name) == false)
+	Yars::MapStringItem&   equipment_item = character_equipment_item[character_id];
+	Yars::MapStringString& equipment_name = character_equipment_name[character_id];
+
+	if(equipment_item.contains(location) == false)
 	{
+		// No Equipment to remove
 		return false;
 	}
-#endif
-
-	skill_map.erase(skill_name);
 
-	return true;
-}
+	const Yars::Item& item = equipment_item[location];
 
+	Yars::Health& health = this->characterHealth(character_id);
+	healthModifierAdjust(health, -item.modify_health_maximum);
+	healthAdjust(        health, -item.modify_health_current);
 
-/**
- * \todo{DebugMessage} Add debugging messages
- *
- * \ingroup group_Skill
- *
- * \brief Check if an Skill already exists
- *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill");
- * if(yars.skillExists("Skill"))
- * {
- * 	std::cout << "Woot!\n";
- * }
- * \endexample
- *
- * \retval true  The Skill was added
- * \retval false Failed to add the Skill
- */
-bool Yars::skillExists(const std::string& skill_name ///< The Skill name
-	) const noexcept
-{
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(skill_name.empty())
+	if(health.current == 0)
 	{
-		return false;
+		// Event: Character Died
 	}
-#endif
-
-	return skill_map.contains(skill_name);
-}
-
-
-/**
- * \ingroup group_Skill
- *
- * \brief Get a list of Skills.
- *
- * Provides a vector of all the Skill names in the Yars class.
- *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * Yars::VectorString skill_list = yars.skillList();
- * \endexample
- *
- * \return A vector of Skill names.
- */
-Yars::VectorString Yars::skillList() const noexcept
-{
-	return Yars::mapKeyList(skill_map);
-}
 
-// }}}
-// {{{ Item
+	characterLevelChanged(character_id);
 
-/**
- * \todo{ExtendedData} Add data support, like what Character has
- *
- * \todo{InventoryRewrite} Re-evaluate the need for a "global" item list
- * 
- * \todo{InventoryRewrite} All items added to a character must have a unique Id
- * 
- * \todo{InventoryRewrite} Add "Policy" support.  Each policy would be 
- * responsible for a single aspect of inventory management.  The following are 
- * the currently planned "Policies"
- * - Stacking
- *   - Maximum count (global) is configurable
- *   - Maximum count (per item) is configurable via ExtendedData
- * - Weight
- *   - Each Item is given an abstract weight via ExtendedData
- *   - Maximum total weight is configurable
- * - Packing 2D
- *   - Each Item is given a cell-pattern which must fit onto a grid via 
- *   ExtendedData
- *
- * \defgroup group_Item Item
- *
- * \brief Item
- *
- * Items are the most complicated aspect of \yars because they:
- * - Provide modifiers to health, attributes, and skills when equipped
- * - Can only be used with certain skills by an attacker
- * - Can only be used with certain skills by a defender
- *
- * The fields of Item are:
- *
- * - \header{Item.count}
- *   The number of items in the stack
- *   <br><br>
- * - \header{Item.affect_attribute}
- * - \header{Item.affect_skill}
- * - \header{Item.affect_health_current}
- * - \header{Item.affect_health_maximum}
- *   These values determine what an Affect will do when an Affect is created 
- *   using this Item.
- *   <br><br>
- * - \header{Item.modify_attribute}
- * - \header{Item.modify_skill}
- * - \header{Item.modify_health_current}
- * - \header{Item.modify_health_maximum}
- *   When an Item is equipped, these values will be applied to the Character.
- *   The modifiers will be removed once the Item is unequipped.
- *   <br><br>
- * - \header{Item.skill_attacker}
- *   A list of Skills that allow the Item to be used.
- *   <br><br>
- * - \header{Item.skill_defender}
- *   A list of Skills that allow the Item to be defended against.
- *
- * When an Item is added to a Character, it will just be in their inventory.
- * However, when a Character equips an Item from their inventory, the 
- * `modify_*` data will be applied to that Character.
- *
- * To use an Item, the Attacker must have a compatible Skill in 
- * `skill_attacker`.  For a Character to defend against an Item, they must have 
- * a compatible Skill in `skill_defender`.
- *
- * Affects created from Items will use the `affect_*` data items.
- *
- * Fortunately, all of this complication only applies to the creation of an 
- * Item.  The \yars game mechanics will use the appropriate data in the Item 
- * automatically.
- *
- * \anchor feature_InventoryRewrite
- * \par The Inventory Rewrite
- *
- * All items will be located in the Yars class.  When an Item is added to a 
- * character, that Item is actually copied in the Yars class and the character 
- * is given a handle (the vector index) to the copied Item.  If the character 
- * "restacks" the Items which results in Items no longer being valid, those 
- * Item indexes will be returned to the Yars class
- *
- * Character Equipment Items will be kept separate from Inventory Items.
- *
- * The Item will be split into 4 parts, where each part is a separate vector.  
- * A single index will be used by the 4 vectors to "combine/merge" the Item 
- * into a cohesive whole.  The following named parts are grouped by access 
- * patterns:
- * - Data
- *   - name
- *   - custom data
- * - Triggers
- *   - skill_attacker
- * - Affect Properties
- *   - affect_attribute
- *   - affect_skill
- *   - affect_health_current
- *   - affect_health_maximum
- *   - skill_defender
- * - Equipped Properties
- *   - modify_attribute
- *   - modify_skill
- *   - modify_health_current
- *   - modify_health_maximum
- *
- * \anchor feature_InventoryPolicy
- * \par Inventory Policies
- *
- * Describe the intent of this feature.
- */
+	Yars::MapStringAttribute& attr_map = characterAttributeMap(character_id);
+	for(const auto& iter : item.modify_attribute)
+	{
+		Yars::Attribute& attr = attr_map[iter.first];
+		Yars::levelModifierAdjust(attr.level, -iter.second);
+	}
 
-/**
- * \ingroup group_Item
- *
- * \struct Yars::Item
- *
- * \brief Item data
- */
+	Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
+	for(const auto& iter : item.modify_skill)
+	{
+		Yars::Skill& skill = skill_map[iter.first];
+		Yars::levelModifierAdjust(skill.level, -iter.second);
+	}
 
-/**
- * \var Yars::Item::affect_attribute
- *
- * \brief Attributes that will have an Affect.
- *
- * When an Affect is created, that Affect can modify the values of Attributes.  
- * This container holds the Attribute name and how much it will modify a 
- * Character's attribute.
- */
+	characterLedgerEquipmentRemove(character_id, location);
 
-/**
- * \var Yars::Item::affect_skill
- *
- * \brief Skills that will have an Affect.
- *
- * When an Affect is created, that Affect can modify the values of Skills.  
- * This container holds the Skill name and how much it will modify a 
- * Character's skill.
- */
+	itemOwnerAdjust(character_id, equipment_name[location], -1);
 
-/**
- * \var Yars::Item::affect_health_current
- *
- * \brief The Affect on Health.
- *
- * An Affect created from an Item can change a Character's current health.  
- * This value will be added to the Character's current health.
- */
+	characterItemAdd(character_id, equipment_name[location], equipment_item[location]);
 
-/**
- * \var Yars::Item::affect_health_maximum
- *
- * \brief The Affect on Health.
- *
- * An Affect created from an Item can change a Character's maximum health.  
- * This value will be added to the Character's maximum health.
- */
+	equipment_item.erase(location);
+	equipment_name.erase(location);
 
-/**
- * \var Yars::Item::count
- *
- * \brief The number of items in the stack.
- */
+	return true;
+}
 
-/**
- * \var Yars::Item::modify_attribute
- *
- * \brief Attribute changes when equipped.
- *
- * When an Item is equipped, it can change Attribute values.  This container 
- * contains the names of the Attributes to modify and by how much.
- */
 
 /**
- * \var Yars::Item::modify_skill
- *
- * \brief Skill changes when equipped.
+ * \ingroup group_CharacterEquipment
  *
- * When an Item is equipped, it can change Skill values.  This container 
- * contains the names of the Skills to modify and by how much.
- */
-
-/**
- * \var Yars::Item::modify_health_current
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Use error codes in debugging messages
  *
- * \brief Health changes when equipped.
+ * \brief Check if equipment exists.
  *
- * When an Item is equipped, this value will change current health value.  
- */
-
-/**
- * \var Yars::Item::modify_health_maximum
+ * Check if an Item is present at the specified location.
  *
- * \brief Health changes when equipped.
+ * \example
+ * Yars yars;
+ * yars.itemAdd("Item", {});
  *
- * When an Item is equipped, this value will change maximum health value.  
- */
-
-/**
- * \var Yars::Item::skill_attacker
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterItemAdd(bubba, "Item");
  *
- * \brief Required skills to use this Item.
+ * yars.characterEquipmentAdd(bubba, "Location", "Item");
+ * if(yars.characterEquipmentExists(bubba, "Location"))
+ * {
+ * 	std::cout << "Bubba has an Item equipped at Location!\n";
+ * }
+ * \endexample
  *
- * In order for a Character to use this Item, they must have one of the Skills 
- * in this list.  If not, they can't use this Item.
+ * \retval true  An Item is equipped at that location
+ * \retval false Nothing is equipped at that location
  */
+bool Yars::characterEquipmentExists(const Yars::Id character_id ///< The Character Id
+	, const std::string& location ///< The location
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
 
-/**
- * \var Yars::Item::skill_defender
- *
- * \brief Required skills to defend against this Item.
- *
- * After an Affect has been created from this Item, a Character must have one 
- * of the Skills in this list to be able to defend against the Affect.
- */
+	const Yars::MapStringItem& equipment_item = character_equipment_item.at(character_id);
 
-/**
- * \ingroup group_Item
- *
- * \typedef Yars::MapStringItem
- *
- * \brief A convenience type.
- */
+	return equipment_item.contains(location);
+}
 
-/**
- * \ingroup group_Item
- *
- * \typedef Yars::MultimapStringItem
- *
- * \brief A convenience type.
- */
+// }}}
+// {{{ Character: Level
 
 /**
- * \ingroup group_Item
+ * \ingroup group_Character
  *
- * \typedef Yars::MapIdMapStringItem
+ * \defgroup group_CharacterLevel Level
  *
- * \brief A convenience type.
- */
-
-/**
- * \ingroup group_Item
+ * \brief A Character's Level
  *
- * \typedef Yars::MapIdMultimapStringItem
+ * When a Character is able to _Level Up_, that Character must choose between 
+ * one of two options:
+ * 1. Increase health
+ * 2. Increase a Skill's Attributes
  *
- * \brief A convenience type.
+ * This forces a Character to be highly skilled but easily killed, or lowly 
+ * skilled but durable.  Items play a pivotal role as well because Items have 
+ * the capability to increase a Character's health and skills.
+ *
+ * Using the dynamics of leveling and Items, an RPG can limit a Character to a 
+ * fixed amount of health and only allow Skills to increase forcing the 
+ * Character to rely upon Items for defense and health boosting properties.
+ * The inverse is also possible, where a Character can only increase their 
+ * Health and must rely on Items for Skills.  It is possible, of course, to do 
+ * something in the middle of these two extremes.
  */
 
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
 /**
- * \ingroup group_ToString
+ * \ingroup group_CharacterLevel
  *
- * \brief Yars::Item to JSON formatted string
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \return A JSON formatted string
- */
-std::string Yars::to_string(const Yars::Item& item ///< Object to convert
-	) noexcept
-{
-	std::stringstream oss;
-
-	oss	<< "{ \"count\": "                 << std::to_string( item.count)
-		<< ", \"affect_attribute\": "      << Yars::to_string(item.affect_attribute)
-		<< ", \"affect_skill\": "          << Yars::to_string(item.affect_skill)
-		<< ", \"modify_attribute\": "      << Yars::to_string(item.modify_attribute)
-		<< ", \"modify_skill\": "          << Yars::to_string(item.modify_skill)
-		<< ", \"skill_attacker\": "        << Yars::to_string(item.skill_attacker)
-		<< ", \"skill_defender\": "        << Yars::to_string(item.skill_defender)
-		<< ", \"affect_health_current\": " << std::to_string( item.affect_health_current)
-		<< ", \"affect_health_maximum\": " << std::to_string( item.affect_health_maximum)
-		<< ", \"modify_health_current\": " << std::to_string( item.modify_health_current)
-		<< ", \"modify_health_maximum\": " << std::to_string( item.modify_health_maximum)
-		<< " }"
-		;
-	
-	return oss.str();
-}
-#endif
-
-
-#if defined (ZAKERO_YARS_ENABLE_TO_STRING)
-/**
- * \ingroup group_ToString
+ * \brief Increase a Character's Health
  *
- * \brief Yars::MapStringItem to JSON formatted string
+ * The Character's health will be increased by the specified \p amount.
  *
- * \return A JSON formatted string
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yar.characterLevelIncrease(bubba, 1);
+ * \endexample
+ *
+ * \retval true  The health was increased
+ * \retval false Failed to increase the health
  */
-std::string Yars::to_string(const Yars::MapStringItem& item_map ///< Object to convert
+bool Yars::characterLevelIncrease(const Yars::Id character_id ///< The Character Id
+	, const uint32_t amount ///< The amount of increase
 	) noexcept
 {
-	std::stringstream oss;
-
-	oss << "{";
-
-	bool first = true;
-	for(const auto& iter : item_map)
+	if(safeMode())
 	{
-		if(first == false)
+		if(characterExists(character_id) == false)
 		{
-			oss << ",";
+			return false;
 		}
+	}
 
-		const std::string& name = iter.first;
-		const Yars::Item&  item = iter.second;
+	indexChanged(telemetry_health, character_id);
 
-		oss	<< " \""
-			<< name
-			<< "\": "
-			<< Yars::to_string(item)
-			;
+	Yars::Health& health = character_health[character_id];
 
-		first = false;
-	}
+	Yars::healthMaximumAdjust(health, amount);
 
-	oss << " }";
-	
-	return oss.str();
+	return true;
 }
-#endif
 
 
 /**
+ * \ingroup group_CharacterLevel
+ *
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_Item
+ * \brief Increase a Character's Attributes
  *
- * \brief Access an Item.
+ * The Character's Attributes that are associated with a Skill will be 
+ * increased by the specified \p amount.  The \p amount is not applied evenly 
+ * to all attributes.  The Attribute's contribution to the Skill determines how 
+ * much they will increase.
  *
- * Calling this method will provide access to an Item with a matching \p 
- * item_name.
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill",
+ * {	.attribute_contribution =
+ * 	{	{ "Attr_1", 1 }
+ * 	,	{ "Attr_2", 3 }
+ * 	}
+ * });
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd("Skill");
  *
- * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- * Yars::Item& item = yars.item("Item");
+ * yar.characterLevelIncrease(bubba, "Skill", 1);
+ * // Total contribution is 4
+ * // Attr_1 will increase by 1/4 = 0.25
+ * // Attr_2 will increase by 3/4 = 0.75
  * \endexample
  *
- * \return A reference to an Item.
+ * \retval true  The Attributes were increased
+ * \retval false Failed to increase the Attributes
  */
-Yars::Item& Yars::item(const std::string& item_name ///< The name of the Item
+bool Yars::characterLevelIncrease(const Yars::Id character_id ///< The Character Id
+	, const std::string& skill_name ///< The Skill
+	, const uint32_t     amount     ///< The amount of increase
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(item_name.empty())
+	if(skill_name.empty())
 	{
-		//ZAKERO_YARS_DEBUG << "Bad Name" << std::endl;
-		Item* retval = nullptr;
-		return *retval;
+		return characterLevelIncrease(character_id, amount);
 	}
 
-	if(itemExists(item_name) == false)
+	Yars::MapStringSkill& skill_data = character_skill[character_id];
+
+	if(skill_data.contains(skill_name) == false)
 	{
-		//ZAKERO_YARS_DEBUG << "Already Exists" << std::endl;
-		Item* retval = nullptr;
-		return *retval;
+		return false;
 	}
-#endif
 
-	return item_map[item_name];
+	characterLevelChanged(character_id);
+
+	Yars::SkillWeight        stale;
+	const Yars::SkillWeight& skill_weight = Yars::skillWeight(skill_data[skill_name], stale);
+
+	auto& attribute = character_attribute.at(character_id);
+
+	for(size_t index = 0; index < skill_weight.attribute.size(); index++)
+	{
+		const std::string& attribute_name = skill_weight.attribute[index];
+
+		float increase = amount * skill_weight.weight[index];
+
+		levelIncrease(attribute[attribute_name].level, increase);
+	}
+
+	return true;
 }
 
 
 /**
+ * \ingroup group_CharacterLevel
+ *
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_Item
+ * \brief Set a Character's Attribute Levels
  *
- * \brief Access an Item.
+ * The Character's Attributes that are associated with a Skill will be set by 
+ * the specified \p amount.  The \p amount is not applied evenly to all 
+ * attributes.  The Attribute's contribution to the Skill determines how much 
+ * they will receive of the \p amount.
  *
- * Calling this method will provide access to an Item with a matching \p 
- * item_name.
+ * Normal \ref group_Level "leveling" rules will apply.
  *
  * \example
  * Yars yars;
- * yars.itemAdd("Item", {});
- * const Yars& y = yars;
- * const Yars::Item& item = y.item("Item");
+ * yars.skillAdd("Skill",
+ * {	.attribute_contribution =
+ * 	{	{ "Attr_1", 1 }
+ * 	,	{ "Attr_2", 3 }
+ * 	}
+ * });
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd("Skill");
+ *
+ * yar.characterLevelSet(bubba, "Skill", 1);
+ * // Total contribution is 4
+ * // Attr_1 will be set to 1/4 = 0.25
+ * // Attr_2 will be set to 3/4 = 0.75
  * \endexample
  *
- * \return A reference to an Item.
+ * \retval true  The Attributes were increased
+ * \retval false Failed to increase the Attributes
  */
-const Yars::Item& Yars::item(const std::string& item_name ///< The name of the Item
-	) const noexcept
+bool Yars::characterLevelSet(const Yars::Id character_id ///< The Character Id
+	, const std::string& skill_name ///< The Skill to change
+	, const uint32_t     amount     ///< The new level amount
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(item_name.empty())
+	if(skill_name.empty())
+	{
+		return characterLevelIncrease(character_id, amount);
+	}
+
+	Yars::MapStringSkill& skill_data = character_skill[character_id];
+
+	if(skill_data.contains(skill_name) == false)
 	{
-		//ZAKERO_YARS_DEBUG << "Bad Name" << std::endl;
-		Item* retval = nullptr;
-		return *retval;
+		return false;
 	}
 
-	if(itemExists(item_name) == false)
+	characterLevelChanged(character_id);
+
+	Yars::SkillWeight        stale;
+	const Yars::SkillWeight& skill_weight = Yars::skillWeight(skill_data[skill_name], stale);
+
+	auto& attribute = character_attribute.at(character_id);
+
+	for(size_t index = 0; index < skill_weight.attribute.size(); index++)
 	{
-		//ZAKERO_YARS_DEBUG << "Already Exists" << std::endl;
-		Item* retval = nullptr;
-		return *retval;
+		const std::string& attribute_name = skill_weight.attribute[index];
+
+		float increase = amount * skill_weight.weight[index];
+
+		levelSet(attribute[attribute_name].level, 0, increase);
 	}
-#endif
 
-	return item_map.at(item_name);
+	return true;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
+ * \ingroup group_CharacterLevel
  *
- * \ingroup group_Item
+ * \brief A Character's Levels were changed.
  *
- * \brief Add a new Item.
+ * The non-const Yars::characterAttribute() and Yars::characterSkill() do 
+ * this automatically.  Only a reference that was kept from before the last 
+ * look-up can change a Level without Yars knowing about it, use this method 
+ * after writing to such a reference.
  *
- * Add a new Item.
+ * The Character's Modifier Cache is invalidated, and the Character is updated 
+ * in the Skill \ref group_Index "Indexes", Leaderboards, and Telemetry.
  *
  * \example
- * Yars yars;
- * yars.itemAdd("Foo", {});
- * yars.itemAdd("Bar",
- * 	{	.affect_attribute =
- * 		{	{ "Attr_1", 1 }
- * 		,	{ "Attr_2", 1 }
- * 		}
- * 	,	.affect_skill =
- * 		{	{ "Skill_1", 1 }
- * 		,	{ "Skill_2", 1 }
- * 		}
- * 	,	.modify_attribute =
- * 		{	{ "Attr_1", 1 }
- * 		,	{ "Attr_2", 1 }
- * 		}
- * 	,	.modify_skill =
- * 		{	{ "Skill_1", 1 }
- * 		,	{ "Skill_2", 1 }
- * 		}
- * 	,	.skill_attacker = { "Skill_1", "Skill_3" }
- * 	,	.skill_defender = { "Skill_2", "Skill_4" }
- *      ,	.count = 1
- *      ,	.affect_health_current = -5
- *      ,	.affect_health_maximum =  0
- *      ,	.modify_health_current =  0
- *      ,	.modify_health_maximum = 10
- *      });
+ * Yars::Skill& skill = yars.characterSkill(bubba, "Skill");
+ * float before = yars.calculateModifier(bubba, "Skill");
+ * skill.level.value++;
+ * yars.characterLevelChanged(bubba);
+ * float after = yars.calculateModifier(bubba, "Skill");
  * \endexample
- *
- * \retval true  The Item was added
- * \retval false Failed to add the Item
  */
-bool Yars::itemAdd(const std::string& item_name ///< The name of the Item
-	, const Yars::Item& item                ///< The Item data
+void Yars::characterLevelChanged(const Yars::Id character_id ///< The Character Id
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(item_name.empty())
-	{
-		return false;
-	}
+	// Every change to a Skill or Attribute Level comes through here
+	indexChanged(index_skill,           character_id);
+	indexChanged(leaderboard_attribute, character_id);
+	indexChanged(leaderboard_skill,     character_id);
+	indexChanged(telemetry_skill,       character_id);
 
-	if(itemExists(item_name))
-	{
-		return false;
-	}
-#endif
+	characterModifierCacheInvalidate(character_id);
+}
 
-	item_map[item_name] = item;
 
-	return true;
-}
+// }}}
+// {{{ Character: Affect
 
+/**
+ * \todo Character should have a subset of the main data. Yars::Attribute has a 
+ * name, data, and a level each of which or in separate containers.  When a 
+ * Character gains an Attribute, a new Attribute is create in the Character's 
+ * data-space with Id's that point to the original name and data.  However a 
+ * new Level is created and the level Id will point to that instead.  The same 
+ * pattern will work for Skills.
+ *
+ * \todo Everything should be access using Id's. Get a Skill Id from a 
+ * Character, then use that Id to get info about the Skill.
+ *
+ * \ingroup group_Character
+ *
+ * \defgroup group_CharacterAffect Affect
+ *
+ * \brief Character and Affect interaction
+ *
+ * After an Affect has been created, it must be applied to a Character in order 
+ * for it to do something.  This group of methods control that interaction.
+ *
+ * Once an Affect is active in a Character, that Affect can not be applied 
+ * again.  There is no problem if a new Affect is created and applied to a 
+ * Character that does the same thing.
+ */
 
 /**
+ * \todo Add a method to get the best skill from an Affect, like with Item.
  * \todo{DebugMessage} Add debugging messages
  * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_Item
+ * \ingroup group_CharacterAffect
  *
- * \brief Remove an Item.
+ * \brief Apply an Affect to a Character
  *
- * Remove an Item.
+ * The Affect will be applied to the Character.  The targeted Character has no 
+ * chance of defending against the Affect as the Affect is applied immediately.
+ *
+ * Since there is no chance of defending against the Affect, no experience will 
+ * be gained by either the creator or defender of the Affect.
+ *
+ * \see Yars::characterAffectDefend()
  *
  * \example
  * Yars yars;
- * yars.itemAdd("Item", {});
- * // Do stuff
- * yars.itemRemove("Item");
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.affect_health_current = 5
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd("Skill");
+ * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
+ * yars.characterItemAdd("Item");
+ *
+ * Yars::Id healing = yars.affectCreate();
+ * yars.affectInit(healing, bubba, "Item", "Skill", 100);
+ *
+ * yars.characterAffectApply(bubba, healing);
  * \endexample
  *
- * \retval true  The Item was removed
- * \retval false Failed to remove the Item
+ * \retval true  The Affect was applied
+ * \retval false Failed to apply the Affect
  */
-bool Yars::itemRemove(const std::string& item_name ///< The name of the Item
+bool Yars::characterAffectApply(const Yars::Id character_id ///< The Character Id
+	, const Yars::Id affect_id ///< The Affect Id
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(item_name.empty())
+	if(safeMode())
 	{
-		return false;
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+
+		if(affectExists(affect_id) == false)
+		{
+			return false;
+		}
+
+		if(characterAffectExists(character_id, affect_id) == true)
+		{
+			return false;
+		}
+	}
+
+	this->character_affect[character_id].push_back(affect_id);
+
+	indexChanged(telemetry_affect, character_id);
+
+	const Yars::Affect& affect = this->affect(affect_id);
+	Yars::Health& health = this->characterHealth(character_id);
+
+	healthModifierAdjust(health, affect.modify_health_maximum);
+	healthAdjust(        health, affect.modify_health_current);
+
+	if(health.current == 0)
+	{
+		// Event: Character Died
 	}
 
-	if(itemExists(item_name) == false)
+	characterLevelChanged(character_id);
+
+	for(const auto& iter : affect.modify_skill)
 	{
-		return false;
+		const std::string& skill_name = iter.first;
+		const int32_t&     modifier   = iter.second;
+
+		if(characterSkillExists(character_id, skill_name) == false)
+		{
+			characterSkillAdd(character_id, skill_name);
+		}
+
+		Yars::Skill& skill = characterSkill(character_id, skill_name);
+		levelModifierAdjust(skill.level, modifier);
+	}
+
+	for(const auto& iter : affect.modify_attribute)
+	{
+		const std::string& attribute_name = iter.first;
+		const int32_t&     modifier       = iter.second;
+
+		Yars::Attribute& attribute = characterAttribute(character_id, attribute_name);
+		levelModifierAdjust(attribute.level, modifier);
 	}
-#endif
 
-	item_map.erase(item_name);
+	characterLedgerAffectAdd(character_id, affect_id);
 
 	return true;
 }
@@ -2940,926 +13488,1114 @@ bool Yars::itemRemove(const std::string& item_name ///< The name of the Item
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_Item
+ * \todo{ErrorCode}    Add error codes to the debugging messages
  *
- * \brief Check if an Item exists
+ * \ingroup group_CharacterAffect
  *
- * \example
- * Yars yars;
- * yars.itemAdd("Item");
- * if(yars.itemExists("Item"))
- * {
- * 	std::cout << "Woot!\n";
- * }
- * \endexample
+ * \brief Apply an Affect to a Character
  *
- * \retval true  The Item was removed
- * \retval false Failed to remove the Item
- */
-bool Yars::itemExists(const std::string& item_name ///< The Item name
-	) const noexcept
-{
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(item_name.empty())
-	{
-		return false;
-	}
-#endif
-
-	return item_map.contains(item_name);
-}
-
-
-/**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * The same as Yars::characterAffectDefend(const Yars::Id, const Yars::Id, 
+ * const std::string&) except that the Character will use their best defense 
+ * Skill.  The best defense Skill is the Skill in the Affect's 
+ * Yars::Affect::defense_skill list that has the highest Level, if there is a 
+ * tie the first one in the list is used.
  *
- * \ingroup group_Item
+ * The Character's Skills are only searched once, so this is faster than 
+ * finding the best defense Skill with Yars::characterSkillExists() and 
+ * Yars::characterSkill() and then calling Yars::characterAffectDefend().
  *
- * \brief Check if an Item is usable
+ * If the Character does not have any of the defense Skills, the Affect will 
+ * be applied.
  *
  * \example
  * Yars yars;
- * yars.itemAdd("Item");
- * if(yars.itemExists("Item"))
- * {
- * 	std::cout << "Woot!\n";
- * }
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.skill_defender = { "Shield.Block", "Movement.Dodge" }
+ * 	,	.affect_health_current = -5
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd("Skill");
+ * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
+ * yars.characterItemAdd("Item");
+ *
+ * Yars::Id poison = yars.affectCreate();
+ * yars.affectInit(poison, bubba, "Item", "Skill", 100);
+ *
+ * Yars::Id billybob = yars.characterCreate();
+ * yars.characterAffectDefend(billybob, poison);
  * \endexample
  *
- * \retval true  The Item was removed
- * \retval false Failed to remove the Item
+ * \retval true  The Affect was applied
+ * \retval false Failed to apply the Affect
  */
-bool Yars::itemIsUsable(const std::string& item_name ///< The Item name
-	) const noexcept
+bool Yars::characterAffectDefend(const Yars::Id character_id ///< The Character Id
+	, const Yars::Id affect_id ///< The Affect Id
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(item_name.empty())
+	if(safeMode())
 	{
-		return false;
-	}
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 
-	if(itemExists(item_name) == false)
-	{
-		return false;
+		if(affectExists(affect_id) == false)
+		{
+			return false;
+		}
 	}
-#endif
-
-	const Yars::Item& item = item_map.at(item_name);
 
-	bool is_usable = (item.skill_attacker.size() > 0)
- 		|| (item.skill_defender.size() > 0)
-		;
+	const Yars::Affect& affect     = this->affect(affect_id);
+	const std::string*  skill_name = nullptr;
+	const Yars::Skill*  skill      = characterSkillBest(character_id
+		, affect.defense_skill
+		, skill_name
+		);
 
-	return is_usable;
+	return characterAffectDefendSkill(character_id
+		, affect_id
+		, (skill_name == nullptr) ? std::string() : *skill_name
+		, skill
+		);
 }
 
 
 /**
+ * \bug A skill level of 0 should be the same as not having that skill
+ *
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Add error codes to the debugging messages
  *
- * \ingroup group_Item
+ * \ingroup group_CharacterAffect
  *
- * \brief Check if an attacker can use the Item
+ * \brief Apply an Affect to a Character
+ *
+ * The Affect will be applied to the Character.  However, unlike 
+ * Yars::characterAffectApply(), the character will have a chance to defend 
+ * against the Affect using the specified skill.
+ *
+ * If the Character successfully defends against the Affect, the defender will 
+ * gain the experience.  However, if the Affect is applied, the creator of the 
+ * Affect will get the experience.
  *
  * \example
  * Yars yars;
- * yars.itemAdd("Item", {});
- * if(yars.itemIsUsableByAttacker("Item") == false)
- * {
- * 	std::cout << "Its useless\n";
- * }
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.affect_health_current = -5
+ * 	});
+ *
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd("Skill");
+ * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
+ * yars.characterItemAdd("Item");
+ *
+ * Yars::Id poison = yars.affectCreate();
+ * yars.affectInit(poison, bubba, "Item", "Skill", 100);
+ *
+ * Yars::Id billybob = yars.characterCreate();
+ * yars.characterAffectDefend(billybob, poison, "Skill");
  * \endexample
  *
- * \retval true  The Item can be used by an attacker
- * \retval false An attacker can not use the Item
+ * \retval true  The Affect was applied
+ * \retval false Failed to apply the Affect
  */
-bool Yars::itemIsUsableByAttacker(const std::string& item_name ///< The Item name
-	) const noexcept
+bool Yars::characterAffectDefend(const Yars::Id character_id ///< The Character Id
+	, const Yars::Id     affect_id  ///< The Affect Id
+	, const std::string& skill_name ///< The Defense Skill
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(item_name.empty())
+	if(safeMode())
 	{
-		return false;
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+
+		if(affectExists(affect_id) == false)
+		{
+			return false;
+		}
+
+		if(characterSkillExists(character_id, skill_name) == false)
+		{
+			return false;
+		}
 	}
+	
+	const Yars::Affect& affect = this->affect(affect_id);
+	const Yars::Skill*  skill  = nullptr;
 
-	if(itemExists(item_name) == false)
+	if(Yars::vectorContains(affect.defense_skill, skill_name))
 	{
-		return false;
+		skill = &std::as_const(*this).characterSkill(character_id, skill_name);
 	}
-#endif
-
-	const Yars::Item& item = item_map.at(item_name);
-
-	bool is_usable = (item.skill_attacker.size() > 0);
 
-	return is_usable;
+	return characterAffectDefendSkill(character_id, affect_id, skill_name, skill);
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_Item
- *
- * \brief Check if an defender can use the Item
+ * \brief Apply an Affect to a Character
  *
- * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- * if(yars.itemIsUsableByDefender("Item") == false)
- * {
- * 	std::cout << "Its useless\n";
- * }
- * \endexample
+ * The same as Yars::characterAffectDefend() but the defense Skill has already 
+ * been found and nothing is validated.  If the \p skill is `nullptr`, the 
+ * Character can not defend against the Affect.
  *
- * \retval true  The Item can be used by an defender
- * \retval false An defender can not use the Item
+ * \retval true  The Affect was applied
+ * \retval false The Affect was not applied
  */
-bool Yars::itemIsUsableByDefender(const std::string& item_name ///< The Item name
-	) const noexcept
+bool Yars::characterAffectDefendSkill(const Yars::Id character_id ///< The Character Id
+	, const Yars::Id     affect_id  ///< The Affect Id
+	, const std::string& skill_name ///< The Defense Skill name
+	, const Yars::Skill* skill      ///< The Defense Skill
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(item_name.empty())
-	{
-		return false;
-	}
+	Yars::Affect& affect = this->affect(affect_id);
 
-	if(itemExists(item_name) == false)
+	if(skill != nullptr)
 	{
-		return false;
-	}
-#endif
-
-	const Yars::Item& item = item_map.at(item_name);
+		// Do skill check
+		const uint32_t skill_level = skill->level.value;
 
-	bool is_usable = (item.skill_defender.size() > 0);
+		const float difficulty    = calculateDifficulty(skill_level, affect.level);
+		const Yars::Result result = difficultyToResult(difficulty);
 
-	return is_usable;
-}
+		if(result == Yars::Result::Success_Automatic)
+		{
+			// successfully defended
+			return false;
+		}
 
+		if(result == Yars::Result::Success)
+		{
+			// successfully defended
+			characterSkillIncrease(character_id
+				, skill_name
+				, affect.experience
+				);
 
-/**
- * \ingroup group_Item
- *
- * \brief Get a list of Items
- *
- * This method will provide a list of all the Item names that are currently in 
- * \yars.
- *
- * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- * Yars::VectorString list = yars.itemList();
- * \endexample
- *
- * \return A vector of Item names
- */
-Yars::VectorString Yars::itemList() const noexcept
-{
-	return Yars::mapKeyList(item_map);
-}
+			return false;
+		}
 
-// }}}
-// {{{ Character
+		if(result == Yars::Result::Chance)
+		{
+			float       probability = 0;
+			const float modifier    = calculateModifierSkill(character_id, skill_name, *skill);
+			bool        success     = calculateIsSuccessModifier(modifier, difficulty, probability);
 
-/**
- * \defgroup group_Character Character
- * 
- * \brief A Character
- *
- * A character in \yars is more than just a PC (Player Character) or a NPC 
- * (Non-Player Character).  Anything that can be interacted with is considered 
- * a Character.
- *
- * In addition to having a collection of Items and Skill, a Character has 
- * Health to track it physical state.  Characters also have support for 
- * free-form data that can be added and changed when ever necessary to enable 
- * the Character be used in unforeseen ways.
- *
- * An example would be a PC attempting to lock-pick a safe. The PC interacts 
- * with the lock with a lock-pick skill. It is this interaction that makes the 
- * `lock` is a Character (a "Lock Character"). The "Lock Character" could have 
- * addition information such as the "Make and Model" or "Is Broken". As Once 
- * the "Lock Character" has been defeated by the PC, the PC can "trade" with 
- * the "Safe Character" to get the Items.
- *
- * Since Characters can do many things, this section has the largest 
- * collections of methods in all of \yars.
- */
+			if(success == true)
+			{
+				// successfully defended
+				characterSkillIncrease(character_id
+					, skill_name
+					, affect.experience
+					);
 
-/**
- * \deprecated{InventoryPolicy}
- *
- * \struct Yars::CharacterConfig
- *
- * \brief Configuration data for each Character
- *
- * The data in this structure will be replaced by the future Inventory Policy 
- * objects.
- */
+				return false; // Affect was not applied
+			}
+		}
+	}
 
-/**
- * \deprecated{InventoryPolicy}
- *
- * \typedef Yars::MapIdCharacterConfig
- *
- * \brief A container.
- */
+	if(characterAffectExists(character_id, affect_id) == false)
+	{
+		characterAffectApply(character_id, affect_id);
+
+		if(affect.experience > 0 && affect.origin_skill.empty() == false)
+		{
+			characterSkillIncrease(affect.origin_character
+				, affect.origin_skill
+				, affect.experience
+				);
+		}
+	}
+
+	return true;
+}
 
-// {{{ Character: Util
 
 /**
- * \ingroup group_Character
+ * \brief Find a Character's best Skill.
  *
- * \brief Create a new Character
- *
- * Create a new Character.
+ * Of all the Skills in the \p skill_list, find the one that the Character 
+ * has with the highest Level.  If more than one Skill has the same Level, 
+ * the first one in the \p skill_list is used.  Skills with a Level of `0` 
+ * are ignored.
  *
- * \example
- * Yars yars;
- * Yars::Id bubba = yars.characterCreate();
- * \endexample
+ * The name of the Skill will be stored in \p skill_name.
  *
- * \return A Character ID
+ * \return The Skill or `nullptr` if the Character does not have any of the 
+ * Skills.
  */
-Yars::Id Yars::characterCreate() noexcept
+const Yars::Skill* Yars::characterSkillBest(const Yars::Id character_id ///< The Character Id
+	, const Yars::VectorString& skill_list ///< The Skills to consider
+	, const std::string*&       skill_name ///< Store the Skill name here
+	) const noexcept
 {
-	Yars::Id character_id;
+	const Yars::MapStringSkill& skill_map   = character_skill.at(character_id);
+	const Yars::Skill*          skill       = nullptr;
+	int32_t                     skill_level = 0;
 
-	if(character_pool.empty())
-	{
-		character_id = this->character_id_max;
-		this->character_id_max++;
-	}
-	else
+	skill_name = nullptr;
+
+	for(const std::string& name : skill_list)
 	{
-#if defined (ZAKERO_YARS_ENABLE_ID_SHUFFLE)
-		std::random_shuffle(std::begin(character_pool)
-			, std::end(character_pool)
-			);
-#endif
+		const auto iter = skill_map.find(name);
 
-		character_id = character_pool.back();
-		character_pool.pop_back();
+		if(iter != std::end(skill_map)
+			&& iter->second.level.value > skill_level
+			)
+		{
+			skill_name  = &name;
+			skill       = &iter->second;
+			skill_level = skill->level.value;
+		}
 	}
 
-	characterClear(character_id);
-
-	return character_id;
+	return skill;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
- *
- * \ingroup group_Character
- *
- * \brief Delete a Character
- *
- * Delete the request Character.
+ * \brief Get the set of a Character's Skills.
  *
- * \example
- * Yars yars;
- * Yars::Id bubba = yars.characterCreate();
- * // Do stuff
- * yars.characterDelete(bubba);
- * \endexample
+ * The set is kept up-to-date by characterSkillAdd() and 
+ * characterSkillRemove().  After characterSkillMap() has been used, the set 
+ * is not available until the next time a Skill is added or removed.
  *
- * \retval true  The Character was deleted
- * \retval false Failed to delete the Character
+ * \return The set or `nullptr` if the set is not up-to-date.
  */
-bool Yars::characterDelete(const Yars::Id character_id ///< The Character Id
-	) noexcept
+const Yars::SkillSet* Yars::characterSkillSet(const Yars::Id character_id ///< The Character Id
+	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	const auto iter = character_skill_set.find(character_id);
+
+	if(iter == std::end(character_skill_set))
 	{
-		return false;
+		return nullptr;
 	}
-#endif
 
-#if defined (ZAKERO_YARS_ENABLE_CLEAR_ON_DELETE)
-	characterClear(character_id);
-#endif
+	const Yars::SkillSet& skill_set = iter->second;
 
-	character_pool.push_back(character_id);
+	if(skill_set.count != character_skill.at(character_id).size())
+	{
+		return nullptr;
+	}
 
-	return true;
+	return &skill_set;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_Character
- *
- * \brief Check if a Character exists
- *
- * Check if a Character exists with the provided Id.
- *
- * \example
- * Yars yars;
- * Yars::Id bubba = yars.characterCreate();
- * if(yars.characterExists(bubba))
- * {
- * 	std::cout << "Hey, I found Bubba!\n";
- * }
- * \endexample
+ * \brief Update the set of a Character's Skills.
  *
- * \retval true  The Character was found
- * \retval false The Character does not exists
+ * When the set matches the Character's Skills before the change, only the 
+ * bit of \p skill_name is changed.  Otherwise the set is rebuilt from all of 
+ * the Character's Skills.
  */
-bool Yars::characterExists(const Yars::Id character_id ///< The Character Id
-	) const noexcept
+void Yars::characterSkillSetChange(const Yars::Id character_id ///< The Character Id
+	, const std::string& skill_name ///< The Skill that was added or removed
+	, const bool         is_added   ///< Was the Skill added
+	) noexcept
 {
-	if(character_id >= this->character_id_max)
+	const Yars::MapStringSkill& skill_map = character_skill[character_id];
+	const auto                  iter      = character_skill_set.find(character_id);
+
+	if(iter != std::end(character_skill_set))
 	{
-		return false;
+		Yars::SkillSet& skill_set = iter->second;
+
+		if(is_added && skill_set.count + 1 == skill_map.size())
+		{
+			skillSetInsert(skill_set
+				, Yars::handleIntern(skill_handle, skill_handle_name, skill_name)
+				);
+			skill_set.count++;
+
+			return;
+		}
+
+		if(is_added == false && skill_set.count == skill_map.size() + 1)
+		{
+			skillSetErase(skill_set
+				, Yars::handleIntern(skill_handle, skill_handle_name, skill_name)
+				);
+			skill_set.count--;
+
+			return;
+		}
 	}
 
-	return (Yars::vectorContains(character_pool, character_id) == false);
+	Yars::SkillSet skill_set = {};
+
+	for(const auto& iter : skill_map)
+	{
+		skillSetInsert(skill_set
+			, Yars::handleIntern(skill_handle, skill_handle_name, iter.first)
+			);
+	}
+
+	skill_set.count = skill_map.size();
+
+	character_skill_set[character_id] = std::move(skill_set);
 }
 
 
 /**
- * \ingroup group_Character
- *
- * \brief Delete Character data
+ * \brief Get a list of usable Items.
  *
- * All data associated with the specified Character Id is cleared.
+ * The \p skill_list and \p skill_set select if the Items are checked for 
+ * use by an Attacker or a Defender.
  *
- * \example
- * Yars yars;
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterClear(bubba);
- * \endexample
+ * \return A vector of Item names.
  */
-void Yars::characterClear(const Yars::Id& character_id ///< The Character Id
-	) noexcept
+Yars::VectorString Yars::characterItemListUsable(const Yars::Id character_id ///< The Character Id
+	, Yars::VectorString Yars::Item::* skill_list ///< The Item Skill names
+	, Yars::SkillSet Yars::Item::*     skill_set  ///< The Item Skill set
+	) const noexcept
 {
-	if(character_affect.contains(character_id))
+	const Yars::SkillSet*               character_set = characterSkillSet(character_id);
+	const Yars::MapStringSkill&         skill_map     = character_skill.at(character_id);
+	const Yars::MapStringCharacterItem& inventory     = character_item.at(character_id);
+
+	Yars::VectorString list;
+
+	for(const auto& iter : inventory)
 	{
-		character_affect.erase(character_id);
+		const Yars::CharacterItem& entry = iter.second;
+
+		if(entry.stack.empty())
+		{
+			continue;
+		}
+
+		const Yars::Item& item = entry.stack.front();
+
+		if(skillSetAny(character_set, skill_map, item.*skill_list, item.*skill_set))
+		{
+			list.push_back(iter.first);
+		}
 	}
 
-	character_attribute[character_id]      = {};
-	character_config[character_id]         = {};
-	character_data_bool[character_id]      = {};
-	character_data_float[character_id]     = {};
-	character_data_int32[character_id]     = {};
-	character_data_string[character_id]    = {};
-	character_equipment_item[character_id] = {};
-	character_equipment_name[character_id] = {};
-	character_health[character_id]         = {};
-	character_item[character_id]           = {};
-	character_skill[character_id]          = {};
+	return list;
 }
 
 
 /**
- * \deprecated{InventoryPolicy}
- *
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
+ * \todo{ErrorCode}    Add error codes to the debugging messages
  *
- * \ingroup group_Character
+ * \ingroup group_CharacterAffect
  *
- * \brief Change the staking value
+ * \brief Check if an Affect has been applied
  *
- * Control the maximum number of Item that can be stacked.
+ * Checks the Character to determine if the Affect is currently active.
  *
  * \example
  * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.affect_health_maximum = 10
+ * 	});
+ *
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterConfigItemStackMax(bubba, 10);
+ * yars.characterSkillAdd("Skill");
+ * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
+ * yars.characterItemAdd("Item");
+ *
+ * Yars::Id hp_boost = yars.affectCreate();
+ * yars.affectInit(hp_boost, bubba, "Item", "Skill", 100);
+ * yars.characterAffectApply(bubba, hp_boost);
+ *
+ * if(yars.characterAffectExists(bubba, hp_boost))
+ * {
+ * 	std::cout << "Bubba has an HP Boost!\n";
+ * }
  * \endexample
  *
- * \retval true  Configuration has been updated
- * \retval false Failed to update the configuration
+ * \retval true  The Affect exists
+ * \retval false The Affect does not exist
  */
-bool Yars::characterConfigItemStackMax(const Yars::Id character_id ///< The Character Id
-	, const uint32_t item_stack_max ///< New stack max value
-	) noexcept
+bool Yars::characterAffectExists(const Yars::Id character_id ///< The Character Id
+	, const Yars::Id affect_id ///< The Affect
+	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return false;
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 	}
 
-	if(item_stack_max == 0)
+	const auto iter = character_affect.find(character_id);
+
+	if(iter == std::end(character_affect))
 	{
 		return false;
 	}
-#endif
-
-	character_config[character_id].item_stack_max = item_stack_max;
 
-	return true;
+	return Yars::vectorContains(iter->second, affect_id);
 }
 
-// }}}
-// {{{ Character: Health
-
-/**
- * \ingroup group_Character
- *
- * \defgroup group_CharacterHealth Health
- *
- * \brief A Character's Health.
- *
- * Every Character has Health.  The following methods allow you to access the 
- * Health object.
- *
- * \see \ref group_Health
- */
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Add error codes to the debugging messages
  *
- * \ingroup group_CharacterHealth
+ * \ingroup group_CharacterAffect
  *
- * \brief Get the Character's Health
+ * \brief Get a list of Affects
  *
- * Access the Health data of a Character.
+ * Creates a list of all the Affects that are currently applied to the 
+ * Character.
+ *
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.affect_health_maximum = 10
+ * 	});
  *
- * \example
- * Yars yars;
  * Yars::Id bubba = yars.characterCreate();
- * Yars::Health& health = yars.characterHealth(bubba);
+ * yars.characterSkillAdd("Skill");
+ * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
+ * yars.characterItemAdd("Item");
+ *
+ * Yars::Id hp_boost = yars.affectCreate();
+ * yars.affectInit(hp_boost, bubba, "Item", "Skill", 100);
+ * yars.characterAffectApply(bubba, hp_boost);
+ *
+ * Yars::VectorId list = yars.characterAffectList(bubba);
  * \endexample
  *
- * \return The Character's Health
+ * \return A list of Affects
  */
-Yars::Health& Yars::characterHealth(const Yars::Id character_id ///< The Character Id
-	) noexcept
+Yars::VectorId Yars::characterAffectList(const Yars::Id character_id ///< The Character Id
+	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		Yars::Health* retval = nullptr;
-		return *retval;
+		if(characterExists(character_id) == false)
+		{
+			return {};
+		}
 	}
-#endif
 
-	return character_health[character_id];
+	const auto iter = character_affect.find(character_id);
+
+	if(iter == std::end(character_affect))
+	{
+		return {};
+	}
+
+	return iter->second;
 }
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterHealth
+ * \ingroup group_CharacterAffect
  *
- * \brief Get the Character's Health
+ * \brief Remove an Affect
  *
- * Access the Health data of a Character.
+ * Removes an Affect from a Character.  After Affect has been removed, the 
+ * changes in the Character that were made by the Affect will remain.  
+ * Effectively becoming permanent.
+ *
+ * Since the changes no longer belong to the Affect, the Affect will also be 
+ * removed from the Character's \ref group_CharacterLedger "Ledger".
  *
  * \example
  * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.affect_health_maximum = 10
+ * 	});
+ *
  * Yars::Id bubba = yars.characterCreate();
+ * yars.characterSkillAdd("Skill");
+ * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
+ * yars.characterItemAdd("Item");
  *
- * const Yars& y = yars;
- * const Yars::Health& health = y.characterHealth(bubba);
- * \endexample
+ * Yars::Id hp_boost = yars.affectCreate();
+ * yars.affectInit(hp_boost, bubba, "Item", "Skill", 100);
+ * yars.characterAffectApply(bubba, hp_boost);
  *
- * \return The Character's Health
+ * yars.characterAffectRemove(bubba, hp_boost);
+ * // Bubba's max health is still at +10.
+ * \endexample
  */
-const Yars::Health& Yars::characterHealth(const Yars::Id character_id ///< The Character Id
-	) const noexcept
+void Yars::characterAffectRemove(const Yars::Id character_id ///< The Character Id
+	, const Yars::Id affect_id ///< The Affect
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		Yars::Health* retval = nullptr;
-		return *retval;
+		if(characterExists(character_id) == false)
+		{
+			return;
+		}
+
+		if(characterAffectExists(character_id, affect_id) == false)
+		{
+			return;
+		}
 	}
-#endif
 
-	return character_health.at(character_id);
+	std::erase(character_affect[character_id], affect_id);
+
+	indexChanged(telemetry_affect, character_id);
+
+	characterLedgerAffectRemove(character_id, affect_id);
 }
 
-// }}}
-// {{{ Character: Attribute
 
 /**
- * \ingroup group_Character
- *
- * \defgroup group_CharacterAttribute Attribute
- *
- * \brief A Character's Attributes.
- *
- * A Character has no control over the Attributes that they have but Attribute 
- * can have an affect on everything they do.  Attributes are acquired as Skills 
- * are learned.  And even if a Skill is lost to the Character, the Attributes 
- * from that Skill will remain.
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * This group of methods allow you to access the Health object.
+ * \ingroup group_CharacterAffect
  *
- * \see \ref group_Attribute
- */
-
-/**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \brief Remove an Affect
  *
- * \ingroup group_CharacterAttribute
+ * Removes an Affect from a Character.  After Affect has been removed, the 
+ * changes in the Character will return to what they were before the Affect was 
+ * applied.
  *
- * \brief Access an Attribute
+ * If an Affect increased the Character's current health, there is a chance 
+ * that the Character can die if the current health goes to `0` after the 
+ * revert.
  *
- * Provides a way to access a Character's Attribute.
+ * The Affect will no longer be in the Character's Affect list nor in the 
+ * Character's \ref group_CharacterLedger "Ledger".
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Skill",
- * 	{	.attribute_contribution =
- * 		{	{ "Attr_1", 1 }
- * 		,	{ "Attr_2", 1 }
- * 		}
+ * yars.skillAdd("Skill", {});
+ * yars.itemAdd("Item",
+ * 	{	.skill_attacker = { "Skill" }
+ * 	,	.affect_health_maximum = 10
  * 	});
  *
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterSkillAdd("Skill");
+ * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
+ * yars.characterItemAdd("Item");
  *
- * Yars::Attribute& attribute = yars.characterAttribute(bubba, "Attr_1");
- * \endexample
+ * Yars::Id hp_boost = yars.affectCreate();
+ * yars.affectInit(hp_boost, bubba, "Item", "Skill", 100);
+ * yars.characterAffectApply(bubba, hp_boost);
  *
- * \return A reference to an Attribute
+ * yars.characterAffectRevert(bubba, hp_boost);
+ * // Bubba's max health no longer has the +10
+ * \endexample
  */
-Yars::Attribute& Yars::characterAttribute(const Yars::Id character_id ///< The Character Id
-	, const std::string& attribute_name ///< The Attribute Name
+void Yars::characterAffectRevert(const Yars::Id character_id ///< The Character Id
+	, const Yars::Id affect_id ///< The Affect
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		Yars::Attribute* retval = nullptr;
-		return *retval;
+		if(characterExists(character_id) == false)
+		{
+			return;
+		}
+
+		if(characterAffectExists(character_id, affect_id) == false)
+		{
+			return;
+		}
 	}
+	
+	const Yars::Affect& affect = this->affect(affect_id);
+	Yars::Health& health = this->characterHealth(character_id);
 
-	if(characterAttributeExists(character_id, attribute_name) == false)
+	healthModifierAdjust(health, -affect.modify_health_maximum);
+	if(health.current == 0)
 	{
-		Yars::Attribute* retval = nullptr;
-		return *retval;
+		// Event: Character Died
 	}
-#endif
 
-	return character_attribute[character_id][attribute_name];
+	characterLevelChanged(character_id);
+
+	for(const auto& iter : affect.modify_skill)
+	{
+		const std::string& skill_name = iter.first;
+		const int32_t&     modifier   = iter.second;
+
+		if(characterSkillExists(character_id, skill_name) == true)
+		{
+			Yars::Skill& skill = characterSkill(character_id, skill_name);
+			levelModifierAdjust(skill.level, -modifier);
+		}
+	}
+
+	for(const auto& iter : affect.modify_attribute)
+	{
+		const std::string& attribute_name = iter.first;
+		const int32_t&     modifier       = iter.second;
+
+		// Attributes are never deleted, no need to check for existence
+
+		Yars::Attribute& attribute = characterAttribute(character_id, attribute_name);
+		levelModifierAdjust(attribute.level, -modifier);
+	}
+
+	std::erase(character_affect[character_id], affect_id);
+
+	indexChanged(telemetry_affect, character_id);
+
+	characterLedgerAffectRemove(character_id, affect_id);
 }
 
+// }}}
+// {{{ Character: Ledger
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \ingroup group_Character
  *
- * \ingroup group_CharacterAttribute
+ * \defgroup group_CharacterLedger Ledger
  *
- * \brief Access an Attribute
+ * \brief Track where a Character's modifiers come from.
  *
- * Provides a way to access a Character's Attribute.
+ * When a Character's Ledger is enabled, every Item that is equipped and every 
+ * Affect that is applied will be recorded in the Ledger.  This makes it 
+ * possible to get the total modifier of an Attribute or Skill without having 
+ * to look at every Item and Affect, and to find out how much each of them 
+ * contributed (for example, to display in a tool-tip).
+ *
+ * The Ledger is updated as Items are equipped and removed and as Affects are 
+ * applied and reverted, and only the modifiers that are in that Item or 
+ * Affect are touched.  If the Ledger ever needs to be recomputed from 
+ * scratch, for example after changing an equipped Item with 
+ * Yars::characterEquipmentItem(), use Yars::characterLedgerRebuild().
+ *
+ * \note The Ledger only tracks the contributions of equipment and Affects.  
+ * Modifiers that are changed directly with Yars::levelModifierAdjust() or 
+ * Yars::healthModifierAdjust() are not in the Ledger.
+ *
+ * \see group_Ledger
+ */
+
+/**
+ * \ingroup group_CharacterLedger
+ *
+ * \brief Access a Character's Ledger.
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Skill",
- * 	{	.attribute_contribution =
- * 		{	{ "Attr_1", 1 }
- * 		,	{ "Attr_2", 1 }
- * 		}
- * 	});
- *
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterLedgerEnable(bubba);
  *
- * const Yars& y = yars;
- * const Yars::Attribute& attribute = y.characterAttribute(bubba, "Attr_1");
+ * const Yars::Ledger& ledger = yars.characterLedger(bubba);
  * \endexample
  *
- * \return A reference to an Attribute
+ * \return A reference to the Ledger.
  */
-const Yars::Attribute& Yars::characterAttribute(const Yars::Id character_id ///< The Character Id
-	, const std::string& attribute_name ///< The Attribute Name
+const Yars::Ledger& Yars::characterLedger(const Yars::Id character_id ///< The Character Id
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		Yars::Attribute* retval = nullptr;
-		return *retval;
-	}
-
-	if(characterAttributeExists(character_id, attribute_name) == false)
+	if(safeMode())
 	{
-		Yars::Attribute* retval = nullptr;
-		return *retval;
+		if(characterLedgerIsEnabled(character_id) == false)
+		{
+			Yars::Ledger* retval = nullptr;
+			return *retval;
+		}
 	}
-#endif
 
-	return character_attribute.at(character_id).at(attribute_name);
+	return character_ledger.at(character_id);
 }
 
 
 /**
- * \ingroup group_CharacterAttribute
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \brief Add an Attribute to a Character.
+ * \ingroup group_CharacterLedger
  *
- * Adds an Attribute to a Character if it does not already exists.
+ * \brief Enable or disable a Character's Ledger.
+ *
+ * When enabled, the Ledger will be built from the Character's current 
+ * equipment and Affects.  Disabling the Ledger will discard it.
  *
  * \example
  * Yars yars;
- * yars.attributeAdd("Attribute");
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterAttributeAdd(bubba, "Attribute");
+ * yars.characterLedgerEnable(bubba);
  * \endexample
+ *
+ * \retval true  The Ledger has been enabled or disabled
+ * \retval false Failed to change the Ledger
  */
-void Yars::characterAttributeAdd(const Yars::Id character_id ///< The Character Id
-	, const std::string& attribute_name ///< The Attribute Name
+bool Yars::characterLedgerEnable(const Yars::Id character_id ///< The Character Id
+	, const bool enable ///< Enable or disable the Ledger
 	) noexcept
 {
-	if(characterAttributeExists(character_id, attribute_name))
+	if(safeMode())
 	{
-		return;
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 	}
 
-	character_attribute[character_id][attribute_name] = attribute_map[attribute_name];
+	if(enable == false)
+	{
+		character_ledger.erase(character_id);
 
-	return;
+		return true;
+	}
+
+	if(character_ledger.contains(character_id))
+	{
+		return true;
+	}
+
+	character_ledger[character_id] = {};
+
+	return characterLedgerRebuild(character_id);
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \ingroup group_CharacterLedger
  *
- * \ingroup group_CharacterAttribute
- *
- * \brief Check if a Character has an Attribute
- *
- * Check if a Character has an Attribute
+ * \brief Check if a Character's Ledger is enabled.
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Skill",
- * 	{	.attribute_contribution =
- * 		{	{ "Attr_1", 1 }
- * 		,	{ "Attr_2", 1 }
- * 		}
- * 	});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- *
- * if(yars.characterAttributeExists(bubba, "Attr_1"))
+ * Yars::Id bubba = yars.characterCreate();
+ * if(yars.characterLedgerIsEnabled(bubba) == false)
  * {
- * 	std::cout << "Bubba has Attr_1\n";
+ * 	yars.characterLedgerEnable(bubba);
  * }
  * \endexample
  *
- * \retval true  The Character does have the Attribute.
- * \retval false The Character does not have the Attribute.
+ * \retval true  The Ledger is enabled
+ * \retval false The Ledger is not enabled
  */
-bool Yars::characterAttributeExists(const Yars::Id character_id ///< The Character Id
-	, const std::string& attribute_name ///< The Attribute Name
+bool Yars::characterLedgerIsEnabled(const Yars::Id character_id ///< The Character Id
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return false;
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 	}
-#endif
-
-	const auto& attribute_map = character_attribute.at(character_id);
 
-	return attribute_map.contains(attribute_name);
+	return character_ledger.contains(character_id);
 }
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterAttribute
+ * \ingroup group_CharacterLedger
  *
- * \brief Get all of the Character's Attributes
+ * \brief Recompute a Character's Ledger.
  *
- * Access to all of the Attributes a Character has will be provided in the 
- * returned map.
+ * All the contributions in the Ledger are discarded and then recomputed from 
+ * the Items that are currently equipped and the Affects that are currently 
+ * applied.
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Skill",
- * 	{	.attribute_contribution =
- * 		{	{ "Attr_1", 1 }
- * 		,	{ "Attr_2", 1 }
- * 		}
- * 	});
+ * yars.itemAdd("Item", {});
  *
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterLedgerEnable(bubba);
+ * yars.characterItemAdd(bubba, "Item");
+ * yars.characterEquipmentAdd(bubba, "Location", "Item");
  *
- * Yars::MapStringAttribute& map = yars.charecterAttributeMap(bubba);
+ * yars.characterEquipmentItem(bubba, "Location").modify_skill["Skill"] = 1;
+ * yars.characterLedgerRebuild(bubba);
  * \endexample
  *
- * \return A reference to a map of Attributes
+ * \retval true  The Ledger was rebuilt
+ * \retval false The Ledger is not enabled
  */
-Yars::MapStringAttribute& Yars::characterAttributeMap(const Yars::Id character_id ///< The Character Id
+bool Yars::characterLedgerRebuild(const Yars::Id character_id ///< The Character Id
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	if(character_ledger.contains(character_id) == false)
 	{
-		Yars::MapStringAttribute* retval = nullptr;
-		return *retval;
+		return false;
 	}
-#endif
 
-	auto& attribute = character_attribute[character_id];
+	Yars::Ledger& ledger = character_ledger[character_id];
+	ledger = {};
 
-	return attribute;
+	for(const auto& iter : character_equipment_item[character_id])
+	{
+		const std::string& location = iter.first;
+		const Yars::Item&  item     = iter.second;
+
+		Yars::LedgerEntry entry = ledgerEntry(item.modify_attribute
+			, item.modify_skill
+			, item.modify_health_maximum
+			);
+
+		ledgerAdjust(ledger, entry, +1);
+		ledger.equipment[location] = std::move(entry);
+	}
+
+	for(const Yars::Id affect_id : character_affect[character_id])
+	{
+		const Yars::Affect& affect = this->affect(affect_id);
+
+		Yars::LedgerEntry entry = ledgerEntry(affect.modify_attribute
+			, affect.modify_skill
+			, affect.modify_health_maximum
+			);
+
+		ledgerAdjust(ledger, entry, +1);
+		ledger.affect[affect_id] = std::move(entry);
+	}
+
+	return true;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \ingroup group_CharacterLedger
  *
- * \ingroup group_CharacterAttribute
+ * \brief Get the total modifier of an Attribute.
  *
- * \brief Get all of the Character's Attributes
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterLedgerEnable(bubba);
  *
- * Access to all of the Attributes a Character has will be provided in the 
- * returned map.
+ * int32_t modifier = yars.characterLedgerAttribute(bubba, "Attr");
+ * \endexample
+ *
+ * \return The sum of all the equipment and Affect modifiers.
+ */
+int32_t Yars::characterLedgerAttribute(const Yars::Id character_id ///< The Character Id
+	, const std::string& attribute_name ///< The Attribute name
+	) const noexcept
+{
+	return characterLedgerAttribute(character_id, attributeHandle(attribute_name));
+}
+
+
+/**
+ * \ingroup group_CharacterLedger
+ *
+ * \brief Get the total modifier of an Attribute.
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Skill",
- * 	{	.attribute_contribution =
- * 		{	{ "Attr_1", 1 }
- * 		,	{ "Attr_2", 1 }
- * 		}
- * 	});
+ * yars.attributeAdd("Attr");
+ * const Yars::Handle attr = yars.attributeHandle("Attr");
  *
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterLedgerEnable(bubba);
  *
- * const Yars& y = yars;
- * const Yars::MapStringAttribute& map = y.charecterAttributeMap(bubba);
+ * int32_t modifier = yars.characterLedgerAttribute(bubba, attr);
  * \endexample
  *
- * \return A reference to a map of Attributes
+ * \return The sum of all the equipment and Affect modifiers.
  */
-const Yars::MapStringAttribute& Yars::characterAttributeMap(const Yars::Id character_id ///< The Character Id
+int32_t Yars::characterLedgerAttribute(const Yars::Id character_id ///< The Character Id
+	, const Yars::Handle handle ///< The Attribute Handle
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return 0;
+		}
+	}
+
+	const auto iter = character_ledger.find(character_id);
+
+	if(iter == std::end(character_ledger))
 	{
-		Yars::MapStringAttribute* retval = nullptr;
-		return *retval;
+		return 0;
 	}
-#endif
 
-	const auto& attribute = character_attribute.at(character_id);
+	const Yars::VectorInt32& attribute = iter->second.attribute;
 
-	return attribute;
-}
+	if(handle >= attribute.size())
+	{
+		return 0;
+	}
 
+	return attribute[handle];
+}
 
-// }}}
-// {{{ Character: Data
 
 /**
- * \ingroup group_Character
+ * \ingroup group_CharacterLedger
  *
- * \defgroup group_CharacterData User Data
+ * \brief Get the contributions to an Attribute.
  *
- * \brief Custom User Data
+ * Every equipment location and Affect that modifies the Attribute will be in 
+ * the list, in no particular order.
  *
- * As a generic RPG Rule System, it is impossible to anticipate all the 
- * different kinds of data that will need to be associated with a Character.  
- * However, it is possible to predict the type of data and that is where this 
- * group of methods come into play.
+ * \example
+ * Yars yars;
+ * Yars::Id bubba = yars.characterCreate();
+ * yars.characterLedgerEnable(bubba);
  *
- * Using these methods, most types of data can be associated with a Character 
- * in a free-form manner.
+ * for(const auto& contribution : yars.characterLedgerAttributeSource(bubba, "Attr"))
+ * {
+ * 	std::cout << contribution.location << ": " << contribution.amount << "\n";
+ * }
+ * \endexample
+ *
+ * \return A list of contributions.
  */
+Yars::VectorLedgerContribution Yars::characterLedgerAttributeSource(const Yars::Id character_id ///< The Character Id
+	, const std::string& attribute_name ///< The Attribute name
+	) const noexcept
+{
+	if(safeMode())
+	{
+		if(characterExists(character_id) == false)
+		{
+			return {};
+		}
+	}
+
+	const auto iter = character_ledger.find(character_id);
+
+	if(iter == std::end(character_ledger))
+	{
+		return {};
+	}
+
+	return ledgerContributionList(iter->second
+		, &Yars::LedgerEntry::attribute
+		, attributeHandle(attribute_name)
+		);
+}
+
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
+ * \ingroup group_CharacterLedger
  *
- * \ingroup group_CharacterData
- *
- * \brief Clear all Character data.
- *
- * All custom user data will be removed from the specified Character.
+ * \brief Get the total maximum Health modifier.
  *
  * \example
  * Yars yars;
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterDataClear(bubba);
+ * yars.characterLedgerEnable(bubba);
+ *
+ * int32_t modifier = yars.characterLedgerHealthMaximum(bubba);
  * \endexample
  *
- * \retval true  All data has been cleared
- * \retval false Failed to clear the data
+ * \return The sum of all the equipment and Affect modifiers.
  */
-bool Yars::characterDataClear(const Yars::Id character_id ///< The Character Id
-	) noexcept
+int32_t Yars::characterLedgerHealthMaximum(const Yars::Id character_id ///< The Character Id
+	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return false;
+		if(characterExists(character_id) == false)
+		{
+			return 0;
+		}
 	}
-#endif
 
-	character_data_bool  [character_id].clear();
-	character_data_float [character_id].clear();
-	character_data_int32 [character_id].clear();
-	character_data_string[character_id].clear();
+	const auto iter = character_ledger.find(character_id);
 
-	return true;
+	if(iter == std::end(character_ledger))
+	{
+		return 0;
+	}
+
+	return iter->second.health_maximum;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
- *
- * \ingroup group_CharacterData
+ * \ingroup group_CharacterLedger
  *
- * \brief Remove Character data.
+ * \brief Get the contributions to the maximum Health.
  *
- * The named data will be removed from the Character regardless of the type of 
- * data.
+ * Every equipment location and Affect that modifies the maximum Health will 
+ * be in the list, in no particular order.
  *
  * \example
  * Yars yars;
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterDataSet(bubba, "Height", 1.5f);
- * yars.characterDataSet(bubba, "Height", "m");
- * yars.characterDataSet(bubba, "Name",   "Bubba");
- * // Do Stuff
- * yars.characterDataErase(bubba, "Height");
- * // Both "Height"/1.5f and "Height"/"m" have been erased.
+ * yars.characterLedgerEnable(bubba);
+ *
+ * auto contribution_list = yars.characterLedgerHealthMaximumSource(bubba);
  * \endexample
  *
- * \retval true  The data has been erased
- * \retval false Failed to erase the data
+ * \return A list of contributions.
  */
-bool Yars::characterDataErase(const Yars::Id character_id ///< The Character Id
-	, const std::string& name ///< The data name
-	) noexcept
+Yars::VectorLedgerContribution Yars::characterLedgerHealthMaximumSource(const Yars::Id character_id ///< The Character Id
+	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
-#endif
-
-	bool retval = false;
-
+	if(safeMode())
 	{
-		Yars::MapStringBool& data = character_data_bool.at(character_id);
-		if(data.contains(name))
+		if(characterExists(character_id) == false)
 		{
-			data.erase(name);
-			retval = true;
+			return {};
 		}
 	}
+
+	const auto iter = character_ledger.find(character_id);
+
+	if(iter == std::end(character_ledger))
 	{
-		Yars::MapStringFloat& data = character_data_float.at(character_id);
-		if(data.contains(name))
-		{
-			data.erase(name);
-			retval = true;
-		}
+		return {};
 	}
+
+	const Yars::Ledger& ledger = iter->second;
+
+	Yars::VectorLedgerContribution retval;
+
+	for(const auto& equipment : ledger.equipment)
 	{
-		Yars::MapStringInt32& data = character_data_int32.at(character_id);
-		if(data.contains(name))
+		if(equipment.second.health_maximum != 0)
 		{
-			data.erase(name);
-			retval = true;
+			retval.push_back(
+				{	.source    = Yars::LedgerSource::Equipment
+				,	.location  = equipment.first
+				,	.affect_id = 0
+				,	.amount    = equipment.second.health_maximum
+				});
 		}
 	}
+
+	for(const auto& affect : ledger.affect)
 	{
-		Yars::MapStringString& data = character_data_string.at(character_id);
-		if(data.contains(name))
+		if(affect.second.health_maximum != 0)
 		{
-			data.erase(name);
-			retval = true;
+			retval.push_back(
+				{	.source    = Yars::LedgerSource::Affect
+				,	.location  = {}
+				,	.affect_id = affect.first
+				,	.amount    = affect.second.health_maximum
+				});
 		}
 	}
 
@@ -3868,928 +14604,1094 @@ bool Yars::characterDataErase(const Yars::Id character_id ///< The Character Id
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
+ * \ingroup group_CharacterLedger
  *
- * \ingroup group_CharacterData
- *
- * \brief Get Character data.
- *
- * The named data will be removed from the Character regardless of the type of 
- * data.  The value will be placed in \p value but if the data name is not 
- * valid or the requested data type is not available, the original contents of 
- * the \p value will not be changed.
+ * \brief Get the total modifier of a Skill.
  *
  * \example
  * Yars yars;
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterDataSet(bubba, "key", true);
- * // Do Stuff
- * bool value = false;
- * yars.characterDataGet(bubba, "key", value);
+ * yars.characterLedgerEnable(bubba);
+ *
+ * int32_t modifier = yars.characterLedgerSkill(bubba, "Skill");
  * \endexample
  *
- * \retval true  The data was retrieved
- * \retval false Failed to retrieve the data
+ * \return The sum of all the equipment and Affect modifiers.
  */
-bool Yars::characterDataGet(const Yars::Id character_id ///< The Character Id
-	, const std::string& name  ///< The data name
-	, bool&              value ///< The data value
+int32_t Yars::characterLedgerSkill(const Yars::Id character_id ///< The Character Id
+	, const std::string& skill_name ///< The Skill name
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
-#endif
-
-	const Yars::MapStringBool& data = character_data_bool.at(character_id);
-	if(data.contains(name) == false)
-	{
-		return false;
-	}
-
-	value = data.at(name);
-
-	return true;
+	return characterLedgerSkill(character_id, skillHandle(skill_name));
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
- *
- * \ingroup group_CharacterData
+ * \ingroup group_CharacterLedger
  *
- * \brief Get Character data.
- *
- * The named data will be removed from the Character regardless of the type of 
- * data.  The value will be placed in \p value but if the data name is not 
- * valid or the requested data type is not available, the original contents of 
- * the \p value will not be changed.
+ * \brief Get the total modifier of a Skill.
  *
  * \example
  * Yars yars;
+ * yars.skillAdd("Skill", {});
+ * const Yars::Handle skill = yars.skillHandle("Skill");
+ *
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterDataSet(bubba, "key", 42.0f);
- * // Do Stuff
- * float value = 0.0f;
- * yars.characterDataGet(bubba, "key", value);
+ * yars.characterLedgerEnable(bubba);
+ *
+ * int32_t modifier = yars.characterLedgerSkill(bubba, skill);
  * \endexample
  *
- * \retval true  The data was retrieved
- * \retval false Failed to retrieve the data
+ * \return The sum of all the equipment and Affect modifiers.
  */
-bool Yars::characterDataGet(const Yars::Id character_id ///< The Character Id
-	, const std::string& name  ///< The data name
-	, float&             value ///< The data value
+int32_t Yars::characterLedgerSkill(const Yars::Id character_id ///< The Character Id
+	, const Yars::Handle handle ///< The Skill Handle
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return false;
+		if(characterExists(character_id) == false)
+		{
+			return 0;
+		}
 	}
-#endif
 
-	const Yars::MapStringFloat& data = character_data_float.at(character_id);
-	if(data.contains(name) == false)
+	const auto iter = character_ledger.find(character_id);
+
+	if(iter == std::end(character_ledger))
 	{
-		return false;
+		return 0;
 	}
 
-	value = data.at(name);
+	const Yars::VectorInt32& skill = iter->second.skill;
 
-	return true;
+	if(handle >= skill.size())
+	{
+		return 0;
+	}
+
+	return skill[handle];
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
- *
- * \ingroup group_CharacterData
+ * \ingroup group_CharacterLedger
  *
- * \brief Get Character data.
+ * \brief Get the contributions to a Skill.
  *
- * The named data will be removed from the Character regardless of the type of 
- * data.  The value will be placed in \p value but if the data name is not 
- * valid or the requested data type is not available, the original contents of 
- * the \p value will not be changed.
+ * Every equipment location and Affect that modifies the Skill will be in the 
+ * list, in no particular order.
  *
  * \example
  * Yars yars;
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterDataSet(bubba, "key", 42);
- * // Do Stuff
- * int32_t value = false;
- * yars.characterDataGet(bubba, "key", value);
+ * yars.characterLedgerEnable(bubba);
+ *
+ * for(const auto& contribution : yars.characterLedgerSkillSource(bubba, "Skill"))
+ * {
+ * 	std::cout << contribution.location << ": " << contribution.amount << "\n";
+ * }
  * \endexample
  *
- * \retval true  The data was retrieved
- * \retval false Failed to retrieve the data
+ * \return A list of contributions.
  */
-bool Yars::characterDataGet(const Yars::Id character_id ///< The Character Id
-	, const std::string& name  ///< The data name
-	, int32_t&           value ///< The data value
+Yars::VectorLedgerContribution Yars::characterLedgerSkillSource(const Yars::Id character_id ///< The Character Id
+	, const std::string& skill_name ///< The Skill name
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return false;
+		if(characterExists(character_id) == false)
+		{
+			return {};
+		}
 	}
-#endif
 
-	const Yars::MapStringInt32& data = character_data_int32.at(character_id);
-	if(data.contains(name) == false)
+	const auto iter = character_ledger.find(character_id);
+
+	if(iter == std::end(character_ledger))
 	{
-		return false;
+		return {};
 	}
 
-	value = data.at(name);
-
-	return true;
+	return ledgerContributionList(iter->second
+		, &Yars::LedgerEntry::skill
+		, skillHandle(skill_name)
+		);
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
- *
- * \ingroup group_CharacterData
- *
- * \brief Get Character data.
- *
- * The named data will be removed from the Character regardless of the type of 
- * data.  The value will be placed in \p value but if the data name is not 
- * valid or the requested data type is not available, the original contents of 
- * the \p value will not be changed.
- *
- * \example
- * Yars yars;
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterDataSet(bubba, "key", "value");
- * // Do Stuff
- * std::string value = "";
- * yars.characterDataGet(bubba, "key", value);
- * \endexample
+ * \brief Record an Affect in the Ledger.
  *
- * \retval true  The data was retrieved
- * \retval false Failed to retrieve the data
+ * Nothing will happen if the Character's Ledger is not enabled.
  */
-bool Yars::characterDataGet(const Yars::Id character_id ///< The Character Id
-	, const std::string& name  ///< The data name
-	, std::string&       value ///< The data value
-	) const noexcept
+void Yars::characterLedgerAffectAdd(const Yars::Id character_id ///< The Character Id
+	, const Yars::Id affect_id ///< The Affect Id
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	const auto iter = character_ledger.find(character_id);
+
+	if(iter == std::end(character_ledger))
 	{
-		return false;
+		return;
 	}
-#endif
 
-	const Yars::MapStringString& data = character_data_string.at(character_id);
-	if(data.contains(name) == false)
+	Yars::Ledger&       ledger = iter->second;
+	const Yars::Affect& affect = this->affect(affect_id);
+
+	Yars::LedgerEntry entry = ledgerEntry(affect.modify_attribute
+		, affect.modify_skill
+		, affect.modify_health_maximum
+		);
+
+	ledgerAdjust(ledger, entry, +1);
+	ledger.affect[affect_id] = std::move(entry);
+}
+
+
+/**
+ * \brief Remove an Affect from the Ledger.
+ *
+ * Nothing will happen if the Character's Ledger is not enabled.
+ */
+void Yars::characterLedgerAffectRemove(const Yars::Id character_id ///< The Character Id
+	, const Yars::Id affect_id ///< The Affect Id
+	) noexcept
+{
+	const auto iter = character_ledger.find(character_id);
+
+	if(iter == std::end(character_ledger))
 	{
-		return false;
+		return;
 	}
 
-	value = data.at(name);
+	Yars::Ledger& ledger = iter->second;
 
-	return true;
+	const auto entry = ledger.affect.find(affect_id);
+
+	if(entry == std::end(ledger.affect))
+	{
+		return;
+	}
+
+	ledgerAdjust(ledger, entry->second, -1);
+	ledger.affect.erase(entry);
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
+ * \brief Record an equipped Item in the Ledger.
  *
- * \ingroup group_CharacterData
- *
- * \brief Set Character data.
- *
- * The named data will be removed from the Character regardless of the type of 
- * data.  The value will be placed in \p value but if the data name is not 
- * valid or the requested data type is not available, the original contents of 
- * the \p value will not be changed.
- *
- * \example
- * Yars yars;
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterDataSet(bubba, "key", true);
- * \endexample
- *
- * \retval true  The data was stored
- * \retval false Failed to store the data
+ * Nothing will happen if the Character's Ledger is not enabled.
  */
-bool Yars::characterDataSet(const Yars::Id character_id ///< The Character Id
-	, const std::string& name  ///< The data name
-	, const bool         value ///< The data value
+void Yars::characterLedgerEquipmentAdd(const Yars::Id character_id ///< The Character Id
+	, const std::string& location ///< The equipment location
+	, const Yars::Item&  item     ///< The equipped Item
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	const auto iter = character_ledger.find(character_id);
+
+	if(iter == std::end(character_ledger))
 	{
-		return false;
+		return;
 	}
-#endif
 
-	character_data_bool[character_id][name] = value;
+	Yars::Ledger& ledger = iter->second;
 
-	return true;
+	Yars::LedgerEntry entry = ledgerEntry(item.modify_attribute
+		, item.modify_skill
+		, item.modify_health_maximum
+		);
+
+	ledgerAdjust(ledger, entry, +1);
+	ledger.equipment[location] = std::move(entry);
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
- *
- * \ingroup group_CharacterData
- *
- * \brief Set Character data.
- *
- * The named data will be removed from the Character regardless of the type of 
- * data.  The value will be placed in \p value but if the data name is not 
- * valid or the requested data type is not available, the original contents of 
- * the \p value will not be changed.
+ * \brief Remove an equipped Item from the Ledger.
  *
- * \example
- * Yars yars;
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterDataSet(bubba, "key", 42.0f);
- * \endexample
- *
- * \retval true  The data was stored
- * \retval false Failed to store the data
+ * Nothing will happen if the Character's Ledger is not enabled.
  */
-bool Yars::characterDataSet(const Yars::Id character_id ///< The Character Id
-	, const std::string& name  ///< The data name
-	, const float        value ///< The data value
+void Yars::characterLedgerEquipmentRemove(const Yars::Id character_id ///< The Character Id
+	, const std::string& location ///< The equipment location
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	const auto iter = character_ledger.find(character_id);
+
+	if(iter == std::end(character_ledger))
 	{
-		return false;
+		return;
 	}
-#endif
 
-	character_data_float[character_id][name] = value;
+	Yars::Ledger& ledger = iter->second;
 
-	return true;
+	const auto entry = ledger.equipment.find(location);
+
+	if(entry == std::end(ledger.equipment))
+	{
+		return;
+	}
+
+	ledgerAdjust(ledger, entry->second, -1);
+	ledger.equipment.erase(entry);
 }
 
+// }}}
+// {{{ Layer
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
+ * \ingroup group_Character
  *
- * \ingroup group_CharacterData
+ * \defgroup group_CharacterLayer Layer
  *
- * \brief Set Character data.
+ * \brief Put a Character in a group.
  *
- * The named data will be removed from the Character regardless of the type of 
- * data.  The value will be placed in \p value but if the data name is not 
- * valid or the requested data type is not available, the original contents of 
- * the \p value will not be changed.
+ * A Character in a group will have the modifiers of the
+ * \ref group_Layer "Layer" with the same name.
+ */
+
+/**
+ * \struct Yars::CharacterLayer
  *
- * \example
- * Yars yars;
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterDataSet(bubba, "key", 42);
- * \endexample
+ * \brief A Character's Layer state.
+ */
+
+/**
+ * \var Yars::CharacterLayer::layer
  *
- * \retval true  The data was stored
- * \retval false Failed to store the data
+ * \brief The groups that the Character is in.
  */
-bool Yars::characterDataSet(const Yars::Id character_id ///< The Character Id
-	, const std::string& name  ///< The data name
-	, const int32_t      value ///< The data value
-	) noexcept
-{
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
-#endif
 
-	character_data_int32[character_id][name] = value;
+/**
+ * \var Yars::CharacterLayer::attribute
+ *
+ * \brief The Attribute modifiers that have been applied.
+ */
 
-	return true;
-}
+/**
+ * \var Yars::CharacterLayer::skill
+ *
+ * \brief The Skill modifiers that have been applied.
+ */
 
+/**
+ * \var Yars::CharacterLayer::version
+ *
+ * \brief The Layer version that has been applied.
+ */
 
 /**
  * \todo{DebugMessage} Add debugging messages
  * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterData
+ * \ingroup group_CharacterLayer
  *
- * \brief Set Character data.
+ * \brief Add a Character to a group.
  *
- * The named data will be removed from the Character regardless of the type of 
- * data.  The value will be placed in \p value but if the data name is not 
- * valid or the requested data type is not available, the original contents of 
- * the \p value will not be changed.
+ * The Layer does not need to exist.  When a Layer with the same name is 
+ * added, its modifiers will apply to the Character.
  *
  * \example
  * Yars yars;
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterDataSet(bubba, "key", "value");
+ * yars.characterLayerAdd(bubba, "Zone.Forge");
  * \endexample
  *
- * \retval true  The data was stored
- * \retval false Failed to store the data
+ * \retval true  The Character was added to the group
+ * \retval false Failed to add the Character to the group
  */
-bool Yars::characterDataSet(const Yars::Id character_id ///< The Character Id
-	, const std::string& name  ///< The data name
-	, const std::string& value ///< The data value
+bool Yars::characterLayerAdd(const Yars::Id character_id ///< The Character Id
+	, const std::string& layer_name ///< The Layer name
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return false;
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+
+		if(layer_name.empty())
+		{
+			return false;
+		}
+
+		if(characterLayerExists(character_id, layer_name))
+		{
+			return false;
+		}
 	}
-#endif
 
-	character_data_string[character_id][name] = value;
+	character_layer[character_id].layer.push_back(layer_name);
+
+	characterLayerChanged(character_id);
+	characterLayerSync(character_id);
 
 	return true;
 }
 
-// }}}
-// {{{ Character: Skill
 
 /**
- * \ingroup group_Character
- *
- * \defgroup group_CharacterSkill Skill
+ * \ingroup group_CharacterLayer
  *
- * \brief A Character's Skills
+ * \brief Check if a Character is in a group.
  *
- * Anything that a Character can do must be done using Skills.  When a 
- * Character gains Skills, those skills will guide how the Character evolves.
+ * \example
+ * if(yars.characterLayerExists(bubba, "Zone.Forge"))
+ * {
+ * 	std::cout << "Bubba is in the Forge\n";
+ * }
+ * \endexample
  *
- * \see \ref group_Skill
+ * \retval true  The Character is in the group
+ * \retval false The Character is not in the group
  */
+bool Yars::characterLayerExists(const Yars::Id character_id ///< The Character Id
+	, const std::string& layer_name ///< The Layer name
+	) const noexcept
+{
+	const auto iter = character_layer.find(character_id);
+
+	if(iter == std::end(character_layer))
+	{
+		return false;
+	}
+
+	return Yars::vectorContains(iter->second.layer, layer_name);
+}
+
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \ingroup group_CharacterLayer
  *
- * \ingroup group_CharacterSkill
- *
- * \brief Access a Skill
+ * \brief Get a list of a Character's groups.
  *
- * Provides a way to access a Character's Skill.
+ * Global Layers are not included.
  *
  * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- *
- * Yars::Skill& skill = yars.characterSkill(bubba, "Skill");
+ * Yars::VectorString list = yars.characterLayerList(bubba);
  * \endexample
  *
- * \return A reference to a Skill
+ * \return A vector of Layer names.
  */
-Yars::Skill& Yars::characterSkill(const Yars::Id character_id ///< The Character Id
-	, const std::string& skill_name ///< The Skill name
-	) noexcept
+Yars::VectorString Yars::characterLayerList(const Yars::Id character_id ///< The Character Id
+	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		Yars::Skill* retval = nullptr;
-		return *retval;
-	}
+	const auto iter = character_layer.find(character_id);
 
-	if(characterSkillExists(character_id, skill_name) == false)
+	if(iter == std::end(character_layer))
 	{
-		Yars::Skill* retval = nullptr;
-		return *retval;
+		return {};
 	}
-#endif
 
-	return character_skill[character_id][skill_name];
+	return iter->second.layer;
 }
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_CharacterSkill
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \brief Access a Skill
+ * \ingroup group_CharacterLayer
  *
- * Provides a way to access a Character's Skill.
+ * \brief Remove a Character from a group.
  *
  * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- *
- * const Yars& y = yars;
- * const Yars::Skill& skill = y.characterSkill(bubba, "Skill");
+ * yars.characterLayerRemove(bubba, "Zone.Forge");
  * \endexample
  *
- * \return A reference to a Skill
+ * \retval true  The Character was removed from the group
+ * \retval false Failed to remove the Character from the group
  */
-const Yars::Skill& Yars::characterSkill(const Yars::Id character_id ///< The Character Id
-	, const std::string& skill_name ///< The Skill name
-	) const noexcept
+bool Yars::characterLayerRemove(const Yars::Id character_id ///< The Character Id
+	, const std::string& layer_name ///< The Layer name
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		Yars::Skill* retval = nullptr;
-		return *retval;
-	}
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 
-	if(characterSkillExists(character_id, skill_name) == false)
-	{
-		Yars::Skill* retval = nullptr;
-		return *retval;
+		if(characterLayerExists(character_id, layer_name) == false)
+		{
+			return false;
+		}
 	}
-#endif
 
-	return character_skill.at(character_id).at(skill_name);
+	std::erase(character_layer[character_id].layer, layer_name);
+
+	characterLayerChanged(character_id);
+	characterLayerSync(character_id);
+
+	return true;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_CharacterSkill
+ * \ingroup group_CharacterLayer
  *
- * \brief Add a Skill to a Character.
+ * \brief Apply the current Layers to a Character.
  *
- * Adds a Skill to a Character if it does not already exists.
+ * This is done automatically when a Layer or the Character's groups change, 
+ * so there is normally no reason to call this method.  The only exception is 
+ * an Attribute or Skill that was added through Yars::characterAttributeMap() 
+ * or Yars::characterSkillMap(), which will not have the Layer modifiers until 
+ * this method, or the non-const Yars::characterAttribute() or 
+ * Yars::characterSkill(), is called for the Character.  If the Character has 
+ * already seen the current Layer version, nothing is done.
  *
  * \example
- * Yars yars;
- * yars.skillAdd("Skill");
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
+ * yars.characterSkillMap(bubba)["Skill"] = {};
+ * yars.characterLayerSync(bubba);
  * \endexample
- *
- * \retval true  The Skill was added
- * \retval false Failed to add the Skill
  */
-bool Yars::characterSkillAdd(const Yars::Id character_id ///< The Character Id
-	, const std::string& skill_name ///< The Skill name
+void Yars::characterLayerSync(const Yars::Id character_id ///< The Character Id
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(layer_version == 0)
 	{
-		return false;
+		return;
 	}
 
-	if(skillExists(skill_name) == false)
+	const auto iter = character_layer.find(character_id);
+
+	if(iter == std::end(character_layer))
 	{
-		return false;
+		return;
+	}
+
+	Yars::CharacterLayer& state = iter->second;
+
+	if(state.version == layer_version)
+	{
+		return;
 	}
 
-	if(characterSkillExists(character_id, skill_name) == true)
+	state.version = layer_version;
+
+	Yars::MapStringInt32 attribute = {};
+	Yars::MapStringInt32 skill     = {};
+
+	for(const auto& layer_iter : layer_map)
 	{
-		return false;
+		const std::string& layer_name = layer_iter.first;
+		const Yars::Layer& layer      = layer_iter.second;
+
+		if(layer.is_global == false
+			&& Yars::vectorContains(state.layer, layer_name) == false
+			)
+		{
+			continue;
+		}
+
+		for(const auto& modifier : layer.modify_attribute)
+		{
+			attribute[modifier.first] += modifier.second;
+		}
+
+		for(const auto& modifier : layer.modify_skill)
+		{
+			skill[modifier.first] += modifier.second;
+		}
 	}
-#endif
 
-	Yars::MapStringSkill& skill = character_skill[character_id];
-	skill[skill_name] = skill_map[skill_name];
+	Yars::VectorString attribute_changed = {};
+	Yars::VectorString skill_changed     = {};
 
-	for(const auto& iter : skill[skill_name].attribute_contribution)
+	characterLayerApply(character_attribute.at(character_id), state.attribute, attribute, attribute_changed);
+	characterLayerApply(character_skill.at(character_id),     state.skill,     skill,     skill_changed);
+
+	if(attribute_changed.empty() && skill_changed.empty())
 	{
-		const std::string& attribute_name        = iter.first;
-		//const int32_t&   modifier_contirbution = iter.second;
+		return;
+	}
 
-		characterAttributeAdd(character_id, attribute_name);
+	// Only the Indexes of the Levels that changed need to be updated
+	for(const std::string& name : attribute_changed)
+	{
+		indexChanged(leaderboard_attribute, character_id, name);
 	}
 
-	return true;
+	for(const std::string& name : skill_changed)
+	{
+		indexChanged(index_skill,       character_id, name);
+		indexChanged(leaderboard_skill, character_id, name);
+		indexChanged(telemetry_skill,   character_id, name);
+	}
+
+	characterModifierCacheInvalidate(character_id);
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_CharacterSkill
- *
- * \brief Remove a Skill from a Character.
- *
- * Remove a Skill from a Character if it exists.
- *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill");
+ * \brief Apply Layer modifiers to Levels.
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- * \endexample
+ * Only the difference between the \p target and the \p applied modifiers is 
+ * added to each Level.  The \p applied modifiers are then updated and the 
+ * names of the Levels that were changed are added to \p changed.
+ */
+template <typename M>
+void Yars::characterLayerApply(M& level_map ///< The Attributes or Skills
+	, Yars::MapStringInt32&       applied ///< The modifiers that have been applied
+	, const Yars::MapStringInt32& target  ///< The modifiers that should be applied
+	, Yars::VectorString&         changed ///< The names of the changed Levels
+	) const noexcept
+{
+	Yars::MapStringInt32 result = {};
+
+	for(auto& iter : level_map)
+	{
+		const std::string& name = iter.first;
+
+		const auto want = target.find(name);
+		const auto have = applied.find(name);
+
+		const int32_t amount_want = (want == std::end(target))  ? 0 : want->second;
+		const int32_t amount_have = (have == std::end(applied)) ? 0 : have->second;
+
+		if(amount_want != amount_have)
+		{
+			Yars::levelModifierAdjust(iter.second.level, amount_want - amount_have);
+			changed.push_back(name);
+		}
+
+		if(amount_want != 0)
+		{
+			result[name] = amount_want;
+		}
+	}
+
+	applied = std::move(result);
+}
+
+
+/**
+ * \brief A Character's Layers need to be applied again.
  *
- * \retval true  The Skill was removed
- * \retval false Failed to remove the Skill
+ * Used when the Character's groups, Attributes, or Skills have changed.
  */
-bool Yars::characterSkillRemove(const Yars::Id character_id ///< The Character Id
-	, const std::string& skill_name ///< The Skill name
+void Yars::characterLayerChanged(const Yars::Id character_id ///< The Character Id
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	const auto iter = character_layer.find(character_id);
+
+	if(iter == std::end(character_layer))
 	{
-		return false;
+		return;
 	}
 
-	if(characterSkillExists(character_id, skill_name) == false)
+	iter->second.version = 0;
+
+	characterLevelChanged(character_id);
+}
+
+
+/**
+ * \brief An Attribute or Skill was added or removed.
+ *
+ * A new Level does not have any of the Layer modifiers, so what was applied 
+ * to the old Level is forgotten.
+ */
+void Yars::characterLayerReset(const Yars::Id character_id ///< The Character Id
+	, Yars::MapStringInt32 Yars::CharacterLayer::* applied ///< The applied modifiers
+	, const std::string& name ///< The Attribute or Skill name
+	) noexcept
+{
+	const auto iter = character_layer.find(character_id);
+
+	if(iter == std::end(character_layer))
 	{
-		return false;
+		return;
 	}
-#endif
 
-	Yars::MapStringSkill& skill = character_skill[character_id];
-	skill.erase(skill_name);
+	(iter->second.*applied).erase(name);
 
-	return true;
+	characterLayerChanged(character_id);
+	characterLayerSync(character_id);
+}
+
+
+/**
+ * \brief A Layer was added or removed.
+ *
+ * The Layer version is changed and the Layer modifiers are applied to every 
+ * Character that the Layer affects.  The other Characters are only moved to 
+ * the new version.  Every Character is visited, so this is O(population).
+ */
+void Yars::characterLayerSyncAll(const std::string& layer_name ///< The Layer name
+	, const bool is_global ///< The Layer applies to every Character
+	) noexcept
+{
+	const uint64_t previous_version = layer_version;
+
+	layer_version++;
+
+	for(auto& iter : character_layer)
+	{
+		const Yars::Id        character_id = iter.first;
+		Yars::CharacterLayer& state        = iter.second;
+
+		if(is_global || Yars::vectorContains(state.layer, layer_name))
+		{
+			characterLayerSync(character_id);
+		}
+		else if(state.version == previous_version)
+		{
+			state.version = layer_version;
+		}
+	}
 }
 
+// }}}
+// {{{ Modifier Cache
+
+/**
+ * \ingroup group_Character
+ *
+ * \defgroup group_CharacterModifierCache Modifier Cache
+ *
+ * \brief Remember a Character's Skill modifiers.
+ *
+ * When a Character's Modifier Cache is enabled, Yars::calculateModifier() 
+ * will only calculate the modifier of a Skill the first time that it is 
+ * needed.  After that, the stored modifier is used until the Character's 
+ * Attributes or Skills are changed.
+ *
+ * \see group_ModifierCache
+ */
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterSkill
+ * \ingroup group_CharacterModifierCache
  *
- * \brief Increase the Skill Level.
+ * \brief Enable or disable a Character's Modifier Cache.
  *
- * As a Character uses a Skill, that Skill Level will eventually increase.  
- * This method give the Skill that opportunity.  Calling this method is not 
- * necessary because it will be automatically invoked when needed.
+ * Disabling the Modifier Cache will discard all the stored modifiers.
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Skill", {});
- *
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- *
- * yars.characterSkillIncrease(bubba, "Skill", 0.25f);
+ * yars.characterModifierCacheEnable(bubba);
  * \endexample
  *
- * \retval true  The Skill increased in a Level
- * \retval false The Skill increase was not enough to increase the Level
+ * \retval true  The Modifier Cache has been enabled or disabled
+ * \retval false Failed to change the Modifier Cache
  */
-bool Yars::characterSkillIncrease(const Yars::Id character_id ///< The Character Id
-	, const std::string& skill_name ///< The Skill name
-	, const float        amount     ///< How much to increase the Skill
+bool Yars::characterModifierCacheEnable(const Yars::Id character_id ///< The Character Id
+	, const bool enable ///< Enable or disable the Modifier Cache
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return false;
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 	}
 
-	if(characterSkillExists(character_id, skill_name) == false)
+	if(enable == false)
 	{
-		return false;
-	}
-#endif
+		modifier_cache.erase(character_id);
 
-	Yars::MapStringSkill& skill = character_skill[character_id];
+		return true;
+	}
 
-	levelIncrease(skill[skill_name].level, amount);
+	if(modifier_cache.contains(character_id))
+	{
+		return true;
+	}
 
-	// If skill level increased, Event: Level_Up, character_id skill_name
+	modifier_cache[character_id] =
+	{	.entry      = Yars::VectorModifierCacheEntry(skill_handle_name.size())
+	,	.generation = ++modifier_cache_generation
+	};
 
 	return true;
 }
-
-
-/**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_CharacterSkill
- *
- * \brief Check if a Character has a Skill
+
+
+/**
+ * \ingroup group_CharacterModifierCache
  *
- * Check if a Character has a Skill
+ * \brief Check if a Character's Modifier Cache is enabled.
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Skill", {});
- *
  * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- *
- * if(yars.characterSkillExists(bubba, "Skill"))
+ * if(yars.characterModifierCacheIsEnabled(bubba) == false)
  * {
- * 	std::cout << "Bubba has Skill\n";
+ * 	yars.characterModifierCacheEnable(bubba);
  * }
  * \endexample
  *
- * \retval true  The Character does have the Skill.
- * \retval false The Character does not have the Skill.
+ * \retval true  The Modifier Cache is enabled
+ * \retval false The Modifier Cache is not enabled
  */
-bool Yars::characterSkillExists(const Yars::Id character_id ///< The Character Id
-	, const std::string& skill_name ///< The Skill name
+bool Yars::characterModifierCacheIsEnabled(const Yars::Id character_id ///< The Character Id
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return false;
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 	}
-#endif
-
-	const Yars::MapStringSkill& skill_map = character_skill.at(character_id);
 
-	return skill_map.contains(skill_name);
+	return modifier_cache.contains(character_id);
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \ingroup group_CharacterModifierCache
  *
- * \ingroup group_CharacterSkill
+ * \brief Invalidate a Character's Modifier Cache.
  *
- * \brief Get a list of Skills.
+ * Yars will do this automatically when the Character's Attributes or Skills 
+ * are accessed for writing.  Only the Modifier Cache is invalidated, use 
+ * Yars::characterLevelChanged() to also update the Indexes.
  *
- * All the Skill names of the Character will be collected and returned.
+ * Nothing will happen if the Character's Modifier Cache is not enabled.
  *
  * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- *
- * Yars::VectorString list = yars.characterSkillList(bubba);
+ * yars.characterModifierCacheInvalidate(bubba);
  * \endexample
- *
- * \return A vector of Skill names
  */
-Yars::VectorString Yars::characterSkillList(const Yars::Id character_id ///< The Character Id
-	) const noexcept
+void Yars::characterModifierCacheInvalidate(const Yars::Id character_id ///< The Character Id
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(modifier_cache.empty())
 	{
-		return {};
+		return;
 	}
-#endif
 
-	const Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
+	const auto iter = modifier_cache.find(character_id);
 
-	return Yars::mapKeyList(skill_map);
+	if(iter == std::end(modifier_cache))
+	{
+		return;
+	}
+
+	iter->second.generation = ++modifier_cache_generation;
+
+	modifier_cache_stats.invalidate++;
 }
 
+// }}}
+// }}}
+// {{{ Archetype
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \defgroup group_Archetype Archetype
  *
- * \ingroup group_CharacterSkill
+ * \brief Create many Characters that start out the same.
  *
- * \brief Get a map of Skills.
+ * An Archetype is a copy of a Character that was set up with the normal 
+ * Character methods: Attributes, Skills, Items, Equipment, Health, Data, and 
+ * Layer groups.  Yars::characterSpawn() will then create as many Characters 
+ * as needed from the Archetype.
  *
- * All the Skills of the Character will be accessible via the returned map.
+ * A spawned Character shares the Archetype's Attributes, Data, Skills, 
+ * Equipment Items, and Inventory, copy-on-write.  Spawning only adds a 
+ * reference to each of those containers, and a Character that is never 
+ * changed does not use any memory for them.  The first time one of those 
+ * containers is accessed for writing, through a non-const method, the 
+ * Character gets its own copy of that container only.  The Health, 
+ * configuration, Equipment slot names, and Layer groups are small and are 
+ * always copied.
+ *
+ * Note that some changes touch every Character, such as a global 
+ * \ref group_Layer "Layer" or a Yars::tick() with decay, and will give every 
+ * affected Character its own copy.  Yars::characterIsShared() tells if a 
+ * Character still shares any data.
+ *
+ * Changing or removing the Archetype will not change any Characters.
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Skill", {});
+ * yars.skillAdd("Club", {});
+ * yars.itemAdd("Club", { .skill_attacker = { "Club" } });
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
+ * Yars::Id goblin = yars.characterCreate();
+ * yars.characterSkillAdd(goblin, "Club");
+ * yars.characterItemAdd(goblin, "Club");
+ * yars.archetypeAdd("Goblin", goblin);
+ * yars.characterDelete(goblin);
  *
- * Yars::MapStringSkill& list = yars.characterSkillMap(bubba);
+ * Yars::VectorId wave;
+ * yars.characterSpawn("Goblin", 5000, wave);
  * \endexample
- *
- * \return A map of Skills
  */
-Yars::MapStringSkill& Yars::characterSkillMap(const Yars::Id character_id ///< The Character Id
-	) noexcept
-{
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		Yars::MapStringSkill* retval = nullptr;
-		return *retval;
-	}
-#endif
 
-	auto& skill = character_skill[character_id];
+/**
+ * \struct Yars::Archetype
+ *
+ * \brief A copy of a Character's data.
+ */
 
-	return skill;
-}
+/**
+ * \struct Yars::ArchetypeShared
+ *
+ * \brief An Archetype and the containers that spawned Characters share.
+ *
+ * The shared containers are moved out of the \c archetype, so they are only 
+ * stored once.
+ */
 
+/**
+ * \typedef Yars::MapStringArchetype
+ *
+ * \brief A convenience type.
+ */
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterSkill
+ * \ingroup group_Archetype
  *
- * \brief Get a map of Skills.
+ * \brief Add an Archetype.
  *
- * All the Skills of the Character will be accessible via the returned map.
+ * The Character's data is copied in to the Archetype.  Affects are not part 
+ * of an Archetype, in safe-mode a Character with Affects can not be used. 
+ * If the Character's \ref group_CharacterLedger "Ledger" or
+ * \ref group_CharacterModifierCache "Modifier Cache" is enabled, it will also
+ * be enabled in the spawned Characters.
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Skill", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- *
- * const Yars& y = yars;
- * const Yars::MapStringSkill& list = y.characterSkillMap(bubba);
+ * Yars::Id goblin = yars.characterCreate();
+ * // Set up the goblin
+ * yars.archetypeAdd("Goblin", goblin);
  * \endexample
  *
- * \return A map of Skills
+ * \retval true  The Archetype was added
+ * \retval false Failed to add the Archetype
  */
-const Yars::MapStringSkill& Yars::characterSkillMap(const Yars::Id character_id ///< The Character Id
-	) const noexcept
+bool Yars::archetypeAdd(const std::string& archetype_name ///< The Archetype name
+	, const Yars::Id character_id ///< The Character to copy
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		Yars::MapStringSkill* retval = nullptr;
-		return *retval;
+		if(archetype_name.empty())
+		{
+			return false;
+		}
+
+		if(archetypeExists(archetype_name))
+		{
+			return false;
+		}
+
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+
+		if(characterAffectList(character_id).empty() == false)
+		{
+			return false;
+		}
 	}
-#endif
 
-	const auto& skill = character_skill.at(character_id);
+	Yars::Archetype        archetype = characterArchetype(character_id);
+	Yars::ArchetypeShared& shared    = archetype_map[archetype_name];
 
-	return skill;
-}
+	// The containers that are shared with the spawned Characters
+	shared.attribute      = std::make_shared<Yars::MapStringAttribute>(std::move(archetype.attribute));
+	shared.data           = std::make_shared<Yars::VectorCharacterData>(std::move(archetype.data));
+	shared.skill          = std::make_shared<Yars::MapStringSkill>(std::move(archetype.skill));
+	shared.equipment_item = std::make_shared<Yars::MapStringItem>(std::move(archetype.equipment_item));
+	shared.item           = std::make_shared<Yars::MapStringCharacterItem>(std::move(archetype.item));
+	shared.archetype      = std::move(archetype);
 
+	return true;
+}
 
-// }}}
-// {{{ Character: Item
 
 /**
- * \todo{InventoryRewrite} Should Items be able to contain other Items?
- * - No. Use the custom data to define the "container".
+ * \todo{DebugMessage} Add debugging messages
  *
- * \todo{InventoryRewrite} The description of the Character Item is not 
- * supported by the code.  AffectInit() allows for any usable Item.  This can 
- * be fixed by adding `characterItemUse()` and characterEquipmentUse()`.
+ * \ingroup group_Archetype
  *
- * \todo{InventoryRewrite} Item is broken.  Consider the following approaches:
- * - Items should contain their own name
- * - Items have their own "data"
- * - Items match only if all "data" matches
- *   - What about `count`?
- * - Missing "familiarity" by the user of the Item
- *   - Could this be handled by `Custom Data`?
- * - Add Policy controller support
- *   - Policy Stacking
- *     - Set Default Stacking value
- *     - Data Key: "Yars.ItemPolicy.Stacking.MaxCount"
- *   - Policy Weight
- *   - Policy Packing
- *   - Policy uses data "Yars.ItemPolicy.Stacking.KEY"
+ * \brief Check if an Archetype exists.
  *
- * \ingroup group_Character
+ * \example
+ * if(yars.archetypeExists("Goblin"))
+ * {
+ * 	std::cout << "Goblins!\n";
+ * }
+ * \endexample
  *
- * \defgroup group_CharacterItem Item
+ * \retval true  The Archetype exists
+ * \retval false The Archetype does not exist
+ */
+bool Yars::archetypeExists(const std::string& archetype_name ///< The Archetype name
+	) const noexcept
+{
+	return archetype_map.contains(archetype_name);
+}
+
+
+/**
+ * \ingroup group_Archetype
  *
- * \brief The Character's Items.
+ * \brief Get a list of Archetype names.
  *
- * Items allow a Character to use their Skills.  A Character must have the 
- * Skill to use Item as well as having that Item in their possession.  The 
- * outcome of using an Item is in Affect is created.  The Affect can then be 
- * applied to a Character.
+ * \example
+ * Yars::VectorString list = yars.archetypeList();
+ * \endexample
  *
- * \see \ref group_Affect
+ * \return A vector of Archetype names.
  */
+Yars::VectorString Yars::archetypeList() const noexcept
+{
+	return Yars::mapKeyList(archetype_map);
+}
+
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterItem
+ * \ingroup group_Archetype
  *
- * \brief Access a Character's Item.
+ * \brief Remove an Archetype.
  *
- * Provides access to an Item that the Character possesses.
+ * Characters that were spawned from the Archetype are not changed.
  *
  * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
- *
- * Yars::Item& item = yars.characterItem(bubba, "Item");
+ * yars.archetypeRemove("Goblin");
  * \endexample
  *
- * \return A reference to an Item.
+ * \retval true  The Archetype was removed
+ * \retval false Failed to remove the Archetype
  */
-Yars::Item& Yars::characterItem(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
-	, const uint32_t     offset    ///< Which Item to access
+bool Yars::archetypeRemove(const std::string& archetype_name ///< The Archetype name
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		Yars::Item* retval = nullptr;
-		return *retval;
+		if(archetypeExists(archetype_name) == false)
+		{
+			return false;
+		}
 	}
 
-	if(characterItemExists(character_id, item_name) == false)
+	archetype_map.erase(archetype_name);
+
+	return true;
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Archetype
+ *
+ * \brief Create a copy of a Character.
+ *
+ * The new Character will have all the same data as the \p character_id, 
+ * including the Affects that have been applied.  Each container is copied as 
+ * a whole, which is much faster than reading each Attribute, Skill, and Item 
+ * and adding them to a new Character.
+ *
+ * \example
+ * Yars::Id mirror = 0;
+ * yars.characterClone(player, mirror);
+ * \endexample
+ *
+ * \retval true  The Character was copied
+ * \retval false Failed to copy the Character
+ */
+bool Yars::characterClone(const Yars::Id character_id ///< The Character to copy
+	, Yars::Id& clone_id ///< The new Character Id
+	) noexcept
+{
+	if(safeMode())
 	{
-		Yars::Item* retval = nullptr;
-		return *retval;
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 	}
 
-	if(character_item.at(character_id).count(item_name) <= offset)
+	Yars::Archetype archetype = characterArchetype(character_id);
+
+	clone_id = characterIdNext();
+
+	characterCopy(clone_id, std::move(archetype));
+
+	const auto affect = character_affect.find(character_id);
+
+	if(affect != std::end(character_affect))
 	{
-		Yars::Item* retval = nullptr;
-		return *retval;
+		character_affect[clone_id] = affect->second;
 	}
-#endif
 
-	auto range = character_item[character_id].equal_range(item_name);
+	action_skill_generation++;
 
-	auto iter = range.first;
-	std::advance(iter, offset);
-
-	return iter->second;
+	return true;
 }
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterItem
+ * \ingroup group_Archetype
  *
- * \brief Access a Character's Item.
+ * \brief Copy a Character out of Yars.
  *
- * Provides access to an Item that the Character possesses.
+ * The Character's data is copied in to \p archetype so that it can be given 
+ * to Yars::characterImport() of another Yars instance.  Affects can not be 
+ * moved between Yars instances, in safe-mode a Character with Affects can 
+ * not be exported.
  *
  * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
+ * Yars::Archetype data;
+ * world.characterExport(player, data);
  *
- * const Yars& y = yars;
- * const Yars::Item& item = y.characterItem(bubba, "Item");
+ * Yars::Id id = 0;
+ * dungeon.characterImport(data, id);
  * \endexample
  *
- * \return A reference to an Item.
+ * \retval true  The Character was exported
+ * \retval false Failed to export the Character
  */
-const Yars::Item& Yars::characterItem(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
-	, const uint32_t     offset    ///< Which Item to access
+bool Yars::characterExport(const Yars::Id character_id ///< The Character Id
+	, Yars::Archetype& archetype ///< Where to copy the data
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		Yars::Item* retval = nullptr;
-		return *retval;
-	}
-
-	if(characterItemExists(character_id, item_name) == false)
+	if(safeMode())
 	{
-		Yars::Item* retval = nullptr;
-		return *retval;
-	}
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 
-	if(character_item.at(character_id).count(item_name) <= offset)
-	{
-		Yars::Item* retval = nullptr;
-		return *retval;
+		if(characterAffectList(character_id).empty() == false)
+		{
+			return false;
+		}
 	}
-#endif
 
-	auto range = character_item.at(character_id).equal_range(item_name);
+	archetype = characterArchetype(character_id);
 
-	auto iter = range.first;
-	std::advance(iter, offset);
+	for(const Yars::CharacterData& data : archetype.data)
+	{
+		archetype.data_name.push_back(data_handle_name[data.handle]);
+	}
 
-	return iter->second;
+	return true;
 }
 
 
@@ -4797,134 +15699,121 @@ const Yars::Item& Yars::characterItem(const Yars::Id character_id ///< The Chara
  * \todo{DebugMessage} Add debugging messages
  * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterItem
+ * \ingroup group_Archetype
  *
- * \brief Add an Item to a Character
+ * \brief Copy a Character in to Yars.
  *
- * The specified Item will be added to the Character.  Optionally, the number 
- * of Items can also be provided.
+ * A new Character is created from the \p archetype that was made by 
+ * Yars::characterExport(), possibly by another Yars instance.  Everything 
+ * that depends on the instance is rebuilt: 
+ * - Skill and Item sets use this instance's Skill Handles 
+ * - Character data uses this instance's data name Handles 
+ * - The Layer modifiers of the other instance are removed and this 
+ *   instance's Layers are applied 
+ * - The \ref group_CharacterLedger "Ledger" is rebuilt
  *
  * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
+ * Yars::Id id = 0;
+ * dungeon.characterImport(data, id);
  * \endexample
  *
- * \retval true  The Item was added
- * \retval false Failed to add the Item
+ * \retval true  The Character was imported
+ * \retval false Failed to import the Character
  */
-bool Yars::characterItemAdd(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
-	, const uint32_t     amount    ///< The number of Items to add
+bool Yars::characterImport(const Yars::Archetype& archetype ///< The Character data
+	, Yars::Id& character_id ///< The new Character Id
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return false;
+		if(archetype.data_name.size() != archetype.data.size())
+		{
+			return false;
+		}
 	}
 
-	if(itemExists(item_name) == false)
-	{
-		return false;
-	}
+	character_id = characterIdNext();
 
-	if(amount == 0)
-	{
-		return false;
-	}
-#endif
+	characterCopy(character_id, archetype);
 
-	Yars::MultimapStringItem& inventory = character_item[character_id];
-	const auto                range     = inventory.equal_range(item_name);
-	const uint32_t            count_max = character_config[character_id].item_stack_max;
-	uint32_t                  remaining = amount;
+	Yars::VectorCharacterData& data = character_data[character_id];
 
-	for(auto iter = range.first; iter != range.second; iter++)
+	for(size_t index = 0; index < data.size(); index++)
 	{
-		Yars::Item& new_item = iter->second;
+		data[index].handle = Yars::handleIntern(data_handle
+			, data_handle_name
+			, archetype.data_name[index]
+			);
+	}
 
-		if(new_item.count >= count_max)
+	std::stable_sort(std::begin(data), std::end(data)
+		, [](const Yars::CharacterData& lhs, const Yars::CharacterData& rhs)
 		{
-			continue;
-		}
+			return (lhs.handle < rhs.handle);
+		});
 
-		uint32_t count = count_max - new_item.count;
+	Yars::CharacterLayer& layer   = character_layer[character_id];
+	Yars::VectorString    changed = {};
 
-		if(count >= remaining)
-		{
-			new_item.count += std::exchange(remaining, 0);
-			break;
-		}
+	characterLayerApply(character_attribute[character_id], layer.attribute, {}, changed);
+	characterLayerApply(character_skill[character_id],     layer.skill,     {}, changed);
+	layer.version = 0;
 
-		new_item.count = count_max;
-		remaining -= count;
-	}
+	characterLayerSync(character_id);
 
-	const Yars::Item& new_item = this->item(item_name);
+	character_skill_set.erase(character_id);
 
-	while(remaining > 0)
+	for(auto& iter : character_item[character_id])
 	{
-		auto iter = inventory.insert({item_name, new_item});
-		Yars::Item& item = iter->second;
-
-		if(remaining <= count_max)
+		for(Yars::Item& item : iter.second.stack)
 		{
-			item.count = std::exchange(remaining, 0);
-			break;
+			itemSkillSetUpdate(item);
 		}
+	}
 
-		item.count = count_max;
-		remaining -= count_max;
+	for(auto& iter : character_equipment_item[character_id])
+	{
+		itemSkillSetUpdate(iter.second);
 	}
 
+	if(archetype.ledger_enable)
+	{
+		characterLedgerRebuild(character_id);
+	}
+
+	action_skill_generation++;
+
 	return true;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
+ * \ingroup group_Archetype
  *
- * \ingroup group_CharacterItem
+ * \brief Check if a Character shares data with an Archetype.
  *
- * \brief Add an Item to a Character
+ * A Character that was spawned from an Archetype shares the Archetype's data 
+ * until it is changed.
  *
- * \note This method is private, no there are no sanity checks.
+ * \example
+ * Yars::VectorId wave;
+ * yars.characterSpawn("Goblin", 1, wave);
+ * yars.characterIsShared(wave[0]); // true
+ * yars.characterSkillIncrease(wave[0], "Club", 1.0f);
+ * \endexample
  *
- * \retval true  The Item was added
- * \retval false Failed to add the Item
+ * \retval true  Some of the Character's data is shared
+ * \retval false None of the Character's data is shared
  */
-bool Yars::characterItemAdd(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
-	, const Yars::Item&  new_item  ///< A reference to the Item
-	) noexcept
+bool Yars::characterIsShared(const Yars::Id character_id ///< The Character Id
+	) const noexcept
 {
-	Yars::MultimapStringItem& inventory = character_item[character_id];
-	auto                      range     = inventory.equal_range(item_name);
-	const uint32_t            count_max = character_config[character_id].item_stack_max;
-
-	bool was_added = false;
-	for(auto& iter = range.first; iter != range.second; iter++)
-	{
-		Yars::Item& item = iter->second;
-
-		if(item.count < count_max)
-		{
-			iter->second.count++;
-			was_added = true;
-			break;
-		}
-	}
-	
-	if(was_added == false)
-	{
-		inventory.emplace(item_name, new_item);
-	}
-
-	return true;
+	return (character_attribute.isShared(character_id)
+		|| character_data.isShared(character_id)
+		|| character_equipment_item.isShared(character_id)
+		|| character_item.isShared(character_id)
+		|| character_skill.isShared(character_id)
+		);
 }
 
 
@@ -4932,2279 +15821,2791 @@ bool Yars::characterItemAdd(const Yars::Id character_id ///< The Character Id
  * \todo{DebugMessage} Add debugging messages
  * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterItem
+ * \ingroup group_Archetype
  *
- * \brief Remove an Item from a Character
+ * \brief Create Characters from an Archetype.
  *
- * The specified Item will be removed from the Character.  If an amount is 
- * specified then that many Items will be removed, if possible.
+ * The Ids of the new Characters are added to the end of \p id_list.  All the 
+ * Ids are allocated before any data is copied, so the Character containers 
+ * only need to grow once.  Each Character then shares the Archetype's data 
+ * until it is changed, see \ref group_Archetype.
  *
  * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
- * // Do Stuff
- * yars.characterItemRemove(bubba, "Item");
+ * Yars::VectorId wave;
+ * yars.characterSpawn("Goblin", 5000, wave);
  * \endexample
  *
- * \retval true  The Item was removed
- * \retval false Failed to remove the Item
+ * \retval true  The Characters were created
+ * \retval false Failed to create the Characters
  */
-bool Yars::characterItemRemove(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
-	, const uint32_t     amount    ///< The number of Items to remove
+bool Yars::characterSpawn(const std::string& archetype_name ///< The Archetype name
+	, const size_t    count   ///< The number of Characters
+	, Yars::VectorId& id_list ///< The new Character Ids
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return false;
+		if(archetypeExists(archetype_name) == false)
+		{
+			return false;
+		}
 	}
 
-	if(characterItemExists(character_id, item_name) == false)
-	{
-		return false;
-	}
-#endif
+	const Yars::ArchetypeShared& shared = archetype_map.at(archetype_name);
 
-	Yars::MultimapStringItem& inventory        = character_item[character_id];
-	auto                      range            = inventory.equal_range(item_name);
-	uint32_t                  amount_to_remove = amount;
+	const size_t first = id_list.size();
+	id_list.reserve(first + count);
 
-	auto iter = range.first;
-	while(iter != range.second)
+	if(yars_config.id_shuffle && count > 0)
 	{
-		Yars::Item& item = iter->second;
+		std::random_shuffle(std::begin(character_pool)
+			, std::end(character_pool)
+			);
+	}
 
-		if(item.count > amount_to_remove)
-		{
-			item.count -= amount_to_remove;
+	const size_t from_pool = std::min(count, character_pool.size());
 
-			break;
-		}
+	for(size_t index = 0; index < from_pool; index++)
+	{
+		id_list.push_back(character_pool.back());
+		character_pool.pop_back();
+	}
 
-		amount_to_remove -= item.count;
+	for(size_t index = from_pool; index < count; index++)
+	{
+		id_list.push_back(character_id_max);
+		character_id_max++;
+	}
 
-		iter = inventory.erase(iter);
+	character_config.reserve(character_id_max);
+	character_health.resize(character_id_max);
+	character_attribute.reserve(character_id_max);
+	character_data.reserve(character_id_max);
+	character_skill.reserve(character_id_max);
+	character_equipment_item.reserve(character_id_max);
+	character_equipment_name.reserve(character_id_max);
+	character_item.reserve(character_id_max);
+	character_skill_set.reserve(character_id_max);
+	character_layer.reserve(character_id_max);
+
+	for(size_t index = first; index < id_list.size(); index++)
+	{
+		characterCopy(id_list[index], shared.archetype, &shared);
 	}
 
+	action_skill_generation++;
+
 	return true;
 }
 
 
 /**
- * \todo{InventoryRewrite} Should this method be private?
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_CharacterItem
- *
- * \brief Remove an Item from a Character
+ * \brief Copy a Character in to an Archetype.
  *
- * The specified Item will be removed from the Character.  This method differs 
- * from Yars::characterItemRemove() by returning a copy of the removed Item.  
- * And only one Item can be taken at a time.
+ * Affects are not part of an Archetype.
  *
- * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
+ * \return The Archetype
+ */
+Yars::Archetype Yars::characterArchetype(const Yars::Id character_id ///< The Character Id
+	) const noexcept
+{
+	Yars::Archetype archetype =
+	{	.config         = character_config.at(character_id)
+	,	.health         = character_health.at(character_id)
+	,	.attribute      = character_attribute.at(character_id)
+	,	.data           = character_data.at(character_id)
+	,	.skill          = character_skill.at(character_id)
+	,	.equipment_item = character_equipment_item.at(character_id)
+	,	.equipment_name = character_equipment_name.at(character_id)
+	,	.item           = character_item.at(character_id)
+	,	.layer          = character_layer.at(character_id)
+	,	.modifier_cache = modifier_cache.contains(character_id)
+	};
+
+	const auto skill_set = character_skill_set.find(character_id);
+
+	if(skill_set != std::end(character_skill_set))
+	{
+		archetype.skill_set = skill_set->second;
+	}
+
+	const auto ledger = character_ledger.find(character_id);
+
+	if(ledger != std::end(character_ledger))
+	{
+		archetype.ledger        = ledger->second;
+		archetype.ledger_enable = true;
+	}
+
+	return archetype;
+}
+
+
+/**
+ * \brief Copy an Archetype in to a Character.
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
- * // Do Stuff
- * yars.characterItemRemove(bubba, "Item");
- * \endexample
+ * This is the same as characterClear() except that the Archetype's data is 
+ * used instead of empty data.  If \p archetype is an rvalue, its data is 
+ * moved.
  *
- * \retval true  The Item was removed
- * \retval false Failed to remove the Item
+ * When \p shared is given, the Attributes, Data, Skills, Equipment Items, 
+ * and Inventory are not copied.  The Character shares them with the 
+ * Archetype until they are accessed for writing.
  */
-Yars::Item Yars::characterItemTake(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
+template <typename A>
+void Yars::characterCopy(const Yars::Id character_id ///< The Character Id
+	, A&& archetype ///< The Archetype
+	, const Yars::ArchetypeShared* shared ///< The shared containers
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(character_affect.contains(character_id))
 	{
-		return {};
+		character_affect.erase(character_id);
 	}
 
-	if(characterItemExists(character_id, item_name) == false)
+	itemOwnerCharacterRemove(character_id);
+
+	if(shared == nullptr)
 	{
-		return {};
+		character_attribute.assign(character_id,      std::forward<A>(archetype).attribute);
+		character_data.assign(character_id,           std::forward<A>(archetype).data);
+		character_equipment_item.assign(character_id, std::forward<A>(archetype).equipment_item);
+		character_item.assign(character_id,           std::forward<A>(archetype).item);
+		character_skill.assign(character_id,          std::forward<A>(archetype).skill);
+	}
+	else
+	{
+		character_attribute.share(character_id,      shared->attribute);
+		character_data.share(character_id,           shared->data);
+		character_equipment_item.share(character_id, shared->equipment_item);
+		character_item.share(character_id,           shared->item);
+		character_skill.share(character_id,          shared->skill);
 	}
-#endif
 
-	Yars::MultimapStringItem& inventory = character_item[character_id];
+	character_config[character_id]         = std::forward<A>(archetype).config;
+	character_equipment_name[character_id] = std::forward<A>(archetype).equipment_name;
+	character_health[character_id]         = std::forward<A>(archetype).health;
 
-	const auto iter = inventory.find(item_name);
+	character_skill_set[character_id] = std::forward<A>(archetype).skill_set;
+	character_layer[character_id]     = std::forward<A>(archetype).layer;
 
-	Yars::Item& item = iter->second;
+	itemOwnerCharacterAdd(character_id);
 
-	Yars::Item taken_item = item;
-	taken_item.count = 1;
+	if(archetype.ledger_enable)
+	{
+		character_ledger[character_id] = std::forward<A>(archetype).ledger;
+	}
+	else
+	{
+		character_ledger.erase(character_id);
+	}
 
-	if(item.count == 1)
+	if(archetype.modifier_cache)
 	{
-		inventory.erase(iter);
+		modifier_cache[character_id] =
+		{	.entry      = Yars::VectorModifierCacheEntry(skill_handle_name.size())
+		,	.generation = ++modifier_cache_generation
+		};
 	}
 	else
 	{
-		item.count--;
+		modifier_cache.erase(character_id);
 	}
 
-	return taken_item;
+	characterLayerSync(character_id);
+
+	actionCharacterChanged(character_id);
+	indexCharacterChanged(character_id);
 }
 
+// }}}
+// {{{ Tick
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \defgroup group_Tick Tick
  *
- * \ingroup group_CharacterItem
+ * \brief Update all Characters at once.
  *
- * \brief Check if a Character has an Item
+ * Games usually change some Character data at a fixed rate: Health 
+ * regenerates every second, unused Skills slowly decay, etc.  Doing this with 
+ * Yars::characterHealth() and Yars::healthAdjust() costs a Character lookup 
+ * per Character.  Yars::tick() instead walks the Health of every Character 
+ * in Id order, which the compiler is able to turn in to SIMD instructions.
  *
- * Find out if a Character has the requested Item.
+ * The rules of a tick are in a Yars::Tick: 
+ * - Yars::Tick.health is added to Yars::Health.current of every living 
+ *   Character.  The amount can be negative.  Dead Characters, with a 
+ *   Yars::Health.current of `0`, are not healed. 
+ * - Yars::Tick.decay_attribute and Yars::Tick.decay_skill are passed to 
+ *   Yars::levelDecrease() for each Attribute and Skill that the Character 
+ *   has.  Attributes and Skills are not added by a tick.
  *
- * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
+ * Anything interesting that happened is added to the Yars::TickEvent: 
+ * - Yars::TickEvent.died contains the Characters whose Health reached `0`. 
+ * - Yars::TickEvent.health_full contains the Characters whose Health reached 
+ *   Yars::Health.maximum.
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
+ * \example
+ * Yars::TickEvent event;
+ * yars.tick({ .health = 1 }, event);
  *
- * if(yars.characterItemExists(bubba, "Item"))
+ * for(const Yars::Id id : event.died)
  * {
- * 	std::cout << "Bubba has an Item!\n";
+ * 	// Bleed out
  * }
  * \endexample
+ */
+
+/**
+ * \struct Yars::Tick
  *
- * \retval true  The Character does have the Item
- * \retval false The Character does not have the Item.
+ * \brief The changes made to every Character by a tick.
  */
-bool Yars::characterItemExists(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
-	) const noexcept
+
+/**
+ * \struct Yars::TickEvent
+ *
+ * \brief The Characters that were changed by a tick.
+ */
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ *
+ * \ingroup group_Tick
+ *
+ * \brief Update all Characters.
+ *
+ * The Health of the Characters is updated in blocks of 
+ * Yars::Tick_Block_Size.  Only a block that has a Character that died or 
+ * reached full Health is checked again to find the Character Ids.
+ *
+ * \example
+ * Yars::TickEvent event;
+ * yars.tick(
+ * 	{	.health      = 2
+ * 	,	.decay_skill = { { "Sword", 0.1f } }
+ * 	}, event);
+ * \endexample
+ */
+void Yars::tick(const Yars::Tick& tick ///< The changes to make
+	, Yars::TickEvent& event ///< What happened
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	Yars::VectorId pool = character_pool;
+	std::sort(std::begin(pool), std::end(pool));
+
+	if(tick.health != 0)
+	{
+		const uint32_t heal = (tick.health > 0) ? (uint32_t)tick.health : 0;
+		const uint32_t hurt = (tick.health < 0) ? (uint32_t)(-(int64_t)tick.health) : 0;
+
+		Yars::Health* health = character_health.data();
+		const size_t  count  = character_health.size();
+
+		for(size_t first = 0; first < count; first += Tick_Block_Size)
+		{
+			const size_t size = std::min(Tick_Block_Size, count - first);
+
+			Yars::Health* block = health + first;
+
+			uint32_t changed = 0;
+
+			for(size_t index = 0; index < size; index++)
+			{
+				const uint32_t current = tickHealth(block[index], heal, hurt);
+
+				changed |= (current != block[index].current)
+					& ((current == 0) | (current == block[index].maximum))
+					;
+			}
+
+			if(changed == 0)
+			{
+				for(size_t index = 0; index < size; index++)
+				{
+					block[index].current = tickHealth(block[index], heal, hurt);
+				}
+
+				continue;
+			}
+
+			for(size_t index = 0; index < size; index++)
+			{
+				const uint32_t before = block[index].current;
+
+				block[index].current = tickHealth(block[index], heal, hurt);
+
+				const Yars::Id character_id = first + index;
+
+				if(std::binary_search(std::begin(pool), std::end(pool), character_id))
+				{
+					continue;
+				}
+
+				tickHealthEvent(character_id, before, block[index], event);
+			}
+		}
+	}
+
+	if(tick.decay_attribute.empty() && tick.decay_skill.empty())
 	{
-		return false;
+		return;
 	}
-#endif
 
-	const Yars::MultimapStringItem& inventory = character_item.at(character_id);
+	auto deleted = std::begin(pool);
 
-	if(inventory.contains(item_name))
+	for(Yars::Id character_id = 0; character_id < character_id_max; character_id++)
 	{
-		return true;
-	}
+		if(deleted != std::end(pool) && *deleted == character_id)
+		{
+			deleted++;
+			continue;
+		}
 
-	return false;
+		tickDecay(character_id, tick);
+	}
 }
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterItem
+ * \ingroup group_Tick
  *
- * \brief Get the number of Items
+ * \brief Update a group of Characters.
  *
- * Get a count of the number if instances of the specified Item.
+ * Only the Characters in \p id_list are updated.  In safe-mode, if any of the 
+ * Characters do not exist, then no Characters are updated.
  *
  * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item", 100);
- *
- * uint32_t count = yars.characterItemCount(bubba, "Item");
+ * Yars::TickEvent event;
+ * yars.tick({ .health = -1 }, poisoned, event);
  * \endexample
  *
- * \return The number of Items
+ * \retval true  The Characters were updated
+ * \retval false Failed to update the Characters
  */
-uint32_t Yars::characterItemCount(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
-	) const noexcept
+bool Yars::tick(const Yars::Tick& tick ///< The changes to make
+	, const Yars::VectorId& id_list ///< The Characters to update
+	, Yars::TickEvent&      event   ///< What happened
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return 0;
+		for(const Yars::Id character_id : id_list)
+		{
+			if(characterExists(character_id) == false)
+			{
+				return false;
+			}
+		}
 	}
 
-	if(characterItemExists(character_id, item_name) == false)
+	const uint32_t heal = (tick.health > 0) ? (uint32_t)tick.health : 0;
+	const uint32_t hurt = (tick.health < 0) ? (uint32_t)(-(int64_t)tick.health) : 0;
+
+	for(const Yars::Id character_id : id_list)
 	{
-		return 0;
-	}
-#endif
+		if(tick.health != 0)
+		{
+			Yars::Health& health = character_health[character_id];
 
-	uint32_t stacks = 0;
+			const uint32_t before = health.current;
 
-	return this->characterItemCount(character_id, item_name, stacks);
+			health.current = tickHealth(health, heal, hurt);
+
+			tickHealthEvent(character_id, before, health, event);
+		}
+
+		tickDecay(character_id, tick);
+	}
+
+	return true;
 }
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterItem
+ * \ingroup group_Tick
  *
- * \brief Get the number of Items
+ * \brief Catch a Character up on missed ticks.
  *
- * Get a count of the number if instances of the specified Item.  This method 
- * will also provide the number of Item stacks.
+ * A Character that was not part of the ticks, for example because it was in 
+ * a zone that was not loaded, can be brought up to date without running 
+ * every tick.  The end result is the same as calling Yars::tick() \p count 
+ * times with only this Character, except for rounding: 
+ * - Health changes by \p count times Yars::Tick.health, stopping at `0` and 
+ *   Yars::Health.maximum.  A dead Character stays dead.  This is exact. 
+ * - Attributes and Skills decay by \p count times their amount.  The total 
+ *   is calculated as a `double` and then taken from Level.partial once, 
+ *   while each Yars::tick() rounds Level.partial to a `float`.  The 
+ *   difference in Level.partial grows with \p count, roughly \p count times 
+ *   the `float` precision of Level.partial, so a Level that ends up right 
+ *   at a boundary can also be one apart.
  *
- * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
+ * The cost does not depend on \p count.  At most one event will be added to 
+ * \p event.
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item", 100);
+ * \example
+ * const Yars::Tick regen = { .health = 1 };
  *
- * uint32_t stacks = 0;
- * uint32_t count = yars.characterItemCount(bubba, "Item", stacks);
+ * // 2 hours of ticks, once per second
+ * for(const Yars::Id id : zone)
+ * {
+ * 	yars.characterFastForward(id, regen, 2 * 60 * 60, event);
+ * }
  * \endexample
  *
- * \return The number of Items
+ * \retval true  The Character was updated
+ * \retval false Failed to update the Character
  */
-uint32_t Yars::characterItemCount(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
-	, uint32_t&          stacks    ///< Store the number of Item stacks
-	) const noexcept
+bool Yars::characterFastForward(const Yars::Id character_id ///< The Character Id
+	, const Yars::Tick& tick  ///< The changes of one tick
+	, const uint64_t    count ///< The number of ticks
+	, Yars::TickEvent&  event ///< What happened
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return 0;
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 	}
 
-	if(characterItemExists(character_id, item_name) == false)
+	if(count == 0)
 	{
-		return 0;
+		return true;
 	}
-#endif
 
-	const Yars::MultimapStringItem& inventory = character_item.at(character_id);
-	auto                            range     = inventory.equal_range(item_name);
-
-	uint32_t item_count = 0;
-	stacks = 0;
-	for(auto iter = range.first; iter != range.second; iter++)
+	if(tick.health != 0)
 	{
-		const Yars::Item& item = iter->second;
-		item_count += item.count;
-		stacks++;
+		// The total is clamped to the largest Health change, which is
+		// the same as stopping at 0 or Yars::Health.maximum
+		const uint64_t amount = (uint64_t)std::abs((int64_t)tick.health);
+		const uint64_t total  = std::min(amount * std::min(count, (uint64_t)Yars::Health_Max)
+			, (uint64_t)std::numeric_limits<uint32_t>::max()
+			);
+
+		const uint32_t heal = (tick.health > 0) ? (uint32_t)total : 0;
+		const uint32_t hurt = (tick.health < 0) ? (uint32_t)total : 0;
+
+		Yars::Health& health = character_health[character_id];
+
+		const uint32_t before = health.current;
+
+		health.current = tickHealth(health, heal, hurt);
+
+		tickHealthEvent(character_id, before, health, event);
 	}
 
-	return item_count;
+	tickDecay(character_id, tick, count);
+
+	return true;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_CharacterItem
- *
- * \brief Get a list of Item names
- *
- * Calling this method will provide a list of all the Item names that the 
- * Character currently has.
- *
- * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
+ * \brief Calculate the Health of a tick.
  *
- * Yars::VectorString list = yars.characterItemList(bubba);
- * \endexample
+ * This is the same as Yars::healthAdjust() except that a dead Character 
+ * stays dead.  Only one of \p heal or \p hurt should be greater than `0`.  
+ * There are no branches so that the loop in Yars::tick() can be vectorized.
  *
- * \return A vector of Item names.
+ * \return The new Yars::Health.current value.
  */
-Yars::VectorString Yars::characterItemList(const Yars::Id character_id ///< The Character Id
-	) const noexcept
+uint32_t Yars::tickHealth(const Yars::Health& health ///< The Health
+	, const uint32_t heal ///< The amount to increase the current health
+	, const uint32_t hurt ///< The amount to decrease the current health
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return {};
-	}
-#endif
+	const uint32_t current = std::min(health.current, health.maximum);
+	const uint32_t healed  = current + std::min(heal, health.maximum - current);
+	const uint32_t wounded  = (healed > hurt) ? (healed - hurt) : 0;
 
-	const Yars::MultimapStringItem& item_map = character_item.at(character_id);
-	return Yars::mapKeyList(item_map);
+	return (health.current == 0) ? 0 : wounded;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_CharacterItem
- *
- * \brief Check if an Item is usable.
- *
- * This method will determine if a Character has use the requested Item.
- *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.skill_defender = { "Skill" }
- * 	});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- * yars.characterItemAdd(bubba, "Item");
- *
- * if(yars.characterItemIsUsable(bubba, "Item"))
- * {
- * 	std::cout << "Bubba can use Item!\n";
- * }
- * \endexample
- *
- * \see Yars::itemIsUsable()
- *
- * \retval true  The Item is usable
- * \retval false The Item is not usable
+ * \brief Add a Character to the tick events.
  */
-bool Yars::characterItemIsUsable(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
-	) const noexcept
+void Yars::tickHealthEvent(const Yars::Id character_id ///< The Character Id
+	, const uint32_t      before ///< The Health before the tick
+	, const Yars::Health& health ///< The Health after the tick
+	, Yars::TickEvent&    event  ///< Where to add the Character
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(health.current == before)
 	{
-		return false;
+		return;
 	}
 
-	if(characterItemExists(character_id, item_name) == false)
+	if(health.current == 0)
 	{
-		return false;
+		event.died.push_back(character_id);
 	}
-#endif
+	else if(health.current == health.maximum)
+	{
+		event.health_full.push_back(character_id);
+	}
+}
 
-	const Yars::MultimapStringItem& inventory = character_item.at(character_id);
 
-	auto iter = inventory.find(item_name);
-	const Yars::Item& item = iter->second;
+/**
+ * \brief Decay the Attributes and Skills of a Character.
+ *
+ * Decreasing a Level many times is the same as decreasing it once by the 
+ * total amount, so \p count ticks are done at once.  The total is calculated 
+ * as a `double` so that it is only rounded once, when it is given to 
+ * Yars::levelDecrease().
+ *
+ * The Character's \ref group_CharacterModifierCache "Modifier Cache" is 
+ * invalidated if any levels were lost.
+ */
+void Yars::tickDecay(const Yars::Id character_id ///< The Character Id
+	, const Yars::Tick& tick  ///< The changes to make
+	, const uint64_t    count ///< The number of ticks
+	) noexcept
+{
+	uint32_t level_down = 0;
 
-	if(this->characterItemIsUsableByAttacker(character_id, item) == true)
+	if(tick.decay_attribute.empty() == false)
 	{
-		return true;
+		Yars::MapStringAttribute& attribute = character_attribute.at(character_id);
+
+		for(const auto& iter : tick.decay_attribute)
+		{
+			const auto found = attribute.find(iter.first);
+
+			if(found != std::end(attribute))
+			{
+				level_down += levelDecrease(found->second.level, (float)((double)iter.second * (double)count));
+			}
+		}
 	}
 
-	if(this->characterItemIsUsableByDefender(character_id, item) == true)
+	if(tick.decay_skill.empty() == false)
 	{
-		return true;
+		Yars::MapStringSkill& skill = character_skill.at(character_id);
+
+		for(const auto& iter : tick.decay_skill)
+		{
+			const auto found = skill.find(iter.first);
+
+			if(found != std::end(skill))
+			{
+				level_down += levelDecrease(found->second.level, (float)((double)iter.second * (double)count));
+			}
+		}
 	}
 
-	return false;
+	if(level_down > 0)
+	{
+		characterLevelChanged(character_id);
+	}
 }
 
+// }}}
+// {{{ Index
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \defgroup group_Index Index
  *
- * \ingroup group_CharacterItem
+ * \brief Find Characters by Skill Level, Item count, or Data value.
  *
- * \brief Check if an Item is usable.
+ * Questions like "Which Characters have the Smithing Skill at level 50 or 
+ * higher?" would normally require looking at every Character.  An Index keeps 
+ * the Characters sorted by a single value so that the answer only costs a 
+ * binary search plus the number of Characters that match.
  *
- * This method will determine if a Character has use the requested Item as an 
- * "Attacker".
+ * There are three kinds of Indexes: 
+ * - Skill: The Character's Skill Level, including all modifiers 
+ * - Item: The number of Items in the Inventory and Equipment 
+ * - Data: An \c int32_t value stored with characterDataSet()
+ *
+ * Characters that do not have the Skill, Item, or Data are not in the Index.
+ *
+ * Indexes are not updated when a Character changes.  Instead, the Character 
+ * is marked and the Index is updated the next time it is used.  Changing a 
+ * Character many times between look-ups only updates the Index once.  Each 
+ * Index keeps its own list of marked Characters, so a change that only 
+ * touches one Skill, such as a \ref group_Layer "Layer" modifier, does not 
+ * update the other Indexes.
+ *
+ * \note Only the Characters that changed are tracked, so modifying a Skill 
+ * through a reference obtained before the last look-up will not be seen.  Use 
+ * the Yars methods to get a new reference after each look-up, or call 
+ * Yars::characterLevelChanged().
  *
  * \example
  * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.skill_defender = { "Skill" }
- * 	});
+ * yars.skillAdd("Smith", {});
+ * yars.indexSkillAdd("Smith");
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- * yars.characterItemAdd(bubba, "Item");
+ * // Create lots of Characters
  *
- * if(yars.characterItemIsUsableByAttacker(bubba, "Item"))
- * {
- * 	std::cout << "Bubba can use Item as an Attacker!\n";
- * }
+ * Yars::VectorId master_smith = yars.indexSkillRange("Smith", 50);
  * \endexample
+ */
+
+/**
+ * \typedef Yars::IndexEntry
  *
- * \see Yars::itemIsUsableByAttacker()
- *
- * \retval true  The Item is usable
- * \retval false The Item is not usable
+ * \brief A value and the Character that has it.
  */
-bool Yars::characterItemIsUsableByAttacker(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
-	) const noexcept
-{
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
 
-	if(characterItemExists(character_id, item_name) == false)
-	{
-		return false;
-	}
-#endif
+/**
+ * \typedef Yars::SetIndexEntry
+ *
+ * \brief A convenience type.
+ */
 
-	const Yars::MultimapStringItem& inventory = character_item.at(character_id);
+/**
+ * \typedef Yars::IndexValue
+ *
+ * \brief The method that gets a Character's value for an Index.
+ */
 
-	auto iter = inventory.find(item_name);
-	const Yars::Item& item = iter->second;
+/**
+ * \struct Yars::Index
+ *
+ * \brief The sorted values of a single Index.
+ *
+ * The \c value map is used to find a Character's entry when the Character 
+ * changes.
+ */
 
-	return characterItemIsUsableByAttacker(character_id, item);
-}
+/**
+ * \typedef Yars::MapStringIndex
+ *
+ * \brief A convenience type.
+ */
 
+/**
+ * \struct Yars::IndexGroup
+ *
+ * \brief All the Indexes of the same kind.
+ *
+ * The \c dirty list contains the Characters that have changed since the 
+ * Indexes were last used.
+ */
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterItem
+ * \ingroup group_Index
  *
- * \brief Check if an Item is usable.
+ * \brief Add a Data Index.
  *
- * This method will determine if a Character has use the requested Item with 
- * the specified Skill as an "Attacker".
+ * Only \c int32_t Data values will be indexed.
  *
  * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.skill_defender = { "Skill" }
- * 	});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- * yars.characterItemAdd(bubba, "Item");
- *
- * if(yars.characterItemIsUsableByAttacker(bubba, "Item", "Skill"))
- * {
- * 	std::cout << "Bubba can use Item as an Attacker!\n";
- * }
+ * yars.indexDataAdd("Gold");
  * \endexample
  *
- * \see Yars::itemIsUsableByAttacker()
- *
- * \retval true  The Item is usable
- * \retval false The Item is not usable
+ * \retval true  The Index was added
+ * \retval false Failed to add the Index
  */
-bool Yars::characterItemIsUsableByAttacker(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name  ///< The Item name
-	, const std::string& skill_name ///< The Skill name
-	) const noexcept
+bool Yars::indexDataAdd(const std::string& name ///< The Data name
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
-
-	if(characterItemExists(character_id, item_name) == false)
-	{
-		return false;
-	}
-#endif
-
-	const Yars::MultimapStringItem& inventory = character_item.at(character_id);
-
-	auto iter = inventory.find(item_name);
-	const Yars::Item& item = iter->second;
+	return indexAdd(index_data, name);
+}
 
-	if(Yars::vectorContains(item.skill_attacker, skill_name) == false)
-	{
-		return false;
-	}
 
-	return true;
+/**
+ * \ingroup group_Index
+ *
+ * \brief Check if a Data Index exists.
+ *
+ * \retval true  The Index exists
+ * \retval false The Index does not exist
+ */
+bool Yars::indexDataExists(const std::string& name ///< The Data name
+	) const noexcept
+{
+	return index_data.index.contains(name);
 }
 
 
 /**
- * \todo{InventoryRewrite} Should this method be private?
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterItem
+ * \ingroup group_Index
  *
- * \brief Check if an Item is usable.
+ * \brief Remove a Data Index.
  *
- * This method will determine if a Character has use the requested Item.
+ * \retval true  The Index was removed
+ * \retval false Failed to remove the Index
+ */
+bool Yars::indexDataRemove(const std::string& name ///< The Data name
+	) noexcept
+{
+	return (index_data.index.erase(name) > 0);
+}
+
+
+/**
+ * \ingroup group_Index
  *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.skill_defender = { "Skill" }
- * 	});
+ * \brief Find Characters by Data value.
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- * yars.characterItemAdd(bubba, "Item");
+ * All Characters with an \c int32_t Data value from \p min to \p max, 
+ * inclusive, will be returned.  The Ids are sorted by value.
  *
- * if(yars.characterItemIsUsableByAttacker(bubba, yars.characterItem("Item")))
- * {
- * 	std::cout << "Bubba can use Item as an Attacker!\n";
- * }
+ * \example
+ * Yars::VectorId rich = yars.indexDataRange("Gold", 1000, 1000000);
  * \endexample
  *
- * \see Yars::itemIsUsableByAttacker()
- *
- * \retval true  The Item is usable
- * \retval false The Item is not usable
+ * \return The Character Ids.
  */
-bool Yars::characterItemIsUsableByAttacker(const Yars::Id character_id ///< The Character Id
-	, const Yars::Item& item ///< The Item
+Yars::VectorId Yars::indexDataRange(const std::string& name ///< The Data name
+	, const int32_t min ///< The lowest value
+	, const int32_t max ///< The highest value
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
-#endif
-
-	const Yars::MapStringSkill& skill_map = character_skill.at(character_id);
-
-	for(const auto& skill_name : item.skill_attacker)
-	{
-		if(skill_map.contains(skill_name))
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return indexRange(index_data, name, min, max);
 }
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterItem
+ * \ingroup group_Index
  *
- * \brief Check if an Item is usable.
+ * \brief Add an Item Index.
  *
- * This method will determine if a Character has use the requested Item as an 
- * "Defender".
+ * The Item does not need to exist.
  *
  * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.skill_defender = { "Skill" }
- * 	});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- * yars.characterItemAdd(bubba, "Item");
- *
- * if(yars.characterItemIsUsableByDefender(bubba, "Item"))
- * {
- * 	std::cout << "Bubba can use Item as a Defender!\n";
- * }
+ * yars.indexItemAdd("Key");
  * \endexample
  *
- * \see Yars::itemIsUsableByDefender()
- *
- * \retval true  The Item is usable
- * \retval false The Item is not usable
+ * \retval true  The Index was added
+ * \retval false Failed to add the Index
  */
-bool Yars::characterItemIsUsableByDefender(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
-	) const noexcept
+bool Yars::indexItemAdd(const std::string& name ///< The Item name
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
-
-	if(characterItemExists(character_id, item_name) == false)
-	{
-		return false;
-	}
-#endif
-
-	const Yars::MultimapStringItem& inventory = character_item.at(character_id);
+	return indexAdd(index_item, name);
+}
 
-	auto iter = inventory.find(item_name);
-	const Yars::Item& item = iter->second;
 
-	return characterItemIsUsableByDefender(character_id, item);
+/**
+ * \ingroup group_Index
+ *
+ * \brief Check if an Item Index exists.
+ *
+ * \retval true  The Index exists
+ * \retval false The Index does not exist
+ */
+bool Yars::indexItemExists(const std::string& name ///< The Item name
+	) const noexcept
+{
+	return index_item.index.contains(name);
 }
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterItem
+ * \ingroup group_Index
  *
- * \brief Check if an Item is usable.
+ * \brief Remove an Item Index.
  *
- * This method will determine if a Character has use the requested Item with 
- * the specified Skill as an "Defender".
+ * \retval true  The Index was removed
+ * \retval false Failed to remove the Index
+ */
+bool Yars::indexItemRemove(const std::string& name ///< The Item name
+	) noexcept
+{
+	return (index_item.index.erase(name) > 0);
+}
+
+
+/**
+ * \ingroup group_Index
  *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.skill_defender = { "Skill" }
- * 	});
+ * \brief Find Characters by Item count.
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- * yars.characterItemAdd(bubba, "Item");
+ * All Characters that have from \p min to \p max of the Item will be 
+ * returned.  Equipped Items are included in the count.  The Ids are sorted by 
+ * count.
  *
- * if(yars.characterItemIsUsableByDefender(bubba, "Item", "Skill"))
- * {
- * 	std::cout << "Bubba can use Item as a Defender!\n";
- * }
+ * \example
+ * Yars::VectorId has_key = yars.indexItemRange("Key");
  * \endexample
  *
- * \see Yars::itemIsUsableByDefender()
- *
- * \retval true  The Item is usable
- * \retval false The Item is not usable
+ * \return The Character Ids.
  */
-bool Yars::characterItemIsUsableByDefender(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name  ///< The Item name
-	, const std::string& skill_name ///< The Skill name
+Yars::VectorId Yars::indexItemRange(const std::string& name ///< The Item name
+	, const int32_t min ///< The lowest count
+	, const int32_t max ///< The highest count
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
-
-	if(characterItemExists(character_id, item_name) == false)
-	{
-		return false;
-	}
-#endif
+	return indexRange(index_item, name, min, max);
+}
 
-	const Yars::MultimapStringItem& inventory = character_item.at(character_id);
 
-	auto iter = inventory.find(item_name);
-	const Yars::Item& item = iter->second;
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Index
+ *
+ * \brief Add a Skill Index.
+ *
+ * \example
+ * yars.indexSkillAdd("Smith");
+ * \endexample
+ *
+ * \retval true  The Index was added
+ * \retval false Failed to add the Index
+ */
+bool Yars::indexSkillAdd(const std::string& name ///< The Skill name
+	) noexcept
+{
+	return indexAdd(index_skill, name);
+}
 
-	if(Yars::vectorContains(item.skill_defender, skill_name) == false)
-	{
-		return false;
-	}
 
-	return true;
+/**
+ * \ingroup group_Index
+ *
+ * \brief Check if a Skill Index exists.
+ *
+ * \retval true  The Index exists
+ * \retval false The Index does not exist
+ */
+bool Yars::indexSkillExists(const std::string& name ///< The Skill name
+	) const noexcept
+{
+	return index_skill.index.contains(name);
 }
 
 
 /**
- * \todo{InventoryRewrite} Should this method be private?
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_CharacterItem
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \brief Check if an Item is usable.
+ * \ingroup group_Index
  *
- * This method will determine if a Character has use the requested Item.
+ * \brief Remove a Skill Index.
  *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.skill_defender = { "Skill" }
- * 	});
+ * \retval true  The Index was removed
+ * \retval false Failed to remove the Index
+ */
+bool Yars::indexSkillRemove(const std::string& name ///< The Skill name
+	) noexcept
+{
+	return (index_skill.index.erase(name) > 0);
+}
+
+
+/**
+ * \ingroup group_Index
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- * yars.characterItemAdd(bubba, "Item");
+ * \brief Find Characters by Skill Level.
  *
- * if(yars.characterItemIsUsableByDefender(bubba, yars.characterItem("Item")))
- * {
- * 	std::cout << "Bubba can use Item as a Defender!\n";
- * }
- * \endexample
+ * All Characters with a Skill Level from \p min to \p max, inclusive, will be 
+ * returned.  The Level includes all modifiers.  The Ids are sorted by Level.
  *
- * \see Yars::itemIsUsableByDefender()
+ * \example
+ * Yars::VectorId master_smith = yars.indexSkillRange("Smith", 50);
+ * \endexample
  *
- * \retval true  The Item is usable
- * \retval false The Item is not usable
+ * \return The Character Ids.
  */
-bool Yars::characterItemIsUsableByDefender(const Yars::Id character_id ///< The Character Id
-	, const Yars::Item& item ///< The Item
+Yars::VectorId Yars::indexSkillRange(const std::string& name ///< The Skill name
+	, const int32_t min ///< The lowest Level
+	, const int32_t max ///< The highest Level
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	return indexRange(index_skill, name, min, max);
+}
+
+
+/**
+ * \brief Add an Index to a group.
+ *
+ * The Index is built right away.
+ *
+ * \retval true  The Index was added
+ * \retval false The Index already exists
+ */
+bool Yars::indexAdd(Yars::IndexGroup& group ///< The Index group
+	, const std::string& name ///< The Index name
+	) noexcept
+{
+	if(name.empty() || group.index.contains(name))
 	{
 		return false;
 	}
-#endif
 
-	const Yars::MapStringSkill& skill_map = character_skill.at(character_id);
+	indexBuild(group, name, group.index[name]);
+
+	return true;
+}
+
 
-	for(const auto& skill_name : item.skill_defender)
+/**
+ * \brief Add all existing Characters to an Index.
+ */
+void Yars::indexBuild(const Yars::IndexGroup& group ///< The Index group
+	, const std::string& name  ///< The Index name
+	, Yars::Index&       index ///< The Index
+	) const noexcept
+{
+	index.entry.clear();
+	index.value.clear();
+	index.rank.clear();
+	index.histogram = {};
+	index.dirty.clear();
+	index.is_dirty.clear();
+
+	Yars::VectorId pool = character_pool;
+	std::sort(std::begin(pool), std::end(pool));
+
+	for(Yars::Id character_id = 0; character_id < character_id_max; character_id++)
 	{
-		if(skill_map.contains(skill_name))
+		if(std::binary_search(std::begin(pool), std::end(pool), character_id))
 		{
-			return true;
+			continue;
 		}
-	}
 
-	return false;
+		int32_t value = 0;
+
+		if((this->*group.value)(character_id, name, value))
+		{
+			indexInsert(group, index, character_id, value);
+		}
+	}
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
- *
- * \ingroup group_CharacterItem
- *
- * \brief Restack all Items
- *
- * All the Items that the Character has will be restacked in the most optimum 
- * way possible.
+ * \brief Mark a Character as changed.
  *
- * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item", 20);
- * yars.characterItemAdd(bubba, "Item", 40);
- * yars.characterItemRestack(bubba);
- * \endexample
- *
- * \retval true  Successfully restacked the Items
- * \retval false Failed to restack the Items
+ * The Character is marked in every Index of the group.  Nothing is done if 
+ * there are no Indexes in the group.
  */
-bool Yars::characterItemRestack(const Yars::Id character_id ///< The Character Id
+void Yars::indexChanged(Yars::IndexGroup& group ///< The Index group
+	, const Yars::Id character_id ///< The Character Id
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	for(auto& iter : group.index)
 	{
-		return false;
+		indexMark(iter.second, character_id);
 	}
-#endif
+}
 
-	Yars::VectorString name_list = characterItemList(character_id);
 
-	for(const auto& item_name : name_list)
+/**
+ * \brief Mark a Character as changed.
+ *
+ * The Character is only marked in the Index with the \p name.  Nothing is 
+ * done if there is no such Index in the group.
+ */
+void Yars::indexChanged(Yars::IndexGroup& group ///< The Index group
+	, const Yars::Id     character_id ///< The Character Id
+	, const std::string& name         ///< The Index name
+	) noexcept
+{
+	const auto iter = group.index.find(name);
+
+	if(iter == std::end(group.index))
 	{
-		characterItemRestack(character_id, item_name);
+		return;
 	}
 
-	return true;
+	indexMark(iter->second, character_id);
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
- *
- * \ingroup group_CharacterItem
- *
- * \brief Restack Items
- *
- * All the Items, with a matching name, that the Character has will be 
- * restacked in the most optimum way possible.
- *
- * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item", 20);
- * yars.characterItemAdd(bubba, "Item", 40);
- * yars.characterItemRestack(bubba, "Item");
- * \endexample
- *
- * \retval true  Successfully restacked the Items
- * \retval false Failed to restack the Items
+ * \brief Mark a Character as changed in an Index.
  */
-bool Yars::characterItemRestack(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
+void Yars::indexMark(Yars::Index& index ///< The Index
+	, const Yars::Id character_id ///< The Character Id
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(character_id >= index.is_dirty.size())
 	{
-		return false;
+		index.is_dirty.resize(character_id + 1, false);
 	}
 
-	if(characterItemExists(character_id, item_name) == false)
+	if(index.is_dirty[character_id] == false)
 	{
-		return false;
+		index.is_dirty[character_id] = true;
+		index.dirty.push_back(character_id);
 	}
-#endif
+}
 
-	Yars::MultimapStringItem& inventory = character_item[character_id];
-	auto                      range     = inventory.equal_range(item_name);
-	const uint32_t            count_max = character_config[character_id].item_stack_max;
 
-	uint32_t remaining = 0;
-	for(auto iter = range.first; iter != range.second; iter++)
+/**
+ * \brief Mark a Character as changed in all Index groups.
+ */
+void Yars::indexCharacterChanged(const Yars::Id character_id ///< The Character Id
+	) noexcept
+{
+	indexChanged(index_data,            character_id);
+	indexChanged(index_item,            character_id);
+	indexChanged(index_skill,           character_id);
+	indexChanged(leaderboard_attribute, character_id);
+	indexChanged(leaderboard_skill,     character_id);
+	indexChanged(telemetry_affect,      character_id);
+	indexChanged(telemetry_health,      character_id);
+	indexChanged(telemetry_item,        character_id);
+	indexChanged(telemetry_skill,       character_id);
+}
+
+
+/**
+ * \brief Remove a Character from an Index.
+ */
+void Yars::indexErase(const Yars::IndexGroup& group ///< The Index group
+	, Yars::Index&   index        ///< The Index
+	, const Yars::Id character_id ///< The Character Id
+	, const int32_t  value        ///< The Character's value
+	) noexcept
+{
+	if(group.histogram)
 	{
-		Yars::Item& item = iter->second;
-		remaining += std::exchange(item.count, 0);
+		histogramAdjust(index.histogram, value, -1);
+	}
+	else
+	{
+		index.entry.erase({ value, character_id });
 	}
 
-	auto iter = range.first;
-
-	while(iter != range.second)
+	if(group.rank)
 	{
-		Yars::Item& item = iter->second;
-		iter++;
+		leaderboardRankAdjust(index, value, -1);
+	}
 
-		if(remaining <= count_max)
-		{
-			item.count = remaining;
-			remaining = 0;
-			break;
-		}
+	index.value.erase(character_id);
+}
 
-		item.count = count_max;
-		remaining -= count_max;
-	}
 
-	if(remaining == 0)
+/**
+ * \brief Add a Character to an Index.
+ *
+ * A Histogram only needs the counts, so the sorted entries are not kept.
+ */
+void Yars::indexInsert(const Yars::IndexGroup& group ///< The Index group
+	, Yars::Index&   index        ///< The Index
+	, const Yars::Id character_id ///< The Character Id
+	, const int32_t  value        ///< The Character's value
+	) noexcept
+{
+	if(group.histogram)
 	{
-		if(iter != range.second)
-		{
-			inventory.erase(iter, range.second);
-		}
+		histogramAdjust(index.histogram, value, +1);
 	}
 	else
 	{
-		characterItemAdd(character_id, item_name, remaining);
+		index.entry.emplace(value, character_id);
 	}
 
-	return true;
+	if(group.rank)
+	{
+		leaderboardRankAdjust(index, value, +1);
+	}
+
+	index.value[character_id] = value;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_CharacterItem
- *
- * \brief Select a Skill for an Item
- *
- * This method to determine what the best Skill to use an Item.  Attributes are 
- * not considered, so it is possible that another Skill may be better.  This is 
- * intentional so that the "best" skill may not be automatically found.
- *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.skill_defender = { "Skill" }
- * 	});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- * yars.characterItemAdd(bubba, "Item");
+ * \brief Get the Characters in a range of values.
  *
- * std::string skill_name = yars.characterItemSkillAttacker(bubba, "Item");
- * \endexample
- *
- * \return The Skill name
+ * \return The Character Ids.
  */
-std::string Yars::characterItemSkillAttacker(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
+Yars::VectorId Yars::indexRange(Yars::IndexGroup& group ///< The Index group
+	, const std::string& name ///< The Index name
+	, const int32_t      min  ///< The lowest value
+	, const int32_t      max  ///< The highest value
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	Yars::VectorId id_list = {};
+
+	if(safeMode())
 	{
-		return {};
+		if(group.index.contains(name) == false)
+		{
+			return id_list;
+		}
 	}
 
-	if(characterItemExists(character_id, item_name) == false)
+	if(min > max)
 	{
-		return {};
+		return id_list;
 	}
-#endif
 
-	const Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
-	const Yars::Item&           item      = characterItem(character_id, item_name);
+	Yars::Index& index = group.index.at(name);
 
-	int32_t     skill_level = 0;
-	std::string skill_name  = "";
+	indexSync(group, name, index);
 
-	for(const auto& name : item.skill_attacker)
-	{
-		auto iter = skill_map.find(name);
-		if(iter == skill_map.end())
-		{
-			continue;
-		}
+	const Yars::SetIndexEntry& entry = index.entry;
 
-		const Yars::Skill& skill = iter->second;
+	auto       iter = entry.lower_bound({ min, 0 });
+	const auto end  = entry.upper_bound({ max, std::numeric_limits<Yars::Id>::max() });
 
-		if(skill.level.value > skill_level)
-		{
-			skill_level = skill.level.value;
-			skill_name  = name;
-		}
+	for(; iter != end; iter++)
+	{
+		id_list.push_back(iter->second);
 	}
 
-	return skill_name;
+	return id_list;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_CharacterItem
- *
- * \brief Get a list of usable Skills for an Item
- *
- * A list of Skill names will be created of all the Skills that a Character can 
- * use with the specified Item.
- *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.skill_defender = { "Skill" }
- * 	});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- * yars.characterItemAdd(bubba, "Item");
- *
- * Yars::VectorString list = yars.characterItemSkillAttacker(bubba, "Item");
- * \endexample
+ * \brief Bring an Index up-to-date.
  *
- * \return A vector of Skill names
+ * Only the Characters that were marked in this Index are updated.
  */
-Yars::VectorString Yars::characterItemSkillAttackerList(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
+void Yars::indexSync(const Yars::IndexGroup& group ///< The Index group
+	, const std::string& name  ///< The Index name
+	, Yars::Index&       index ///< The Index
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(index.dirty.empty())
 	{
-		return {};
+		return;
 	}
 
-	if(characterItemExists(character_id, item_name) == false)
+	for(const Yars::Id character_id : index.dirty)
 	{
-		return {};
+		indexUpdate(group, name, index, character_id);
+
+		index.is_dirty[character_id] = false;
 	}
-#endif
 
-	const Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
-	const Yars::Item&           item      = characterItem(character_id, item_name);
+	index.dirty.clear();
+}
 
-	Yars::VectorString list;
 
-	for(const auto& name : item.skill_attacker)
+/**
+ * \brief Update a Character in an Index.
+ */
+void Yars::indexUpdate(const Yars::IndexGroup& group ///< The Index group
+	, const std::string& name         ///< The Index name
+	, Yars::Index&       index        ///< The Index
+	, const Yars::Id     character_id ///< The Character Id
+	) const noexcept
+{
+	const auto iter = index.value.find(character_id);
+
+	if(iter != std::end(index.value))
 	{
-		if(skill_map.contains(name) == false)
-		{
-			continue;
-		}
+		indexErase(group, index, character_id, iter->second);
+	}
 
-		list.push_back(name);
+	int32_t value = 0;
+
+	if(characterExists(character_id)
+		&& (this->*group.value)(character_id, name, value)
+		)
+	{
+		indexInsert(group, index, character_id, value);
 	}
-
-	return list;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_CharacterItem
- *
- * \brief Select a Skill for an Item
- *
- * This method to determine what the best Skill to use an Item.  Attributes are 
- * not considered, so it is possible that another Skill may be better.  This is 
- * intentional so that the "best" skill may not be automatically found.
- *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.skill_defender = { "Skill" }
- * 	});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- * yars.characterItemAdd(bubba, "Item");
+ * \brief Get a Character's \c int32_t Data value.
  *
- * std::string skill_name = yars.characterItemSkillDefender(bubba, "Item");
- * \endexample
- *
- * \return The Skill name
+ * \retval true  The Character has the value
+ * \retval false The Character does not have the value
  */
-std::string Yars::characterItemSkillDefender(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
+bool Yars::indexValueData(const Yars::Id character_id ///< The Character Id
+	, const std::string& name  ///< The Data name
+	, int32_t&           value ///< The value
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return {};
-	}
+	const auto iter = character_data.find(character_id);
 
-	if(characterItemExists(character_id, item_name) == false)
+	if(iter == std::end(character_data))
 	{
-		return {};
+		return false;
 	}
-#endif
 
-	const Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
-	const Yars::Item&           item      = characterItem(character_id, item_name);
+	return characterDataGetValue(iter->second, name, value);
+}
 
-	int32_t     skill_level = 0;
-	std::string skill_name  = "";
 
-	for(const auto& name : item.skill_defender)
+/**
+ * \brief Get the number of Items a Character has.
+ *
+ * Both the Inventory and Equipment are counted.
+ *
+ * \retval true  The Character has the Item
+ * \retval false The Character does not have the Item
+ */
+bool Yars::indexValueItem(const Yars::Id character_id ///< The Character Id
+	, const std::string& name  ///< The Item name
+	, int32_t&           value ///< The count
+	) const noexcept
+{
+	int64_t count = 0;
+
+	const auto item = character_item.find(character_id);
+
+	if(item != std::end(character_item))
 	{
-		auto iter = skill_map.find(name);
-		if(iter == skill_map.end())
+		const auto iter = item->second.find(name);
+
+		if(iter != std::end(item->second))
 		{
-			continue;
+			count += iter->second.count;
 		}
+	}
 
-		const Yars::Skill& skill = iter->second;
+	const auto equipment = character_equipment_name.find(character_id);
 
-		if(skill.level.value > skill_level)
+	if(equipment != std::end(character_equipment_name))
+	{
+		for(const auto& iter : equipment->second)
 		{
-			skill_level = skill.level.value;
-			skill_name  = name;
+			if(iter.second == name)
+			{
+				count++;
+			}
 		}
 	}
 
-	return skill_name;
+	if(count == 0)
+	{
+		return false;
+	}
+
+	value = (int32_t)std::min(count, (int64_t)std::numeric_limits<int32_t>::max());
+
+	return true;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- *
- * \ingroup group_CharacterItem
- *
- * \brief Get a list of usable Skills for an Item
- *
- * A list of Skill names will be created of all the Skills that a Character can 
- * use with the specified Item.
- *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.skill_defender = { "Skill" }
- * 	});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd(bubba, "Skill");
- * yars.characterItemAdd(bubba, "Item");
- *
- * Yars::VectorString list = yars.characterItemSkillDefender(bubba, "Item");
- * \endexample
+ * \brief Get a Character's Attribute Level.
  *
- * \return A vector of Skill names
+ * \retval true  The Character has the Attribute
+ * \retval false The Character does not have the Attribute
  */
-Yars::VectorString Yars::characterItemSkillDefenderList(const Yars::Id character_id ///< The Character Id
-	, const std::string& item_name ///< The Item name
+bool Yars::indexValueAttribute(const Yars::Id character_id ///< The Character Id
+	, const std::string& name  ///< The Attribute name
+	, int32_t&           value ///< The Level
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	const auto attribute_map = character_attribute.find(character_id);
+
+	if(attribute_map == std::end(character_attribute))
 	{
-		return {};
+		return false;
 	}
 
-	if(characterItemExists(character_id, item_name) == false)
+	const auto iter = attribute_map->second.find(name);
+
+	if(iter == std::end(attribute_map->second))
 	{
-		return {};
+		return false;
 	}
-#endif
 
-	const Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
-	const Yars::Item&           item      = characterItem(character_id, item_name);
+	value = iter->second.level.value;
 
-	Yars::VectorString list;
+	return true;
+}
 
-	for(const auto& name : item.skill_defender)
+
+/**
+ * \brief Get a Character's Skill Level.
+ *
+ * \retval true  The Character has the Skill
+ * \retval false The Character does not have the Skill
+ */
+bool Yars::indexValueSkill(const Yars::Id character_id ///< The Character Id
+	, const std::string& name  ///< The Skill name
+	, int32_t&           value ///< The Level
+	) const noexcept
+{
+	const auto skill_map = character_skill.find(character_id);
+
+	if(skill_map == std::end(character_skill))
 	{
-		if(skill_map.contains(name) == false)
-		{
-			continue;
-		}
+		return false;
+	}
 
-		list.push_back(name);
+	const auto iter = skill_map->second.find(name);
+
+	if(iter == std::end(skill_map->second))
+	{
+		return false;
 	}
 
-	return list;
+	value = iter->second.level.value;
+
+	return true;
 }
 
 // }}}
-// {{{ Character: Equipment
+// {{{ Leaderboard
 
 /**
- * \todo{Equipment} Be able to define equipment locations.
- * - characterEquipmentLocationAdd(const Yars::Id, const std::string&)
- * - characterEquipmentLocationAdd(const Yars::Id, const Yars::VectorString&)
- * - characterEquipmentLocationRemove(const Yars::Id, const std::string&)
- * - characterEquipmentLocationRemoveAll(const Yars::Id)
- * - characterEquipmentLocationDisable(const Yars::Id, const std::string&)
- * - characterEquipmentLocationEnable(const Yars::Id, const std::string&)
+ * \defgroup group_Leaderboard Leaderboard
  *
- * \ingroup group_Character
+ * \brief Rank Characters by Skill or Attribute Level.
  *
- * \defgroup group_CharacterEquipment Equipment
+ * A Leaderboard is an \ref group_Index "Index" that can also tell where a 
+ * Character ranks.  Getting the top Characters costs a binary search plus the 
+ * number of Characters requested, and the rank of any Character is found 
+ * without looking at the Characters above it.
  *
- * \brief A Character's Equipment
+ * Like an Index, Characters that change are only marked.  The Leaderboard is 
+ * updated the next time it is used, so a Character that gains many Levels 
+ * between look-ups is only moved once.
  *
- * Equipment allows the passive modifiers of an Item to affect a Character.  
- * What separates equipable items from unequipable items? Nothing in \yars 
- * enforces that distinction, so any item can be equipped.
+ * Characters with the same Level have the same rank.  If two Characters are 
+ * tied for first, the next Character is third.
  *
- * When an Item is equipped, the Yars::Item::modify_attribute,
- * Yars::Item::modify_skill, Yars::Item::modify_health_current, and 
- * Yars::Item::modify_health_maximum will be applied to the Character. Of 
- * course unequipping the Item will reverse these affects.  However, be careful 
- * when removing equipment! For example, if a Character has less than 5 health 
- * and unequips an Item that with a `modify_health_current +5`, this will drop 
- * the Character's health to `0` and kill that Character.
+ * \example
+ * Yars yars;
+ * yars.skillAdd("Sword", {});
+ * yars.leaderboardSkillAdd("Sword");
  *
- * Equipment is based on location.  Locations are free-form strings that make 
- * sense for the RPG.
+ * // Create lots of Characters
+ *
+ * Yars::VectorId top_100 = yars.leaderboardSkillTop("Sword", 100);
+ * size_t         rank    = yars.leaderboardSkillRank("Sword", bubba);
+ * \endexample
  */
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
- * \todo{Equipment}    Rename to `characterEquipment()`
- *
- * \ingroup group_CharacterEquipment
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \brief Access a piece of equipment.
+ * \ingroup group_Leaderboard
  *
- * Provides access to an equipped Item.
+ * \brief Add an Attribute Leaderboard.
  *
  * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
- *
- * yars.characterEquipmentAdd(bubba, "Location", "Item");
- * Yars::Item& item = yars.characterEquipmentItem(bubba, "Location");
+ * yars.leaderboardAttributeAdd("Strength");
  * \endexample
  *
- * \return A reference to an Item
+ * \retval true  The Leaderboard was added
+ * \retval false Failed to add the Leaderboard
  */
-Yars::Item& Yars::characterEquipmentItem(const Yars::Id character_id ///< The Character Id
-	, const std::string& location ///< The location
+bool Yars::leaderboardAttributeAdd(const std::string& name ///< The Attribute name
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		Yars::Item* item = nullptr;
-		return *item;
-	}
+	return indexAdd(leaderboard_attribute, name);
+}
 
-	if(characterEquipmentExists(character_id, location) == false)
-	{
-		Yars::Item* item = nullptr;
-		return *item;
-	}
-#endif
 
-	Yars::MapStringItem& equipment_item = character_equipment_item.at(character_id);
+/**
+ * \ingroup group_Leaderboard
+ *
+ * \brief Check if an Attribute Leaderboard exists.
+ *
+ * \retval true  The Leaderboard exists
+ * \retval false The Leaderboard does not exist
+ */
+bool Yars::leaderboardAttributeExists(const std::string& name ///< The Attribute name
+	) const noexcept
+{
+	return leaderboard_attribute.index.contains(name);
+}
 
-	return equipment_item[location];
+
+/**
+ * \ingroup group_Leaderboard
+ *
+ * \brief Get a Character's rank.
+ *
+ * The Character with the highest Attribute Level is rank \c 1.
+ *
+ * \example
+ * size_t rank = yars.leaderboardAttributeRank("Strength", bubba);
+ * \endexample
+ *
+ * \return The Character's rank.  If the Character does not have the 
+ * Attribute, \c 0 is returned.
+ */
+size_t Yars::leaderboardAttributeRank(const std::string& name ///< The Attribute name
+	, const Yars::Id character_id ///< The Character Id
+	) const noexcept
+{
+	return leaderboardRank(leaderboard_attribute, name, character_id);
 }
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
  * \todo{ErrorCode}    Return an error code instead of a boolean
- * \todo{Equipment}    Rename to `characterEquipment()`
  *
- * \ingroup group_CharacterEquipment
+ * \ingroup group_Leaderboard
  *
- * \brief Access a piece of equipment.
+ * \brief Remove an Attribute Leaderboard.
  *
- * Provides access to an equipped Item.
+ * \retval true  The Leaderboard was removed
+ * \retval false Failed to remove the Leaderboard
+ */
+bool Yars::leaderboardAttributeRemove(const std::string& name ///< The Attribute name
+	) noexcept
+{
+	return (leaderboard_attribute.index.erase(name) > 0);
+}
+
+
+/**
+ * \ingroup group_Leaderboard
+ *
+ * \brief Get the top Characters.
+ *
+ * The Characters are sorted by Attribute Level, highest first.
  *
  * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
+ * Yars::VectorId strongest = yars.leaderboardAttributeTop("Strength", 10);
+ * \endexample
+ *
+ * \return Up to \p count Character Ids.
+ */
+Yars::VectorId Yars::leaderboardAttributeTop(const std::string& name ///< The Attribute name
+	, const size_t count ///< The number of Characters
+	) const noexcept
+{
+	return leaderboardTop(leaderboard_attribute, name, count);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Leaderboard
+ *
+ * \brief Add a Skill Leaderboard.
+ *
+ * \example
+ * yars.leaderboardSkillAdd("Sword");
+ * \endexample
+ *
+ * \retval true  The Leaderboard was added
+ * \retval false Failed to add the Leaderboard
+ */
+bool Yars::leaderboardSkillAdd(const std::string& name ///< The Skill name
+	) noexcept
+{
+	return indexAdd(leaderboard_skill, name);
+}
+
+
+/**
+ * \ingroup group_Leaderboard
+ *
+ * \brief Check if a Skill Leaderboard exists.
+ *
+ * \retval true  The Leaderboard exists
+ * \retval false The Leaderboard does not exist
+ */
+bool Yars::leaderboardSkillExists(const std::string& name ///< The Skill name
+	) const noexcept
+{
+	return leaderboard_skill.index.contains(name);
+}
+
+
+/**
+ * \ingroup group_Leaderboard
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
+ * \brief Get a Character's rank.
  *
- * yars.characterEquipmentAdd(bubba, "Location", "Item");
+ * The Character with the highest Skill Level is rank \c 1.
  *
- * const Yars& y = yars;
- * const Yars::Item& item = y.characterEquipmentItem(bubba, "Location");
+ * \example
+ * size_t rank = yars.leaderboardSkillRank("Sword", bubba);
  * \endexample
  *
- * \return A reference to an Item
+ * \return The Character's rank.  If the Character does not have the Skill, 
+ * \c 0 is returned.
  */
-const Yars::Item& Yars::characterEquipmentItem(const Yars::Id character_id ///< The Character Id
-	, const std::string& location ///< The location
+size_t Yars::leaderboardSkillRank(const std::string& name ///< The Skill name
+	, const Yars::Id character_id ///< The Character Id
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		Yars::Item* item = nullptr;
-		return *item;
-	}
-
-	if(characterEquipmentExists(character_id, location) == false)
-	{
-		Yars::Item* item = nullptr;
-		return *item;
-	}
-#endif
-
-	const Yars::MapStringItem& equipment_item = character_equipment_item.at(character_id);
-
-	return equipment_item.at(location);
+	return leaderboardRank(leaderboard_skill, name, character_id);
 }
 
 
 /**
- * \deprecated{InventoryRewrite}
- *
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterEquipment
+ * \ingroup group_Leaderboard
  *
- * \brief Get the name of a piece of equipment.
+ * \brief Remove a Skill Leaderboard.
  *
- * Get the name of the equipped Item at the specified \p location.  If the 
- * equipment location does not have an Item, then an empty string will be 
- * returned.
+ * \retval true  The Leaderboard was removed
+ * \retval false Failed to remove the Leaderboard
+ */
+bool Yars::leaderboardSkillRemove(const std::string& name ///< The Skill name
+	) noexcept
+{
+	return (leaderboard_skill.index.erase(name) > 0);
+}
+
+
+/**
+ * \ingroup group_Leaderboard
  *
- * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
+ * \brief Get the top Characters.
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
+ * The Characters are sorted by Skill Level, highest first.
  *
- * yars.characterEquipmentAdd(bubba, "Location", "Item");
- * std::string item_name = yars.characterEquipmentName(bubba, "Location");
+ * \example
+ * Yars::VectorId top_100 = yars.leaderboardSkillTop("Sword", 100);
  * \endexample
  *
- * \return The Item name
+ * \return Up to \p count Character Ids.
  */
-std::string Yars::characterEquipmentName(const Yars::Id character_id ///< The Character Id
-	, const std::string& location ///< The location
+Yars::VectorId Yars::leaderboardSkillTop(const std::string& name ///< The Skill name
+	, const size_t count ///< The number of Characters
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	return leaderboardTop(leaderboard_skill, name, count);
+}
+
+
+/**
+ * \brief Convert a Level to a rank key.
+ *
+ * The keys have the same order as the Levels, but start at \c 1 so they can 
+ * be used in the rank tree.
+ *
+ * \return The key.
+ */
+uint64_t Yars::leaderboardKey(const int32_t value ///< The Level
+	) noexcept
+{
+	return (uint64_t)((int64_t)value - std::numeric_limits<int32_t>::min()) + 1;
+}
+
+
+/**
+ * \brief Get a Character's rank.
+ *
+ * \return The rank, or \c 0.
+ */
+size_t Yars::leaderboardRank(Yars::IndexGroup& group ///< The Leaderboard group
+	, const std::string& name         ///< The Leaderboard name
+	, const Yars::Id     character_id ///< The Character Id
+	) const noexcept
+{
+	if(safeMode())
 	{
-		return {};
+		if(group.index.contains(name) == false)
+		{
+			return 0;
+		}
 	}
 
-	if(characterEquipmentExists(character_id, location) == false)
+	Yars::Index& index = group.index.at(name);
+
+	indexSync(group, name, index);
+
+	const auto iter = index.value.find(character_id);
+
+	if(iter == std::end(index.value))
 	{
-		return {};
+		return 0;
 	}
-#endif
 
-	const Yars::MapStringString& equipment_name = character_equipment_name.at(character_id);
+	const uint32_t not_above = leaderboardRankCount(index, leaderboardKey(iter->second));
 
-	return equipment_name.at(location);
+	return index.entry.size() - not_above + 1;
 }
 
 
 /**
- * \ingroup group_CharacterEquipment
- *
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
- *
- * \brief Equip an Item
- *
- * The Character will take the Item out of its inventory and a equip it at the 
- * specified location.  The Character must have the Item and the location must 
- * not already be occupied, otherwise the Item can not be equipped.
- *
- * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
- *
- * yars.characterEquipmentAdd(bubba, "Location", "Item");
- * \endexample
+ * \brief Add to the number of Characters with a Level.
  *
- * \retval true  The Item was equipped
- * \retval false Failed to equip the Item
+ * The rank tree is a Fenwick tree that covers every possible Level.  Only the 
+ * nodes that have been used are stored, so changing a count touches at most 
+ * 32 nodes.
  */
-bool Yars::characterEquipmentAdd(const Yars::Id character_id ///< The Character Id
-	, const std::string& location  ///< The location
-	, const std::string& item_name ///< The Item name
+void Yars::leaderboardRankAdjust(Yars::Index& index ///< The Leaderboard
+	, const int32_t value ///< The Level
+	, const int32_t delta ///< The change in count
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
+	constexpr uint64_t Size = (uint64_t)1 << 32;
 
-	if(characterItemExists(character_id, item_name) == false)
+	for(uint64_t key = leaderboardKey(value); key <= Size; key += (key & -key))
 	{
-		return false;
+		index.rank[key] += delta;
 	}
-#endif
+}
 
-	if(itemIsUsable(item_name) == false)
-	{
-		return false;
-	}
 
-	Yars::MapStringItem&   equipment_item = character_equipment_item[character_id];
-	Yars::MapStringString& equipment_name = character_equipment_name[character_id];
+/**
+ * \brief Count the Characters at or below a Level.
+ *
+ * \return The number of Characters.
+ */
+uint32_t Yars::leaderboardRankCount(const Yars::Index& index ///< The Leaderboard
+	, const uint64_t key ///< The Level's key
+	) noexcept
+{
+	uint32_t count = 0;
 
-	if(equipment_item.contains(location) == true)
+	for(uint64_t node = key; node > 0; node -= (node & -node))
 	{
-		// Error Type: Equipment must be removed first
-		return false;
+		const auto iter = index.rank.find(node);
+
+		if(iter != std::end(index.rank))
+		{
+			count += iter->second;
+		}
 	}
 
-	Yars::Item item = characterItemTake(character_id, item_name);
+	return count;
+}
 
-	equipment_item[location] = item;
-	equipment_name[location] = item_name;
 
-	Yars::Health& health = this->characterHealth(character_id);
-	healthModifierAdjust(health, item.modify_health_maximum);
-	healthAdjust(        health, item.modify_health_current);
+/**
+ * \brief Get the top Characters.
+ *
+ * \return The Character Ids.
+ */
+Yars::VectorId Yars::leaderboardTop(Yars::IndexGroup& group ///< The Leaderboard group
+	, const std::string& name  ///< The Leaderboard name
+	, const size_t       count ///< The number of Characters
+	) const noexcept
+{
+	Yars::VectorId id_list = {};
 
-	if(health.current == 0)
+	if(safeMode())
 	{
-		// Event: Character Died
+		if(group.index.contains(name) == false)
+		{
+			return id_list;
+		}
 	}
 
-	Yars::MapStringAttribute& attr_map = characterAttributeMap(character_id);
-	for(const auto& iter : item.modify_attribute)
-	{
-		Yars::Attribute& attr = attr_map[iter.first];
-		Yars::levelModifierAdjust(attr.level, +iter.second);
-	}
+	Yars::Index& index = group.index.at(name);
 
-	Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
-	for(const auto& iter : item.modify_skill)
+	indexSync(group, name, index);
+
+	const Yars::SetIndexEntry& entry = index.entry;
+
+	id_list.reserve(std::min(count, entry.size()));
+
+	for(auto iter = entry.rbegin()
+		; iter != entry.rend() && id_list.size() < count
+		; iter++
+		)
 	{
-		Yars::Skill& skill = skill_map[iter.first];
-		Yars::levelModifierAdjust(skill.level, +iter.second);
+		id_list.push_back(iter->second);
 	}
 
-	return true;
+	return id_list;
 }
 
+// }}}
+// {{{ Telemetry
 
 /**
- * \ingroup group_CharacterEquipment
+ * \defgroup group_Telemetry Telemetry
  *
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
+ * \brief Live distributions of the Character population.
  *
- * \brief Unequip an Item
+ * Telemetry keeps a \ref group_Histogram "Histogram" of a value for every 
+ * Character, which can be used to see how Skill Levels, maximum Health, 
+ * Affects, and Items are spread across the population without looking at any 
+ * Characters.
  *
- * The Character will remove an equipped Item and place it back into the 
- * Inventory.
+ * The following can be tracked: 
+ * - Skill: The Character's Skill Level, including all modifiers 
+ * - Item: The number of Items in the Inventory and Equipment 
+ * - Health: The Character's maximum Health 
+ * - Affect: The number of Affects applied to the Character
  *
- * \note In the future, \ref feature_InventoryPolicy "Inventory Policies" may 
- * prevent Items from going back into the Inventory, so unequipping items may 
- * not be possible until the Policy conditions have been met.
+ * Characters without the Skill or Item are not counted.  Like an 
+ * \ref group_Index "Index", a Character that changes is only marked and the 
+ * Histogram is updated the next time it is requested.  After that, getting a 
+ * Histogram is only a copy of Yars::Histogram_Size counters.
  *
  * \example
  * Yars yars;
- * yars.itemAdd("Item", {});
+ * yars.telemetrySkillAdd("Sword");
+ * yars.telemetryHealthEnable();
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
+ * // Play the game
  *
- * yars.characterEquipmentAdd(bubba, "Location", "Item");
- * // Do Stuff
- * yars.characterEquipmentRemove(bubba, "Location");
+ * Yars::Histogram sword = yars.telemetrySkill("Sword");
+ * Yars::Histogram health = yars.telemetryHealth();
  * \endexample
+ */
+
+/**
+ * \ingroup group_Telemetry
  *
- * \retval true  The Item was equipped
- * \retval false Failed to equip the Item
+ * \brief Get the Affect Histogram.
+ *
+ * \example
+ * Yars::Histogram histogram = yars.telemetryAffect();
+ * \endexample
+ *
+ * \return The number of Affects applied to each Character.  If Affect 
+ * Telemetry is not enabled, the Histogram will be empty.
  */
-bool Yars::characterEquipmentRemove(const Yars::Id character_id ///< The Character Id
-	, const std::string& location ///< The location
-	) noexcept
+Yars::Histogram Yars::telemetryAffect() const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
-#endif
-
-	Yars::MapStringItem&   equipment_item = character_equipment_item[character_id];
-	Yars::MapStringString& equipment_name = character_equipment_name[character_id];
-
-	if(equipment_item.contains(location) == false)
-	{
-		// No Equipment to remove
-		return false;
-	}
+	return telemetryHistogram(telemetry_affect, "Affect");
+}
 
-	const Yars::Item& item = equipment_item[location];
 
-	Yars::Health& health = this->characterHealth(character_id);
-	healthModifierAdjust(health, -item.modify_health_maximum);
-	healthAdjust(        health, -item.modify_health_current);
+/**
+ * \ingroup group_Telemetry
+ *
+ * \brief Stop counting Affects.
+ *
+ * \retval true  Affect Telemetry was disabled
+ * \retval false Affect Telemetry was not enabled
+ */
+bool Yars::telemetryAffectDisable() noexcept
+{
+	return (telemetry_affect.index.erase("Affect") > 0);
+}
 
-	if(health.current == 0)
-	{
-		// Event: Character Died
-	}
 
-	Yars::MapStringAttribute& attr_map = characterAttributeMap(character_id);
-	for(const auto& iter : item.modify_attribute)
-	{
-		Yars::Attribute& attr = attr_map[iter.first];
-		Yars::levelModifierAdjust(attr.level, -iter.second);
-	}
+/**
+ * \ingroup group_Telemetry
+ *
+ * \brief Start counting Affects.
+ *
+ * \example
+ * yars.telemetryAffectEnable();
+ * \endexample
+ *
+ * \retval true  Affect Telemetry was enabled
+ * \retval false Affect Telemetry is already enabled
+ */
+bool Yars::telemetryAffectEnable() noexcept
+{
+	return indexAdd(telemetry_affect, "Affect");
+}
 
-	Yars::MapStringSkill& skill_map = characterSkillMap(character_id);
-	for(const auto& iter : item.modify_skill)
-	{
-		Yars::Skill& skill = skill_map[iter.first];
-		Yars::levelModifierAdjust(skill.level, -iter.second);
-	}
 
-	characterItemAdd(character_id, equipment_name[location], equipment_item[location]);
+/**
+ * \ingroup group_Telemetry
+ *
+ * \brief Check if Affects are being counted.
+ *
+ * \retval true  Affect Telemetry is enabled
+ * \retval false Affect Telemetry is not enabled
+ */
+bool Yars::telemetryAffectIsEnabled() const noexcept
+{
+	return telemetry_affect.index.contains("Affect");
+}
 
-	equipment_item.erase(location);
-	equipment_name.erase(location);
 
-	return true;
+/**
+ * \ingroup group_Telemetry
+ *
+ * \brief Get the Health Histogram.
+ *
+ * \example
+ * Yars::Histogram histogram = yars.telemetryHealth();
+ * \endexample
+ *
+ * \return The maximum Health of each Character.  If Health Telemetry is not 
+ * enabled, the Histogram will be empty.
+ */
+Yars::Histogram Yars::telemetryHealth() const noexcept
+{
+	return telemetryHistogram(telemetry_health, "Health");
 }
 
 
 /**
- * \ingroup group_CharacterEquipment
+ * \ingroup group_Telemetry
  *
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Use error codes in debugging messages
+ * \brief Stop counting maximum Health.
  *
- * \brief Check if equipment exists.
+ * \retval true  Health Telemetry was disabled
+ * \retval false Health Telemetry was not enabled
+ */
+bool Yars::telemetryHealthDisable() noexcept
+{
+	return (telemetry_health.index.erase("Health") > 0);
+}
+
+
+/**
+ * \ingroup group_Telemetry
  *
- * Check if an Item is present at the specified location.
+ * \brief Start counting maximum Health.
  *
  * \example
- * Yars yars;
- * yars.itemAdd("Item", {});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterItemAdd(bubba, "Item");
- *
- * yars.characterEquipmentAdd(bubba, "Location", "Item");
- * if(yars.characterEquipmentExists(bubba, "Location"))
- * {
- * 	std::cout << "Bubba has an Item equipped at Location!\n";
- * }
+ * yars.telemetryHealthEnable();
  * \endexample
  *
- * \retval true  An Item is equipped at that location
- * \retval false Nothing is equipped at that location
+ * \retval true  Health Telemetry was enabled
+ * \retval false Health Telemetry is already enabled
  */
-bool Yars::characterEquipmentExists(const Yars::Id character_id ///< The Character Id
-	, const std::string& location ///< The location
-	) const noexcept
+bool Yars::telemetryHealthEnable() noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
-#endif
-
-	const Yars::MapStringItem& equipment_item = character_equipment_item.at(character_id);
-
-	return equipment_item.contains(location);
+	return indexAdd(telemetry_health, "Health");
 }
 
-// }}}
-// {{{ Character: Level
 
 /**
- * \ingroup group_Character
+ * \ingroup group_Telemetry
  *
- * \defgroup group_CharacterLevel Level
+ * \brief Check if maximum Health is being counted.
  *
- * \brief A Character's Level
+ * \retval true  Health Telemetry is enabled
+ * \retval false Health Telemetry is not enabled
+ */
+bool Yars::telemetryHealthIsEnabled() const noexcept
+{
+	return telemetry_health.index.contains("Health");
+}
+
+
+/**
+ * \ingroup group_Telemetry
  *
- * When a Character is able to _Level Up_, that Character must choose between 
- * one of two options:
- * 1. Increase health
- * 2. Increase a Skill's Attributes
+ * \brief Get an Item Histogram.
  *
- * This forces a Character to be highly skilled but easily killed, or lowly 
- * skilled but durable.  Items play a pivotal role as well because Items have 
- * the capability to increase a Character's health and skills.
+ * \example
+ * Yars::Histogram histogram = yars.telemetryItem("Gold Coin");
+ * \endexample
  *
- * Using the dynamics of leveling and Items, an RPG can limit a Character to a 
- * fixed amount of health and only allow Skills to increase forcing the 
- * Character to rely upon Items for defense and health boosting properties.
- * The inverse is also possible, where a Character can only increase their 
- * Health and must rely on Items for Skills.  It is possible, of course, to do 
- * something in the middle of these two extremes.
+ * \return The number of Items held by each Character.  If the Item is not 
+ * being tracked, the Histogram will be empty.
  */
+Yars::Histogram Yars::telemetryItem(const std::string& name ///< The Item name
+	) const noexcept
+{
+	return telemetryHistogram(telemetry_item, name);
+}
+
 
 /**
- * \ingroup group_CharacterLevel
- *
  * \todo{DebugMessage} Add debugging messages
  * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \brief Increase a Character's Health
+ * \ingroup group_Telemetry
  *
- * The Character's health will be increased by the specified \p amount.
+ * \brief Start counting an Item.
  *
  * \example
- * Yars yars;
- * Yars::Id bubba = yars.characterCreate();
- * yar.characterLevelIncrease(bubba, 1);
+ * yars.telemetryItemAdd("Gold Coin");
  * \endexample
  *
- * \retval true  The health was increased
- * \retval false Failed to increase the health
+ * \retval true  The Item is being counted
+ * \retval false Failed to add the Item
  */
-bool Yars::characterLevelIncrease(const Yars::Id character_id ///< The Character Id
-	, const uint32_t amount ///< The amount of increase
+bool Yars::telemetryItemAdd(const std::string& name ///< The Item name
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
-#endif
+	return indexAdd(telemetry_item, name);
+}
 
-	Yars::Health& health = character_health[character_id];
 
-	Yars::healthMaximumAdjust(health, amount);
+/**
+ * \ingroup group_Telemetry
+ *
+ * \brief Check if an Item is being counted.
+ *
+ * \retval true  The Item is being counted
+ * \retval false The Item is not being counted
+ */
+bool Yars::telemetryItemExists(const std::string& name ///< The Item name
+	) const noexcept
+{
+	return telemetry_item.index.contains(name);
+}
 
-	return true;
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Telemetry
+ *
+ * \brief Stop counting an Item.
+ *
+ * \retval true  The Item is no longer counted
+ * \retval false The Item was not being counted
+ */
+bool Yars::telemetryItemRemove(const std::string& name ///< The Item name
+	) noexcept
+{
+	return (telemetry_item.index.erase(name) > 0);
 }
 
 
 /**
- * \ingroup group_CharacterLevel
+ * \ingroup group_Telemetry
+ *
+ * \brief Get a Skill Histogram.
+ *
+ * \example
+ * Yars::Histogram histogram = yars.telemetrySkill("Sword");
+ * \endexample
  *
+ * \return The Skill Level of each Character.  If the Skill is not being 
+ * tracked, the Histogram will be empty.
+ */
+Yars::Histogram Yars::telemetrySkill(const std::string& name ///< The Skill name
+	) const noexcept
+{
+	return telemetryHistogram(telemetry_skill, name);
+}
+
+
+/**
  * \todo{DebugMessage} Add debugging messages
  * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \brief Increase a Character's Attributes
+ * \ingroup group_Telemetry
  *
- * The Character's Attributes that are associated with a Skill will be 
- * increased by the specified \p amount.  The \p amount is not applied evenly 
- * to all attributes.  The Attribute's contribution to the Skill determines how 
- * much they will increase.
+ * \brief Start counting a Skill.
  *
  * \example
- * Yars yars;
- * yars.skillAdd("Skill",
- * {	.attribute_contribution =
- * 	{	{ "Attr_1", 1 }
- * 	,	{ "Attr_2", 3 }
- * 	}
- * });
+ * yars.telemetrySkillAdd("Sword");
+ * \endexample
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd("Skill");
+ * \retval true  The Skill is being counted
+ * \retval false Failed to add the Skill
+ */
+bool Yars::telemetrySkillAdd(const std::string& name ///< The Skill name
+	) noexcept
+{
+	return indexAdd(telemetry_skill, name);
+}
+
+
+/**
+ * \ingroup group_Telemetry
  *
- * yar.characterLevelIncrease(bubba, "Skill", 1);
- * // Total contribution is 4
- * // Attr_1 will increase by 1/4 = 0.25
- * // Attr_2 will increase by 3/4 = 0.75
- * \endexample
+ * \brief Check if a Skill is being counted.
  *
- * \retval true  The Attributes were increased
- * \retval false Failed to increase the Attributes
+ * \retval true  The Skill is being counted
+ * \retval false The Skill is not being counted
  */
-bool Yars::characterLevelIncrease(const Yars::Id character_id ///< The Character Id
-	, const std::string& skill_name ///< The Skill
-	, const uint32_t     amount     ///< The amount of increase
+bool Yars::telemetrySkillExists(const std::string& name ///< The Skill name
+	) const noexcept
+{
+	return telemetry_skill.index.contains(name);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Telemetry
+ *
+ * \brief Stop counting a Skill.
+ *
+ * \retval true  The Skill is no longer counted
+ * \retval false The Skill was not being counted
+ */
+bool Yars::telemetrySkillRemove(const std::string& name ///< The Skill name
 	) noexcept
 {
-	if(skill_name.empty())
-	{
-		return characterLevelIncrease(character_id, amount);
-	}
+	return (telemetry_skill.index.erase(name) > 0);
+}
 
-	Yars::MapStringSkill& skill_data = character_skill[character_id];
 
-	if(skill_data.contains(skill_name) == false)
+/**
+ * \brief Get an up-to-date Histogram.
+ *
+ * \return A copy of the Histogram.
+ */
+Yars::Histogram Yars::telemetryHistogram(Yars::IndexGroup& group ///< The Telemetry group
+	, const std::string& name ///< The Telemetry name
+	) const noexcept
+{
+	const auto iter = group.index.find(name);
+
+	if(iter == std::end(group.index))
 	{
-		return false;
+		return {};
 	}
 
-	Yars::Skill& skill = skill_data[skill_name];
+	indexSync(group, name, iter->second);
 
-	float contribution_total = std::accumulate(std::begin(skill.attribute_contribution)
-		, std::end(skill.attribute_contribution)
-		, 0
-		, [](const float& total, const auto& pair)
-		{
-			return total + pair.second;
-		}
-		);
+	return iter->second.histogram;
+}
 
-	auto& attribute = character_attribute.at(character_id);
 
-	for(const auto& iter : skill.attribute_contribution)
-	{
-		const std::string& attribute_name      = iter.first;
-		const int32_t&     contribution_amount = iter.second;
+/**
+ * \brief Get the number of Affects on a Character.
+ *
+ * \retval true  Always
+ */
+bool Yars::telemetryValueAffect(const Yars::Id character_id ///< The Character Id
+	, const std::string& ///< Not used
+	, int32_t&           value ///< The number of Affects
+	) const noexcept
+{
+	const auto iter = character_affect.find(character_id);
 
-		float increase = amount * (contribution_amount / contribution_total);
+	value = (iter == std::end(character_affect))
+		? 0
+		: (int32_t)iter->second.size()
+		;
 
-		levelIncrease(attribute[attribute_name].level, increase);
-	}
+	return true;
+}
+
+
+/**
+ * \brief Get a Character's maximum Health.
+ *
+ * \retval true  Always
+ */
+bool Yars::telemetryValueHealth(const Yars::Id character_id ///< The Character Id
+	, const std::string& ///< Not used
+	, int32_t&           value ///< The maximum Health
+	) const noexcept
+{
+	const uint32_t maximum = character_health[character_id].maximum;
+
+	value = (int32_t)std::min(maximum, (uint32_t)Yars::Health_Max);
 
 	return true;
 }
 
+// }}}
+// {{{ Item Owner
 
 /**
- * \ingroup group_CharacterLevel
+ * \defgroup group_ItemOwner Item Owner
  *
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
+ * \brief Find out who has an Item.
  *
- * \brief Set a Character's Attribute Levels
+ * Yars keeps track of which Characters have each Item and how many they 
+ * have.  Both Items in the Inventory and equipped Items are counted.  The 
+ * counts are updated as Items are added, removed, taken, restacked, and 
+ * equipped, so questions like "How many Gold Coins are there?" do not need to 
+ * look at any Characters.
  *
- * The Character's Attributes that are associated with a Skill will be set by 
- * the specified \p amount.  The \p amount is not applied evenly to all 
- * attributes.  The Attribute's contribution to the Skill determines how much 
- * they will receive of the \p amount.
+ * \example
+ * uint64_t       supply = yars.itemSupply("Gold Coin");
+ * Yars::VectorId holder = yars.itemHolderList("Gold Coin");
  *
- * Normal \ref group_Level "leveling" rules will apply.
+ * for(const Yars::Id id : holder)
+ * {
+ * 	std::cout << id << ": " << yars.itemHolderAmount("Gold Coin", id) << "\n";
+ * }
+ * \endexample
+ */
+
+/**
+ * \struct Yars::ItemOwner
  *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill",
- * {	.attribute_contribution =
- * 	{	{ "Attr_1", 1 }
- * 	,	{ "Attr_2", 3 }
- * 	}
- * });
+ * \brief The Characters that have an Item.
+ */
+
+/**
+ * \typedef Yars::MapStringItemOwner
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd("Skill");
+ * \brief A convenience type.
+ */
+
+/**
+ * \ingroup group_ItemOwner
  *
- * yar.characterLevelSet(bubba, "Skill", 1);
- * // Total contribution is 4
- * // Attr_1 will be set to 1/4 = 0.25
- * // Attr_2 will be set to 3/4 = 0.75
+ * \brief How many of an Item a Character has.
+ *
+ * \example
+ * uint32_t coins = yars.itemHolderAmount("Gold Coin", bubba);
  * \endexample
  *
- * \retval true  The Attributes were increased
- * \retval false Failed to increase the Attributes
+ * \return The number of Items in the Character's Inventory and Equipment.
  */
-bool Yars::characterLevelSet(const Yars::Id character_id ///< The Character Id
-	, const std::string& skill_name ///< The Skill to change
-	, const uint32_t     amount     ///< The new level amount
-	) noexcept
+uint32_t Yars::itemHolderAmount(const std::string& item_name ///< The Item name
+	, const Yars::Id character_id ///< The Character Id
+	) const noexcept
 {
-	if(skill_name.empty())
+	const auto owner = item_owner.find(item_name);
+
+	if(owner == std::end(item_owner))
 	{
-		return characterLevelIncrease(character_id, amount);
+		return 0;
 	}
 
-	Yars::MapStringSkill& skill_data = character_skill[character_id];
+	const auto iter = owner->second.holder.find(character_id);
 
-	if(skill_data.contains(skill_name) == false)
+	if(iter == std::end(owner->second.holder))
 	{
-		return false;
+		return 0;
 	}
 
-	Yars::Skill& skill = skill_data[skill_name];
+	return iter->second;
+}
 
-	float contribution_total = std::accumulate(std::begin(skill.attribute_contribution)
-		, std::end(skill.attribute_contribution)
-		, 0
-		, [](const float& total, const auto& pair)
-		{
-			return total + pair.second;
-		}
-		);
 
-	auto& attribute = character_attribute.at(character_id);
+/**
+ * \ingroup group_ItemOwner
+ *
+ * \brief How many Characters have an Item.
+ *
+ * \example
+ * size_t count = yars.itemHolderCount("Gold Coin");
+ * \endexample
+ *
+ * \return The number of Characters.
+ */
+size_t Yars::itemHolderCount(const std::string& item_name ///< The Item name
+	) const noexcept
+{
+	const auto owner = item_owner.find(item_name);
 
-	for(const auto& iter : skill.attribute_contribution)
+	if(owner == std::end(item_owner))
 	{
-		const std::string& attribute_name      = iter.first;
-		const int32_t&     contribution_amount = iter.second;
-
-		float increase = amount * (contribution_amount / contribution_total);
-
-		levelSet(attribute[attribute_name].level, 0, increase);
+		return 0;
 	}
 
-	return true;
+	return owner->second.holder.size();
 }
 
 
-// }}}
-// {{{ Character: Affect
-
 /**
- * \todo Character should have a subset of the main data. Yars::Attribute has a 
- * name, data, and a level each of which or in separate containers.  When a 
- * Character gains an Attribute, a new Attribute is create in the Character's 
- * data-space with Id's that point to the original name and data.  However a 
- * new Level is created and the level Id will point to that instead.  The same 
- * pattern will work for Skills.
- *
- * \todo Everything should be access using Id's. Get a Skill Id from a 
- * Character, then use that Id to get info about the Skill.
+ * \ingroup group_ItemOwner
  *
- * \ingroup group_Character
- *
- * \defgroup group_CharacterAffect Affect
+ * \brief Get the Characters that have an Item.
  *
- * \brief Character and Affect interaction
+ * The Ids are not in any particular order.
  *
- * After an Affect has been created, it must be applied to a Character in order 
- * for it to do something.  This group of methods control that interaction.
+ * \example
+ * Yars::VectorId holder = yars.itemHolderList("Gold Coin");
+ * \endexample
  *
- * Once an Affect is active in a Character, that Affect can not be applied 
- * again.  There is no problem if a new Affect is created and applied to a 
- * Character that does the same thing.
+ * \return The Character Ids.
  */
+Yars::VectorId Yars::itemHolderList(const std::string& item_name ///< The Item name
+	) const noexcept
+{
+	Yars::VectorId id_list = {};
+
+	const auto owner = item_owner.find(item_name);
+
+	if(owner == std::end(item_owner))
+	{
+		return id_list;
+	}
+
+	id_list.reserve(owner->second.holder.size());
+
+	for(const auto& iter : owner->second.holder)
+	{
+		id_list.push_back(iter.first);
+	}
+
+	return id_list;
+}
+
 
 /**
- * \todo Add a method to get the best skill from an Affect, like with Item.
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
- *
- * \ingroup group_CharacterAffect
- *
- * \brief Apply an Affect to a Character
- *
- * The Affect will be applied to the Character.  The targeted Character has no 
- * chance of defending against the Affect as the Affect is applied immediately.
- *
- * Since there is no chance of defending against the Affect, no experience will 
- * be gained by either the creator or defender of the Affect.
+ * \ingroup group_ItemOwner
  *
- * \see Yars::characterAffectDefend()
+ * \brief How many of an Item exist.
  *
  * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.affect_health_current = 5
- * 	});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd("Skill");
- * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
- * yars.characterItemAdd("Item");
- *
- * Yars::Id healing = yars.affectCreate();
- * yars.affectInit(healing, bubba, "Item", "Skill", 100);
- *
- * yars.characterAffectApply(bubba, healing);
+ * uint64_t supply = yars.itemSupply("Gold Coin");
  * \endexample
  *
- * \retval true  The Affect was applied
- * \retval false Failed to apply the Affect
+ * \return The number of Items held by all Characters.
  */
-bool Yars::characterAffectApply(const Yars::Id character_id ///< The Character Id
-	, const Yars::Id affect_id ///< The Affect Id
-	) noexcept
+uint64_t Yars::itemSupply(const std::string& item_name ///< The Item name
+	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	const auto owner = item_owner.find(item_name);
+
+	if(owner == std::end(item_owner))
 	{
-		return false;
+		return 0;
 	}
 
-	if(affectExists(affect_id) == false)
+	return owner->second.supply;
+}
+
+
+/**
+ * \brief Change how many of an Item a Character has.
+ */
+void Yars::itemOwnerAdjust(const Yars::Id character_id ///< The Character Id
+	, const std::string& item_name ///< The Item name
+	, const int64_t      amount    ///< The change in count
+	) noexcept
+{
+	if(amount == 0)
 	{
-		return false;
+		return;
 	}
 
-	if(characterAffectExists(character_id, affect_id) == true)
+	Yars::ItemOwner& owner  = item_owner[item_name];
+	uint32_t&        holder = owner.holder[character_id];
+
+	holder       += amount;
+	owner.supply += amount;
+
+	if(holder == 0)
 	{
-		return false;
+		owner.holder.erase(character_id);
 	}
-#endif
-
-	this->character_affect.emplace(character_id, affect_id);
+}
 
-	const Yars::Affect& affect = this->affect(affect_id);
-	Yars::Health& health = this->characterHealth(character_id);
 
-	healthModifierAdjust(health, affect.modify_health_maximum);
-	healthAdjust(        health, affect.modify_health_current);
+/**
+ * \brief Count all the Items a Character has.
+ */
+void Yars::itemOwnerCharacterAdd(const Yars::Id character_id ///< The Character Id
+	) noexcept
+{
+	for(const auto& iter : character_item[character_id])
+	{
+		itemOwnerAdjust(character_id, iter.first, iter.second.count);
+	}
 
-	if(health.current == 0)
+	for(const auto& iter : character_equipment_name[character_id])
 	{
-		// Event: Character Died
+		itemOwnerAdjust(character_id, iter.second, +1);
 	}
+}
 
-	for(const auto& iter : affect.modify_skill)
+
+/**
+ * \brief Stop counting the Items a Character has.
+ *
+ * The amounts that were counted are removed, so calling this more than once 
+ * is safe.
+ */
+void Yars::itemOwnerCharacterRemove(const Yars::Id character_id ///< The Character Id
+	) noexcept
+{
+	const auto remove = [&](const std::string& item_name)
 	{
-		const std::string& skill_name = iter.first;
-		const int32_t&     modifier   = iter.second;
+		const auto owner = item_owner.find(item_name);
 
-		if(characterSkillExists(character_id, skill_name) == false)
+		if(owner == std::end(item_owner))
 		{
-			characterSkillAdd(character_id, skill_name);
+			return;
 		}
 
-		Yars::Skill& skill = characterSkill(character_id, skill_name);
-		levelModifierAdjust(skill.level, modifier);
-	}
+		const auto iter = owner->second.holder.find(character_id);
 
-	for(const auto& iter : affect.modify_attribute)
-	{
-		const std::string& attribute_name = iter.first;
-		const int32_t&     modifier       = iter.second;
+		if(iter == std::end(owner->second.holder))
+		{
+			return;
+		}
 
-		Yars::Attribute& attribute = characterAttribute(character_id, attribute_name);
-		levelModifierAdjust(attribute.level, modifier);
+		owner->second.supply -= iter->second;
+		owner->second.holder.erase(iter);
+	};
+
+	const auto item = character_item.find(character_id);
+
+	if(item != std::end(character_item))
+	{
+		for(const auto& iter : item->second)
+		{
+			remove(iter.first);
+		}
 	}
 
-	return true;
+	const auto equipment = character_equipment_name.find(character_id);
+
+	if(equipment != std::end(character_equipment_name))
+	{
+		for(const auto& iter : equipment->second)
+		{
+			remove(iter.second);
+		}
+	}
 }
 
+// }}}
+// {{{ Loot
 
 /**
- * \bug A skill level of 0 should be the same as not having that skill
- *
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Add error codes to the debugging messages
+ * \defgroup group_Loot Loot
  *
- * \ingroup group_CharacterAffect
+ * \brief Weighted random Item drops.
  *
- * \brief Apply an Affect to a Character
+ * A Loot table is a list of entries, each entry is either an Item or another 
+ * Loot table.  When the table is rolled, one entry is picked based on its 
+ * weight and the entry provides between `count_min` and `count_max` Items.  
+ * If the entry is a Loot table, then that table is rolled `count` times.
  *
- * The Affect will be applied to the Character.  However, unlike 
- * Yars::characterAffectApply(), the character will have a chance to defend 
- * against the Affect using the specified skill.
+ * Every Loot table has a pre-computed alias table so that picking an entry 
+ * takes the same amount of time no matter how many entries the table has.  
+ * All the random numbers come from the Yars random number generator, using 
+ * the same seed will produce the same Loot.
  *
- * If the Character successfully defends against the Affect, the defender will 
- * gain the experience.  However, if the Affect is applied, the creator of the 
- * Affect will get the experience.
+ * A nested Loot table must exist before it can be used, and a Loot table can 
+ * not be removed while another Loot table is using it.  This prevents Loot 
+ * tables from containing themselves.  The same goes for Items, an Item can 
+ * not be removed while a Loot table is using it.
  *
  * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.affect_health_current = -5
+ * yars.lootAdd("Gems",
+ * 	{	{ .item = "Ruby",     .weight = 1 }
+ * 	,	{ .item = "Sapphire", .weight = 3 }
  * 	});
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd("Skill");
- * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
- * yars.characterItemAdd("Item");
- *
- * Yars::Id poison = yars.affectCreate();
- * yars.affectInit(poison, bubba, "Item", "Skill", 100);
+ * yars.lootAdd("Goblin",
+ * 	{	{ .item  = "Gold Coin", .weight = 90, .count_min = 1, .count_max = 20 }
+ * 	,	{ .table = "Gems",      .weight = 10 }
+ * 	});
  *
- * Yars::Id billybob = yars.characterCreate();
- * yars.characterAffectDefend(billybob, poison, "Skill");
+ * yars.lootGrant(bubba, "Goblin", 3);
  * \endexample
+ */
+
+/**
+ * \struct Yars::LootEntry
  *
- * \retval true  The Affect was applied
- * \retval false Failed to apply the Affect
+ * \brief An entry in a Loot table.
+ *
+ * Only one of \p item or \p table can be used.
+ *
+ * \var Yars::LootEntry::item
+ * \brief The name of the Item
+ *
+ * \var Yars::LootEntry::table
+ * \brief The name of the Loot table
+ *
+ * \var Yars::LootEntry::weight
+ * \brief How likely this entry is to be picked
+ *
+ * \var Yars::LootEntry::count_min
+ * \brief The fewest Items (or rolls) provided
+ *
+ * \var Yars::LootEntry::count_max
+ * \brief The most Items (or rolls) provided
  */
-bool Yars::characterAffectDefend(const Yars::Id character_id ///< The Character Id
-	, const Yars::Id     affect_id  ///< The Affect Id
-	, const std::string& skill_name ///< The Defense Skill
-	) noexcept
-{
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
 
-	if(affectExists(affect_id) == false)
-	{
-		return false;
-	}
+/**
+ * \typedef Yars::VectorLootEntry
+ *
+ * \brief A convenience type.
+ */
 
-	if(characterSkillExists(character_id, skill_name) == false)
-	{
-		return false;
-	}
-#endif
-	
-	Yars::Affect& affect = this->affect(affect_id);
+/**
+ * \struct Yars::Loot
+ *
+ * \brief A Loot table with its alias table.
+ */
 
-	auto iter = std::find(std::begin(affect.defense_skill)
-		, std::end(affect.defense_skill)
-		, skill_name
-		);
+/**
+ * \typedef Yars::MapStringLoot
+ *
+ * \brief A convenience type.
+ */
 
-	if(iter != affect.defense_skill.end())
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_Loot
+ *
+ * \brief Add a Loot table.
+ *
+ * Every entry must have either an Item or a Loot table, a \p weight greater 
+ * than `0`, and a \p count_max that is not less than \p count_min.  The Items 
+ * and Loot tables must already exist.
+ *
+ * \example
+ * yars.lootAdd("Chest",
+ * 	{	{ .item = "Gold Coin", .weight = 4, .count_min = 10, .count_max = 50 }
+ * 	,	{ .item = "Sword",     .weight = 1 }
+ * 	});
+ * \endexample
+ *
+ * \retval true  The Loot table was added
+ * \retval false Failed to add the Loot table
+ */
+bool Yars::lootAdd(const std::string& loot_name ///< The Loot table name
+	, const Yars::VectorLootEntry& entry_list ///< The entries
+	) noexcept
+{
+	if(loot_name.empty()
+		|| entry_list.empty()
+		|| entry_list.size() > std::numeric_limits<uint32_t>::max()
+		|| lootExists(loot_name)
+		)
 	{
-		// Do skill check
-		const Yars::Skill& skill       = characterSkill(character_id, skill_name);
-		const uint32_t     skill_level = skill.level.value;
+		return false;
+	}
 
-		const float difficulty    = calculateDifficulty(skill_level, affect.level);
-		const Yars::Result result = difficultyToResult(difficulty);
+	Yars::Loot loot = { .entry = entry_list };
 
-		if(result == Yars::Result::Success_Automatic)
+	for(const Yars::LootEntry& entry : entry_list)
+	{
+		if(entry.item.empty() == entry.table.empty())
 		{
-			// successfully defended
 			return false;
 		}
 
-		if(result == Yars::Result::Success)
+		if(entry.item.empty() == false && itemExists(entry.item) == false)
 		{
-			// successfully defended
-			characterSkillIncrease(character_id
-				, skill_name
-				, affect.experience
-				);
-
 			return false;
 		}
 
-		if(result == Yars::Result::Chance)
+		if(entry.table.empty() == false && lootExists(entry.table) == false)
 		{
-			bool success = calculateIsSuccess(character_id, skill_name, difficulty);
-
-			if(success == true)
-			{
-				// successfully defended
-				characterSkillIncrease(character_id
-					, skill_name
-					, affect.experience
-					);
-
-				return false; // Affect was not applied
-			}
+			return false;
 		}
-	}
-
-	if(characterAffectExists(character_id, affect_id) == false)
-	{
-		characterAffectApply(character_id, affect_id);
 
-		if(affect.experience > 0 && affect.origin_skill.empty() == false)
+		if(entry.weight == 0 || entry.count_min > entry.count_max)
 		{
-			characterSkillIncrease(affect.origin_character
-				, affect.origin_skill
-				, affect.experience
-				);
+			return false;
 		}
+
+		loot.weight += entry.weight;
 	}
 
+	lootAliasBuild(loot);
+
+	loot_map[loot_name] = std::move(loot);
+
 	return true;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Add error codes to the debugging messages
- *
- * \ingroup group_CharacterAffect
+ * \ingroup group_Loot
  *
- * \brief Check if an Affect has been applied
+ * \brief Check if a Loot table exists.
  *
- * Checks the Character to determine if the Affect is currently active.
+ * \retval true  The Loot table exists
+ * \retval false The Loot table does not exist
+ */
+bool Yars::lootExists(const std::string& loot_name ///< The Loot table name
+	) const noexcept
+{
+	return loot_map.contains(loot_name);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.affect_health_maximum = 10
- * 	});
+ * \ingroup group_Loot
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd("Skill");
- * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
- * yars.characterItemAdd("Item");
+ * \brief Give Loot to a Character.
  *
- * Yars::Id hp_boost = yars.affectCreate();
- * yars.affectInit(hp_boost, bubba, "Item", "Skill", 100);
- * yars.characterAffectApply(bubba, hp_boost);
+ * The Loot table is rolled \p rolls times and all the Items are added to the 
+ * Character's Inventory at the same time, once per Item.
  *
- * if(yars.characterAffectExists(bubba, hp_boost))
- * {
- * 	std::cout << "Bubba has an HP Boost!\n";
- * }
+ * \example
+ * yars.lootGrant(bubba, "Goblin", goblins_killed);
  * \endexample
  *
- * \retval true  The Affect exists
- * \retval false The Affect does not exist
+ * \retval true  The Loot was added
+ * \retval false Failed to add the Loot
  */
-bool Yars::characterAffectExists(const Yars::Id character_id ///< The Character Id
-	, const Yars::Id affect_id ///< The Affect
-	) const noexcept
+bool Yars::lootGrant(const Yars::Id character_id ///< The Character Id
+	, const std::string& loot_name ///< The Loot table name
+	, const uint32_t     rolls     ///< The number of times to roll
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
-#endif
+	Yars::MapStringUint32 drop = {};
 
-	return multimapContains(character_affect, character_id, affect_id);
+	return lootGrant(character_id, loot_name, drop, rolls);
 }
 
 
 /**
  * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Add error codes to the debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \ingroup group_CharacterAffect
+ * \ingroup group_Loot
  *
- * \brief Get a list of Affects
+ * \brief Give Loot to a Character.
  *
- * Creates a list of all the Affects that are currently applied to the 
- * Character.
+ * The same as lootGrant() but the Items that were given to the Character will 
+ * be stored in \p drop.  If an Item could not be given to the Character, it 
+ * is not in \p drop and `false` is returned.
  *
  * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.affect_health_maximum = 10
- * 	});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd("Skill");
- * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
- * yars.characterItemAdd("Item");
+ * Yars::MapStringUint32 drop;
+ * yars.lootGrant(bubba, "Goblin", drop);
  *
- * Yars::Id hp_boost = yars.affectCreate();
- * yars.affectInit(hp_boost, bubba, "Item", "Skill", 100);
- * yars.characterAffectApply(bubba, hp_boost);
- *
- * Yars::VectorId list = yars.characterAffectList(bubba);
+ * for(const auto& [item_name, count] : drop)
+ * {
+ * 	std::cout << "Found " << count << " " << item_name << "\n";
+ * }
  * \endexample
  *
- * \return A list of Affects
+ * \retval true  The Loot was added
+ * \retval false Failed to add the Loot
  */
-Yars::VectorId Yars::characterAffectList(const Yars::Id character_id ///< The Character Id
-	) const noexcept
+bool Yars::lootGrant(const Yars::Id character_id ///< The Character Id
+	, const std::string&    loot_name ///< The Loot table name
+	, Yars::MapStringUint32& drop      ///< The Items that were added
+	, const uint32_t        rolls     ///< The number of times to roll
+	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	drop.clear();
+
+	if(safeMode())
 	{
-		return {};
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
+	}
+
+	const auto loot = loot_map.find(loot_name);
+
+	if(loot == std::end(loot_map))
+	{
+		return false;
 	}
-#endif
 
-	Yars::VectorId vector;
+	Yars::MapStringUint32 roll = {};
 
-	auto range = character_affect.equal_range(character_id);
+	lootRollInto(loot->second, rolls, roll);
 
-	std::for_each(range.first, range.second
-		, [&](const auto& iter)
+	if(safeMode())
+	{
+		for(const auto& [item_name, count] : roll)
 		{
-			const Yars::Id& affect_id = iter.second;
+			if(itemExists(item_name) == false)
+			{
+				return false;
+			}
+		}
+	}
 
-			vector.push_back(affect_id);
-		});
+	bool retval = true;
+
+	for(const auto& [item_name, count] : roll)
+	{
+		if(characterItemAdd(character_id, item_name, count))
+		{
+			drop[item_name] = count;
+		}
+		else
+		{
+			retval = false;
+		}
+	}
 
-	return vector;
+	return retval;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
- *
- * \ingroup group_CharacterAffect
+ * \ingroup group_Loot
  *
- * \brief Remove an Affect
+ * \brief Get a list of all the Loot tables.
  *
- * Removes an Affect from a Character.  After Affect has been removed, the 
- * changes in the Character that were made by the Affect will remain.  
- * Effectively becoming permanent.
+ * \return The Loot table names.
+ */
+Yars::VectorString Yars::lootList() const noexcept
+{
+	return mapKeyList(loot_map);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
  *
- * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.affect_health_maximum = 10
- * 	});
+ * \ingroup group_Loot
  *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd("Skill");
- * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
- * yars.characterItemAdd("Item");
+ * \brief Remove a Loot table.
  *
- * Yars::Id hp_boost = yars.affectCreate();
- * yars.affectInit(hp_boost, bubba, "Item", "Skill", 100);
- * yars.characterAffectApply(bubba, hp_boost);
+ * A Loot table that is used by another Loot table can not be removed.
  *
- * yars.characterAffectRemove(bubba, hp_boost);
- * // Bubba's max health is still at +10.
- * \endexample
+ * \retval true  The Loot table was removed
+ * \retval false Failed to remove the Loot table
  */
-void Yars::characterAffectRemove(const Yars::Id character_id ///< The Character Id
-	, const Yars::Id affect_id ///< The Affect
+bool Yars::lootRemove(const std::string& loot_name ///< The Loot table name
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(lootExists(loot_name) == false)
 	{
-		return;
+		return false;
 	}
 
-	if(characterAffectExists(character_id, affect_id) == false)
+	for(const auto& [name, loot] : loot_map)
 	{
-		return;
+		for(const Yars::LootEntry& entry : loot.entry)
+		{
+			if(entry.table == loot_name)
+			{
+				return false;
+			}
+		}
 	}
-#endif
 
-	multimapErase(character_affect, character_id, affect_id);
+	loot_map.erase(loot_name);
+
+	return true;
 }
 
 
 /**
- * \todo{DebugMessage} Add debugging messages
- * \todo{ErrorCode}    Return an error code instead of a boolean
- *
- * \ingroup group_CharacterAffect
- *
- * \brief Remove an Affect
+ * \ingroup group_Loot
  *
- * Removes an Affect from a Character.  After Affect has been removed, the 
- * changes in the Character will return to what they were before the Affect was 
- * applied.
+ * \brief Roll a Loot table.
  *
- * If an Affect increased the Character's current health, there is a chance 
- * that the Character can die if the current health goes to `0` after the 
- * revert.
+ * The Loot table is rolled \p rolls times and the Items are collected 
+ * together.  No Characters are changed.
  *
  * \example
- * Yars yars;
- * yars.skillAdd("Skill", {});
- * yars.itemAdd("Item",
- * 	{	.skill_attacker = { "Skill" }
- * 	,	.affect_health_maximum = 10
- * 	});
- *
- * Yars::Id bubba = yars.characterCreate();
- * yars.characterSkillAdd("Skill");
- * yars.levelSet(yars.characterSkill(bubba, "Skill").level, 10);
- * yars.characterItemAdd("Item");
+ * Yars::MapStringUint32 drop = yars.lootRoll("Chest");
+ * \endexample
  *
- * Yars::Id hp_boost = yars.affectCreate();
- * yars.affectInit(hp_boost, bubba, "Item", "Skill", 100);
- * yars.characterAffectApply(bubba, hp_boost);
+ * \return The Items and how many of each.
+ */
+Yars::MapStringUint32 Yars::lootRoll(const std::string& loot_name ///< The Loot table name
+	, const uint32_t rolls ///< The number of times to roll
+	) const noexcept
+{
+	Yars::MapStringUint32 drop = {};
+
+	const auto loot = loot_map.find(loot_name);
+
+	if(loot != std::end(loot_map))
+	{
+		lootRollInto(loot->second, rolls, drop);
+	}
+
+	return drop;
+}
+
+
+/**
+ * \brief Build the alias table.
  *
- * yars.characterAffectRevert(bubba, hp_boost);
- * // Bubba's max health no longer has the +10
- * \endexample
+ * This is Vose's alias method using integers.  Each entry's weight is scaled 
+ * by the number of entries so that the average is the total weight.  Entries 
+ * below the average are paired with an entry above the average which makes 
+ * up the difference.
  */
-void Yars::characterAffectRevert(const Yars::Id character_id ///< The Character Id
-	, const Yars::Id affect_id ///< The Affect
+void Yars::lootAliasBuild(Yars::Loot& loot ///< The Loot table
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	const uint32_t size = (uint32_t)loot.entry.size();
+
+	loot.probability.resize(size);
+	loot.alias.resize(size);
+
+	std::vector<uint32_t> small = {};
+	std::vector<uint32_t> large = {};
+
+	for(uint32_t i = 0; i < size; i++)
 	{
-		return;
+		loot.probability[i] = (uint64_t)loot.entry[i].weight * size;
+		loot.alias[i]       = i;
+
+		if(loot.probability[i] < loot.weight)
+		{
+			small.push_back(i);
+		}
+		else
+		{
+			large.push_back(i);
+		}
 	}
 
-	if(characterAffectExists(character_id, affect_id) == false)
+	while(small.empty() == false && large.empty() == false)
+	{
+		const uint32_t less = small.back();
+		const uint32_t more = large.back();
+
+		small.pop_back();
+
+		loot.alias[less]        = more;
+		loot.probability[more] -= loot.weight - loot.probability[less];
+
+		if(loot.probability[more] < loot.weight)
+		{
+			large.pop_back();
+			small.push_back(more);
+		}
+	}
+
+	for(const uint32_t i : small)
 	{
-		return;
+		loot.probability[i] = loot.weight;
 	}
-#endif
-	
-	const Yars::Affect& affect = this->affect(affect_id);
-	Yars::Health& health = this->characterHealth(character_id);
 
-	healthModifierAdjust(health, -affect.modify_health_maximum);
-	if(health.current == 0)
+	for(const uint32_t i : large)
 	{
-		// Event: Character Died
+		loot.probability[i] = loot.weight;
 	}
+}
 
-	for(const auto& iter : affect.modify_skill)
+
+/**
+ * \brief Roll a Loot table.
+ *
+ * The Items are added to \p drop.
+ */
+void Yars::lootRollInto(const Yars::Loot& loot ///< The Loot table
+	, const uint32_t        rolls ///< The number of times to roll
+	, Yars::MapStringUint32& drop  ///< The Items
+	) const noexcept
+{
+	std::uniform_int_distribution<uint32_t> pick(0, (uint32_t)loot.entry.size() - 1);
+	std::uniform_int_distribution<uint64_t> chance(0, loot.weight - 1);
+
+	for(uint32_t roll = 0; roll < rolls; roll++)
 	{
-		const std::string& skill_name = iter.first;
-		const int32_t&     modifier   = iter.second;
+		uint32_t index = pick(mt_engine);
 
-		if(characterSkillExists(character_id, skill_name) == true)
+		if(chance(mt_engine) >= loot.probability[index])
 		{
-			Yars::Skill& skill = characterSkill(character_id, skill_name);
-			levelModifierAdjust(skill.level, -modifier);
+			index = loot.alias[index];
 		}
-	}
 
-	for(const auto& iter : affect.modify_attribute)
-	{
-		const std::string& attribute_name = iter.first;
-		const int32_t&     modifier       = iter.second;
+		const Yars::LootEntry& entry = loot.entry[index];
 
-		// Attributes are never deleted, no need to check for existence
+		uint32_t count = entry.count_min;
 
-		Yars::Attribute& attribute = characterAttribute(character_id, attribute_name);
-		levelModifierAdjust(attribute.level, -modifier);
+		if(entry.count_min < entry.count_max)
+		{
+			count = std::uniform_int_distribution<uint32_t>(entry.count_min, entry.count_max)(mt_engine);
+		}
+
+		if(count == 0)
+		{
+			continue;
+		}
+
+		if(entry.item.empty() == false)
+		{
+			drop[entry.item] += count;
+		}
+		else
+		{
+			lootRollInto(loot_map.find(entry.table)->second, count, drop);
+		}
 	}
 }
 
-// }}}
 // }}}
 // {{{ Affect
 
@@ -7384,13 +18785,14 @@ std::string Yars::to_string(const Yars::Affect& affect ///< Object to convert
 Yars::Affect& Yars::affect(const Yars::Id affect_id ///< The Affect ID
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(affectExists(affect_id) == false)
+	if(safeMode())
 	{
-		Affect* retval = nullptr;
-		return *retval;
+		if(affectExists(affect_id) == false)
+		{
+			Affect* retval = nullptr;
+			return *retval;
+		}
 	}
-#endif
 
 	return affect_vector[affect_id];
 }
@@ -7419,13 +18821,14 @@ Yars::Affect& Yars::affect(const Yars::Id affect_id ///< The Affect ID
 const Yars::Affect& Yars::affect(const Yars::Id affect_id ///< The Affect ID
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(affectExists(affect_id) == false)
+	if(safeMode())
 	{
-		Affect* retval = nullptr;
-		return *retval;
+		if(affectExists(affect_id) == false)
+		{
+			Affect* retval = nullptr;
+			return *retval;
+		}
 	}
-#endif
 
 	return affect_vector.at(affect_id);
 }
@@ -7459,11 +18862,12 @@ Yars::Id Yars::affectCreate() noexcept
 	}
 	else
 	{
-#if defined (ZAKERO_YARS_ENABLE_ID_SHUFFLE)
-		std::random_shuffle(std::begin(affect_pool)
-			, std::end(affect_pool)
-			);
-#endif
+		if(yars_config.id_shuffle)
+		{
+			std::random_shuffle(std::begin(affect_pool)
+				, std::end(affect_pool)
+				);
+		}
 		affect_id = affect_pool.back();
 		affect_pool.pop_back();
 
@@ -7499,16 +18903,18 @@ Yars::Id Yars::affectCreate() noexcept
 bool Yars::affectDelete(const Yars::Id affect_id ///< The Affect
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(affectExists(affect_id) == false)
+	if(safeMode())
 	{
-		return false;
+		if(affectExists(affect_id) == false)
+		{
+			return false;
+		}
 	}
-#endif
 
-#if defined (ZAKERO_YARS_ENABLE_CLEAR_ON_DELETE)
-	affectClear(affect_id);
-#endif
+	if(yars_config.clear_on_delete)
+	{
+		affectClear(affect_id);
+	}
 
 	affect_pool.push_back(affect_id);
 
@@ -7615,30 +19021,56 @@ bool Yars::affectInit(const Yars::Id affect_id    ///< The Affect
 	, const int32_t              adjustment   ///< Weaker <--> Stronger
 	) noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(affectExists(affect_id) == false)
+	if(safeMode())
 	{
-		return false;
-	}
+		if(affectExists(affect_id) == false)
+		{
+			return false;
+		}
 
-	if(characterExists(character_id) == false)
-	{
-		return false;
-	}
+		if(characterExists(character_id) == false)
+		{
+			return false;
+		}
 
-	if(characterItemIsUsableByAttacker(character_id, item) == false)
-	{
-		return false;
-	}
+		if(characterItemIsUsableByAttacker(character_id, item) == false)
+		{
+			return false;
+		}
 
-	if(characterSkillExists(character_id, skill_name) == false)
-	{
-		return false;
+		if(characterSkillExists(character_id, skill_name) == false)
+		{
+			return false;
+		}
 	}
-#endif
 
-	const Yars::Skill& skill = characterSkill(character_id, skill_name);
+	return affectInitSkill(affect_id
+		, character_id
+		, item
+		, skill_name
+		, std::as_const(*this).characterSkill(character_id, skill_name)
+		, adjustment
+		);
+}
+
 
+/**
+ * \brief Initialize an Affect
+ *
+ * The same as Yars::affectInit() but the Skill has already been found and 
+ * nothing is validated.
+ *
+ * \retval true  The Affect was initialized
+ * \retval false Failed to initialize the Affect
+ */
+bool Yars::affectInitSkill(const Yars::Id affect_id    ///< The Affect
+	, const Yars::Id             character_id ///< The "creator" Character
+	, const Yars::Item&          item         ///< The Item
+	, const std::string&         skill_name   ///< The Skill name
+	, const Yars::Skill&         skill        ///< The Skill
+	, const int32_t              adjustment   ///< Weaker <--> Stronger
+	) noexcept
+{
 	const uint32_t skill_level  = skill.level.value;
 	const uint32_t affect_level = uint32_t(std::max(0
 		, int32_t(skill_level + adjustment)
@@ -7657,7 +19089,8 @@ bool Yars::affectInit(const Yars::Id affect_id    ///< The Affect
 	if(result == Yars::Result::Chance)
 	{
 		float probability = 0;
-		bool success = calculateIsSuccess(character_id, skill_name, difficulty, probability);
+		const float modifier = calculateModifierSkill(character_id, skill_name, skill);
+		bool success = calculateIsSuccessModifier(modifier, difficulty, probability);
 
 		if(success == false)
 		{
@@ -7761,22 +19194,23 @@ Yars::Result Yars::approxDifficultyCheck(const Yars::Id character_attacker
 	, const Yars::Id     character_defender
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_attacker) == false)
+	if(safeMode())
 	{
-		return Yars::Result::Error;
-	}
+		if(characterExists(character_attacker) == false)
+		{
+			return Yars::Result::Error;
+		}
 
-	if(characterItemExists(character_attacker, item_name) == false)
-	{
-		return Yars::Result::Error;
-	}
+		if(characterItemExists(character_attacker, item_name) == false)
+		{
+			return Yars::Result::Error;
+		}
 
-	if(characterExists(character_defender) == false)
-	{
-		return Yars::Result::Error;
+		if(characterExists(character_defender) == false)
+		{
+			return Yars::Result::Error;
+		}
 	}
-#endif
 
 	std::string skill_attacker = characterItemSkillAttacker(character_attacker, item_name);
 	std::string skill_defender = characterItemSkillAttacker(character_defender, item_name);
@@ -7797,42 +19231,43 @@ Yars::Result Yars::approxDifficultyCheck(const Yars::Id character_attacker
 	, const std::string& skill_defender
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_attacker) == false)
+	if(safeMode())
 	{
-		return Yars::Result::Error;
-	}
+		if(characterExists(character_attacker) == false)
+		{
+			return Yars::Result::Error;
+		}
 
-	if(characterSkillExists(character_attacker, skill_attacker) == false)
-	{
-		return Yars::Result::Error;
-	}
+		if(characterSkillExists(character_attacker, skill_attacker) == false)
+		{
+			return Yars::Result::Error;
+		}
 
-	if(characterItemExists(character_attacker, item_name) == false)
-	{
-		return Yars::Result::Error;
-	}
+		if(characterItemExists(character_attacker, item_name) == false)
+		{
+			return Yars::Result::Error;
+		}
 
-	if(characterItemIsUsableByAttacker(character_attacker, item_name, skill_attacker) == false)
-	{
-		return Yars::Result::Error;
-	}
+		if(characterItemIsUsableByAttacker(character_attacker, item_name, skill_attacker) == false)
+		{
+			return Yars::Result::Error;
+		}
 
-	if(characterExists(character_defender) == false)
-	{
-		return Yars::Result::Error;
-	}
+		if(characterExists(character_defender) == false)
+		{
+			return Yars::Result::Error;
+		}
 
-	if(characterSkillExists(character_defender, skill_defender) == false)
-	{
-		return Yars::Result::Error;
-	}
+		if(characterSkillExists(character_defender, skill_defender) == false)
+		{
+			return Yars::Result::Error;
+		}
 
-	if(characterItemIsUsableByDefender(character_defender, item_name, skill_defender) == false)
-	{
-		return Yars::Result::Error;
+		if(characterItemIsUsableByDefender(character_defender, item_name, skill_defender) == false)
+		{
+			return Yars::Result::Error;
+		}
 	}
-#endif
 
 	const Yars::Skill& attacker = characterSkill(character_attacker, skill_attacker);
 	const Yars::Skill& defender = characterSkill(character_defender, skill_defender);
@@ -7846,6 +19281,151 @@ Yars::Result Yars::approxDifficultyCheck(const Yars::Id character_attacker
 */
 // }}}
 
+/**
+ * \ingroup group_Calculations
+ *
+ * \brief Determine the difficulty using fixed-point math.
+ *
+ * The same ratio as Yars::calculateDifficulty(const uint32_t, const uint32_t) 
+ * const, but as a fixed-point value with #Yars::Fixed_Shift fractional bits. 
+ * The result is rounded to the nearest value.
+ *
+ * The \p target must not be `0`.
+ *
+ * \example
+ * int64_t difficulty = Yars::fixedDifficulty(55, 66);
+ * \endexample
+ *
+ * \return A fixed-point difficulty ratio
+ */
+int64_t Yars::fixedDifficulty(const uint32_t base ///< Base Difficulty
+	, const uint32_t target ///< Target Difficulty
+	) noexcept
+{
+	const int64_t numerator = ((int64_t)target - (int64_t)base) * 2 * Fixed_One;
+	const int64_t half      = (int64_t)target / 2;
+
+	if(numerator < 0)
+	{
+		return (numerator - half) / (int64_t)target;
+	}
+
+	return (numerator + half) / (int64_t)target;
+}
+
+
+/**
+ * \ingroup group_Calculations
+ *
+ * \brief Calculate the probability using fixed-point math.
+ *
+ * The same formula as Yars::calculateProbability(), but the \p ratio and the 
+ * result are fixed-point values with #Yars::Fixed_Shift fractional bits.  The 
+ * \p ratio is limited to the range [-32, 32].
+ *
+ * The formula is odd (\f$f(-x) = -f(x)\f$) so only the magnitude is 
+ * calculated, which makes the rounding symmetric.
+ *
+ * \example
+ * int64_t probability = Yars::fixedProbability(Yars::Fixed_One / 2);
+ * \endexample
+ *
+ * \return The fixed-point probability
+ */
+int64_t Yars::fixedProbability(const int64_t ratio ///< The difficulty ratio
+	) noexcept
+{
+	return zakero_yars_fixed_probability_(ratio);
+}
+
+
+/**
+ * \ingroup group_Calculations
+ *
+ * \brief Convert a float to a fixed-point value.
+ *
+ * The value is limited to the range [-32, 32] and rounded to the nearest 
+ * fixed-point value.  The \p value must not be NaN.
+ *
+ * \return The fixed-point value
+ */
+int64_t Yars::fixedFromFloat(const float value ///< The value to convert
+	) noexcept
+{
+	// Scaling by a power of 2 is exact, so only the rounding can differ
+	const float scaled = std::clamp(value, -32.0f, 32.0f) * (float)Fixed_One;
+
+	return (int64_t)(scaled + ((scaled < 0) ? -0.5f : 0.5f));
+}
+
+
+/**
+ * \ingroup group_Calculations
+ *
+ * \brief Convert a fixed-point value to a float.
+ *
+ * \return The float value
+ */
+float Yars::fixedToFloat(const int64_t value ///< The value to convert
+	) noexcept
+{
+	return (float)value * (1.0f / (float)Fixed_One);
+}
+
+
+/**
+ * \ingroup group_Calculations
+ *
+ * \brief Calculate the probability using a table.
+ *
+ * The probability of the ratios in the range [0, 1] are stored in a table 
+ * that is built at compile-time by Yars::fixedProbability().  Negative ratios 
+ * use the same table because the formula is odd.  The probability 
+ * of the \p ratio is linearly interpolated between the two closest entries. 
+ * Ratios outside of the table are passed to Yars::fixedProbability().
+ *
+ * \example
+ * int64_t probability = Yars::tableProbability(Yars::Fixed_One / 2);
+ * \endexample
+ *
+ * \return The fixed-point probability
+ */
+int64_t Yars::tableProbability(const int64_t ratio ///< The difficulty ratio
+	) noexcept
+{
+	if(ratio < -Fixed_One || ratio > Fixed_One)
+	{
+		return zakero_yars_fixed_probability_(ratio);
+	}
+
+	constexpr int64_t Shift = zakero_yars_table_shift_;
+	constexpr int64_t Mask  = (1 << Shift) - 1;
+	constexpr int64_t Half  = (1 << Shift) / 2;
+
+	const auto& table = zakero_yars_probability_table_;
+
+	const int64_t position = (ratio < 0) ? -ratio : ratio;
+	const int64_t index    = position >> Shift;
+	const int64_t fraction = position & Mask;
+
+	int64_t probability = table[index];
+
+	if(fraction != 0)
+	{
+		const int64_t delta = (int64_t)table[index + 1] - probability;
+
+		probability += ((delta * fraction) + Half) >> Shift;
+	}
+
+	if(ratio < 0)
+	{
+		return -probability;
+	}
+
+	return probability;
+}
+
+
 /**
  * \ingroup group_Calculations
  *
@@ -7952,6 +19532,9 @@ float Yars::calculateDifficulty(const Yars::Skill& skill ///< Attacker Skill
  * '(base - target)' by `-2`.  Multiplying by `0.5` has a result closer to `0`, 
  * while multiplying by `2` moves away from `0`.
  *
+ * When Yars::Config::math is not Yars::Math::Float, the ratio is calculated 
+ * with Yars::fixedDifficulty().
+ *
  * \example
  * Yars yars;
  *
@@ -7964,6 +19547,11 @@ float Yars::calculateDifficulty(const uint32_t base ///< Base Difficulty
 	, const uint32_t target ///< Target Difficulty
 	) const noexcept
 {
+	if(yars_config.math != Yars::Math::Float && target != 0)
+	{
+		return fixedToFloat(fixedDifficulty(base, target));
+	}
+
 	//const float ratio = (((float)base - (float)target)) / ((float)target / -2.0f);
 	const float ratio = (((float)base - (float)target)) / ((float)target * -0.5f);
 
@@ -8062,18 +19650,37 @@ bool Yars::calculateIsSuccess(const Yars::Id& character_id ///< The Character
  * }
  * \endexample
  *
- * \see Yars::calculateDifficulty()
+ * \see Yars::calculateDifficulty()
+ *
+ * \retval true  Success
+ * \retval false Failure
+ */
+bool Yars::calculateIsSuccess(const Yars::Id& character_id ///< The Character
+	, const std::string& skill_name  ///< The Skill
+	, const float        difficulty  ///< The difficulty
+	, float&             probability ///< Store the probability here
+	) const noexcept
+{
+	const float modifier = calculateModifier(character_id, skill_name);
+
+	return calculateIsSuccessModifier(modifier, difficulty, probability);
+}
+
+
+/**
+ * \brief Determine Success or Failure.
+ *
+ * The same as Yars::calculateIsSuccess() but the modifier has already been 
+ * calculated.
  *
  * \retval true  Success
  * \retval false Failure
  */
-bool Yars::calculateIsSuccess(const Yars::Id& character_id ///< The Character
-	, const std::string& skill_name  ///< The Skill
-	, const float        difficulty  ///< The difficulty
-	, float&             probability ///< Store the probability here
+bool Yars::calculateIsSuccessModifier(const float modifier ///< The Skill modifier
+	, const float difficulty  ///< The difficulty
+	, float&      probability ///< Store the probability here
 	) const noexcept
 {
-	const float modifier   = calculateModifier(character_id, skill_name);
 	const float rand_value = zakero_yars_distribution_(mt_engine);
 
 	probability = calculateProbability(difficulty);
@@ -8159,58 +19766,107 @@ float Yars::calculateModifier(const Yars::Id character_id ///< The Character Id
 	, const std::string& skill_name ///< The Skill
 	) const noexcept
 {
-#if defined (ZAKERO_YARS_ENABLE_SAFE_MODE)
-	if(characterExists(character_id) == false)
+	if(safeMode())
 	{
-		return 0;
-	}
+		if(characterExists(character_id) == false)
+		{
+			return 0;
+		}
 
-	if(characterSkillExists(character_id, skill_name) == false)
-	{
-		return 0;
+		if(characterSkillExists(character_id, skill_name) == false)
+		{
+			return 0;
+		}
 	}
-#endif
 
-	const Yars::Skill& skill = characterSkill(character_id, skill_name);
+	return modifierCacheCalculate(character_id, skill_name);
+}
+
 
-	if(skill.level.value == 0)
+/**
+ * \ingroup group_Calculations
+ *
+ * \brief Calculate the Attribute modifier of a Skill.
+ *
+ * The same as calculateModifier() but the Skill name is a Name that was 
+ * hashed at compile-time.
+ *
+ * \example
+ * float modifier = yars.calculateModifier(bubba, "Skill"_yars);
+ * \endexample
+ *
+ * \return The modifier
+ */
+float Yars::calculateModifier(const Yars::Id character_id ///< The Character Id
+	, const Yars::Name& skill_name ///< The Skill
+	) const noexcept
+{
+	if(safeMode())
 	{
-		return 0;
+		if(characterSkillExists(character_id, skill_name) == false)
+		{
+			return 0;
+		}
 	}
 
-	float contribution_total = 0;
-
-	for(const auto& iter : skill.attribute_contribution)
-	{
-		//const std::string& name  = iter.first;
-		const int32_t&       value = iter.second;
+	return modifierCacheCalculate(character_id, skill_name);
+}
 
-		contribution_total += value;
-	}
 
-	if(contribution_total == 0)
+/**
+ * \brief Calculate the Attribute modifier of a Character's Skill.
+ *
+ * \return The modifier
+ */
+float Yars::calculateModifierSkill(const Yars::Id character_id ///< The Character Id
+	, const Yars::Skill& skill ///< The Character's Skill
+	) const noexcept
+{
+	if(skill.level.value == 0)
 	{
 		return 0;
 	}
 
+	Yars::SkillWeight        stale;
+	const Yars::SkillWeight& skill_weight = Yars::skillWeight(skill, stale);
+
 	const Yars::MapStringAttribute& attribute = characterAttributeMap(character_id);
 	float modifier = 0;
 
-	for(const auto& iter : skill.attribute_contribution)
+	for(size_t index = 0; index < skill_weight.attribute.size(); index++)
 	{
-		const std::string& name  = iter.first;
-		const int32_t&     value = iter.second;
-
-		const float ratio  = value / contribution_total;
-		const float amount = ratio * attribute.at(name).level.value;
+		const std::string& name = skill_weight.attribute[index];
 
-		modifier += amount;
+		modifier += skill_weight.weight[index] * attribute.at(name).level.value;
 	}
 
 	return modifier / skill.level.value;
 }
 
 
+/**
+ * \brief Calculate the Attribute modifier of a Character's Skill.
+ *
+ * The Skill has already been found, so it will only be looked up again if 
+ * the Character's \ref group_CharacterModifierCache "Modifier Cache" is 
+ * enabled.
+ *
+ * \return The modifier
+ */
+float Yars::calculateModifierSkill(const Yars::Id character_id ///< The Character Id
+	, const std::string& skill_name ///< The Skill name
+	, const Yars::Skill& skill      ///< The Character's Skill
+	) const noexcept
+{
+	if(modifier_cache.empty() == false && modifier_cache.contains(character_id))
+	{
+		return modifierCacheCalculate(character_id, skill_name);
+	}
+
+	return calculateModifierSkill(character_id, skill);
+}
+
+
 /**
  * \ingroup group_Calculations
  *
@@ -8230,6 +19886,8 @@ float Yars::calculateModifier(const Yars::Id character_id ///< The Character Id
  * probablity the result is "pass", otherwise it is "fail".  This translates to 
  * _above the line is success, below the line is failure._
  *
+ * The math that is used depends on Yars::Config::math, see Yars::Math.
+ *
  * \example
  * Yars yars;
  *
@@ -8241,6 +19899,28 @@ float Yars::calculateModifier(const Yars::Id character_id ///< The Character Id
 float Yars::calculateProbability(const float ratio ///< The difficulty ratio
 	) const noexcept
 {
+	switch(yars_config.math)
+	{
+		case Yars::Math::Table:
+			if(std::isnan(ratio))
+			{
+				return ratio;
+			}
+
+			return fixedToFloat(tableProbability(fixedFromFloat(ratio)));
+
+		case Yars::Math::Fixed:
+			if(std::isnan(ratio))
+			{
+				return ratio;
+			}
+
+			return fixedToFloat(fixedProbability(fixedFromFloat(ratio)));
+
+		case Yars::Math::Float:
+			break;
+	}
+
 	const float probability = (ratio
 		+ (ratio * ratio * ratio)
 		+ (ratio * ratio * ratio * ratio * ratio)
@@ -8300,6 +19980,323 @@ Yars::Result Yars::difficultyToResult(const float difficulty ///< The difficulty
 	return Yars::Result::Chance;
 }
 
+// }}}
+// {{{ Prepared Action
+
+/**
+ * \defgroup group_PreparedAction Prepared Action
+ *
+ * \brief Do the same thing many times.
+ *
+ * Attacking another Character requires several steps: checking that the 
+ * Item is usable, selecting the Skill, creating and initializing an Affect, 
+ * and having the defender try to defend against it.  Each of those steps 
+ * looks up the same Character, Item, and Skill again and, in safe mode, 
+ * validates them again.
+ *
+ * A Prepared Action does all of that work once.  Yars::actionPrepare() 
+ * validates the attacker, the Item, and the attacker's Skill, then keeps a 
+ * copy of the Item and a pointer to the attacker's Skill.  After that, 
+ * Yars::actionExecute() can be called as often as needed, only looking up 
+ * the defender.
+ *
+ * The defense Skill set is the Item's Yars::Item::skill_defender list.  The 
+ * defender will use the Skill from that list with the highest Level.
+ *
+ * Generation counters are used to detect when a Prepared Action is no longer 
+ * valid:
+ * - If the attacker is deleted or no longer has the Item, the Prepared 
+ *   Action must be prepared again.
+ * - If any Character's Skills are added or removed, the pointer to the 
+ *   attacker's Skill is found again automatically.  This includes Skills 
+ *   that are added by Yars::characterSkill() and 
+ *   Yars::characterSkillIncrease() when safe mode is not enabled.
+ *
+ * \example
+ * Yars::PreparedAction attack;
+ * yars.actionPrepare(attack, bubba, "Sword");
+ *
+ * for(const Yars::Id billybob : enemy_list)
+ * {
+ * 	Yars::Id affect_id;
+ * 	if(yars.actionExecute(attack, billybob, affect_id))
+ * 	{
+ * 		// Billybob has been hit
+ * 	}
+ * }
+ * \endexample
+ */
+
+/**
+ * \struct Yars::PreparedAction
+ *
+ * \brief The resolved data of an action.
+ *
+ * The data is filled in by Yars::actionPrepare() and should not be changed.
+ */
+
+/**
+ * \var Yars::PreparedAction::attacker
+ *
+ * \brief The attacking Character.
+ */
+
+/**
+ * \var Yars::PreparedAction::item
+ *
+ * \brief A copy of the Item that is used.
+ */
+
+/**
+ * \var Yars::PreparedAction::skill_name
+ *
+ * \brief The name of the attacker's Skill.
+ */
+
+/**
+ * \var Yars::PreparedAction::skill
+ *
+ * \brief The attacker's Skill.
+ */
+
+/**
+ * \var Yars::PreparedAction::character_generation
+ *
+ * \brief The generation of the attacker when the action was prepared.
+ */
+
+/**
+ * \var Yars::PreparedAction::skill_generation
+ *
+ * \brief The generation of the Skill storage when the Skill was found.
+ */
+
+/**
+ * \typedef Yars::MapIdGeneration
+ *
+ * \brief A generation counter for each Id.
+ */
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_PreparedAction
+ *
+ * \brief Execute a Prepared Action.
+ *
+ * The attacker will use the Item against the \p defender_id, exactly as if 
+ * the following had been done:
+ * - Yars::affectCreate()
+ * - Yars::affectInit()
+ * - Yars::characterAffectDefend() using the defender's best defense Skill
+ *
+ * If the Affect was applied to the defender, \p affect_id will be set to the 
+ * Affect.  Otherwise the Affect is deleted.
+ *
+ * \example
+ * Yars::PreparedAction attack;
+ * yars.actionPrepare(attack, bubba, "Sword", "Sword.Swing");
+ *
+ * Yars::Id affect_id;
+ * if(yars.actionExecute(attack, billybob, affect_id))
+ * {
+ * 	// Billybob has been hit
+ * }
+ * \endexample
+ *
+ * \retval true  The Affect was applied to the defender
+ * \retval false The Affect was not applied
+ */
+bool Yars::actionExecute(Yars::PreparedAction& action ///< The Prepared Action
+	, const Yars::Id defender_id ///< The Defending Character
+	, Yars::Id&      affect_id   ///< The Affect that was applied
+	, const int32_t  adjustment  ///< Weaker <--> Stronger
+	) noexcept
+{
+	if(actionIsValid(action) == false)
+	{
+		return false;
+	}
+
+	if(safeMode())
+	{
+		if(characterExists(defender_id) == false)
+		{
+			return false;
+		}
+	}
+
+	if(action.skill_generation != action_skill_generation)
+	{
+		const Yars::MapStringSkill& skill_map = character_skill.at(action.attacker);
+		const auto                  iter      = skill_map.find(action.skill_name);
+
+		if(iter == std::end(skill_map))
+		{
+			action.character_generation = 0;
+
+			return false;
+		}
+
+		action.skill            = &iter->second;
+		action.skill_generation = action_skill_generation;
+	}
+
+	characterLayerSync(action.attacker);
+
+	affect_id = affectCreate();
+
+	if(affectInitSkill(affect_id
+		, action.attacker
+		, action.item
+		, action.skill_name
+		, *action.skill
+		, adjustment
+		) == false)
+	{
+		affectDelete(affect_id);
+
+		return false;
+	}
+
+	const std::string* skill_name = nullptr;
+	const Yars::Skill* skill      = characterSkillBest(defender_id
+		, action.item.skill_defender
+		, skill_name
+		);
+
+	if(characterAffectDefendSkill(defender_id
+		, affect_id
+		, (skill_name == nullptr) ? std::string() : *skill_name
+		, skill
+		) == false)
+	{
+		affectDelete(affect_id);
+
+		return false;
+	}
+
+	return true;
+}
+
+
+/**
+ * \ingroup group_PreparedAction
+ *
+ * \brief Check if a Prepared Action is valid.
+ *
+ * A Prepared Action is no longer valid when the attacker is deleted, no 
+ * longer has the Item, or has lost the Skill.
+ *
+ * \example
+ * if(yars.actionIsValid(attack) == false)
+ * {
+ * 	yars.actionPrepare(attack, bubba, "Sword");
+ * }
+ * \endexample
+ *
+ * \retval true  The Prepared Action is valid
+ * \retval false The Prepared Action must be prepared again
+ */
+bool Yars::actionIsValid(const Yars::PreparedAction& action ///< The Prepared Action
+	) const noexcept
+{
+	if(action.character_generation == 0)
+	{
+		return false;
+	}
+
+	const auto iter = action_character_generation.find(action.attacker);
+
+	if(iter == std::end(action_character_generation))
+	{
+		return false;
+	}
+
+	return (iter->second == action.character_generation);
+}
+
+
+/**
+ * \todo{DebugMessage} Add debugging messages
+ * \todo{ErrorCode}    Return an error code instead of a boolean
+ *
+ * \ingroup group_PreparedAction
+ *
+ * \brief Prepare an action.
+ *
+ * The attacker, the Item, and the Skill are validated, even if safe mode is 
+ * not enabled.  If \p skill_name is empty, the Skill will be selected by 
+ * Yars::characterItemSkillAttacker().
+ *
+ * \example
+ * Yars::PreparedAction attack;
+ * if(yars.actionPrepare(attack, bubba, "Sword") == false)
+ * {
+ * 	std::cout << "Bubba can not use the Sword\n";
+ * }
+ * \endexample
+ *
+ * \retval true  The action was prepared
+ * \retval false Failed to prepare the action
+ */
+bool Yars::actionPrepare(Yars::PreparedAction& action ///< The Prepared Action
+	, const Yars::Id     character_id ///< The Attacking Character
+	, const std::string& item_name    ///< The Item
+	, const std::string& skill_name   ///< The Skill
+	) noexcept
+{
+	action = {};
+
+	if(characterExists(character_id) == false)
+	{
+		return false;
+	}
+
+	if(characterItemExists(character_id, item_name) == false)
+	{
+		return false;
+	}
+
+	const std::string name = skill_name.empty()
+		? characterItemSkillAttacker(character_id, item_name)
+		: skill_name
+		;
+
+	if(characterItemIsUsableByAttacker(character_id, item_name, name) == false)
+	{
+		return false;
+	}
+
+	const Yars::MapStringSkill& skill_map = character_skill.at(character_id);
+	const auto                  iter      = skill_map.find(name);
+
+	if(iter == std::end(skill_map))
+	{
+		return false;
+	}
+
+	action.attacker             = character_id;
+	action.item                 = std::as_const(*this).characterItem(character_id, item_name);
+	action.skill_name           = name;
+	action.skill                = &iter->second;
+	action.character_generation = action_character_generation.at(character_id);
+	action.skill_generation     = action_skill_generation;
+
+	return true;
+}
+
+
+/**
+ * \brief Invalidate a Character's Prepared Actions.
+ */
+void Yars::actionCharacterChanged(const Yars::Id character_id ///< The Character Id
+	) noexcept
+{
+	action_character_generation[character_id] = ++action_generation;
+}
+
 // }}}
 
 };
@@ -0,0 +1,251 @@
+/*
+g++ -std=c++2a -DCATCH_CONFIG_MAIN -Wall -Werror -o Action Action.cpp && ./Action
+ */
+
+#ifdef CATCH_CONFIG_MAIN
+#define ZAKERO_YARS_IMPLEMENTATION
+#define ZAKERO_YARS_ENABLE_DEBUG
+#define ZAKERO_YARS_ENABLE_ID_SHUFFLE
+#define ZAKERO_YARS_ENABLE_SAFE_MODE
+#endif
+
+#include "../src/Zakero_Yars.h"
+#include "catch.hpp"
+
+using namespace zakero;
+
+namespace
+{
+	const std::string Skill_Sword  = "Sword.Swing";
+	const std::string Skill_Shield = "Shield.Block";
+	const std::string Skill_Dodge  = "Movement.Dodge";
+	const std::string Item_Sword   = "Sword";
+
+	void setup(Yars& yars
+		, Yars::Id&  attacker
+		, Yars::Id&  defender
+		)
+	{
+		yars.skillAdd(Skill_Sword,  {});
+		yars.skillAdd(Skill_Shield, {});
+		yars.skillAdd(Skill_Dodge,  {});
+
+		yars.itemAdd(Item_Sword,
+			{	.skill_attacker        = { Skill_Sword }
+			,	.skill_defender        = { Skill_Shield, Skill_Dodge }
+			,	.affect_health_current = -1
+			});
+
+		attacker = yars.characterCreate();
+		yars.characterSkillAdd(attacker, Skill_Sword);
+		yars.levelSet(yars.characterSkill(attacker, Skill_Sword).level, 10);
+		yars.characterItemAdd(attacker, Item_Sword);
+
+		defender = yars.characterCreate();
+		yars.characterSkillAdd(defender, Skill_Shield);
+		yars.characterSkillAdd(defender, Skill_Dodge);
+		yars.levelSet(yars.characterSkill(defender, Skill_Shield).level,  8);
+		yars.levelSet(yars.characterSkill(defender, Skill_Dodge).level,  12);
+	}
+}
+
+
+TEST_CASE("Action.Prepare", "[action]")
+{
+	Yars yars;
+	Yars::Id attacker = 0;
+	Yars::Id defender = 0;
+
+	setup(yars, attacker, defender);
+
+	Yars::PreparedAction action;
+
+	SECTION("Invalid Character")
+	{
+		REQUIRE(yars.actionPrepare(action, 1234, Item_Sword) == false);
+		REQUIRE(yars.actionIsValid(action) == false);
+	}
+
+	SECTION("Invalid Item")
+	{
+		REQUIRE(yars.actionPrepare(action, defender, Item_Sword) == false);
+		REQUIRE(yars.actionIsValid(action) == false);
+	}
+
+	SECTION("Invalid Skill")
+	{
+		REQUIRE(yars.actionPrepare(action, attacker, Item_Sword, Skill_Shield) == false);
+		REQUIRE(yars.actionIsValid(action) == false);
+	}
+
+	SECTION("Select Skill")
+	{
+		REQUIRE(yars.actionPrepare(action, attacker, Item_Sword));
+		REQUIRE(yars.actionIsValid(action));
+		REQUIRE(action.attacker   == attacker);
+		REQUIRE(action.skill_name == Skill_Sword);
+		REQUIRE(action.item       == yars.item(Item_Sword));
+	}
+}
+
+
+TEST_CASE("Action.Execute", "[action]")
+{
+	std::mt19937 mt_prepared(1234);
+	std::mt19937 mt_manual(1234);
+
+	Yars prepared(mt_prepared, Yars::Config{ .safe_mode = true });
+	Yars manual(mt_manual,     Yars::Config{ .safe_mode = true });
+
+	Yars::Id attacker = 0;
+	Yars::Id defender = 0;
+
+	setup(prepared, attacker, defender);
+	setup(manual,   attacker, defender);
+
+	Yars::PreparedAction action;
+	REQUIRE(prepared.actionPrepare(action, attacker, Item_Sword));
+
+	SECTION("Same As Manual")
+	{
+		size_t applied = 0;
+
+		for(size_t i = 0; i < 200; i++)
+		{
+			Yars::Id affect_id  = 0;
+			bool prepared_result = prepared.actionExecute(action, defender, affect_id);
+
+			bool manual_result = false;
+			Yars::Id manual_id = manual.affectCreate();
+
+			if(manual.affectInit(manual_id, attacker, manual.characterItem(attacker, Item_Sword), Skill_Sword))
+			{
+				const std::string& best = (manual.characterSkill(defender, Skill_Shield).level.value
+					>= manual.characterSkill(defender, Skill_Dodge).level.value)
+					? Skill_Shield
+					: Skill_Dodge
+					;
+
+				manual_result = manual.characterAffectDefend(defender, manual_id, best);
+			}
+
+			if(manual_result == false)
+			{
+				manual.affectDelete(manual_id);
+			}
+
+			REQUIRE(prepared_result == manual_result);
+
+			if(prepared_result)
+			{
+				REQUIRE(prepared.characterAffectExists(defender, affect_id));
+				applied++;
+			}
+		}
+
+		REQUIRE(applied > 0);
+
+		for(const std::string& name : { Skill_Sword })
+		{
+			const Yars::Level& a = prepared.characterSkill(attacker, name).level;
+			const Yars::Level& b = manual.characterSkill(attacker, name).level;
+
+			REQUIRE(a.value   == b.value);
+			REQUIRE(a.partial == b.partial);
+		}
+
+		for(const std::string& name : { Skill_Shield, Skill_Dodge })
+		{
+			const Yars::Level& a = prepared.characterSkill(defender, name).level;
+			const Yars::Level& b = manual.characterSkill(defender, name).level;
+
+			REQUIRE(a.value   == b.value);
+			REQUIRE(a.partial == b.partial);
+		}
+	}
+
+	SECTION("Skill Storage Changed")
+	{
+		Yars::Id other = prepared.characterCreate();
+		prepared.characterSkillAdd(other, Skill_Dodge);
+
+		prepared.characterSkillAdd(attacker, Skill_Dodge);
+		prepared.levelSet(prepared.characterSkill(attacker, Skill_Sword).level, 1000);
+
+		Yars::Id affect_id = 0;
+		REQUIRE(prepared.actionIsValid(action));
+		REQUIRE(prepared.actionExecute(action, defender, affect_id, 600));
+		REQUIRE(action.skill == &prepared.characterSkill(attacker, Skill_Sword));
+	}
+
+	SECTION("Skill Storage Grown")
+	{
+		Yars unsafe(Yars::Config{ .safe_mode = false });
+		setup(unsafe, attacker, defender);
+
+		REQUIRE(unsafe.actionPrepare(action, attacker, Item_Sword));
+
+		// Going past 8 Skills moves all of them to new storage
+		for(int i = 0; i < 8; i++)
+		{
+			unsafe.characterSkill(attacker, "Extra." + std::to_string(i));
+		}
+
+		unsafe.characterSkillIncrease(attacker, "Extra.Increase", 1.0f);
+
+		Yars::Id affect_id = 0;
+		REQUIRE(unsafe.actionIsValid(action));
+		unsafe.actionExecute(action, defender, affect_id);
+		REQUIRE(action.skill == &unsafe.characterSkill(attacker, Skill_Sword));
+		REQUIRE(action.skill->level.value == 10);
+	}
+
+	SECTION("Skill Removed")
+	{
+		prepared.characterSkillRemove(attacker, Skill_Sword);
+
+		Yars::Id affect_id = 0;
+		REQUIRE(prepared.actionExecute(action, defender, affect_id) == false);
+		REQUIRE(prepared.actionIsValid(action) == false);
+	}
+
+	SECTION("Item Removed")
+	{
+		prepared.characterItemRemove(attacker, Item_Sword);
+		REQUIRE(prepared.actionIsValid(action) == false);
+	}
+
+	SECTION("Item Taken")
+	{
+		prepared.characterItemTake(attacker, Item_Sword);
+
+		Yars::Id affect_id = 0;
+		REQUIRE(prepared.actionIsValid(action) == false);
+		REQUIRE(prepared.actionExecute(action, defender, affect_id) == false);
+	}
+
+	SECTION("Item Equipped")
+	{
+		REQUIRE(prepared.characterEquipmentAdd(attacker, "Hand", Item_Sword));
+
+		Yars::Id affect_id = 0;
+		REQUIRE(prepared.actionIsValid(action) == false);
+		REQUIRE(prepared.actionExecute(action, defender, affect_id) == false);
+	}
+
+	SECTION("Character Deleted")
+	{
+		prepared.characterDelete(attacker);
+		REQUIRE(prepared.actionIsValid(action) == false);
+
+		Yars::Id character_id = prepared.characterCreate();
+		REQUIRE(character_id == attacker);
+		REQUIRE(prepared.actionIsValid(action) == false);
+	}
+
+	SECTION("Invalid Defender")
+	{
+		Yars::Id affect_id = 0;
+		REQUIRE(prepared.actionExecute(action, 1234, affect_id) == false);
+	}
+}
@@ -0,0 +1,347 @@
+/*
+g++ -std=c++2a -DCATCH_CONFIG_MAIN -Wall -Werror -o Archetype Archetype.cpp && ./Archetype
+ */
+
+#ifdef CATCH_CONFIG_MAIN
+#define ZAKERO_YARS_IMPLEMENTATION
+#define ZAKERO_YARS_ENABLE_DEBUG
+#define ZAKERO_YARS_ENABLE_ID_SHUFFLE
+#define ZAKERO_YARS_ENABLE_SAFE_MODE
+#endif
+
+#include "../src/Zakero_Yars.h"
+#include "catch.hpp"
+
+using namespace zakero;
+
+namespace
+{
+	const std::string Archetype_Goblin = "Goblin";
+	const std::string Attr_Strength    = "Strength";
+	const std::string Skill_Club       = "Club";
+	const std::string Item_Club        = "Club";
+	const std::string Item_Helmet      = "Helmet";
+	const std::string Data_Name        = "Name";
+
+	Yars::Id setup(Yars& yars)
+	{
+		yars.skillAdd(Skill_Club,
+			{	.attribute_contribution = { { Attr_Strength, 1 } }
+			});
+
+		yars.itemAdd(Item_Club,
+			{	.skill_attacker        = { Skill_Club }
+			,	.affect_health_current = -2
+			});
+
+		yars.itemAdd(Item_Helmet,
+			{	.modify_skill          = { { Skill_Club, 1 } }
+			,	.skill_defender        = { Skill_Club }
+			,	.modify_health_maximum = 5
+			});
+
+		Yars::Id goblin = yars.characterCreate();
+
+		yars.characterHealth(goblin) = { .current = 10, .maximum = 10 };
+		yars.characterSkillAdd(goblin, Skill_Club);
+		yars.levelSet(yars.characterSkill(goblin, Skill_Club).level, 3);
+		yars.characterItemAdd(goblin, Item_Club, 2);
+		yars.characterItemAdd(goblin, Item_Helmet);
+		yars.characterEquipmentAdd(goblin, "Head", Item_Helmet);
+		yars.characterDataSet(goblin, Data_Name, std::string("Grub"));
+		yars.characterLedgerEnable(goblin);
+
+		return goblin;
+	}
+}
+
+
+TEST_CASE("Archetype.Add", "[archetype]")
+{
+	Yars yars;
+
+	Yars::Id goblin = setup(yars);
+
+	SECTION("Invalid")
+	{
+		REQUIRE(yars.archetypeAdd("", goblin) == false);
+		REQUIRE(yars.archetypeAdd(Archetype_Goblin, 1234) == false);
+	}
+
+	SECTION("Has Affects")
+	{
+		Yars::Id affect_id = yars.affectCreate();
+		yars.characterAffectApply(goblin, affect_id);
+
+		REQUIRE(yars.archetypeAdd(Archetype_Goblin, goblin) == false);
+	}
+
+	SECTION("Add And Remove")
+	{
+		REQUIRE(yars.archetypeAdd(Archetype_Goblin, goblin));
+		REQUIRE(yars.archetypeAdd(Archetype_Goblin, goblin) == false);
+		REQUIRE(yars.archetypeExists(Archetype_Goblin));
+		REQUIRE(yars.archetypeList() == Yars::VectorString{ Archetype_Goblin });
+
+		REQUIRE(yars.archetypeRemove(Archetype_Goblin));
+		REQUIRE(yars.archetypeRemove(Archetype_Goblin) == false);
+		REQUIRE(yars.archetypeExists(Archetype_Goblin) == false);
+	}
+}
+
+
+TEST_CASE("Archetype.Spawn", "[archetype][character]")
+{
+	Yars yars;
+
+	Yars::Id goblin = setup(yars);
+	yars.archetypeAdd(Archetype_Goblin, goblin);
+
+	Yars::VectorId wave;
+
+	SECTION("Invalid Archetype")
+	{
+		REQUIRE(yars.characterSpawn("Orc", 10, wave) == false);
+		REQUIRE(wave.empty() == true);
+	}
+
+	SECTION("Same As Archetype")
+	{
+		REQUIRE(yars.characterSpawn(Archetype_Goblin, 100, wave));
+		REQUIRE(wave.size() == 100);
+
+		for(const Yars::Id id : wave)
+		{
+			REQUIRE(id != goblin);
+			REQUIRE(yars.characterExists(id));
+			REQUIRE(yars.characterHealth(id).maximum == yars.characterHealth(goblin).maximum);
+			REQUIRE(yars.characterSkill(id, Skill_Club).level.value == 4);
+			REQUIRE(yars.characterAttributeExists(id, Attr_Strength));
+			REQUIRE(yars.characterItemCount(id, Item_Club) == 2);
+			REQUIRE(yars.characterEquipmentName(id, "Head") == Item_Helmet);
+			REQUIRE(yars.characterItemIsUsableByAttacker(id, Item_Club));
+			REQUIRE(yars.characterLedgerIsEnabled(id));
+			REQUIRE(yars.characterLedgerSkill(id, Skill_Club) == 1);
+
+			std::string name;
+			REQUIRE(yars.characterDataGet(id, Data_Name, name));
+			REQUIRE(name == "Grub");
+		}
+	}
+
+	SECTION("Independent")
+	{
+		yars.characterSpawn(Archetype_Goblin, 2, wave);
+
+		yars.characterSkillRemove(wave[0], Skill_Club);
+		yars.characterItemRemove(wave[0], Item_Club, 2);
+
+		REQUIRE(yars.characterSkillExists(wave[1], Skill_Club));
+		REQUIRE(yars.characterItemCount(wave[1], Item_Club) == 2);
+		REQUIRE(yars.characterItemIsUsableByAttacker(wave[0], yars.item(Item_Club)) == false);
+		REQUIRE(yars.characterItemIsUsableByAttacker(wave[1], yars.item(Item_Club)) == true);
+
+		yars.archetypeRemove(Archetype_Goblin);
+
+		REQUIRE(yars.characterSkillExists(wave[1], Skill_Club));
+	}
+
+	SECTION("Shared")
+	{
+		yars.characterSpawn(Archetype_Goblin, 2, wave);
+
+		const Yars& y = yars;
+
+		REQUIRE(yars.characterIsShared(wave[0]));
+		REQUIRE(yars.characterIsShared(wave[1]));
+		REQUIRE(yars.characterIsShared(goblin) == false);
+
+		// Reading does not copy
+		REQUIRE(y.characterSkill(wave[0], Skill_Club).level.value == 4);
+		REQUIRE(y.characterAttributeExists(wave[0], Attr_Strength));
+		REQUIRE(yars.characterItemCount(wave[0], Item_Club) == 2);
+		REQUIRE(yars.characterEquipmentName(wave[0], "Head") == Item_Helmet);
+		REQUIRE(yars.characterIsShared(wave[0]));
+
+		// Writing copies only the Character that was changed
+		yars.levelSet(yars.characterSkill(wave[0], Skill_Club).level, 10);
+		yars.characterAttribute(wave[0], Attr_Strength);
+		yars.characterItemAdd(wave[0], Item_Club);
+		yars.characterEquipmentRemove(wave[0], "Head");
+		yars.characterDataSet(wave[0], Data_Name, std::string("Snik"));
+
+		REQUIRE(yars.characterIsShared(wave[0]) == false);
+		REQUIRE(yars.characterIsShared(wave[1]));
+
+		REQUIRE(y.characterSkill(wave[0], Skill_Club).level.value != 4);
+		REQUIRE(yars.characterItemCount(wave[0], Item_Club) == 3);
+		REQUIRE(yars.characterEquipmentExists(wave[0], "Head") == false);
+
+		std::string name;
+		REQUIRE(yars.characterDataGet(wave[0], Data_Name, name));
+		REQUIRE(name == "Snik");
+
+		REQUIRE(y.characterSkill(wave[1], Skill_Club).level.value == 4);
+		REQUIRE(yars.characterItemCount(wave[1], Item_Club) == 2);
+		REQUIRE(yars.characterEquipmentName(wave[1], "Head") == Item_Helmet);
+		REQUIRE(yars.characterDataGet(wave[1], Data_Name, name));
+		REQUIRE(name == "Grub");
+
+		// The last Character to use the data owns it
+		yars.archetypeRemove(Archetype_Goblin);
+
+		REQUIRE(yars.characterIsShared(wave[1]) == false);
+		REQUIRE(yars.characterItemCount(wave[1], Item_Club) == 2);
+	}
+
+	SECTION("Reuse Deleted Ids")
+	{
+		Yars::Id deleted = yars.characterCreate();
+		Yars::Id affect_id = yars.affectCreate();
+		yars.characterAffectApply(deleted, affect_id);
+		yars.characterDelete(deleted);
+
+		wave.push_back(goblin);
+
+		yars.characterSpawn(Archetype_Goblin, 3, wave);
+
+		REQUIRE(wave.size() == 4);
+		REQUIRE(wave[0] == goblin);
+		REQUIRE(Yars::vectorContains(wave, deleted));
+		REQUIRE(yars.characterAffectList(deleted).empty() == true);
+		REQUIRE(yars.characterSkill(deleted, Skill_Club).level.value == 4);
+	}
+
+	SECTION("Layer")
+	{
+		yars.layerAdd("Night", { .modify_skill = { { Skill_Club, 2 } } });
+		yars.characterLayerAdd(goblin, "Night");
+		yars.archetypeAdd("Night Goblin", goblin);
+
+		yars.characterSpawn("Night Goblin", 1, wave);
+
+		REQUIRE(yars.characterLayerExists(wave[0], "Night"));
+		REQUIRE(yars.characterSkill(wave[0], Skill_Club).level.value == 6);
+
+		yars.layerRemove("Night");
+
+		REQUIRE(yars.characterSkill(wave[0], Skill_Club).level.value == 4);
+	}
+}
+
+
+TEST_CASE("Archetype.Clone", "[archetype][character]")
+{
+	Yars yars;
+
+	Yars::Id goblin = setup(yars);
+
+	SECTION("Invalid")
+	{
+		Yars::Id clone_id = 0;
+		REQUIRE(yars.characterClone(1234, clone_id) == false);
+	}
+
+	SECTION("Clone")
+	{
+		Yars::Id affect_id = yars.affectCreate();
+		yars.affect(affect_id).modify_skill[Skill_Club] = 2;
+		yars.characterAffectApply(goblin, affect_id);
+
+		Yars::Id clone_id = 0;
+		REQUIRE(yars.characterClone(goblin, clone_id));
+		REQUIRE(clone_id != goblin);
+
+		REQUIRE(yars.characterSkill(clone_id, Skill_Club).level.value == 6);
+		REQUIRE(yars.characterAffectExists(clone_id, affect_id));
+		REQUIRE(yars.characterLedgerSkill(clone_id, Skill_Club) == 3);
+		REQUIRE(yars.characterItemCount(clone_id, Item_Club) == 2);
+
+		yars.characterAffectRevert(clone_id, affect_id);
+
+		REQUIRE(yars.characterSkill(clone_id, Skill_Club).level.value == 4);
+		REQUIRE(yars.characterSkill(goblin, Skill_Club).level.value   == 6);
+	}
+}
+
+
+TEST_CASE("Archetype.Export", "[archetype][character]")
+{
+	Yars world;
+	Yars dungeon;
+
+	// Different Skill Handles in each instance
+	dungeon.skillAdd("Other", {});
+	dungeon.skillAdd(Skill_Club, {});
+	dungeon.layerAdd("Darkness",
+		{	.modify_skill = { { Skill_Club, -1 } }
+		,	.is_global    = true
+		});
+
+	Yars::Id goblin = setup(world);
+	world.layerAdd("Daylight",
+		{	.modify_skill = { { Skill_Club, 5 } }
+		,	.is_global    = true
+		});
+
+	REQUIRE(world.characterSkill(goblin, Skill_Club).level.value == 9);
+
+	Yars::Archetype data;
+
+	SECTION("Has Affects")
+	{
+		Yars::Id affect_id = world.affectCreate();
+		world.characterAffectApply(goblin, affect_id);
+
+		REQUIRE(world.characterExport(goblin, data) == false);
+	}
+
+	SECTION("Import")
+	{
+		REQUIRE(world.characterExport(goblin, data));
+
+		Yars::Id id = 1234;
+		REQUIRE(dungeon.characterImport(data, id));
+		REQUIRE(dungeon.characterExists(id));
+
+		REQUIRE(dungeon.characterSkill(id, Skill_Club).level.value == 3);
+		REQUIRE(dungeon.characterLedgerSkill(id, Skill_Club) == 1);
+		REQUIRE(dungeon.characterItemIsUsableByAttacker(id, dungeon.characterItem(id, Item_Club)));
+		REQUIRE(dungeon.characterItemListUsableByAttacker(id) == Yars::VectorString{ Item_Club });
+
+		dungeon.characterSkillAdd(id, "Other");
+
+		REQUIRE(dungeon.characterItemListUsableByAttacker(id) == Yars::VectorString{ Item_Club });
+	}
+
+	SECTION("Data")
+	{
+		dungeon.characterDataSet(dungeon.characterCreate(), "Other", 1);
+		world.characterDataSet(goblin, "Angry", true);
+
+		REQUIRE(world.characterExport(goblin, data));
+
+		Yars::Id id = 1234;
+		REQUIRE(dungeon.characterImport(data, id));
+
+		std::string name;
+		bool        angry = false;
+		int32_t     other = 0;
+
+		REQUIRE(dungeon.characterDataGet(id, Data_Name, name));
+		REQUIRE(name == "Grub");
+		REQUIRE(dungeon.characterDataGet(id, "Angry", angry));
+		REQUIRE(angry == true);
+		REQUIRE(dungeon.characterDataGet(id, "Other", other) == false);
+	}
+
+	SECTION("Data Without Names")
+	{
+		REQUIRE(world.characterExport(goblin, data));
+
+		data.data_name.clear();
+
+		Yars::Id id = 1234;
+		REQUIRE(dungeon.characterImport(data, id) == false);
+	}
+}
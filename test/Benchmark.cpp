@@ -0,0 +1,1281 @@
+/*
+g++ -std=c++2a -O2 -DCATCH_CONFIG_MAIN -Wall -Werror -o Benchmark Benchmark.cpp && ./Benchmark
+ */
+
+#ifdef CATCH_CONFIG_MAIN
+#define ZAKERO_YARS_IMPLEMENTATION
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#endif
+
+#include "../src/Zakero_Yars.h"
+#include "catch.hpp"
+
+// Benchmarks are only built when this file is compiled on its own.
+#if defined (CATCH_CONFIG_ENABLE_BENCHMARKING)
+
+using namespace zakero;
+
+namespace
+{
+	const size_t Skill_Count = 12;
+	const size_t Small_Count = 6;
+	const size_t Data_Count  = 8;
+	const size_t Item_Count  = 256;
+
+	Yars::VectorString nameList(const std::string& prefix
+		, const size_t count
+		) noexcept
+	{
+		Yars::VectorString list;
+
+		for(size_t i = 0; i < count; i++)
+		{
+			list.push_back(prefix + " " + std::to_string(i));
+		}
+
+		return list;
+	}
+
+	template <typename Map>
+	size_t memoryNode(const Map& map) noexcept
+	{
+		// Each node holds the value, a next pointer, and a cached hash
+		return (map.bucket_count() * sizeof(void*))
+			+ (map.size() * (sizeof(typename Map::value_type) + (2 * sizeof(void*))))
+			;
+	}
+
+	template <typename Map>
+	size_t memoryFlat(const Map& map) noexcept
+	{
+		return map.capacity() * (sizeof(typename Map::value_type) + 1);
+	}
+}
+
+
+TEST_CASE("Benchmark.Map.Lookup", "[benchmark]")
+{
+	const Yars::VectorString skill_list = nameList("Skill", Skill_Count);
+
+	std::unordered_map<std::string, Yars::Skill> node_map;
+	Yars::FlatMap<std::string, Yars::Skill>      flat_map;
+
+	for(const std::string& name : skill_list)
+	{
+		node_map[name] = {};
+		flat_map[name] = {};
+	}
+
+	BENCHMARK("std::unordered_map<std::string, Skill>::find")
+	{
+		size_t found = 0;
+
+		for(const std::string& name : skill_list)
+		{
+			found += (node_map.find(name) != std::end(node_map));
+		}
+
+		return found;
+	};
+
+	BENCHMARK("Yars::FlatMap<std::string, Skill>::find")
+	{
+		size_t found = 0;
+
+		for(const std::string& name : skill_list)
+		{
+			found += (flat_map.find(name) != std::end(flat_map));
+		}
+
+		return found;
+	};
+
+	Yars::FlatMap<std::string, Yars::Skill>   frozen_source = flat_map;
+	Yars::FrozenMap<std::string, Yars::Skill> frozen_map;
+
+	frozen_map.build(frozen_source);
+
+	BENCHMARK("Yars::FrozenMap<std::string, Skill>::find")
+	{
+		size_t found = 0;
+
+		for(const std::string& name : skill_list)
+		{
+			found += (frozen_map.find(name) != std::end(frozen_map));
+		}
+
+		return found;
+	};
+
+	const Yars::VectorString small_list = nameList("Skill", Small_Count);
+
+	Yars::FlatMap<std::string, Yars::Skill>     small_flat;
+	Yars::SmallMap<std::string, Yars::Skill, 8> small_map;
+
+	for(const std::string& name : small_list)
+	{
+		small_flat[name] = {};
+		small_map[name]  = {};
+	}
+
+	BENCHMARK("Yars::FlatMap<std::string, Skill>::find (" + std::to_string(Small_Count) + ")")
+	{
+		size_t found = 0;
+
+		for(const std::string& name : small_list)
+		{
+			found += (small_flat.find(name) != std::end(small_flat));
+		}
+
+		return found;
+	};
+
+	BENCHMARK("Yars::SmallMap<std::string, Skill, 8>::find (" + std::to_string(Small_Count) + ")")
+	{
+		size_t found = 0;
+
+		for(const std::string& name : small_list)
+		{
+			found += (small_map.find(name) != std::end(small_map));
+		}
+
+		return found;
+	};
+
+	BENCHMARK("Yars::FlatMap<std::string, Skill> copy (" + std::to_string(Small_Count) + ")")
+	{
+		return Yars::FlatMap<std::string, Yars::Skill>(small_flat).size();
+	};
+
+	BENCHMARK("Yars::SmallMap<std::string, Skill, 8> copy (" + std::to_string(Small_Count) + ")")
+	{
+		return Yars::SmallMap<std::string, Yars::Skill, 8>(small_map).size();
+	};
+
+	std::unordered_map<Yars::Id, Yars::Health> node_id;
+	Yars::FlatMap<Yars::Id, Yars::Health>      flat_id;
+	Yars::VectorId                             id_list;
+
+	for(Yars::Id id = 0; id < 4096; id++)
+	{
+		node_id[id] = {};
+		flat_id[id] = {};
+		id_list.push_back(id);
+	}
+
+	// Characters are rarely accessed in Id order
+	std::shuffle(std::begin(id_list), std::end(id_list), std::mt19937(0));
+
+	BENCHMARK("std::unordered_map<Id, Health>::find")
+	{
+		size_t found = 0;
+
+		for(const Yars::Id id : id_list)
+		{
+			found += (node_id.find(id) != std::end(node_id));
+		}
+
+		return found;
+	};
+
+	BENCHMARK("Yars::FlatMap<Id, Health>::find")
+	{
+		size_t found = 0;
+
+		for(const Yars::Id id : id_list)
+		{
+			found += (flat_id.find(id) != std::end(flat_id));
+		}
+
+		return found;
+	};
+
+	WARN("Memory (" << Skill_Count << " Skills): "
+		<< "std::unordered_map ~" << memoryNode(node_map) << " bytes in "
+		<< (node_map.size() + 1) << " allocations, "
+		<< "Yars::FlatMap " << memoryFlat(flat_map) << " bytes in 2 allocations"
+		);
+
+	WARN("Memory (4096 Health): "
+		<< "std::unordered_map ~" << memoryNode(node_id) << " bytes, "
+		<< "Yars::FlatMap " << memoryFlat(flat_id) << " bytes"
+		);
+}
+
+
+TEST_CASE("Benchmark.Yars.Lookup", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	const Yars::VectorString skill_list = nameList("Skill", Skill_Count);
+	const Yars::VectorString data_list  = nameList("Data",  Data_Count);
+	const Yars::VectorString item_list  = nameList("Item",  Item_Count);
+
+	for(const std::string& name : skill_list)
+	{
+		yars.skillAdd(name, {});
+	}
+
+	for(const std::string& name : item_list)
+	{
+		yars.itemAdd(name, {});
+	}
+
+	Yars::VectorId character_list;
+
+	for(size_t i = 0; i < 256; i++)
+	{
+		Yars::Id character_id = yars.characterCreate();
+
+		for(const std::string& name : skill_list)
+		{
+			yars.characterSkillAdd(character_id, name);
+		}
+
+		for(const std::string& name : data_list)
+		{
+			yars.characterDataSet(character_id, name, (int32_t)i);
+		}
+
+		character_list.push_back(character_id);
+	}
+
+	BENCHMARK("characterSkill")
+	{
+		int32_t total = 0;
+
+		for(const Yars::Id character_id : character_list)
+		{
+			for(const std::string& name : skill_list)
+			{
+				total += yars.characterSkill(character_id, name).level.value;
+			}
+		}
+
+		return total;
+	};
+
+	BENCHMARK("characterSkill (literal)")
+	{
+		int32_t total = 0;
+
+		for(const Yars::Id character_id : character_list)
+		{
+			total += yars.characterSkill(character_id, "Skill 11").level.value;
+		}
+
+		return total;
+	};
+
+	BENCHMARK("characterSkill (_yars)")
+	{
+		int32_t total = 0;
+
+		for(const Yars::Id character_id : character_list)
+		{
+			total += yars.characterSkill(character_id, "Skill 11"_yars).level.value;
+		}
+
+		return total;
+	};
+
+	BENCHMARK("characterDataGet")
+	{
+		int32_t total = 0;
+
+		for(const Yars::Id character_id : character_list)
+		{
+			for(const std::string& name : data_list)
+			{
+				int32_t value = 0;
+				yars.characterDataGet(character_id, name, value);
+				total += value;
+			}
+		}
+
+		return total;
+	};
+
+	BENCHMARK("item")
+	{
+		uint32_t total = 0;
+
+		for(const std::string& name : item_list)
+		{
+			total += yars.item(name).count;
+		}
+
+		return total;
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.SafeMode", "[benchmark]")
+{
+	Yars checked(Yars::Config{ .safe_mode = true });
+	Yars unchecked(Yars::Config{ .safe_mode = false });
+
+	const Yars::VectorString skill_list = nameList("Skill", Skill_Count);
+
+	Yars::VectorId character_list;
+
+	for(Yars* yars : { &checked, &unchecked })
+	{
+		for(const std::string& name : skill_list)
+		{
+			yars->skillAdd(name, {});
+		}
+
+		yars->itemAdd("Item", {});
+
+		character_list.clear();
+
+		for(size_t i = 0; i < 256; i++)
+		{
+			Yars::Id character_id = yars->characterCreate();
+
+			for(const std::string& name : skill_list)
+			{
+				yars->characterSkillAdd(character_id, name);
+			}
+
+			yars->characterItemAdd(character_id, "Item", 2);
+
+			character_list.push_back(character_id);
+		}
+	}
+
+	auto lookup_total = [&](const Yars& yars)
+	{
+		int32_t total = 0;
+
+		for(const Yars::Id character_id : character_list)
+		{
+			for(const std::string& name : skill_list)
+			{
+				total += yars.characterSkillExists(character_id, name);
+				total += yars.characterSkill(character_id, name).level.value;
+			}
+
+			total += yars.characterItemCount(character_id, "Item");
+			total += yars.characterHealth(character_id).current;
+		}
+
+		return total;
+	};
+
+	BENCHMARK("safe_mode = true")
+	{
+		return lookup_total(checked);
+	};
+
+	BENCHMARK("safe_mode = false")
+	{
+		return lookup_total(unchecked);
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.Modifier", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	const Yars::VectorString skill_list     = nameList("Skill",     Skill_Count);
+	const Yars::VectorString attribute_list = nameList("Attribute", 8);
+
+	for(const std::string& name : skill_list)
+	{
+		Yars::Skill skill = {};
+
+		for(size_t i = 0; i < attribute_list.size(); i++)
+		{
+			skill.attribute_contribution[attribute_list[i]] = int32_t(i + 1);
+		}
+
+		yars.skillAdd(name, skill);
+	}
+
+	Yars::VectorId character_list;
+
+	for(size_t i = 0; i < 256; i++)
+	{
+		Yars::Id character_id = yars.characterCreate();
+
+		for(const std::string& name : skill_list)
+		{
+			yars.characterSkillAdd(character_id, name);
+			yars.characterSkillIncrease(character_id, name, 1.0f);
+		}
+
+		character_list.push_back(character_id);
+	}
+
+	auto modifier_total = [&]()
+	{
+		float total = 0;
+
+		for(const Yars::Id character_id : character_list)
+		{
+			for(const std::string& name : skill_list)
+			{
+				total += yars.calculateModifier(character_id, name);
+			}
+		}
+
+		return total;
+	};
+
+	BENCHMARK("calculateModifier")
+	{
+		return modifier_total();
+	};
+
+	for(const Yars::Id character_id : character_list)
+	{
+		yars.characterModifierCacheEnable(character_id);
+	}
+
+	BENCHMARK("calculateModifier (cached)")
+	{
+		return modifier_total();
+	};
+
+	const Yars::ModifierCacheStats& stats = yars.modifierCacheStats();
+
+	WARN("Modifier Cache: "
+		<< stats.hit << " hits, "
+		<< stats.miss << " misses"
+		);
+}
+
+
+TEST_CASE("Benchmark.Yars.Math", "[benchmark]")
+{
+	std::vector<float> ratio_list;
+
+	for(int32_t i = -4096; i <= 4096; i++)
+	{
+		ratio_list.push_back((float)i / 4096.0f);
+	}
+
+	for(const Yars::Math math : { Yars::Math::Float, Yars::Math::Table, Yars::Math::Fixed })
+	{
+		Yars yars(Yars::Config{ .safe_mode = false, .math = math });
+
+		const std::string name = (math == Yars::Math::Float) ? "Float"
+			: (math == Yars::Math::Table) ? "Table"
+			: "Fixed"
+			;
+
+		BENCHMARK("calculateProbability (" + name + ")")
+		{
+			float total = 0;
+
+			for(const float ratio : ratio_list)
+			{
+				total += yars.calculateProbability(ratio);
+			}
+
+			return total;
+		};
+
+		BENCHMARK("calculateDifficulty (" + name + ")")
+		{
+			float total = 0;
+
+			for(uint32_t base = 0; base < 8192; base++)
+			{
+				total += yars.calculateDifficulty(base, 4096);
+			}
+
+			return total;
+		};
+	}
+}
+
+
+TEST_CASE("Benchmark.Yars.Action", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = true });
+
+	yars.skillAdd("Sword.Swing",  {});
+	yars.skillAdd("Shield.Block", {});
+	yars.itemAdd("Sword",
+		{	.skill_attacker = { "Sword.Swing" }
+		,	.skill_defender = { "Shield.Block" }
+		});
+
+	Yars::Id attacker = yars.characterCreate();
+	yars.characterSkillAdd(attacker, "Sword.Swing");
+	yars.levelSet(yars.characterSkill(attacker, "Sword.Swing").level, 10);
+	yars.characterItemAdd(attacker, "Sword");
+
+	Yars::Id defender = yars.characterCreate();
+	yars.characterSkillAdd(defender, "Shield.Block");
+	yars.levelSet(yars.characterSkill(defender, "Shield.Block").level, 10);
+
+	BENCHMARK("affectInit + characterAffectDefend")
+	{
+		size_t applied = 0;
+
+		for(size_t i = 0; i < 256; i++)
+		{
+			Yars::Id affect_id = yars.affectCreate();
+
+			if(yars.affectInit(affect_id, attacker, yars.characterItem(attacker, "Sword"), "Sword.Swing")
+				&& yars.characterAffectDefend(defender, affect_id, "Shield.Block")
+				)
+			{
+				yars.characterAffectRevert(defender, affect_id);
+				applied++;
+			}
+
+			yars.affectDelete(affect_id);
+		}
+
+		return applied;
+	};
+
+	Yars::PreparedAction action;
+	yars.actionPrepare(action, attacker, "Sword");
+
+	BENCHMARK("actionExecute")
+	{
+		size_t applied = 0;
+
+		for(size_t i = 0; i < 256; i++)
+		{
+			Yars::Id affect_id = 0;
+
+			if(yars.actionExecute(action, defender, affect_id))
+			{
+				yars.characterAffectRevert(defender, affect_id);
+				yars.affectDelete(affect_id);
+				applied++;
+			}
+		}
+
+		return applied;
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.Item.Usable", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	Yars::Id bubba = yars.characterCreate();
+
+	for(size_t i = 0; i < 32; i++)
+	{
+		const std::string skill_name = "Skill_" + std::to_string(i);
+
+		yars.skillAdd(skill_name, {});
+
+		if(i % 4 == 0)
+		{
+			yars.characterSkillAdd(bubba, skill_name);
+		}
+	}
+
+	for(size_t i = 0; i < 64; i++)
+	{
+		const std::string item_name = "Item_" + std::to_string(i);
+
+		yars.itemAdd(item_name,
+			{	.skill_attacker =
+				{	"Skill_" + std::to_string((i + 1) % 32)
+				,	"Skill_" + std::to_string((i + 2) % 32)
+				,	"Skill_" + std::to_string((i + 3) % 32)
+				}
+			});
+
+		yars.characterItemAdd(bubba, item_name);
+	}
+
+	BENCHMARK("characterItemListUsableByAttacker")
+	{
+		return yars.characterItemListUsableByAttacker(bubba);
+	};
+
+	yars.characterSkillMap(bubba);
+
+	BENCHMARK("characterItemListUsableByAttacker - Name Look-Up")
+	{
+		return yars.characterItemListUsableByAttacker(bubba);
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.Layer", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	yars.skillAdd("Craft.Smith", {});
+
+	Yars::VectorId character_list;
+
+	for(size_t i = 0; i < 1000; i++)
+	{
+		Yars::Id character_id = yars.characterCreate();
+		yars.characterSkillAdd(character_id, "Craft.Smith");
+
+		character_list.push_back(character_id);
+	}
+
+	Yars::Id affect_id = yars.affectCreate();
+	yars.affect(affect_id).modify_skill["Craft.Smith"] = 2;
+
+	BENCHMARK("characterAffectApply + characterAffectRevert")
+	{
+		for(const Yars::Id character_id : character_list)
+		{
+			yars.characterAffectApply(character_id, affect_id);
+		}
+
+		for(const Yars::Id character_id : character_list)
+		{
+			yars.characterAffectRevert(character_id, affect_id);
+		}
+
+		return character_list.size();
+	};
+
+	BENCHMARK("layerAdd + layerRemove")
+	{
+		yars.layerAdd("Event",
+			{	.modify_skill = { { "Craft.Smith", 2 } }
+			,	.is_global    = true
+			});
+
+		yars.layerRemove("Event");
+
+		return character_list.size();
+	};
+
+	const Yars& y = yars;
+
+	BENCHMARK("characterSkill - No Layer Change")
+	{
+		int32_t total = 0;
+
+		for(const Yars::Id character_id : character_list)
+		{
+			total += y.characterSkill(character_id, "Craft.Smith").level.value;
+		}
+
+		return total;
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.Spawn", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	const Yars::VectorString skill_list = { "Club", "Dodge", "Sneak", "Bite" };
+
+	for(const std::string& skill_name : skill_list)
+	{
+		yars.skillAdd(skill_name, { .attribute_contribution = { { "Strength", 1 }, { "Agility", 1 } } });
+	}
+
+	yars.itemAdd("Club", { .skill_attacker = { "Club" } });
+
+	auto build = [&](const Yars::Id goblin)
+	{
+		for(const std::string& skill_name : skill_list)
+		{
+			yars.characterSkillAdd(goblin, skill_name);
+		}
+
+		yars.characterItemAdd(goblin, "Club");
+		yars.characterDataSet(goblin, "Name", std::string("Grub"));
+	};
+
+	Yars::Id goblin = yars.characterCreate();
+	build(goblin);
+	yars.archetypeAdd("Goblin", goblin);
+
+	BENCHMARK_ADVANCED("characterCreate + Setup")(Catch::Benchmark::Chronometer meter)
+	{
+		Yars::VectorId wave;
+		wave.reserve(5000);
+
+		meter.measure([&]
+		{
+			for(size_t i = 0; i < 5000; i++)
+			{
+				Yars::Id id = yars.characterCreate();
+				build(id);
+				wave.push_back(id);
+			}
+
+			return wave.size();
+		});
+
+		for(const Yars::Id id : wave)
+		{
+			yars.characterDelete(id);
+		}
+	};
+
+	BENCHMARK_ADVANCED("characterSpawn")(Catch::Benchmark::Chronometer meter)
+	{
+		Yars::VectorId wave;
+		wave.reserve(5000);
+
+		meter.measure([&]
+		{
+			yars.characterSpawn("Goblin", 5000, wave);
+
+			return wave.size();
+		});
+
+		for(const Yars::Id id : wave)
+		{
+			yars.characterDelete(id);
+		}
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.Clone", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	for(size_t i = 0; i < Skill_Count; i++)
+	{
+		yars.skillAdd("Skill_" + std::to_string(i), { .attribute_contribution = { { "Attr", 1 } } });
+		yars.itemAdd("Item_" + std::to_string(i), { .skill_attacker = { "Skill_" + std::to_string(i) } });
+	}
+
+	Yars::Id player = yars.characterCreate();
+
+	for(size_t i = 0; i < Skill_Count; i++)
+	{
+		yars.characterSkillAdd(player, "Skill_" + std::to_string(i));
+		yars.characterItemAdd(player, "Item_" + std::to_string(i));
+		yars.characterDataSet(player, "Data_" + std::to_string(i), (int32_t)i);
+	}
+
+	const Yars& y = yars;
+
+	BENCHMARK_ADVANCED("API Replay")(Catch::Benchmark::Chronometer meter)
+	{
+		Yars::Id mirror = 0;
+
+		meter.measure([&]
+		{
+			mirror = yars.characterCreate();
+
+			yars.characterHealth(mirror) = y.characterHealth(player);
+
+			for(const auto& iter : y.characterSkillMap(player))
+			{
+				yars.characterSkillAdd(mirror, iter.first);
+				yars.characterSkill(mirror, iter.first) = iter.second;
+			}
+
+			for(const auto& iter : y.characterAttributeMap(player))
+			{
+				yars.characterAttribute(mirror, iter.first) = iter.second;
+			}
+
+			for(const std::string& item_name : y.characterItemList(player))
+			{
+				yars.characterItemAdd(mirror, item_name, y.characterItemCount(player, item_name));
+			}
+
+			for(size_t i = 0; i < Skill_Count; i++)
+			{
+				const std::string name = "Data_" + std::to_string(i);
+				int32_t value = 0;
+				y.characterDataGet(player, name, value);
+				yars.characterDataSet(mirror, name, value);
+			}
+
+			return mirror;
+		});
+
+		yars.characterDelete(mirror);
+	};
+
+	BENCHMARK_ADVANCED("characterClone")(Catch::Benchmark::Chronometer meter)
+	{
+		Yars::Id mirror = 0;
+
+		meter.measure([&]
+		{
+			yars.characterClone(player, mirror);
+
+			return mirror;
+		});
+
+		yars.characterDelete(mirror);
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.Data", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	Yars::Id player = yars.characterCreate();
+
+	Yars::VectorString   name_list;
+	Yars::MapStringInt32 quest;
+
+	for(size_t i = 0; i < Skill_Count * 4; i++)
+	{
+		name_list.push_back("Quest_" + std::to_string(i));
+		quest[name_list.back()] = (int32_t)i;
+
+		yars.characterDataSet(player, name_list.back(), (int32_t)i);
+		yars.characterDataSet(player, name_list.back(), true);
+	}
+
+	const Yars& y = yars;
+
+	BENCHMARK("characterDataGet")
+	{
+		int32_t total = 0;
+
+		for(const std::string& name : name_list)
+		{
+			int32_t value = 0;
+			y.characterDataGet(player, name, value);
+			total += value;
+		}
+
+		return total;
+	};
+
+	BENCHMARK("characterDataSet")
+	{
+		for(const std::string& name : name_list)
+		{
+			yars.characterDataSet(player, name, (int32_t)1);
+		}
+
+		return player;
+	};
+
+	BENCHMARK("characterDataGet(Batch)")
+	{
+		return y.characterDataGet(player, quest);
+	};
+
+	BENCHMARK("characterDataSet(Batch)")
+	{
+		return yars.characterDataSet(player, quest);
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.Tick", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	Yars::Id player = yars.characterCreate();
+	Yars::healthSet(yars.characterHealth(player), 1000, 1000);
+	yars.archetypeAdd("Player", player);
+
+	Yars::VectorId id_list;
+	yars.characterSpawn("Player", 100'000 - 1, id_list);
+	id_list.push_back(player);
+
+	for(const Yars::Id id : id_list)
+	{
+		Yars::healthAdjust(yars.characterHealth(id), -(int32_t)(id % 1000));
+	}
+
+	int32_t amount = 1;
+
+	BENCHMARK("healthAdjust")
+	{
+		for(const Yars::Id id : id_list)
+		{
+			Yars::healthAdjust(yars.characterHealth(id), amount);
+		}
+
+		amount = -amount;
+
+		return amount;
+	};
+
+	BENCHMARK("tick")
+	{
+		Yars::TickEvent event;
+
+		yars.tick({ .health = amount }, event);
+
+		amount = -amount;
+
+		return event.died.size();
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.FastForward", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	yars.skillAdd("Sword", {});
+
+	Yars::Id player = yars.characterCreate();
+	Yars::healthSet(yars.characterHealth(player), 1000, 1000);
+	yars.characterSkillAdd(player, "Sword");
+	yars.archetypeAdd("Player", player);
+
+	Yars::VectorId zone;
+	yars.characterSpawn("Player", 10'000, zone);
+
+	const Yars::Tick tick =
+	{	.health      = 1
+	,	.decay_skill = { { "Sword", 0.01f } }
+	};
+
+	const size_t Tick_Count = 60;
+
+	BENCHMARK("tick")
+	{
+		Yars::TickEvent event;
+
+		for(size_t i = 0; i < Tick_Count; i++)
+		{
+			yars.tick(tick, zone, event);
+		}
+
+		return event.health_full.size();
+	};
+
+	BENCHMARK("characterFastForward")
+	{
+		Yars::TickEvent event;
+
+		for(const Yars::Id id : zone)
+		{
+			yars.characterFastForward(id, tick, Tick_Count, event);
+		}
+
+		return event.health_full.size();
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.Index", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	yars.skillAdd("Smith", {});
+
+	Yars::Id player = yars.characterCreate();
+	yars.characterSkillAdd(player, "Smith");
+	yars.archetypeAdd("Player", player);
+
+	Yars::VectorId zone;
+	yars.characterSpawn("Player", 100'000, zone);
+
+	for(const Yars::Id id : zone)
+	{
+		Yars::levelSet(yars.characterSkill(id, "Smith").level, id % 100);
+	}
+
+	yars.indexSkillAdd("Smith");
+
+	const Yars& y = yars;
+
+	BENCHMARK("scan")
+	{
+		Yars::VectorId id_list;
+
+		for(const Yars::Id id : zone)
+		{
+			if(y.characterSkill(id, "Smith").level.value >= 99)
+			{
+				id_list.push_back(id);
+			}
+		}
+
+		return id_list.size();
+	};
+
+	BENCHMARK("indexSkillRange")
+	{
+		return yars.indexSkillRange("Smith", 99).size();
+	};
+
+	Yars::Id id = 0;
+
+	BENCHMARK("levelSet + indexSkillRange")
+	{
+		Yars::levelSet(yars.characterSkill(zone[id], "Smith").level, 99);
+		id = (id + 1) % zone.size();
+
+		return yars.indexSkillRange("Smith", 99).size();
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.Leaderboard", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	yars.skillAdd("Sword", {});
+
+	Yars::Id player = yars.characterCreate();
+	yars.characterSkillAdd(player, "Sword");
+	yars.archetypeAdd("Player", player);
+
+	Yars::VectorId zone;
+	yars.characterSpawn("Player", 100'000, zone);
+
+	for(const Yars::Id id : zone)
+	{
+		Yars::levelSet(yars.characterSkill(id, "Sword").level, (id * 7919) % 10'000);
+	}
+
+	yars.leaderboardSkillAdd("Sword");
+
+	const Yars& y = yars;
+
+	BENCHMARK("scan top 100")
+	{
+		std::vector<std::pair<int32_t, Yars::Id>> list;
+		list.reserve(zone.size());
+
+		for(const Yars::Id id : zone)
+		{
+			list.emplace_back(y.characterSkill(id, "Sword").level.value, id);
+		}
+
+		std::partial_sort(std::begin(list)
+			, std::begin(list) + 100
+			, std::end(list)
+			, std::greater<>()
+			);
+
+		return list[0].second;
+	};
+
+	BENCHMARK("leaderboardSkillTop 100")
+	{
+		return yars.leaderboardSkillTop("Sword", 100).size();
+	};
+
+	size_t index = 0;
+
+	BENCHMARK("levelIncrease + leaderboardSkillRank")
+	{
+		const Yars::Id id = zone[index];
+		index = (index + 1) % zone.size();
+
+		Yars::levelIncrease(yars.characterSkill(id, "Sword").level, 1'000);
+
+		return yars.leaderboardSkillRank("Sword", id);
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.Telemetry", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	yars.skillAdd("Sword", {});
+
+	Yars::Id player = yars.characterCreate();
+	yars.characterSkillAdd(player, "Sword");
+	yars.archetypeAdd("Player", player);
+
+	Yars::VectorId zone;
+	yars.characterSpawn("Player", 100'000, zone);
+
+	for(const Yars::Id id : zone)
+	{
+		Yars::levelSet(yars.characterSkill(id, "Sword").level, id % 1'000);
+	}
+
+	yars.telemetrySkillAdd("Sword");
+
+	const Yars& y = yars;
+
+	BENCHMARK("scan")
+	{
+		Yars::Histogram histogram;
+
+		for(const Yars::Id id : zone)
+		{
+			Yars::histogramAdjust(histogram, y.characterSkill(id, "Sword").level.value, 1);
+		}
+
+		return histogram.total;
+	};
+
+	BENCHMARK("telemetrySkill")
+	{
+		return yars.telemetrySkill("Sword").total;
+	};
+
+	size_t index = 0;
+
+	BENCHMARK("levelIncrease x100 + telemetrySkill")
+	{
+		for(size_t i = 0; i < 100; i++)
+		{
+			const Yars::Id id = zone[index];
+			index = (index + 1) % zone.size();
+
+			Yars::levelIncrease(yars.characterSkill(id, "Sword").level, 1'000);
+		}
+
+		return yars.telemetrySkill("Sword").total;
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.ItemOwner", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	yars.itemAdd("Coin", {});
+
+	Yars::Id player = yars.characterCreate();
+	yars.archetypeAdd("Player", player);
+
+	Yars::VectorId zone;
+	yars.characterSpawn("Player", 100'000, zone);
+
+	for(const Yars::Id id : zone)
+	{
+		if(id % 10 == 0)
+		{
+			yars.characterItemAdd(id, "Coin", id % 1'000 + 1);
+		}
+	}
+
+	const Yars& y = yars;
+
+	BENCHMARK("scan")
+	{
+		uint64_t supply = 0;
+
+		for(const Yars::Id id : zone)
+		{
+			if(y.characterItemExists(id, "Coin"))
+			{
+				supply += y.characterItemCount(id, "Coin");
+			}
+		}
+
+		return supply;
+	};
+
+	BENCHMARK("itemSupply")
+	{
+		return yars.itemSupply("Coin");
+	};
+
+	BENCHMARK("itemHolderList")
+	{
+		return yars.itemHolderList("Coin").size();
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.Transfer", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	yars.itemAdd("Coin", {});
+
+	Yars::Id bubba = yars.characterCreate();
+	Yars::Id jimbo = yars.characterCreate();
+
+	yars.characterConfigItemStackMax(bubba, 100);
+	yars.characterConfigItemStackMax(jimbo, 100);
+
+	yars.characterItemAdd(bubba, "Coin", 1'000);
+	yars.characterItemAdd(jimbo, "Coin", 1'000);
+
+	BENCHMARK("take + add")
+	{
+		yars.characterItemTake(bubba, "Coin");
+		yars.characterItemAdd(jimbo, "Coin");
+		yars.characterItemTake(jimbo, "Coin");
+		return yars.characterItemAdd(bubba, "Coin");
+	};
+
+	BENCHMARK("characterItemTransfer")
+	{
+		yars.characterItemTransfer(bubba, jimbo, "Coin");
+		return yars.characterItemTransfer(jimbo, bubba, "Coin");
+	};
+
+	BENCHMARK("characterTrade")
+	{
+		return yars.characterTrade(bubba, { { "Coin", 1 } }, jimbo, { { "Coin", 1 } });
+	};
+}
+
+
+TEST_CASE("Benchmark.Yars.Loot", "[benchmark]")
+{
+	Yars yars(Yars::Config{ .safe_mode = false });
+
+	Yars::VectorLootEntry entry_list;
+	std::vector<uint32_t> weight_sum;
+	uint32_t              weight_total = 0;
+
+	for(uint32_t i = 0; i < 1'000; i++)
+	{
+		const std::string name = "Item " + std::to_string(i);
+
+		yars.itemAdd(name, {});
+
+		entry_list.push_back({ .item = name, .weight = i % 50 + 1 });
+
+		weight_total += i % 50 + 1;
+		weight_sum.push_back(weight_total);
+	}
+
+	yars.lootAdd("Table", entry_list);
+
+	Yars::Id player = yars.characterCreate();
+	yars.characterConfigItemStackMax(player, std::numeric_limits<uint32_t>::max());
+
+	std::mt19937 mt_engine(42);
+	std::uniform_int_distribution<uint32_t> pick(0, weight_total - 1);
+
+	BENCHMARK("cumulative scan")
+	{
+		const uint32_t value = pick(mt_engine);
+
+		for(size_t i = 0; i < weight_sum.size(); i++)
+		{
+			if(value < weight_sum[i])
+			{
+				return i;
+			}
+		}
+
+		return weight_sum.size();
+	};
+
+	BENCHMARK("lootRoll")
+	{
+		return yars.lootRoll("Table").size();
+	};
+
+	BENCHMARK("lootRoll x100")
+	{
+		return yars.lootRoll("Table", 100).size();
+	};
+
+	BENCHMARK("lootGrant x100")
+	{
+		return yars.lootGrant(player, "Table", 100);
+	};
+}
+
+#endif
@@ -245,6 +245,179 @@ TEST_CASE("Calculate.Modifier", "[calculate][character][skill]")
 		// (12 * 0.25) + (8 * 0.75) = 3 + 6 = 9
 		REQUIRE(yars.calculateModifier(character_id, "skill_2") == Approx(9));
 	}
+
+	SECTION("Changed Contribution")
+	{
+		Yars::Skill skill =
+		{	.attribute_contribution =
+			{	{ "A", 1 }
+			,	{ "B", 1 }
+			}
+		};
+		yars.skillAdd("skill", skill);
+
+		yars.characterSkillAdd(character_id, "skill");
+		yars.characterSkillIncrease(character_id, "skill", 1.0f);
+
+		Yars::levelSet(yars.characterAttribute(character_id, "A").level, 12, 0);
+		Yars::levelSet(yars.characterAttribute(character_id, "B").level,  4, 0);
+
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+
+		// A changed contribution is used even without an update
+		Yars::Skill& character_skill = yars.characterSkill(character_id, "skill");
+		character_skill.attribute_contribution["A"] = 3;
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(10));
+
+		Yars::skillWeightUpdate(character_skill);
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(10));
+
+		// Renaming a contribution keeps the count the same
+		yars.skillAdd("other", { .attribute_contribution = { { "C", 1 } } });
+		yars.characterSkillAdd(character_id, "other");
+		Yars::levelSet(yars.characterAttribute(character_id, "C").level, 8, 0);
+
+		Yars::Skill& renamed_skill = yars.characterSkill(character_id, "skill");
+		renamed_skill.attribute_contribution.erase("A");
+		renamed_skill.attribute_contribution["C"] = 3;
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(7));
+	}
+}
+
+
+TEST_CASE("Calculate.Modifier.Cache", "[calculate][character][skill]")
+{
+	Yars yars;
+
+	Yars::Skill skill =
+	{	.attribute_contribution =
+		{	{ "A", 1 }
+		,	{ "B", 1 }
+		}
+	};
+	yars.skillAdd("skill", skill);
+
+	Yars::Id character_id = yars.characterCreate();
+	yars.characterSkillAdd(character_id, "skill");
+	yars.characterSkillIncrease(character_id, "skill", 1.0f);
+
+	Yars::levelSet(yars.characterAttribute(character_id, "A").level, 12, 0);
+	Yars::levelSet(yars.characterAttribute(character_id, "B").level,  4, 0);
+
+	const Yars& y = yars;
+
+	SECTION("Disabled")
+	{
+		REQUIRE(yars.characterModifierCacheIsEnabled(character_id) == false);
+
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+
+		REQUIRE(yars.modifierCacheStats().hit  == 0);
+		REQUIRE(yars.modifierCacheStats().miss == 0);
+	}
+
+	SECTION("Invalid Character")
+	{
+		REQUIRE(yars.characterModifierCacheEnable(1234) == false);
+		REQUIRE(yars.characterModifierCacheIsEnabled(1234) == false);
+	}
+
+	REQUIRE(yars.characterModifierCacheEnable(character_id));
+	REQUIRE(yars.characterModifierCacheIsEnabled(character_id));
+
+	SECTION("Hit and Miss")
+	{
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+		REQUIRE(yars.modifierCacheStats().hit  == 0);
+		REQUIRE(yars.modifierCacheStats().miss == 1);
+
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+		REQUIRE(yars.calculateModifier(character_id, "skill"_yars) == Approx(8));
+		REQUIRE(yars.modifierCacheStats().hit  == 2);
+		REQUIRE(yars.modifierCacheStats().miss == 1);
+
+		// Reading through a const Yars does not invalidate
+		REQUIRE(y.characterAttribute(character_id, "A").level.value == 12);
+		REQUIRE(y.characterSkill(character_id, "skill").level.value == 1);
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+		REQUIRE(yars.modifierCacheStats().hit  == 3);
+
+		// Getting a reference that can be written to does invalidate
+		REQUIRE(yars.characterSkill(character_id, "skill"_yars).level.value == 1);
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+		REQUIRE(yars.modifierCacheStats().miss       == 2);
+		REQUIRE(yars.modifierCacheStats().invalidate == 1);
+
+		yars.modifierCacheStatsReset();
+		REQUIRE(yars.modifierCacheStats().hit        == 0);
+		REQUIRE(yars.modifierCacheStats().miss       == 0);
+		REQUIRE(yars.modifierCacheStats().invalidate == 0);
+	}
+
+	SECTION("Attribute Change")
+	{
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+
+		Yars::levelSet(yars.characterAttribute(character_id, "B").level, 8, 0);
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(10));
+
+		Yars::levelSet(yars.characterAttribute(character_id, "B"_yars).level, 4, 0);
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+
+		REQUIRE(yars.modifierCacheStats().miss       == 3);
+		REQUIRE(yars.modifierCacheStats().invalidate == 2);
+	}
+
+	SECTION("Skill Change")
+	{
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+
+		yars.characterSkillRemove(character_id, "skill");
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(0));
+
+		yars.characterSkillAdd(character_id, "skill");
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(0));
+
+		yars.characterSkillIncrease(character_id, "skill", 1.0f);
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+	}
+
+	SECTION("Level Change")
+	{
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+
+		yars.characterLevelSet(character_id, "skill", 16);
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(4));
+		REQUIRE(yars.modifierCacheStats().miss == 2);
+	}
+
+	SECTION("Held Reference")
+	{
+		Yars::Attribute& attribute = yars.characterAttribute(character_id, "B");
+
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+
+		Yars::levelSet(attribute.level, 8, 0);
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+
+		yars.characterModifierCacheInvalidate(character_id);
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(10));
+
+		Yars::levelSet(attribute.level, 4, 0);
+		yars.modifierCacheInvalidate();
+		REQUIRE(yars.calculateModifier(character_id, "skill") == Approx(8));
+	}
+
+	SECTION("Disable")
+	{
+		REQUIRE(yars.characterModifierCacheEnable(character_id, false));
+		REQUIRE(yars.characterModifierCacheIsEnabled(character_id) == false);
+
+		yars.characterDelete(character_id);
+		character_id = yars.characterCreate();
+		REQUIRE(yars.characterModifierCacheIsEnabled(character_id) == false);
+	}
 }
 
 
@@ -267,6 +440,74 @@ TEST_CASE("Calculate.Probability", "[calculate]")
 }
 
 
+TEST_CASE("Calculate.Math", "[calculate]")
+{
+	Yars reference(Yars::Config{ .math = Yars::Math::Float });
+	Yars table(Yars::Config{ .math = Yars::Math::Table });
+	Yars fixed(Yars::Config{ .math = Yars::Math::Fixed });
+
+	SECTION("Probability Accuracy")
+	{
+		for(int32_t i = -4096; i <= 4096; i++)
+		{
+			const float ratio    = (float)i / 4096.0f;
+			const float expected = reference.calculateProbability(ratio);
+
+			REQUIRE(table.calculateProbability(ratio) == Approx(expected).margin(0.0001));
+			REQUIRE(fixed.calculateProbability(ratio) == Approx(expected).margin(0.0001));
+
+			REQUIRE(table.calculateProbability(-ratio) == -table.calculateProbability(ratio));
+			REQUIRE(fixed.calculateProbability(-ratio) == -fixed.calculateProbability(ratio));
+		}
+
+		for(float ratio : { -8.0f, -3.5f, -1.25f, 1.25f, 1.5f, 2.0f })
+		{
+			const float expected = reference.calculateProbability(ratio);
+
+			REQUIRE(table.calculateProbability(ratio) == Approx(expected).epsilon(0.0001));
+			REQUIRE(fixed.calculateProbability(ratio) == Approx(expected).epsilon(0.0001));
+		}
+	}
+
+	SECTION("Probability Exact")
+	{
+		// These values must be the same on every build
+		REQUIRE(fixed.calculateProbability( 0.00f) ==  0.0f);
+		REQUIRE(fixed.calculateProbability( 0.50f) ==  0.21875f);
+		REQUIRE(fixed.calculateProbability(-1.00f) == -1.0f);
+		REQUIRE(fixed.calculateProbability( 2.00f) == 14.0f);
+
+		REQUIRE(Yars::fixedProbability(Yars::Fixed_One / 4) == 5824);
+		REQUIRE(Yars::tableProbability(Yars::Fixed_One / 4) == 5824);
+		REQUIRE(Yars::tableProbability(Yars::Fixed_One / 3) == 8181);
+
+		REQUIRE(std::isnan(table.calculateProbability(NAN)));
+		REQUIRE(std::isnan(fixed.calculateProbability(NAN)));
+	}
+
+	SECTION("Difficulty")
+	{
+		for(uint32_t target : { 1u, 7u, 100u, 333u, 100000u })
+		{
+			for(uint32_t base = 0; base <= target * 3; base += (target / 7) + 1)
+			{
+				const float expected = reference.calculateDifficulty(base, target);
+
+				REQUIRE(table.calculateDifficulty(base, target) == Approx(expected).margin(0.00002));
+				REQUIRE(fixed.calculateDifficulty(base, target) == Approx(expected).margin(0.00002));
+			}
+		}
+
+		REQUIRE(fixed.calculateDifficulty(200, 100) == -2.0f);
+		REQUIRE(fixed.calculateDifficulty(125, 100) == -0.5f);
+		REQUIRE(Yars::fixedDifficulty(55, 66) == 21845);
+
+		REQUIRE(std::isnan(fixed.calculateDifficulty(  0, 0)));
+		REQUIRE(std::isinf(fixed.calculateDifficulty(100, 0)));
+	}
+}
+
+
 TEST_CASE("Calculate.Difficulty_To_Result", "[calculate]")
 {
 	REQUIRE(Yars::difficultyToResult(-2.00) == Yars::Result::Success_Automatic);
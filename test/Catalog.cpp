@@ -0,0 +1,177 @@
+/*
+g++ -std=c++2a -DCATCH_CONFIG_MAIN -Wall -Werror -o Catalog Catalog.cpp && ./Catalog
+ */
+
+#ifdef CATCH_CONFIG_MAIN
+#define ZAKERO_YARS_IMPLEMENTATION
+#define ZAKERO_YARS_ENABLE_DEBUG
+#define ZAKERO_YARS_ENABLE_ID_SHUFFLE
+#define ZAKERO_YARS_ENABLE_SAFE_MODE
+#endif
+
+#include "../src/Zakero_Yars.h"
+#include "catch.hpp"
+
+using namespace zakero;
+
+namespace
+{
+	const std::string Attr_Name  = "attribute";
+	const std::string Skill_Name = "skill";
+	const std::string Item_Name  = "item";
+
+	Yars::Skill skill =
+	{	.attribute_contribution =
+		{	{ Attr_Name, 1 }
+		}
+	,	.level =
+		{	.value      = 2
+		,	.value_base = 2
+		}
+	};
+
+	Yars::Item item =
+	{	.modify_attribute =
+		{	{ Attr_Name, 5 }
+		}
+	,	.skill_attacker =
+		{	Skill_Name
+		}
+	};
+};
+
+
+TEST_CASE("Catalog.Freeze", "[catalog]")
+{
+	Yars yars;
+
+	REQUIRE(yars.catalogIsFrozen() == false);
+
+	yars.skillAdd(Skill_Name, skill);
+	yars.itemAdd(Item_Name, item);
+
+	REQUIRE(yars.catalogFreeze() == true);
+	REQUIRE(yars.catalogIsFrozen() == true);
+	REQUIRE(yars.catalogFreeze() == false);
+
+	SECTION("Lookup")
+	{
+		REQUIRE(yars.attributeExists(Attr_Name) == true);
+		REQUIRE(yars.skillExists(Skill_Name)    == true);
+		REQUIRE(yars.itemExists(Item_Name)      == true);
+		REQUIRE(yars.itemExists("nothing")      == false);
+
+		REQUIRE(yars.skill(Skill_Name).level.value == 2);
+		REQUIRE(yars.item(Item_Name) == item);
+
+		REQUIRE(yars.itemIsUsable(Item_Name)           == true);
+		REQUIRE(yars.itemIsUsableByAttacker(Item_Name) == true);
+		REQUIRE(yars.itemIsUsableByDefender(Item_Name) == false);
+
+		REQUIRE(yars.skillList() == Yars::VectorString{ Skill_Name });
+		REQUIRE(yars.itemList()  == Yars::VectorString{ Item_Name });
+	}
+
+	SECTION("Index")
+	{
+		const Yars::CatalogIndex skill_index = yars.catalogSkillIndex(Skill_Name);
+		const Yars::CatalogIndex item_index  = yars.catalogItemIndex(Item_Name);
+		const Yars::CatalogIndex attr_index  = yars.catalogAttributeIndex(Attr_Name);
+
+		REQUIRE(skill_index != Yars::CatalogIndex_Invalid);
+		REQUIRE(item_index  != Yars::CatalogIndex_Invalid);
+		REQUIRE(attr_index  != Yars::CatalogIndex_Invalid);
+
+		REQUIRE(&yars.catalogSkill(skill_index)    == &yars.skill(Skill_Name));
+		REQUIRE(&yars.catalogItem(item_index)      == &yars.item(Item_Name));
+		REQUIRE(&yars.catalogAttribute(attr_index) == &yars.attribute(Attr_Name));
+
+		REQUIRE(yars.catalogItemIndex("nothing") == Yars::CatalogIndex_Invalid);
+	}
+
+	SECTION("Mutation is rejected")
+	{
+		REQUIRE(yars.attributeAdd("other")    == false);
+		REQUIRE(yars.skillAdd("other", {})    == false);
+		REQUIRE(yars.skillRemove(Skill_Name)  == false);
+		REQUIRE(yars.itemAdd("other", {})     == false);
+		REQUIRE(yars.itemRemove(Item_Name)    == false);
+
+		REQUIRE(yars.skillExists("other") == false);
+		REQUIRE(yars.skillExists(Skill_Name) == true);
+
+		// Values can still be changed
+		yars.item(Item_Name).count = 3;
+		REQUIRE(yars.item(Item_Name).count == 3);
+	}
+
+	SECTION("Characters")
+	{
+		Yars::Id id = yars.characterCreate();
+
+		REQUIRE(yars.characterSkillAdd(id, Skill_Name) == true);
+		REQUIRE(yars.characterSkill(id, Skill_Name).level.value == 2);
+		REQUIRE(yars.characterAttributeExists(id, Attr_Name) == true);
+
+		REQUIRE(yars.characterItemAdd(id, Item_Name, 2) == true);
+		REQUIRE(yars.characterItemCount(id, Item_Name) == 2);
+		REQUIRE(yars.characterItemIsUsableByAttacker(id, Item_Name) == true);
+	}
+
+	SECTION("Unfreeze")
+	{
+		yars.item(Item_Name).count = 3;
+
+		yars.catalogUnfreeze();
+
+		REQUIRE(yars.catalogIsFrozen() == false);
+		REQUIRE(yars.catalogItemIndex(Item_Name) == Yars::CatalogIndex_Invalid);
+		REQUIRE(yars.item(Item_Name).count == 3);
+
+		REQUIRE(yars.skillAdd("other", {}) == true);
+		REQUIRE(yars.skillExists("other") == true);
+		REQUIRE(yars.itemRemove(Item_Name) == true);
+		REQUIRE(yars.itemExists(Item_Name) == false);
+	}
+}
+
+
+TEST_CASE("Catalog.Empty", "[catalog]")
+{
+	Yars yars;
+
+	REQUIRE(yars.catalogFreeze() == true);
+	REQUIRE(yars.skillExists(Skill_Name) == false);
+	REQUIRE(yars.skillList().empty() == true);
+	REQUIRE(yars.catalogSkillIndex(Skill_Name) == Yars::CatalogIndex_Invalid);
+
+	yars.catalogUnfreeze();
+
+	REQUIRE(yars.skillAdd(Skill_Name, {}) == true);
+}
+
+
+TEST_CASE("Catalog.Large", "[catalog]")
+{
+	Yars yars;
+
+	constexpr int32_t Item_Count = 200'000;
+
+	for(int32_t i = 0; i < Item_Count; i++)
+	{
+		yars.itemAdd(Item_Name + " " + std::to_string(i), {});
+	}
+
+	REQUIRE(yars.catalogFreeze() == true);
+	REQUIRE(yars.itemList().size() == Item_Count);
+
+	for(int32_t i = 0; i < Item_Count; i += 997)
+	{
+		const std::string name = Item_Name + " " + std::to_string(i);
+
+		REQUIRE(yars.itemExists(name) == true);
+		REQUIRE(yars.catalogItemIndex(name) != Yars::CatalogIndex_Invalid);
+	}
+
+	REQUIRE(yars.itemExists(Item_Name + " " + std::to_string(Item_Count)) == false);
+}
@@ -196,6 +196,50 @@ TEST_CASE("Character.Config", "[character]")
 }
 
 
+TEST_CASE("Character.Yars_Config", "[character]")
+{
+	SECTION("Default")
+	{
+		Yars yars;
+
+		REQUIRE(yars.config().safe_mode  == Yars::configDefault().safe_mode);
+		REQUIRE(yars.config().id_shuffle == Yars::configDefault().id_shuffle);
+	}
+
+	SECTION("Checked and Unchecked")
+	{
+		Yars checked(Yars::Config{ .safe_mode = true });
+		Yars unchecked(Yars::Config{ .safe_mode = false });
+
+		REQUIRE(checked.config().safe_mode   == true);
+		REQUIRE(unchecked.config().safe_mode == false);
+
+		REQUIRE(checked.characterDelete(1234) == false);
+
+		Yars::Id character_id = unchecked.characterCreate();
+		REQUIRE(unchecked.characterExists(character_id) == true);
+		REQUIRE(unchecked.characterDelete(character_id) == true);
+	}
+
+	SECTION("Clear on Delete")
+	{
+		Yars keep(Yars::Config{ .safe_mode = false, .clear_on_delete = false });
+		Yars clear(Yars::Config{ .safe_mode = false, .clear_on_delete = true });
+
+		Yars::Id keep_id  = keep.characterCreate();
+		Yars::Id clear_id = clear.characterCreate();
+
+		Yars::healthSet(keep.characterHealth(keep_id),   10, 10);
+		Yars::healthSet(clear.characterHealth(clear_id), 10, 10);
+
+		keep.characterDelete(keep_id);
+		clear.characterDelete(clear_id);
+
+		REQUIRE(keep.characterHealth(keep_id).maximum   == 10);
+		REQUIRE(clear.characterHealth(clear_id).maximum == 0);
+	}
+}
+
 TEST_CASE("Character.Clear_With_Affect", "[character][affect]")
 {
 	Yars yars;
@@ -549,6 +593,77 @@ TEST_CASE("Character.Data", "[character][data]")
 }
 
 
+TEST_CASE("Character.Data.Batch", "[character][data]")
+{
+	Yars yars;
+
+	Yars::MapStringBool   flag  = { { "Door.Open", true }, { "Door.Locked", false } };
+	Yars::MapStringInt32  quest = { { "Quest.Rat", 2 }, { "Quest.Bat", 1 } };
+	Yars::MapStringString text  = { { "Name", "Bubba" } };
+
+	SECTION("Invalid Character Id")
+	{
+		REQUIRE(yars.characterDataSet(0, flag) == false);
+		REQUIRE(yars.characterDataGet(0, flag) == false);
+	}
+
+	Yars::Id character_id = yars.characterCreate();
+
+	SECTION("Set")
+	{
+		REQUIRE(yars.characterDataSet(character_id, flag));
+		REQUIRE(yars.characterDataSet(character_id, quest));
+		REQUIRE(yars.characterDataSet(character_id, text));
+
+		bool        value_bool   = false;
+		int32_t     value_int32  = 0;
+		std::string value_string = "";
+
+		REQUIRE(yars.characterDataGet(character_id, "Door.Open", value_bool));
+		REQUIRE(value_bool == true);
+		REQUIRE(yars.characterDataGet(character_id, "Quest.Bat", value_int32));
+		REQUIRE(value_int32 == 1);
+		REQUIRE(yars.characterDataGet(character_id, "Name", value_string));
+		REQUIRE(value_string == "Bubba");
+
+		// Different types do not replace each other
+		REQUIRE(yars.characterDataGet(character_id, "Door.Open", value_int32) == false);
+	}
+
+	SECTION("Get")
+	{
+		yars.characterDataSet(character_id, quest);
+		yars.characterDataSet(character_id, "Door.Open", true);
+
+		Yars::MapStringInt32 value = { { "Quest.Rat", 0 }, { "Quest.Bat", 0 } };
+
+		REQUIRE(yars.characterDataGet(character_id, value));
+		REQUIRE(value.at("Quest.Rat") == 2);
+		REQUIRE(value.at("Quest.Bat") == 1);
+
+		value["Quest.Cat"] = 7;
+		value["Door.Open"] = 8;
+
+		REQUIRE(yars.characterDataGet(character_id, value) == false);
+		REQUIRE(value.at("Quest.Rat") == 2);
+		REQUIRE(value.at("Quest.Cat") == 7);
+		REQUIRE(value.at("Door.Open") == 8);
+	}
+
+	SECTION("Erase")
+	{
+		yars.characterDataSet(character_id, flag);
+		yars.characterDataSet(character_id, quest);
+
+		REQUIRE(yars.characterDataErase(character_id, "Door.Open"));
+		REQUIRE(yars.characterDataErase(character_id, "Door.Open") == false);
+
+		REQUIRE(yars.characterDataGet(character_id, flag) == false);
+		REQUIRE(yars.characterDataGet(character_id, quest));
+	}
+}
+
+
 TEST_CASE("Character.Skill", "[character][skill]")
 {
 	Yars yars;
@@ -656,6 +771,38 @@ TEST_CASE("Character.Skill.Exists", "[character][skill]")
 }
 
 
+TEST_CASE("Character.Skill.Name", "[character][skill]")
+{
+	Yars yars;
+
+	yars.skillAdd(Skill_Medic, medic);
+
+	Yars::Id character_id = yars.characterCreate();
+
+	REQUIRE(yars.characterSkillExists(character_id, "Medic"_yars) == false);
+	REQUIRE(yars.characterSkillAdd(   character_id, Skill_Medic)  == true);
+	REQUIRE(yars.characterSkillExists(character_id, "Medic"_yars) == true);
+	REQUIRE(yars.characterSkillExists(character_id, "Acting"_yars) == false);
+
+	REQUIRE(yars.skillExists("Medic"_yars) == true);
+	REQUIRE(&yars.skill("Medic"_yars) == &yars.skill(Skill_Medic));
+
+	REQUIRE(&yars.characterSkill(character_id, "Medic"_yars) == &yars.characterSkill(character_id, Skill_Medic));
+	REQUIRE(yars.attributeExists("Vision"_yars) == true);
+	REQUIRE(yars.characterAttributeExists(character_id, "Vision"_yars) == true);
+
+	yars.characterAttribute(character_id, "Vision"_yars).level.value = 5;
+	yars.characterSkill(character_id, "Medic"_yars).level.value      = 1;
+
+	REQUIRE(yars.characterAttribute(character_id, Attr_Vision).level.value == 5);
+	REQUIRE(yars.calculateModifier(character_id, "Medic"_yars) == yars.calculateModifier(character_id, Skill_Medic));
+
+	constexpr Yars::NameSchema<2> Skill = {{ "Acting", "Medic" }};
+
+	REQUIRE(yars.characterSkillExists(character_id, Skill("Medic")) == true);
+}
+
+
 TEST_CASE("Character.Skill.List", "[character][skill]")
 {
 	Yars yars;
@@ -1284,6 +1431,103 @@ TEST_CASE("Character.Item.List", "[character][item]")
 }
 
 
+TEST_CASE("Character.Item.List.Usable", "[character][item][skill]")
+{
+	Yars yars;
+
+	const std::string Sword  = "Sword";
+	const std::string Shield = "Shield";
+	const std::string Apple  = "Apple";
+
+	yars.skillAdd(Skill_Acting,   {});
+	yars.skillAdd(Skill_Mentalist, {});
+
+	yars.itemAdd(Sword,  { .skill_attacker = { Skill_Acting } });
+	yars.itemAdd(Shield, { .skill_defender = { Skill_Mentalist, Skill_Acting } });
+	yars.itemAdd(Apple,  {});
+
+	SECTION("Invalid Character")
+	{
+		REQUIRE(yars.characterItemListUsableByAttacker(1234).empty() == true);
+		REQUIRE(yars.characterItemListUsableByDefender(1234).empty() == true);
+	}
+
+	Yars::Id character_id = yars.characterCreate();
+
+	yars.characterItemAdd(character_id, Sword);
+	yars.characterItemAdd(character_id, Shield);
+	yars.characterItemAdd(character_id, Apple);
+
+	SECTION("No Skills")
+	{
+		REQUIRE(yars.characterItemListUsableByAttacker(character_id).empty() == true);
+		REQUIRE(yars.characterItemListUsableByDefender(character_id).empty() == true);
+	}
+
+	SECTION("Skill Added and Removed")
+	{
+		yars.characterSkillAdd(character_id, Skill_Mentalist);
+
+		REQUIRE(yars.characterItemListUsableByAttacker(character_id).empty() == true);
+		REQUIRE(yars.characterItemListUsableByDefender(character_id) == Yars::VectorString{ Shield });
+
+		yars.characterSkillAdd(character_id, Skill_Acting);
+
+		REQUIRE(yars.characterItemListUsableByAttacker(character_id) == Yars::VectorString{ Sword });
+		REQUIRE(yars.characterItemIsUsableByAttacker(character_id, Sword) == true);
+
+		yars.characterSkillRemove(character_id, Skill_Acting);
+		yars.characterSkillRemove(character_id, Skill_Mentalist);
+
+		REQUIRE(yars.characterItemListUsableByAttacker(character_id).empty() == true);
+		REQUIRE(yars.characterItemListUsableByDefender(character_id).empty() == true);
+		REQUIRE(yars.characterItemIsUsableByDefender(character_id, Shield) == false);
+	}
+
+	SECTION("Skill Map Changed")
+	{
+		yars.characterSkillMap(character_id)[Skill_Acting] = {};
+
+		REQUIRE(yars.characterItemIsUsableByAttacker(character_id, Sword) == true);
+
+		yars.characterSkillAdd(character_id, Skill_Mentalist);
+		yars.characterSkillMap(character_id).erase(Skill_Acting);
+
+		REQUIRE(yars.characterItemIsUsableByAttacker(character_id, Sword) == false);
+		REQUIRE(yars.characterItemIsUsableByDefender(character_id, Shield) == true);
+	}
+
+	SECTION("Item Changed")
+	{
+		yars.characterSkillAdd(character_id, Skill_Mentalist);
+
+		Yars::Item& item = yars.characterItem(character_id, Sword);
+		item.skill_attacker.push_back(Skill_Mentalist);
+
+		REQUIRE(yars.characterItemIsUsableByAttacker(character_id, Sword) == true);
+
+		yars.itemSkillSetUpdate(item);
+
+		REQUIRE(yars.characterItemIsUsableByAttacker(character_id, Sword) == true);
+		REQUIRE(yars.characterItemListUsableByAttacker(character_id) == Yars::VectorString{ Sword });
+	}
+
+	SECTION("Item Name Replaced")
+	{
+		yars.characterSkillAdd(character_id, Skill_Mentalist);
+
+		Yars::Item& item = yars.characterItem(character_id, Sword);
+		item.skill_attacker[0] = Skill_Mentalist;
+
+		REQUIRE(yars.characterItemIsUsableByAttacker(character_id, Sword) == true);
+
+		item.skill_attacker[0] = Skill_Acting;
+
+		REQUIRE(yars.characterItemIsUsableByAttacker(character_id, Sword) == false);
+	}
+}
+
+
 TEST_CASE("Character.Item.Restack", "[character][item]")
 {
 	Yars yars;
@@ -1941,6 +2185,219 @@ TEST_CASE("Character.Item.Take", "[character][item]")
 }
 
 
+TEST_CASE("Character.Item.Stack_Order", "[character][item]")
+{
+	Yars yars;
+
+	yars.itemAdd(Item_Stuff, stuff);
+
+	Yars::Id character_id = yars.characterCreate();
+
+	yars.characterConfigItemStackMax(character_id, 4);
+
+	uint32_t stacks = 0;
+	uint32_t count  = 0;
+
+	SECTION("Add fills the first stack that is not full")
+	{
+		yars.characterItemAdd(character_id, Item_Stuff, 10);
+
+		count = yars.characterItemCount(character_id, Item_Stuff, stacks);
+		REQUIRE(count  == 10);
+		REQUIRE(stacks == 3);
+		REQUIRE(yars.characterItem(character_id, Item_Stuff, 0).count == 4);
+		REQUIRE(yars.characterItem(character_id, Item_Stuff, 1).count == 4);
+		REQUIRE(yars.characterItem(character_id, Item_Stuff, 2).count == 2);
+
+		yars.characterItemAdd(character_id, Item_Stuff, 3);
+
+		count = yars.characterItemCount(character_id, Item_Stuff, stacks);
+		REQUIRE(count  == 13);
+		REQUIRE(stacks == 4);
+		REQUIRE(yars.characterItem(character_id, Item_Stuff, 2).count == 4);
+		REQUIRE(yars.characterItem(character_id, Item_Stuff, 3).count == 1);
+	}
+
+	SECTION("Remove and Take use the last stack")
+	{
+		yars.characterItemAdd(character_id, Item_Stuff, 10);
+
+		yars.characterItemRemove(character_id, Item_Stuff, 3);
+
+		count = yars.characterItemCount(character_id, Item_Stuff, stacks);
+		REQUIRE(count  == 7);
+		REQUIRE(stacks == 2);
+		REQUIRE(yars.characterItem(character_id, Item_Stuff, 0).count == 4);
+		REQUIRE(yars.characterItem(character_id, Item_Stuff, 1).count == 3);
+
+		yars.characterItemTake(character_id, Item_Stuff);
+
+		count = yars.characterItemCount(character_id, Item_Stuff, stacks);
+		REQUIRE(count  == 6);
+		REQUIRE(stacks == 2);
+		REQUIRE(yars.characterItem(character_id, Item_Stuff, 1).count == 2);
+
+		yars.characterItemRemove(character_id, Item_Stuff, 6);
+		REQUIRE(yars.characterItemExists(character_id, Item_Stuff) == false);
+	}
+
+	SECTION("Restack keeps the cached count")
+	{
+		yars.characterItemAdd(character_id, Item_Stuff, 10);
+
+		yars.characterConfigItemStackMax(character_id, 6);
+		yars.characterItemRestack(character_id, Item_Stuff);
+
+		count = yars.characterItemCount(character_id, Item_Stuff, stacks);
+		REQUIRE(count  == 10);
+		REQUIRE(stacks == 2);
+		REQUIRE(yars.characterItem(character_id, Item_Stuff, 0).count == 6);
+		REQUIRE(yars.characterItem(character_id, Item_Stuff, 1).count == 4);
+
+		yars.characterConfigItemStackMax(character_id, 3);
+		yars.characterItemRestack(character_id, Item_Stuff);
+
+		count = yars.characterItemCount(character_id, Item_Stuff, stacks);
+		REQUIRE(count  == 10);
+		REQUIRE(stacks == 4);
+		REQUIRE(yars.characterItem(character_id, Item_Stuff, 3).count == 1);
+	}
+}
+
+TEST_CASE("Character.Item.Transfer", "[character][item]")
+{
+	Yars yars;
+
+	yars.itemAdd(Item_Stuff, stuff);
+	yars.itemAdd(Item_Glasses, glasses);
+
+	Yars::Id bubba = yars.characterCreate();
+	Yars::Id jimbo = yars.characterCreate();
+
+	yars.characterConfigItemStackMax(bubba, 4);
+	yars.characterConfigItemStackMax(jimbo, 4);
+
+	yars.characterItemAdd(bubba, Item_Stuff, 10);
+
+	uint32_t stacks = 0;
+
+	SECTION("Invalid")
+	{
+		REQUIRE(yars.characterItemTransfer(bubba, 1234,  Item_Stuff, 1) == false);
+		REQUIRE(yars.characterItemTransfer(bubba, bubba, Item_Stuff, 1) == false);
+		REQUIRE(yars.characterItemTransfer(bubba, jimbo, Item_Stuff, 0) == false);
+		REQUIRE(yars.characterItemTransfer(bubba, jimbo, Item_Stuff, 11) == false);
+		REQUIRE(yars.characterItemTransfer(jimbo, bubba, Item_Stuff, 1) == false);
+
+		REQUIRE(yars.characterItemCount(bubba, Item_Stuff) == 10);
+		REQUIRE(yars.characterItemExists(jimbo, Item_Stuff) == false);
+	}
+
+	SECTION("Whole Stacks")
+	{
+		REQUIRE(yars.characterItemTransfer(bubba, jimbo, Item_Stuff, 6));
+
+		REQUIRE(yars.characterItemCount(bubba, Item_Stuff, stacks) == 4);
+		REQUIRE(stacks == 1);
+		REQUIRE(yars.characterItemCount(jimbo, Item_Stuff, stacks) == 6);
+		REQUIRE(stacks == 2);
+		REQUIRE(yars.characterItem(jimbo, Item_Stuff, 0).count == 4);
+		REQUIRE(yars.characterItem(jimbo, Item_Stuff, 1).count == 2);
+	}
+
+	SECTION("Fills Partial Stacks")
+	{
+		yars.characterItemAdd(jimbo, Item_Stuff, 3);
+
+		REQUIRE(yars.characterItemTransfer(bubba, jimbo, Item_Stuff, 3));
+
+		REQUIRE(yars.characterItemCount(bubba, Item_Stuff) == 7);
+		REQUIRE(yars.characterItemCount(jimbo, Item_Stuff, stacks) == 6);
+		REQUIRE(stacks == 2);
+		REQUIRE(yars.characterItem(jimbo, Item_Stuff, 0).count == 4);
+		REQUIRE(yars.characterItem(jimbo, Item_Stuff, 1).count == 2);
+	}
+
+	SECTION("Smaller Stacks")
+	{
+		yars.characterConfigItemStackMax(jimbo, 3);
+
+		REQUIRE(yars.characterItemTransfer(bubba, jimbo, Item_Stuff, 10));
+
+		REQUIRE(yars.characterItemExists(bubba, Item_Stuff) == false);
+		REQUIRE(yars.characterItemCount(jimbo, Item_Stuff, stacks) == 10);
+		REQUIRE(stacks == 4);
+
+		for(uint32_t i = 0; i < stacks; i++)
+		{
+			REQUIRE(yars.characterItem(jimbo, Item_Stuff, i).count <= 3);
+		}
+	}
+
+	SECTION("Item Data Is Moved")
+	{
+		yars.characterItemAdd(bubba, Item_Glasses);
+		yars.characterItem(bubba, Item_Glasses).modify_health_maximum = 42;
+
+		REQUIRE(yars.characterItemTransfer(bubba, jimbo, Item_Glasses));
+
+		REQUIRE(yars.characterItemExists(bubba, Item_Glasses) == false);
+		REQUIRE(yars.characterItem(jimbo, Item_Glasses).modify_health_maximum == 42);
+	}
+}
+
+
+TEST_CASE("Character.Item.Trade", "[character][item]")
+{
+	Yars yars;
+
+	yars.itemAdd(Item_Stuff, stuff);
+	yars.itemAdd(Item_Glasses, glasses);
+
+	Yars::Id bubba = yars.characterCreate();
+	Yars::Id jimbo = yars.characterCreate();
+
+	yars.characterItemAdd(bubba, Item_Stuff, 10);
+	yars.characterItemAdd(jimbo, Item_Glasses, 2);
+
+	SECTION("Invalid")
+	{
+		REQUIRE(yars.characterTrade(bubba, {}, bubba, {}) == false);
+		REQUIRE(yars.characterTrade(bubba, {}, 1234, {}) == false);
+	}
+
+	SECTION("Not Enough")
+	{
+		REQUIRE(yars.characterTrade(bubba, { { Item_Stuff, 5 } }
+			, jimbo, { { Item_Glasses, 3 } }
+			) == false);
+
+		REQUIRE(yars.characterTrade(bubba, { { Item_Stuff, 5 }, { Item_Glasses, 1 } }
+			, jimbo, {}
+			) == false);
+
+		REQUIRE(yars.characterItemCount(bubba, Item_Stuff)   == 10);
+		REQUIRE(yars.characterItemCount(jimbo, Item_Glasses) == 2);
+		REQUIRE(yars.characterItemExists(jimbo, Item_Stuff)   == false);
+		REQUIRE(yars.characterItemExists(bubba, Item_Glasses) == false);
+	}
+
+	SECTION("Trade")
+	{
+		REQUIRE(yars.characterTrade(bubba, { { Item_Stuff, 5 } }
+			, jimbo, { { Item_Glasses, 2 } }
+			));
+
+		REQUIRE(yars.characterItemCount(bubba, Item_Stuff)   == 5);
+		REQUIRE(yars.characterItemCount(bubba, Item_Glasses) == 2);
+		REQUIRE(yars.characterItemCount(jimbo, Item_Stuff)   == 5);
+		REQUIRE(yars.characterItemExists(jimbo, Item_Glasses) == false);
+
+		REQUIRE(yars.itemSupply(Item_Stuff)              == 10);
+		REQUIRE(yars.itemHolderAmount(Item_Glasses, bubba) == 2);
+	}
+}
+
 TEST_CASE("Character.Equipment.Add", "[character][equipment][item]")
 {
 	Yars yars;
@@ -2462,6 +2919,65 @@ TEST_CASE("Character.Affect.Defend", "[character][level][skill]")
 }
 
 
+TEST_CASE("Character.Affect.Defend.Best", "[character][level][skill]")
+{
+	Yars yars;
+
+	SECTION("Bad Character Id")
+	{
+		REQUIRE(yars.characterAffectDefend(0, 0) == false);
+	}
+
+	SECTION("Bad Affect Id")
+	{
+		Yars::Id character_id = yars.characterCreate();
+
+		REQUIRE(yars.characterAffectDefend(character_id, 0) == false);
+	}
+
+	yars.skillAdd(Skill_Acting,    {});
+	yars.skillAdd(Skill_Mentalist, {});
+
+	Yars::Id affect_id = yars.affectCreate();
+	yars.affect(affect_id) =
+	{	.level                 = 10
+	,	.modify_health_current = -1
+	,	.defense_skill         = { Skill_Acting, Skill_Mentalist }
+	};
+
+	Yars::Id character_id = yars.characterCreate();
+
+	SECTION("No Defense Skill")
+	{
+		REQUIRE(yars.characterAffectDefend(character_id, affect_id) == true);
+		REQUIRE(yars.characterAffectExists(character_id, affect_id) == true);
+	}
+
+	SECTION("Weak Skill Is Ignored")
+	{
+		yars.characterSkillAdd(character_id, Skill_Acting);
+		yars.characterSkillAdd(character_id, Skill_Mentalist);
+
+		yars.levelSet(yars.characterSkill(character_id, Skill_Acting).level,      1);
+		yars.levelSet(yars.characterSkill(character_id, Skill_Mentalist).level, 100);
+
+		// Using Acting would automatically fail, Mentalist automatically succeeds
+		REQUIRE(yars.characterAffectDefend(character_id, affect_id) == false);
+		REQUIRE(yars.characterAffectExists(character_id, affect_id) == false);
+	}
+
+	SECTION("Best Skill Is Weak")
+	{
+		yars.characterSkillAdd(character_id, Skill_Mentalist);
+
+		yars.levelSet(yars.characterSkill(character_id, Skill_Mentalist).level, 1);
+
+		REQUIRE(yars.characterAffectDefend(character_id, affect_id) == true);
+		REQUIRE(yars.characterAffectExists(character_id, affect_id) == true);
+	}
+}
+
+
 TEST_CASE("Character.Affect.Exists", "[affect][character]")
 {
 	Yars yars;
@@ -0,0 +1,285 @@
+/*
+g++ -std=c++2a -DCATCH_CONFIG_MAIN -Wall -Werror -o CharacterLedger CharacterLedger.cpp && ./CharacterLedger
+ */
+
+#ifdef CATCH_CONFIG_MAIN
+#define ZAKERO_YARS_IMPLEMENTATION
+#define ZAKERO_YARS_ENABLE_DEBUG
+#define ZAKERO_YARS_ENABLE_ID_SHUFFLE
+#define ZAKERO_YARS_ENABLE_SAFE_MODE
+#endif
+
+#include "../src/Zakero_Yars.h"
+#include "catch.hpp"
+
+using namespace zakero;
+
+namespace
+{
+	const std::string Attr_Name  = "attribute";
+	const std::string Skill_Name = "skill";
+
+	const std::string Item_Helmet = "helmet";
+	Yars::Item helmet =
+	{	.modify_attribute =
+		{	{ Attr_Name, 2 }
+		}
+	,	.modify_skill =
+		{	{ Skill_Name, 3 }
+		}
+	,	.skill_attacker =
+		{	Skill_Name
+		}
+	,	.modify_health_maximum = 10
+	};
+
+	const std::string Item_Ring = "ring";
+	Yars::Item ring =
+	{	.modify_skill =
+		{	{ Skill_Name, 1 }
+		}
+	,	.skill_attacker =
+		{	Skill_Name
+		}
+	};
+
+	const std::string Equip_Head   = "head";
+	const std::string Equip_Finger = "finger";
+}
+
+TEST_CASE("Character.Ledger.Handle", "[character][ledger]")
+{
+	Yars yars;
+
+	REQUIRE(yars.attributeHandle(Attr_Name) == Yars::Handle_Invalid);
+	REQUIRE(yars.skillHandle(Skill_Name)    == Yars::Handle_Invalid);
+
+	yars.skillAdd(Skill_Name,
+	{	.attribute_contribution =
+		{	{ Attr_Name, 1 }
+		}
+	});
+
+	const Yars::Handle attr  = yars.attributeHandle(Attr_Name);
+	const Yars::Handle skill = yars.skillHandle(Skill_Name);
+
+	REQUIRE(attr  != Yars::Handle_Invalid);
+	REQUIRE(skill != Yars::Handle_Invalid);
+	REQUIRE(yars.attributeHandleName(attr) == Attr_Name);
+	REQUIRE(yars.skillHandleName(skill)    == Skill_Name);
+	REQUIRE(yars.skillHandleName(Yars::Handle_Invalid).empty());
+
+	yars.skillRemove(Skill_Name);
+	REQUIRE(yars.skillHandle(Skill_Name) == skill);
+}
+
+
+TEST_CASE("Character.Ledger.Enable", "[character][ledger]")
+{
+	Yars yars;
+
+	SECTION("Invalid Character")
+	{
+		REQUIRE(yars.characterLedgerEnable(1234) == false);
+		REQUIRE(yars.characterLedgerIsEnabled(1234) == false);
+		REQUIRE(yars.characterLedgerRebuild(1234) == false);
+		REQUIRE(&yars.characterLedger(1234) == nullptr);
+	}
+
+	Yars::Id character_id = yars.characterCreate();
+
+	SECTION("Disabled by default")
+	{
+		REQUIRE(yars.characterLedgerIsEnabled(character_id) == false);
+		REQUIRE(yars.characterLedgerRebuild(character_id) == false);
+		REQUIRE(yars.characterLedgerSkill(character_id, Skill_Name) == 0);
+		REQUIRE(yars.characterLedgerSkillSource(character_id, Skill_Name).empty());
+	}
+
+	SECTION("Enable and Disable")
+	{
+		REQUIRE(yars.characterLedgerEnable(character_id) == true);
+		REQUIRE(yars.characterLedgerIsEnabled(character_id) == true);
+		REQUIRE(&yars.characterLedger(character_id) != nullptr);
+
+		REQUIRE(yars.characterLedgerEnable(character_id, false) == true);
+		REQUIRE(yars.characterLedgerIsEnabled(character_id) == false);
+	}
+
+	SECTION("Cleared on Create")
+	{
+		yars.characterLedgerEnable(character_id);
+		yars.characterDelete(character_id);
+
+		Yars::Id new_id = yars.characterCreate();
+		REQUIRE(new_id == character_id);
+		REQUIRE(yars.characterLedgerIsEnabled(new_id) == false);
+	}
+}
+
+
+TEST_CASE("Character.Ledger.Equipment", "[character][ledger][equipment]")
+{
+	Yars yars;
+
+	yars.skillAdd(Skill_Name, {});
+	yars.itemAdd(Item_Helmet, helmet);
+	yars.itemAdd(Item_Ring,   ring);
+
+	Yars::Id character_id = yars.characterCreate();
+	yars.characterItemAdd(character_id, Item_Helmet);
+	yars.characterItemAdd(character_id, Item_Ring);
+
+	SECTION("Incremental")
+	{
+		yars.characterLedgerEnable(character_id);
+
+		yars.characterEquipmentAdd(character_id, Equip_Head,   Item_Helmet);
+		yars.characterEquipmentAdd(character_id, Equip_Finger, Item_Ring);
+
+		REQUIRE(yars.characterLedgerAttribute(character_id, Attr_Name) == 2);
+		REQUIRE(yars.characterLedgerSkill(character_id, Skill_Name)    == 4);
+		REQUIRE(yars.characterLedgerHealthMaximum(character_id)        == 10);
+
+		const Yars::Handle skill = yars.skillHandle(Skill_Name);
+		REQUIRE(yars.characterLedgerSkill(character_id, skill) == 4);
+		REQUIRE(yars.characterLedger(character_id).skill[skill] == 4);
+
+		REQUIRE(yars.characterLedgerSkill(character_id, skill)
+			== yars.characterSkill(character_id, Skill_Name).level.modifier
+			);
+
+		yars.characterEquipmentRemove(character_id, Equip_Head);
+
+		REQUIRE(yars.characterLedgerAttribute(character_id, Attr_Name) == 0);
+		REQUIRE(yars.characterLedgerSkill(character_id, Skill_Name)    == 1);
+		REQUIRE(yars.characterLedgerHealthMaximum(character_id)        == 0);
+	}
+
+	SECTION("Enable after Equip")
+	{
+		yars.characterEquipmentAdd(character_id, Equip_Head,   Item_Helmet);
+		yars.characterEquipmentAdd(character_id, Equip_Finger, Item_Ring);
+
+		yars.characterLedgerEnable(character_id);
+
+		REQUIRE(yars.characterLedgerAttribute(character_id, Attr_Name) == 2);
+		REQUIRE(yars.characterLedgerSkill(character_id, Skill_Name)    == 4);
+		REQUIRE(yars.characterLedgerHealthMaximum(character_id)        == 10);
+	}
+
+	SECTION("Source")
+	{
+		yars.characterLedgerEnable(character_id);
+
+		yars.characterEquipmentAdd(character_id, Equip_Head,   Item_Helmet);
+		yars.characterEquipmentAdd(character_id, Equip_Finger, Item_Ring);
+
+		Yars::VectorLedgerContribution source;
+
+		source = yars.characterLedgerSkillSource(character_id, Skill_Name);
+		REQUIRE(source.size() == 2);
+
+		int32_t total = 0;
+		for(const auto& contribution : source)
+		{
+			REQUIRE(contribution.source == Yars::LedgerSource::Equipment);
+
+			if(contribution.location == Equip_Head)
+			{
+				REQUIRE(contribution.amount == 3);
+			}
+			else
+			{
+				REQUIRE(contribution.location == Equip_Finger);
+				REQUIRE(contribution.amount   == 1);
+			}
+
+			total += contribution.amount;
+		}
+		REQUIRE(total == yars.characterLedgerSkill(character_id, Skill_Name));
+
+		source = yars.characterLedgerAttributeSource(character_id, Attr_Name);
+		REQUIRE(source.size() == 1);
+		REQUIRE(source[0].location == Equip_Head);
+
+		source = yars.characterLedgerHealthMaximumSource(character_id);
+		REQUIRE(source.size() == 1);
+		REQUIRE(source[0].amount == 10);
+
+		source = yars.characterLedgerSkillSource(character_id, "unknown");
+		REQUIRE(source.empty());
+	}
+
+	SECTION("Rebuild")
+	{
+		yars.characterLedgerEnable(character_id);
+
+		yars.characterEquipmentAdd(character_id, Equip_Finger, Item_Ring);
+		yars.characterEquipmentItem(character_id, Equip_Finger).modify_skill[Skill_Name] = 5;
+
+		REQUIRE(yars.characterLedgerSkill(character_id, Skill_Name) == 1);
+		REQUIRE(yars.characterLedgerRebuild(character_id) == true);
+		REQUIRE(yars.characterLedgerSkill(character_id, Skill_Name) == 5);
+	}
+}
+
+
+TEST_CASE("Character.Ledger.Affect", "[character][ledger][affect]")
+{
+	Yars yars;
+
+	yars.skillAdd(Skill_Name,
+	{	.attribute_contribution =
+		{	{ Attr_Name, 1 }
+		}
+	});
+
+	Yars::Id character_id = yars.characterCreate();
+	yars.characterSkillAdd(character_id, Skill_Name);
+	yars.characterLedgerEnable(character_id);
+
+	Yars::Id affect_id = yars.affectCreate();
+	Yars::Affect& affect = yars.affect(affect_id);
+	affect.modify_skill[Skill_Name]    = 4;
+	affect.modify_attribute[Attr_Name] = -1;
+	affect.modify_health_maximum       = 5;
+
+	yars.characterAffectApply(character_id, affect_id);
+
+	REQUIRE(yars.characterLedgerSkill(character_id, Skill_Name)    == 4);
+	REQUIRE(yars.characterLedgerAttribute(character_id, Attr_Name) == -1);
+	REQUIRE(yars.characterLedgerHealthMaximum(character_id)        == 5);
+
+	Yars::VectorLedgerContribution source = yars.characterLedgerSkillSource(character_id, Skill_Name);
+	REQUIRE(source.size() == 1);
+	REQUIRE(source[0].source    == Yars::LedgerSource::Affect);
+	REQUIRE(source[0].affect_id == affect_id);
+	REQUIRE(source[0].amount    == 4);
+
+	SECTION("Revert")
+	{
+		yars.characterAffectRevert(character_id, affect_id);
+
+		REQUIRE(yars.characterAffectExists(character_id, affect_id) == false);
+		REQUIRE(yars.characterLedgerSkill(character_id, Skill_Name)    == 0);
+		REQUIRE(yars.characterLedgerAttribute(character_id, Attr_Name) == 0);
+		REQUIRE(yars.characterLedgerHealthMaximum(character_id)        == 0);
+		REQUIRE(yars.characterSkill(character_id, Skill_Name).level.modifier == 0);
+	}
+
+	SECTION("Remove")
+	{
+		yars.characterAffectRemove(character_id, affect_id);
+
+		REQUIRE(yars.characterLedgerSkill(character_id, Skill_Name) == 0);
+		REQUIRE(yars.characterSkill(character_id, Skill_Name).level.modifier == 4);
+	}
+
+	SECTION("Rebuild")
+	{
+		REQUIRE(yars.characterLedgerRebuild(character_id) == true);
+		REQUIRE(yars.characterLedgerSkill(character_id, Skill_Name) == 4);
+		REQUIRE(yars.characterLedgerHealthMaximum(character_id)     == 5);
+	}
+}
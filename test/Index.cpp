@@ -0,0 +1,273 @@
+/*
+g++ -std=c++2a -DCATCH_CONFIG_MAIN -Wall -Werror -o Index Index.cpp && ./Index
+ */
+
+#ifdef CATCH_CONFIG_MAIN
+#define ZAKERO_YARS_IMPLEMENTATION
+#define ZAKERO_YARS_ENABLE_DEBUG
+#define ZAKERO_YARS_ENABLE_ID_SHUFFLE
+#define ZAKERO_YARS_ENABLE_SAFE_MODE
+#endif
+
+#include "../src/Zakero_Yars.h"
+#include "catch.hpp"
+
+using namespace zakero;
+
+namespace
+{
+	const std::string Skill_Smith = "Smith";
+	const std::string Skill_Sword = "Sword";
+	const std::string Item_Key    = "Key";
+	const std::string Item_Ring   = "Ring";
+	const std::string Data_Gold   = "Gold";
+
+	Yars::Id create(Yars& yars
+		, const uint32_t smith
+		)
+	{
+		Yars::Id id = yars.characterCreate();
+
+		yars.characterSkillAdd(id, Skill_Smith);
+		yars.levelSet(yars.characterSkill(id, Skill_Smith).level, smith);
+
+		return id;
+	}
+
+	Yars::VectorId sorted(Yars::VectorId id_list)
+	{
+		std::sort(std::begin(id_list), std::end(id_list));
+
+		return id_list;
+	}
+}
+
+
+TEST_CASE("Index.Add", "[index]")
+{
+	Yars yars;
+
+	SECTION("Invalid")
+	{
+		REQUIRE(yars.indexSkillAdd("") == false);
+		REQUIRE(yars.indexSkillRemove(Skill_Smith) == false);
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 0).empty() == true);
+	}
+
+	SECTION("Add And Remove")
+	{
+		REQUIRE(yars.indexSkillAdd(Skill_Smith));
+		REQUIRE(yars.indexSkillAdd(Skill_Smith) == false);
+		REQUIRE(yars.indexSkillExists(Skill_Smith));
+		REQUIRE(yars.indexItemExists(Skill_Smith) == false);
+
+		REQUIRE(yars.indexSkillRemove(Skill_Smith));
+		REQUIRE(yars.indexSkillExists(Skill_Smith) == false);
+
+		REQUIRE(yars.indexItemAdd(Item_Key));
+		REQUIRE(yars.indexItemExists(Item_Key));
+		REQUIRE(yars.indexItemRemove(Item_Key));
+
+		REQUIRE(yars.indexDataAdd(Data_Gold));
+		REQUIRE(yars.indexDataExists(Data_Gold));
+		REQUIRE(yars.indexDataRemove(Data_Gold));
+	}
+}
+
+
+TEST_CASE("Index.Skill", "[index][skill]")
+{
+	Yars yars;
+
+	yars.skillAdd(Skill_Smith, {});
+	yars.skillAdd(Skill_Sword, {});
+
+	Yars::Id novice = create(yars, 5);
+	Yars::Id expert = create(yars, 50);
+	Yars::Id master = create(yars, 90);
+	Yars::Id fighter = yars.characterCreate();
+	yars.characterSkillAdd(fighter, Skill_Sword);
+
+	SECTION("Existing Characters")
+	{
+		yars.indexSkillAdd(Skill_Smith);
+
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 0) == Yars::VectorId{ novice, expert, master });
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 50) == Yars::VectorId{ expert, master });
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 6, 89) == Yars::VectorId{ expert });
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 91).empty() == true);
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 90, 0).empty() == true);
+	}
+
+	yars.indexSkillAdd(Skill_Smith);
+
+	SECTION("New Characters")
+	{
+		Yars::Id other = create(yars, 60);
+
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 50) == Yars::VectorId{ expert, other, master });
+	}
+
+	SECTION("Level Changed")
+	{
+		yars.levelSet(yars.characterSkill(novice, Skill_Smith).level, 105);
+
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 50) == Yars::VectorId{ expert, master, novice });
+
+		yars.levelSet(yars.characterSkill(master, Skill_Smith).level, 10);
+
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 50) == Yars::VectorId{ expert, novice });
+	}
+
+	SECTION("Skill Added And Removed")
+	{
+		yars.characterSkillAdd(fighter, Skill_Smith);
+
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 0, 0) == Yars::VectorId{ fighter });
+
+		yars.characterSkillRemove(expert, Skill_Smith);
+
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 0) == Yars::VectorId{ fighter, novice, master });
+	}
+
+	SECTION("Character Deleted")
+	{
+		yars.characterDelete(expert);
+
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 0) == Yars::VectorId{ novice, master });
+	}
+
+	SECTION("Layer")
+	{
+		yars.layerAdd("Forge", { .modify_skill = { { Skill_Smith, 10 } } });
+
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 10, 20).empty() == true);
+
+		yars.characterLayerAdd(novice, "Forge");
+
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 10, 20) == Yars::VectorId{ novice });
+
+		yars.layerAdd("Event", { .modify_skill = { { Skill_Smith, 40 } }, .is_global = true });
+
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 50, 60) == Yars::VectorId{ novice });
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 90) == Yars::VectorId{ expert, master });
+	}
+
+	SECTION("Layer On Another Skill")
+	{
+		yars.levelSet(yars.characterSkill(fighter, Skill_Sword).level, 10);
+		yars.indexSkillAdd(Skill_Sword);
+
+		REQUIRE(yars.indexSkillRange(Skill_Sword, 10, 10) == Yars::VectorId{ fighter });
+
+		yars.layerAdd("Arena", { .modify_skill = { { Skill_Sword, 30 } }, .is_global = true });
+
+		REQUIRE(yars.indexSkillRange(Skill_Sword, 40, 40) == Yars::VectorId{ fighter });
+		REQUIRE(yars.indexSkillRange(Skill_Smith, 0) == Yars::VectorId{ novice, expert, master });
+
+		yars.layerRemove("Arena");
+
+		REQUIRE(yars.indexSkillRange(Skill_Sword, 10, 10) == Yars::VectorId{ fighter });
+	}
+
+	SECTION("Archetype")
+	{
+		yars.archetypeAdd("Master", master);
+
+		Yars::VectorId wave;
+		yars.characterSpawn("Master", 3, wave);
+
+		REQUIRE(sorted(yars.indexSkillRange(Skill_Smith, 90)) == sorted({ master, wave[0], wave[1], wave[2] }));
+	}
+}
+
+
+TEST_CASE("Index.Item", "[index][item]")
+{
+	Yars yars;
+
+	yars.skillAdd(Skill_Smith, {});
+	yars.itemAdd(Item_Key, {});
+	yars.itemAdd(Item_Ring, { .skill_defender = { Skill_Smith } });
+
+	Yars::Id bubba = yars.characterCreate();
+	Yars::Id jimbo = yars.characterCreate();
+
+	yars.characterItemAdd(bubba, Item_Key, 3);
+	yars.characterItemAdd(jimbo, Item_Ring, 2);
+
+	yars.indexItemAdd(Item_Key);
+	yars.indexItemAdd(Item_Ring);
+
+	REQUIRE(yars.indexItemRange(Item_Key) == Yars::VectorId{ bubba });
+	REQUIRE(yars.indexItemRange(Item_Ring) == Yars::VectorId{ jimbo });
+
+	SECTION("Add And Remove")
+	{
+		yars.characterItemAdd(jimbo, Item_Key);
+
+		REQUIRE(yars.indexItemRange(Item_Key) == Yars::VectorId{ jimbo, bubba });
+		REQUIRE(yars.indexItemRange(Item_Key, 2) == Yars::VectorId{ bubba });
+
+		yars.characterItemRemove(bubba, Item_Key, 3);
+
+		REQUIRE(yars.indexItemRange(Item_Key) == Yars::VectorId{ jimbo });
+	}
+
+	SECTION("Equipment")
+	{
+		yars.characterEquipmentAdd(jimbo, "Left Hand", Item_Ring);
+
+		REQUIRE(yars.indexItemRange(Item_Ring, 2, 2) == Yars::VectorId{ jimbo });
+
+		yars.characterEquipmentAdd(jimbo, "Right Hand", Item_Ring);
+
+		REQUIRE(yars.characterItemCount(jimbo, Item_Ring) == 0);
+		REQUIRE(yars.indexItemRange(Item_Ring, 2, 2) == Yars::VectorId{ jimbo });
+
+		yars.characterEquipmentRemove(jimbo, "Left Hand");
+
+		REQUIRE(yars.indexItemRange(Item_Ring, 2, 2) == Yars::VectorId{ jimbo });
+	}
+}
+
+
+TEST_CASE("Index.Data", "[index][data]")
+{
+	Yars yars;
+
+	Yars::Id bubba = yars.characterCreate();
+	Yars::Id jimbo = yars.characterCreate();
+	Yars::Id other = yars.characterCreate();
+
+	yars.characterDataSet(bubba, Data_Gold, 100);
+	yars.characterDataSet(jimbo, Data_Gold, -5);
+	yars.characterDataSet(other, Data_Gold, std::string("Lots"));
+
+	yars.indexDataAdd(Data_Gold);
+
+	REQUIRE(yars.indexDataRange(Data_Gold, -10, 1000) == Yars::VectorId{ jimbo, bubba });
+
+	SECTION("Set")
+	{
+		yars.characterDataSet(other, Data_Gold, 500);
+		yars.characterDataSet(bubba, Data_Gold, 1000);
+
+		REQUIRE(yars.indexDataRange(Data_Gold, 0, 1000) == Yars::VectorId{ other, bubba });
+	}
+
+	SECTION("Set Map")
+	{
+		yars.characterDataSet(jimbo, Yars::MapStringInt32{ { Data_Gold, 50 } });
+
+		REQUIRE(yars.indexDataRange(Data_Gold, 0, 1000) == Yars::VectorId{ jimbo, bubba });
+	}
+
+	SECTION("Erase And Clear")
+	{
+		yars.characterDataErase(bubba, Data_Gold);
+		yars.characterDataClear(jimbo);
+
+		REQUIRE(yars.indexDataRange(Data_Gold, -10, 1000).empty() == true);
+	}
+}
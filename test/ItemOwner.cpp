@@ -0,0 +1,152 @@
+/*
+g++ -std=c++2a -DCATCH_CONFIG_MAIN -Wall -Werror -o ItemOwner ItemOwner.cpp && ./ItemOwner
+ */
+
+#ifdef CATCH_CONFIG_MAIN
+#define ZAKERO_YARS_IMPLEMENTATION
+#define ZAKERO_YARS_ENABLE_DEBUG
+#define ZAKERO_YARS_ENABLE_ID_SHUFFLE
+#define ZAKERO_YARS_ENABLE_SAFE_MODE
+#endif
+
+#include "../src/Zakero_Yars.h"
+#include "catch.hpp"
+
+using namespace zakero;
+
+namespace
+{
+	const std::string Skill_Sword = "Sword";
+	const std::string Item_Coin   = "Coin";
+	const std::string Item_Sword  = "Sword";
+
+	Yars::VectorId sorted(Yars::VectorId id_list)
+	{
+		std::sort(std::begin(id_list), std::end(id_list));
+
+		return id_list;
+	}
+}
+
+
+TEST_CASE("ItemOwner.Inventory", "[item][character]")
+{
+	Yars yars;
+
+	yars.itemAdd(Item_Coin, {});
+
+	Yars::Id bubba = yars.characterCreate();
+	Yars::Id jimbo = yars.characterCreate();
+
+	REQUIRE(yars.itemSupply(Item_Coin)      == 0);
+	REQUIRE(yars.itemHolderCount(Item_Coin) == 0);
+	REQUIRE(yars.itemHolderList(Item_Coin).empty() == true);
+
+	yars.characterItemAdd(bubba, Item_Coin, 100);
+	yars.characterItemAdd(jimbo, Item_Coin, 5);
+
+	REQUIRE(yars.itemSupply(Item_Coin)              == 105);
+	REQUIRE(yars.itemHolderCount(Item_Coin)         == 2);
+	REQUIRE(yars.itemHolderAmount(Item_Coin, bubba) == 100);
+	REQUIRE(yars.itemHolderAmount(Item_Coin, jimbo) == 5);
+	REQUIRE(sorted(yars.itemHolderList(Item_Coin)) == Yars::VectorId{ bubba, jimbo });
+
+	SECTION("Remove")
+	{
+		yars.characterItemRemove(bubba, Item_Coin, 30);
+
+		REQUIRE(yars.itemSupply(Item_Coin)              == 75);
+		REQUIRE(yars.itemHolderAmount(Item_Coin, bubba) == 70);
+
+		yars.characterItemRemove(jimbo, Item_Coin, 500);
+
+		REQUIRE(yars.itemSupply(Item_Coin)              == 70);
+		REQUIRE(yars.itemHolderCount(Item_Coin)         == 1);
+		REQUIRE(yars.itemHolderAmount(Item_Coin, jimbo) == 0);
+	}
+
+	SECTION("Take")
+	{
+		yars.characterItemTake(jimbo, Item_Coin);
+
+		REQUIRE(yars.itemSupply(Item_Coin)              == 104);
+		REQUIRE(yars.itemHolderAmount(Item_Coin, jimbo) == 4);
+	}
+
+	SECTION("Restack")
+	{
+		yars.characterItem(bubba, Item_Coin).count += 10;
+		yars.characterItemRestack(bubba);
+
+		REQUIRE(yars.itemSupply(Item_Coin)              == 115);
+		REQUIRE(yars.itemHolderAmount(Item_Coin, bubba) == 110);
+	}
+
+	SECTION("Character Deleted")
+	{
+		yars.characterDelete(bubba);
+
+		REQUIRE(yars.itemSupply(Item_Coin)      == 5);
+		REQUIRE(yars.itemHolderCount(Item_Coin) == 1);
+
+		Yars::Id other = yars.characterCreate();
+
+		REQUIRE(other == bubba);
+		REQUIRE(yars.itemSupply(Item_Coin) == 5);
+	}
+}
+
+
+TEST_CASE("ItemOwner.Equipment", "[item][character][equipment]")
+{
+	Yars yars;
+
+	yars.skillAdd(Skill_Sword, {});
+	yars.itemAdd(Item_Sword, { .skill_attacker = { Skill_Sword } });
+
+	Yars::Id bubba = yars.characterCreate();
+
+	yars.characterItemAdd(bubba, Item_Sword, 2);
+	yars.characterEquipmentAdd(bubba, "Left Hand", Item_Sword);
+	yars.characterEquipmentAdd(bubba, "Right Hand", Item_Sword);
+
+	REQUIRE(yars.characterItemCount(bubba, Item_Sword) == 0);
+	REQUIRE(yars.itemSupply(Item_Sword)                == 2);
+	REQUIRE(yars.itemHolderAmount(Item_Sword, bubba)   == 2);
+
+	yars.characterEquipmentRemove(bubba, "Left Hand");
+
+	REQUIRE(yars.itemSupply(Item_Sword)              == 2);
+	REQUIRE(yars.itemHolderAmount(Item_Sword, bubba) == 2);
+
+	SECTION("Archetype")
+	{
+		yars.archetypeAdd("Fighter", bubba);
+
+		Yars::VectorId wave;
+		yars.characterSpawn("Fighter", 10, wave);
+
+		REQUIRE(yars.itemSupply(Item_Sword)      == 22);
+		REQUIRE(yars.itemHolderCount(Item_Sword) == 11);
+		REQUIRE(yars.itemHolderAmount(Item_Sword, wave[0]) == 2);
+
+		Yars::Id clone_id = 0;
+		yars.characterClone(wave[0], clone_id);
+
+		REQUIRE(yars.itemSupply(Item_Sword) == 24);
+	}
+
+	SECTION("Character Cleared")
+	{
+		Yars::Id other = yars.characterCreate();
+
+		yars.characterDelete(bubba);
+
+		REQUIRE(yars.itemSupply(Item_Sword) == 0);
+		REQUIRE(yars.itemHolderAmount(Item_Sword, bubba) == 0);
+
+		yars.characterItemAdd(other, Item_Sword);
+
+		REQUIRE(yars.itemSupply(Item_Sword) == 1);
+	}
+}
@@ -0,0 +1,269 @@
+/*
+g++ -std=c++2a -DCATCH_CONFIG_MAIN -Wall -Werror -o Layer Layer.cpp && ./Layer
+ */
+
+#ifdef CATCH_CONFIG_MAIN
+#define ZAKERO_YARS_IMPLEMENTATION
+#define ZAKERO_YARS_ENABLE_DEBUG
+#define ZAKERO_YARS_ENABLE_ID_SHUFFLE
+#define ZAKERO_YARS_ENABLE_SAFE_MODE
+#endif
+
+#include "../src/Zakero_Yars.h"
+#include "catch.hpp"
+
+using namespace zakero;
+
+namespace
+{
+	const std::string Attr_Strength = "Strength";
+	const std::string Skill_Smith   = "Craft.Smith";
+	const std::string Skill_Sword   = "Sword.Swing";
+	const std::string Layer_Event   = "Event.Crafting";
+	const std::string Layer_Forge   = "Zone.Forge";
+
+	const Yars::Skill smith =
+	{	.attribute_contribution =
+		{	{ Attr_Strength, 1 }
+		}
+	};
+
+	void setup(Yars& yars
+		, Yars::Id& bubba
+		)
+	{
+		yars.skillAdd(Skill_Smith, smith);
+		yars.skillAdd(Skill_Sword, {});
+
+		bubba = yars.characterCreate();
+		yars.characterSkillAdd(bubba, Skill_Smith);
+		yars.characterLevelSet(bubba, Skill_Smith, 10);
+		yars.levelSet(yars.characterSkill(bubba, Skill_Smith).level, 10);
+	}
+}
+
+
+TEST_CASE("Layer.Add", "[layer]")
+{
+	Yars yars;
+
+	REQUIRE(yars.layerList().empty() == true);
+
+	SECTION("Invalid Name")
+	{
+		REQUIRE(yars.layerAdd("", {}) == false);
+	}
+
+	SECTION("Add")
+	{
+		REQUIRE(yars.layerAdd(Layer_Event, { .is_global = true }));
+		REQUIRE(yars.layerExists(Layer_Event));
+		REQUIRE(yars.layer(Layer_Event).is_global == true);
+		REQUIRE(yars.layerList() == Yars::VectorString{ Layer_Event });
+
+		REQUIRE(yars.layerAdd(Layer_Event, {}) == false);
+	}
+
+	SECTION("Remove")
+	{
+		REQUIRE(yars.layerRemove(Layer_Event) == false);
+
+		yars.layerAdd(Layer_Event, {});
+
+		REQUIRE(yars.layerRemove(Layer_Event));
+		REQUIRE(yars.layerExists(Layer_Event) == false);
+	}
+}
+
+
+TEST_CASE("Layer.Global", "[layer][character]")
+{
+	Yars yars;
+	Yars::Id bubba = 0;
+
+	setup(yars, bubba);
+
+	const Yars& y = yars;
+
+	REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value == 10);
+
+	yars.layerAdd(Layer_Event,
+		{	.modify_attribute = { { Attr_Strength, 3 } }
+		,	.modify_skill     = { { Skill_Smith, 2 }, { Skill_Sword, 5 } }
+		,	.is_global        = true
+		});
+
+	SECTION("Applied When Added")
+	{
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value    == 12);
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.modifier == 2);
+		REQUIRE(y.characterAttribute(bubba, Attr_Strength).level.modifier == 3);
+
+		// Layers do not add Skills
+		REQUIRE(yars.characterSkillExists(bubba, Skill_Sword) == false);
+	}
+
+	SECTION("New Character")
+	{
+		Yars::Id other = yars.characterCreate();
+		yars.characterSkillAdd(other, Skill_Smith);
+
+		REQUIRE(y.characterSkill(other, Skill_Smith).level.modifier == 2);
+	}
+
+	SECTION("New Skill")
+	{
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value == 12);
+
+		yars.characterSkillAdd(bubba, Skill_Sword);
+
+		REQUIRE(y.characterSkill(bubba, Skill_Sword).level.modifier == 5);
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.modifier == 2);
+
+		yars.characterSkillRemove(bubba, Skill_Sword);
+		yars.characterSkillAdd(bubba, Skill_Sword);
+
+		REQUIRE(y.characterSkill(bubba, Skill_Sword).level.modifier == 5);
+	}
+
+	SECTION("Removed")
+	{
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value == 12);
+
+		yars.layerRemove(Layer_Event);
+
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value    == 10);
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.modifier == 0);
+		REQUIRE(y.characterAttribute(bubba, Attr_Strength).level.modifier == 0);
+	}
+
+	SECTION("Removed Before Access")
+	{
+		yars.layerRemove(Layer_Event);
+
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value == 10);
+	}
+
+	SECTION("Added Through Map")
+	{
+		yars.characterSkillMap(bubba)[Skill_Sword] = {};
+
+		REQUIRE(y.characterSkill(bubba, Skill_Sword).level.modifier == 0);
+
+		yars.characterLayerSync(bubba);
+
+		REQUIRE(y.characterSkill(bubba, Skill_Sword).level.modifier == 5);
+	}
+
+	SECTION("Name")
+	{
+		REQUIRE(y.characterSkill(bubba, "Craft.Smith"_yars).level.value == 12);
+		REQUIRE(y.characterSkillMap(bubba).at(Skill_Smith).level.value == 12);
+	}
+
+	SECTION("Modifier")
+	{
+		const float with_layer = yars.calculateModifier(bubba, Skill_Smith);
+
+		yars.layerRemove(Layer_Event);
+
+		REQUIRE(yars.calculateModifier(bubba, Skill_Smith) != with_layer);
+	}
+
+	SECTION("Modifier Cache")
+	{
+		yars.layerRemove(Layer_Event);
+		yars.characterModifierCacheEnable(bubba);
+
+		const float without_layer = yars.calculateModifier(bubba, Skill_Smith);
+
+		yars.layerAdd(Layer_Event,
+			{	.modify_attribute = { { Attr_Strength, 3 } }
+			,	.is_global        = true
+			});
+
+		REQUIRE(yars.calculateModifier(bubba, Skill_Smith) != without_layer);
+
+		yars.layerRemove(Layer_Event);
+
+		REQUIRE(yars.calculateModifier(bubba, Skill_Smith) == without_layer);
+	}
+}
+
+
+TEST_CASE("Layer.Group", "[layer][character]")
+{
+	Yars yars;
+	Yars::Id bubba = 0;
+
+	setup(yars, bubba);
+
+	const Yars& y = yars;
+
+	yars.layerAdd(Layer_Forge, { .modify_skill = { { Skill_Smith, 1 } } });
+
+	REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value == 10);
+
+	SECTION("Invalid")
+	{
+		REQUIRE(yars.characterLayerAdd(1234, Layer_Forge) == false);
+		REQUIRE(yars.characterLayerAdd(bubba, "") == false);
+		REQUIRE(yars.characterLayerRemove(bubba, Layer_Forge) == false);
+	}
+
+	SECTION("Add And Remove")
+	{
+		REQUIRE(yars.characterLayerAdd(bubba, Layer_Forge));
+		REQUIRE(yars.characterLayerAdd(bubba, Layer_Forge) == false);
+		REQUIRE(yars.characterLayerExists(bubba, Layer_Forge));
+		REQUIRE(yars.characterLayerList(bubba) == Yars::VectorString{ Layer_Forge });
+
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value == 11);
+
+		REQUIRE(yars.characterLayerRemove(bubba, Layer_Forge));
+		REQUIRE(yars.characterLayerExists(bubba, Layer_Forge) == false);
+
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value == 10);
+	}
+
+	SECTION("Layer Added Later")
+	{
+		REQUIRE(yars.characterLayerAdd(bubba, "Zone.Mine"));
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value == 10);
+
+		yars.layerAdd("Zone.Mine", { .modify_skill = { { Skill_Smith, 4 } } });
+
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value == 14);
+	}
+
+	SECTION("Stacks With Global And Affects")
+	{
+		yars.characterLayerAdd(bubba, Layer_Forge);
+		yars.layerAdd(Layer_Event,
+			{	.modify_skill = { { Skill_Smith, 2 } }
+			,	.is_global    = true
+			});
+
+		Yars::Id affect_id = yars.affectCreate();
+		yars.affect(affect_id).modify_skill[Skill_Smith] = 5;
+		yars.characterAffectApply(bubba, affect_id);
+
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value == 18);
+
+		yars.layerRemove(Layer_Event);
+		yars.characterAffectRevert(bubba, affect_id);
+
+		REQUIRE(y.characterSkill(bubba, Skill_Smith).level.value == 11);
+	}
+
+	SECTION("Character Deleted")
+	{
+		yars.characterLayerAdd(bubba, Layer_Forge);
+		yars.characterDelete(bubba);
+
+		Yars::Id other = yars.characterCreate();
+
+		REQUIRE(other == bubba);
+		REQUIRE(yars.characterLayerList(other).empty() == true);
+	}
+}
@@ -0,0 +1,167 @@
+/*
+g++ -std=c++2a -DCATCH_CONFIG_MAIN -Wall -Werror -o Leaderboard Leaderboard.cpp && ./Leaderboard
+ */
+
+#ifdef CATCH_CONFIG_MAIN
+#define ZAKERO_YARS_IMPLEMENTATION
+#define ZAKERO_YARS_ENABLE_DEBUG
+#define ZAKERO_YARS_ENABLE_ID_SHUFFLE
+#define ZAKERO_YARS_ENABLE_SAFE_MODE
+#endif
+
+#include "../src/Zakero_Yars.h"
+#include "catch.hpp"
+
+using namespace zakero;
+
+namespace
+{
+	const std::string Attr_Strength = "Strength";
+	const std::string Skill_Sword   = "Sword";
+
+	Yars::Id create(Yars& yars
+		, const int32_t sword
+		)
+	{
+		Yars::Id id = yars.characterCreate();
+
+		yars.characterSkillAdd(id, Skill_Sword);
+		yars.levelSet(yars.characterSkill(id, Skill_Sword).level, sword);
+
+		return id;
+	}
+}
+
+
+TEST_CASE("Leaderboard.Add", "[leaderboard]")
+{
+	Yars yars;
+
+	SECTION("Invalid")
+	{
+		REQUIRE(yars.leaderboardSkillAdd("") == false);
+		REQUIRE(yars.leaderboardSkillRemove(Skill_Sword) == false);
+		REQUIRE(yars.leaderboardSkillTop(Skill_Sword, 10).empty() == true);
+		REQUIRE(yars.leaderboardSkillRank(Skill_Sword, 0) == 0);
+	}
+
+	SECTION("Add And Remove")
+	{
+		REQUIRE(yars.leaderboardSkillAdd(Skill_Sword));
+		REQUIRE(yars.leaderboardSkillAdd(Skill_Sword) == false);
+		REQUIRE(yars.leaderboardSkillExists(Skill_Sword));
+		REQUIRE(yars.indexSkillExists(Skill_Sword) == false);
+		REQUIRE(yars.leaderboardSkillRemove(Skill_Sword));
+		REQUIRE(yars.leaderboardSkillExists(Skill_Sword) == false);
+
+		REQUIRE(yars.leaderboardAttributeAdd(Attr_Strength));
+		REQUIRE(yars.leaderboardAttributeExists(Attr_Strength));
+		REQUIRE(yars.leaderboardAttributeRemove(Attr_Strength));
+	}
+}
+
+
+TEST_CASE("Leaderboard.Skill", "[leaderboard][skill]")
+{
+	Yars yars;
+
+	yars.skillAdd(Skill_Sword, {});
+
+	Yars::Id novice = create(yars, 5);
+	Yars::Id expert = create(yars, 50);
+	Yars::Id master = create(yars, 90);
+	Yars::Id nobody = yars.characterCreate();
+
+	yars.leaderboardSkillAdd(Skill_Sword);
+
+	REQUIRE(yars.leaderboardSkillTop(Skill_Sword, 2) == Yars::VectorId{ master, expert });
+	REQUIRE(yars.leaderboardSkillTop(Skill_Sword, 10) == Yars::VectorId{ master, expert, novice });
+	REQUIRE(yars.leaderboardSkillRank(Skill_Sword, master) == 1);
+	REQUIRE(yars.leaderboardSkillRank(Skill_Sword, expert) == 2);
+	REQUIRE(yars.leaderboardSkillRank(Skill_Sword, novice) == 3);
+	REQUIRE(yars.leaderboardSkillRank(Skill_Sword, nobody) == 0);
+
+	SECTION("Level Changed")
+	{
+		yars.levelSet(yars.characterSkill(novice, Skill_Sword).level, 100);
+
+		REQUIRE(yars.leaderboardSkillTop(Skill_Sword, 1) == Yars::VectorId{ novice });
+		REQUIRE(yars.leaderboardSkillRank(Skill_Sword, master) == 2);
+		REQUIRE(yars.leaderboardSkillRank(Skill_Sword, expert) == 3);
+	}
+
+	SECTION("Modifier")
+	{
+		yars.levelModifierAdjust(yars.characterSkill(expert, Skill_Sword).level, 60);
+
+		REQUIRE(yars.leaderboardSkillRank(Skill_Sword, expert) == 1);
+	}
+
+	SECTION("Tie")
+	{
+		yars.levelSet(yars.characterSkill(expert, Skill_Sword).level, 90);
+
+		REQUIRE(yars.leaderboardSkillRank(Skill_Sword, master) == 1);
+		REQUIRE(yars.leaderboardSkillRank(Skill_Sword, expert) == 1);
+		REQUIRE(yars.leaderboardSkillRank(Skill_Sword, novice) == 3);
+	}
+
+	SECTION("Zero Level")
+	{
+		yars.levelModifierAdjust(yars.characterSkill(novice, Skill_Sword).level, -20);
+		yars.characterSkillAdd(nobody, Skill_Sword);
+
+		REQUIRE(yars.leaderboardSkillTop(Skill_Sword, 10).size() == 4);
+		REQUIRE(yars.leaderboardSkillRank(Skill_Sword, novice) == 3);
+		REQUIRE(yars.leaderboardSkillRank(Skill_Sword, nobody) == 3);
+	}
+
+	SECTION("Character Deleted")
+	{
+		yars.characterDelete(master);
+
+		REQUIRE(yars.leaderboardSkillTop(Skill_Sword, 1) == Yars::VectorId{ expert });
+		REQUIRE(yars.leaderboardSkillRank(Skill_Sword, master) == 0);
+		REQUIRE(yars.leaderboardSkillRank(Skill_Sword, novice) == 2);
+	}
+
+	SECTION("Layer")
+	{
+		yars.layerAdd("Event", { .modify_skill = { { Skill_Sword, 10 } } });
+		yars.characterLayerAdd(novice, "Event");
+		yars.characterLayerAdd(expert, "Event");
+
+		REQUIRE(yars.leaderboardSkillRank(Skill_Sword, expert) == 2);
+
+		yars.layerRemove("Event");
+		yars.layerAdd("Event", { .modify_skill = { { Skill_Sword, 50 } } });
+
+		REQUIRE(yars.leaderboardSkillTop(Skill_Sword, 10) == Yars::VectorId{ expert, master, novice });
+	}
+}
+
+
+TEST_CASE("Leaderboard.Attribute", "[leaderboard][attribute]")
+{
+	Yars yars;
+
+	yars.skillAdd(Skill_Sword,
+		{	.attribute_contribution = { { Attr_Strength, 1 } }
+		});
+
+	Yars::Id bubba = create(yars, 0);
+	Yars::Id jimbo = create(yars, 0);
+
+	yars.levelSet(yars.characterAttribute(bubba, Attr_Strength).level, 10);
+	yars.levelSet(yars.characterAttribute(jimbo, Attr_Strength).level, 20);
+
+	yars.leaderboardAttributeAdd(Attr_Strength);
+
+	REQUIRE(yars.leaderboardAttributeTop(Attr_Strength, 10) == Yars::VectorId{ jimbo, bubba });
+	REQUIRE(yars.leaderboardAttributeRank(Attr_Strength, bubba) == 2);
+
+	yars.levelSet(yars.characterAttribute(bubba, Attr_Strength).level, 30);
+
+	REQUIRE(yars.leaderboardAttributeRank(Attr_Strength, bubba) == 1);
+	REQUIRE(yars.leaderboardAttributeRank(Attr_Strength, jimbo) == 2);
+}
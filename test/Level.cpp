@@ -138,6 +138,56 @@ TEST_CASE("Level.Increase", "[level]")
 	}
 }
 
+TEST_CASE("Level.Decrease", "[level]")
+{
+	Yars::Level level;
+
+	Yars::levelIncrease(level, 5.5);
+	REQUIRE(level.value == 3);
+
+	SECTION("Partial level")
+	{
+		REQUIRE(Yars::levelDecrease(level, 1.0) == 0);
+		REQUIRE(level.value == 3);
+		REQUIRE(level.partial == Approx(0.5f));
+	}
+
+	SECTION("1 full level, with partial")
+	{
+		REQUIRE(Yars::levelDecrease(level, 2.0) == 1);
+		REQUIRE(level.value == 2);
+		REQUIRE(level.partial == Approx(1.5f));
+	}
+
+	SECTION("Reverse of Increase")
+	{
+		REQUIRE(Yars::levelDecrease(level, 5.5) == 3);
+		REQUIRE(level.value == 0);
+		REQUIRE(level.partial == Approx(0.0f));
+	}
+
+	SECTION("Not below 0")
+	{
+		REQUIRE(Yars::levelDecrease(level, 100.0) == 3);
+		REQUIRE(level.value_base == 0);
+		REQUIRE(level.partial == Approx(0.0f));
+	}
+
+	SECTION("Modifier")
+	{
+		Yars::levelModifierAdjust(level, 2);
+		Yars::levelDecrease(level, 2.0);
+		REQUIRE(level.value == 4);
+	}
+
+	SECTION("Negative Decrease, not allowed")
+	{
+		REQUIRE(Yars::levelDecrease(level, -1.0) == 0);
+		REQUIRE(level.value == 3);
+		REQUIRE(level.partial == Approx(1.5f));
+	}
+}
+
 TEST_CASE("Level.Modifier", "[level]")
 {
 	Yars::Level level;
@@ -0,0 +1,232 @@
+/*
+g++ -std=c++2a -DCATCH_CONFIG_MAIN -Wall -Werror -o Loot Loot.cpp && ./Loot
+ */
+
+#ifdef CATCH_CONFIG_MAIN
+#define ZAKERO_YARS_IMPLEMENTATION
+#define ZAKERO_YARS_ENABLE_DEBUG
+#define ZAKERO_YARS_ENABLE_ID_SHUFFLE
+#define ZAKERO_YARS_ENABLE_SAFE_MODE
+#endif
+
+#include "../src/Zakero_Yars.h"
+#include "catch.hpp"
+
+using namespace zakero;
+
+namespace
+{
+	const std::string Item_Coin     = "Coin";
+	const std::string Item_Ruby     = "Ruby";
+	const std::string Item_Sapphire = "Sapphire";
+	const std::string Loot_Gems     = "Gems";
+	const std::string Loot_Goblin   = "Goblin";
+
+	void setup(Yars& yars)
+	{
+		yars.itemAdd(Item_Coin, {});
+		yars.itemAdd(Item_Ruby, {});
+		yars.itemAdd(Item_Sapphire, {});
+	}
+}
+
+
+TEST_CASE("Loot.Add", "[loot]")
+{
+	Yars yars;
+
+	setup(yars);
+
+	SECTION("Invalid")
+	{
+		REQUIRE(yars.lootAdd("", { { .item = Item_Coin } }) == false);
+		REQUIRE(yars.lootAdd(Loot_Gems, {}) == false);
+		REQUIRE(yars.lootAdd(Loot_Gems, { {} }) == false);
+		REQUIRE(yars.lootAdd(Loot_Gems, { { .item = Item_Coin, .table = Loot_Goblin } }) == false);
+		REQUIRE(yars.lootAdd(Loot_Gems, { { .item = "Diamond" } }) == false);
+		REQUIRE(yars.lootAdd(Loot_Gems, { { .table = Loot_Goblin } }) == false);
+		REQUIRE(yars.lootAdd(Loot_Gems, { { .item = Item_Ruby, .weight = 0 } }) == false);
+		REQUIRE(yars.lootAdd(Loot_Gems, { { .item = Item_Ruby, .count_min = 2, .count_max = 1 } }) == false);
+
+		REQUIRE(yars.lootExists(Loot_Gems) == false);
+		REQUIRE(yars.lootRoll(Loot_Gems).empty() == true);
+	}
+
+	SECTION("Add And Remove")
+	{
+		REQUIRE(yars.lootAdd(Loot_Gems, { { .item = Item_Ruby } }));
+		REQUIRE(yars.lootAdd(Loot_Gems, { { .item = Item_Ruby } }) == false);
+		REQUIRE(yars.lootExists(Loot_Gems));
+		REQUIRE(yars.lootList() == Yars::VectorString{ Loot_Gems });
+
+		REQUIRE(yars.lootAdd(Loot_Goblin, { { .table = Loot_Gems } }));
+		REQUIRE(yars.lootRemove(Loot_Gems) == false);
+
+		REQUIRE(yars.lootRemove(Loot_Goblin));
+		REQUIRE(yars.lootRemove(Loot_Goblin) == false);
+		REQUIRE(yars.lootRemove(Loot_Gems));
+		REQUIRE(yars.lootList().empty() == true);
+	}
+
+	SECTION("Item In Use")
+	{
+		REQUIRE(yars.lootAdd(Loot_Gems, { { .item = Item_Ruby } }));
+		REQUIRE(yars.itemRemove(Item_Ruby) == false);
+		REQUIRE(yars.itemExists(Item_Ruby));
+		REQUIRE(yars.itemRemove(Item_Sapphire));
+
+		REQUIRE(yars.lootRemove(Loot_Gems));
+		REQUIRE(yars.itemRemove(Item_Ruby));
+	}
+}
+
+
+TEST_CASE("Loot.Roll", "[loot]")
+{
+	Yars yars;
+
+	setup(yars);
+
+	SECTION("Single Entry")
+	{
+		yars.lootAdd(Loot_Gems, { { .item = Item_Ruby, .count_min = 2, .count_max = 2 } });
+
+		Yars::MapStringUint32 drop = yars.lootRoll(Loot_Gems, 10);
+
+		REQUIRE(drop.size()    == 1);
+		REQUIRE(drop[Item_Ruby] == 20);
+	}
+
+	SECTION("Count Range")
+	{
+		yars.lootAdd(Loot_Gems, { { .item = Item_Ruby, .count_min = 0, .count_max = 3 } });
+
+		uint32_t minimum = 3;
+		uint32_t maximum = 0;
+
+		for(size_t i = 0; i < 200; i++)
+		{
+			Yars::MapStringUint32 drop = yars.lootRoll(Loot_Gems);
+
+			const uint32_t count = drop.contains(Item_Ruby) ? drop[Item_Ruby] : 0;
+
+			minimum = std::min(minimum, count);
+			maximum = std::max(maximum, count);
+		}
+
+		REQUIRE(minimum == 0);
+		REQUIRE(maximum == 3);
+	}
+
+	SECTION("Weight")
+	{
+		yars.lootAdd(Loot_Gems,
+			{	{ .item = Item_Ruby,     .weight = 1 }
+			,	{ .item = Item_Sapphire, .weight = 3 }
+			,	{ .item = Item_Coin,     .weight = 6 }
+			});
+
+		Yars::MapStringUint32 drop = yars.lootRoll(Loot_Gems, 100'000);
+
+		REQUIRE(drop[Item_Ruby] + drop[Item_Sapphire] + drop[Item_Coin] == 100'000);
+		REQUIRE(drop[Item_Ruby]     > 9'000);
+		REQUIRE(drop[Item_Ruby]     < 11'000);
+		REQUIRE(drop[Item_Sapphire] > 28'500);
+		REQUIRE(drop[Item_Sapphire] < 31'500);
+		REQUIRE(drop[Item_Coin]     > 58'500);
+		REQUIRE(drop[Item_Coin]     < 61'500);
+	}
+
+	SECTION("Nested")
+	{
+		yars.lootAdd(Loot_Gems,
+			{	{ .item = Item_Ruby }
+			,	{ .item = Item_Sapphire }
+			});
+
+		yars.lootAdd(Loot_Goblin,
+			{	{ .table = Loot_Gems, .count_min = 3, .count_max = 3 }
+			});
+
+		Yars::MapStringUint32 drop = yars.lootRoll(Loot_Goblin, 10);
+
+		REQUIRE(drop.contains(Item_Coin) == false);
+		REQUIRE(drop[Item_Ruby] + drop[Item_Sapphire] == 30);
+	}
+}
+
+
+TEST_CASE("Loot.Seed", "[loot]")
+{
+	std::mt19937 mt_1(42);
+	std::mt19937 mt_2(42);
+
+	Yars yars_1(mt_1);
+	Yars yars_2(mt_2);
+
+	for(Yars* yars : { &yars_1, &yars_2 })
+	{
+		setup(*yars);
+
+		yars->lootAdd(Loot_Gems,
+			{	{ .item = Item_Ruby,     .weight = 5, .count_max = 4 }
+			,	{ .item = Item_Sapphire, .weight = 7, .count_max = 9 }
+			});
+	}
+
+	for(size_t i = 0; i < 10; i++)
+	{
+		Yars::MapStringUint32 drop_1 = yars_1.lootRoll(Loot_Gems, 7);
+		Yars::MapStringUint32 drop_2 = yars_2.lootRoll(Loot_Gems, 7);
+
+		REQUIRE(drop_1[Item_Ruby]     == drop_2[Item_Ruby]);
+		REQUIRE(drop_1[Item_Sapphire] == drop_2[Item_Sapphire]);
+	}
+}
+
+
+TEST_CASE("Loot.Grant", "[loot][character][item]")
+{
+	Yars yars;
+
+	setup(yars);
+
+	yars.lootAdd(Loot_Gems,
+		{	{ .item = Item_Ruby,     .weight = 1 }
+		,	{ .item = Item_Sapphire, .weight = 1 }
+		});
+
+	yars.lootAdd(Loot_Goblin,
+		{	{ .item  = Item_Coin, .weight = 1, .count_min = 5, .count_max = 5 }
+		,	{ .table = Loot_Gems, .weight = 1 }
+		});
+
+	Yars::Id bubba = yars.characterCreate();
+
+	SECTION("Invalid")
+	{
+		REQUIRE(yars.lootGrant(1234, Loot_Goblin) == false);
+		REQUIRE(yars.lootGrant(bubba, "Dragon") == false);
+		REQUIRE(yars.characterItemList(bubba).empty() == true);
+	}
+
+	SECTION("Grant")
+	{
+		Yars::MapStringUint32 drop;
+
+		REQUIRE(yars.lootGrant(bubba, Loot_Goblin, drop, 50));
+
+		uint32_t total = 0;
+
+		for(const auto& [item_name, count] : drop)
+		{
+			REQUIRE(yars.characterItemCount(bubba, item_name) == count);
+			REQUIRE(yars.itemHolderAmount(item_name, bubba) == count);
+
+			total += count;
+		}
+
+		REQUIRE(total >= 50);
+		REQUIRE(total <= 250);
+	}
+}
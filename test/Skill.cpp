@@ -140,6 +140,100 @@ TEST_CASE("Skill.Remove", "[skill]")
 }
 
 
+TEST_CASE("Skill.Weight", "[skill]")
+{
+	Yars yars;
+
+	Yars::Skill skill =
+	{	.attribute_contribution =
+		{	{ "A", 1 }
+		,	{ "B", 3 }
+		}
+	};
+
+	REQUIRE(skill.attribute_weight == nullptr);
+
+	yars.skillAdd("skill", skill);
+
+	const Yars::SkillWeight& weight = *yars.skill("skill").attribute_weight;
+
+	REQUIRE(weight.attribute == Yars::VectorString{ "A", "B" });
+	REQUIRE(weight.weight[0] == Approx(0.25));
+	REQUIRE(weight.weight[1] == Approx(0.75));
+	REQUIRE(weight.contribution == skill.attribute_contribution);
+
+	SECTION("Update")
+	{
+		skill.attribute_contribution["C"] = 4;
+		Yars::skillWeightUpdate(skill);
+
+		REQUIRE(skill.attribute_weight->attribute.size() == 3);
+		REQUIRE(skill.attribute_weight->weight[0] == Approx(0.125));
+		REQUIRE(skill.attribute_weight->weight[2] == Approx(0.5));
+	}
+
+	SECTION("Zero")
+	{
+		skill.attribute_contribution["B"] = -1;
+		Yars::skillWeightUpdate(skill);
+
+		REQUIRE(skill.attribute_weight->weight == Yars::VectorFloat{ 0, 0 });
+	}
+
+	SECTION("Shared")
+	{
+		Yars::Id character_id = yars.characterCreate();
+		yars.characterSkillAdd(character_id, "skill");
+
+		REQUIRE(yars.characterSkill(character_id, "skill").attribute_weight
+			== yars.skill("skill").attribute_weight
+			);
+	}
+}
+
+
+TEST_CASE("Skill.Set", "[skill]")
+{
+	Yars yars;
+
+	Yars::SkillSet a = yars.skillSet({ "A", "B" });
+	Yars::SkillSet b = yars.skillSet({ "B", "C" });
+	Yars::SkillSet c = yars.skillSet({ "C" });
+
+	REQUIRE(a.count == 2);
+	REQUIRE(Yars::skillSetContains(a, yars.skillHandle("A")) == true);
+	REQUIRE(Yars::skillSetContains(a, yars.skillHandle("C")) == false);
+
+	REQUIRE(Yars::skillSetIntersects(a, b) == true);
+	REQUIRE(Yars::skillSetIntersects(a, c) == false);
+	REQUIRE(Yars::skillSetIntersects(a, {}) == false);
+
+	SECTION("Erase")
+	{
+		Yars::skillSetErase(b, yars.skillHandle("B"));
+
+		REQUIRE(Yars::skillSetContains(b, yars.skillHandle("B")) == false);
+		REQUIRE(Yars::skillSetIntersects(a, b) == false);
+	}
+
+	SECTION("Many Handles")
+	{
+		for(size_t i = 0; i < 200; i++)
+		{
+			yars.skillAdd("Skill_" + std::to_string(i), {});
+		}
+
+		Yars::SkillSet d = yars.skillSet({ "Skill_199" });
+		Yars::SkillSet e = yars.skillSet({ "A", "Skill_199" });
+
+		REQUIRE(d.bit.size() > 1);
+		REQUIRE(Yars::skillSetIntersects(a, d) == false);
+		REQUIRE(Yars::skillSetIntersects(d, e) == true);
+		REQUIRE(Yars::skillSetIntersects(e, a) == true);
+	}
+}
+
+
 TEST_CASE("Skill.Level", "[level][skill]")
 {
 	Yars::Skill mentalist =
@@ -0,0 +1,254 @@
+/*
+g++ -std=c++2a -DCATCH_CONFIG_MAIN -Wall -Werror -o Telemetry Telemetry.cpp && ./Telemetry
+ */
+
+#ifdef CATCH_CONFIG_MAIN
+#define ZAKERO_YARS_IMPLEMENTATION
+#define ZAKERO_YARS_ENABLE_DEBUG
+#define ZAKERO_YARS_ENABLE_ID_SHUFFLE
+#define ZAKERO_YARS_ENABLE_SAFE_MODE
+#endif
+
+#include "../src/Zakero_Yars.h"
+#include "catch.hpp"
+
+using namespace zakero;
+
+namespace
+{
+	const std::string Skill_Sword = "Sword";
+	const std::string Item_Coin   = "Coin";
+
+	Yars::Id create(Yars& yars
+		, const int32_t sword
+		)
+	{
+		Yars::Id id = yars.characterCreate();
+
+		yars.characterSkillAdd(id, Skill_Sword);
+		yars.levelSet(yars.characterSkill(id, Skill_Sword).level, sword);
+
+		return id;
+	}
+}
+
+
+TEST_CASE("Histogram.Bucket", "[histogram]")
+{
+	REQUIRE(Yars::histogramBucket(-5) == 0);
+	REQUIRE(Yars::histogramBucket(0)  == 0);
+	REQUIRE(Yars::histogramBucket(1)  == 1);
+	REQUIRE(Yars::histogramBucket(2)  == 2);
+	REQUIRE(Yars::histogramBucket(3)  == 2);
+	REQUIRE(Yars::histogramBucket(4)  == 3);
+	REQUIRE(Yars::histogramBucket(100) == 7);
+	REQUIRE(Yars::histogramBucket(Yars::Level_Max) == Yars::Histogram_Size - 1);
+
+	REQUIRE(Yars::histogramBucketMin(0) == Yars::Level_Min);
+	REQUIRE(Yars::histogramBucketMin(1) == 1);
+	REQUIRE(Yars::histogramBucketMin(7) == 64);
+
+	for(size_t bucket = 1; bucket < Yars::Histogram_Size; bucket++)
+	{
+		REQUIRE(Yars::histogramBucket(Yars::histogramBucketMin(bucket)) == bucket);
+	}
+
+	Yars::Histogram histogram;
+
+	Yars::histogramAdjust(histogram, 5, +2);
+	Yars::histogramAdjust(histogram, 6, -1);
+
+	REQUIRE(histogram.count[3] == 1);
+	REQUIRE(histogram.total    == 1);
+}
+
+
+TEST_CASE("Telemetry.Skill", "[telemetry][skill]")
+{
+	Yars yars;
+
+	yars.skillAdd(Skill_Sword, {});
+
+	Yars::Id novice = create(yars, 1);
+	Yars::Id expert = create(yars, 50);
+	create(yars, 60);
+	yars.characterCreate();
+
+	SECTION("Not Tracked")
+	{
+		REQUIRE(yars.telemetrySkill(Skill_Sword).total == 0);
+		REQUIRE(yars.telemetrySkillRemove(Skill_Sword) == false);
+	}
+
+	REQUIRE(yars.telemetrySkillAdd(Skill_Sword));
+	REQUIRE(yars.telemetrySkillAdd(Skill_Sword) == false);
+	REQUIRE(yars.telemetrySkillExists(Skill_Sword));
+
+	Yars::Histogram histogram = yars.telemetrySkill(Skill_Sword);
+
+	REQUIRE(histogram.total    == 3);
+	REQUIRE(histogram.count[1] == 1);
+	REQUIRE(histogram.count[6] == 2);
+
+	SECTION("Level Changed")
+	{
+		yars.levelSet(yars.characterSkill(novice, Skill_Sword).level, 100);
+		yars.levelModifierAdjust(yars.characterSkill(expert, Skill_Sword).level, 100);
+
+		histogram = yars.telemetrySkill(Skill_Sword);
+
+		REQUIRE(histogram.total    == 3);
+		REQUIRE(histogram.count[1] == 0);
+		REQUIRE(histogram.count[6] == 1);
+		REQUIRE(histogram.count[7] == 1);
+		REQUIRE(histogram.count[8] == 1);
+	}
+
+	SECTION("Character Deleted")
+	{
+		yars.characterDelete(expert);
+
+		histogram = yars.telemetrySkill(Skill_Sword);
+
+		REQUIRE(histogram.total    == 2);
+		REQUIRE(histogram.count[6] == 1);
+	}
+
+	SECTION("Layer")
+	{
+		yars.layerAdd("Event", { .modify_skill = { { Skill_Sword, 100 } }, .is_global = true });
+
+		histogram = yars.telemetrySkill(Skill_Sword);
+
+		REQUIRE(histogram.total    == 3);
+		REQUIRE(histogram.count[7] == 1);
+		REQUIRE(histogram.count[8] == 2);
+	}
+
+	SECTION("Remove")
+	{
+		REQUIRE(yars.telemetrySkillRemove(Skill_Sword));
+		REQUIRE(yars.telemetrySkill(Skill_Sword).total == 0);
+	}
+}
+
+
+TEST_CASE("Telemetry.Health", "[telemetry][health]")
+{
+	Yars yars;
+
+	Yars::Id bubba = yars.characterCreate();
+	Yars::Id jimbo = yars.characterCreate();
+
+	Yars::healthSet(yars.characterHealth(bubba), 10, 10);
+	Yars::healthSet(yars.characterHealth(jimbo), 100, 100);
+
+	REQUIRE(yars.telemetryHealthIsEnabled() == false);
+	REQUIRE(yars.telemetryHealth().total == 0);
+
+	REQUIRE(yars.telemetryHealthEnable());
+	REQUIRE(yars.telemetryHealthEnable() == false);
+	REQUIRE(yars.telemetryHealthIsEnabled());
+
+	Yars::Histogram histogram = yars.telemetryHealth();
+
+	REQUIRE(histogram.total    == 2);
+	REQUIRE(histogram.count[4] == 1);
+	REQUIRE(histogram.count[7] == 1);
+
+	SECTION("Maximum Changed")
+	{
+		Yars::healthMaximumAdjust(yars.characterHealth(bubba), 100);
+		yars.characterLevelIncrease(jimbo, 100);
+
+		histogram = yars.telemetryHealth();
+
+		REQUIRE(histogram.count[4] == 0);
+		REQUIRE(histogram.count[7] == 1);
+		REQUIRE(histogram.count[8] == 1);
+	}
+
+	SECTION("New Character")
+	{
+		yars.characterCreate();
+
+		histogram = yars.telemetryHealth();
+
+		REQUIRE(histogram.total    == 3);
+		REQUIRE(histogram.count[0] == 1);
+	}
+
+	SECTION("Disable")
+	{
+		REQUIRE(yars.telemetryHealthDisable());
+		REQUIRE(yars.telemetryHealthDisable() == false);
+		REQUIRE(yars.telemetryHealth().total == 0);
+	}
+}
+
+
+TEST_CASE("Telemetry.Affect", "[telemetry][affect]")
+{
+	Yars yars;
+
+	Yars::Id bubba = yars.characterCreate();
+	yars.characterCreate();
+
+	Yars::Id poison = yars.affectCreate();
+	Yars::Id curse  = yars.affectCreate();
+
+	yars.telemetryAffectEnable();
+
+	REQUIRE(yars.telemetryAffectIsEnabled());
+	REQUIRE(yars.telemetryAffect().count[0] == 2);
+
+	yars.characterAffectApply(bubba, poison);
+	yars.characterAffectApply(bubba, curse);
+
+	Yars::Histogram histogram = yars.telemetryAffect();
+
+	REQUIRE(histogram.count[0] == 1);
+	REQUIRE(histogram.count[2] == 1);
+
+	yars.characterAffectRevert(bubba, curse);
+
+	histogram = yars.telemetryAffect();
+
+	REQUIRE(histogram.count[1] == 1);
+
+	REQUIRE(yars.telemetryAffectDisable());
+	REQUIRE(yars.telemetryAffectIsEnabled() == false);
+}
+
+
+TEST_CASE("Telemetry.Item", "[telemetry][item]")
+{
+	Yars yars;
+
+	yars.itemAdd(Item_Coin, {});
+
+	Yars::Id bubba = yars.characterCreate();
+	Yars::Id jimbo = yars.characterCreate();
+
+	yars.characterItemAdd(bubba, Item_Coin, 5);
+
+	REQUIRE(yars.telemetryItemAdd(Item_Coin));
+	REQUIRE(yars.telemetryItemExists(Item_Coin));
+
+	Yars::Histogram histogram = yars.telemetryItem(Item_Coin);
+
+	REQUIRE(histogram.total    == 1);
+	REQUIRE(histogram.count[3] == 1);
+
+	yars.characterItemAdd(jimbo, Item_Coin, 1000);
+	yars.characterItemRemove(bubba, Item_Coin, 4);
+
+	histogram = yars.telemetryItem(Item_Coin);
+
+	REQUIRE(histogram.total     == 2);
+	REQUIRE(histogram.count[1]  == 1);
+	REQUIRE(histogram.count[10] == 1);
+
+	REQUIRE(yars.telemetryItemRemove(Item_Coin));
+	REQUIRE(yars.telemetryItemExists(Item_Coin) == false);
+}
@@ -0,0 +1,288 @@
+/*
+g++ -std=c++2a -DCATCH_CONFIG_MAIN -Wall -Werror -o Tick Tick.cpp && ./Tick
+ */
+
+#ifdef CATCH_CONFIG_MAIN
+#define ZAKERO_YARS_IMPLEMENTATION
+#define ZAKERO_YARS_ENABLE_DEBUG
+#define ZAKERO_YARS_ENABLE_ID_SHUFFLE
+#define ZAKERO_YARS_ENABLE_SAFE_MODE
+#endif
+
+#include "../src/Zakero_Yars.h"
+#include "catch.hpp"
+
+using namespace zakero;
+
+namespace
+{
+	const std::string Attr_Strength = "Strength";
+	const std::string Skill_Sword   = "Sword";
+
+	Yars::Id create(Yars& yars
+		, const uint32_t current
+		, const uint32_t maximum
+		)
+	{
+		Yars::Id id = yars.characterCreate();
+
+		Yars::Health& health = yars.characterHealth(id);
+		Yars::healthSet(health, maximum, maximum);
+		Yars::healthAdjust(health, (int32_t)current - (int32_t)maximum);
+
+		return id;
+	}
+}
+
+
+TEST_CASE("Tick.Health", "[tick][health]")
+{
+	Yars yars;
+	Yars::TickEvent event;
+
+	Yars::Id hurt = create(yars, 5, 10);
+	Yars::Id full = create(yars, 10, 10);
+	Yars::Id dead = create(yars, 0, 10);
+	Yars::Id weak = create(yars, 1, 10);
+
+	SECTION("Nothing")
+	{
+		yars.tick({}, event);
+
+		REQUIRE(yars.characterHealth(hurt).current == 5);
+		REQUIRE(event.died.empty() == true);
+		REQUIRE(event.health_full.empty() == true);
+	}
+
+	SECTION("Regenerate")
+	{
+		yars.tick({ .health = 2 }, event);
+
+		REQUIRE(yars.characterHealth(hurt).current == 7);
+		REQUIRE(yars.characterHealth(full).current == 10);
+		REQUIRE(yars.characterHealth(dead).current == 0);
+		REQUIRE(yars.characterHealth(weak).current == 3);
+		REQUIRE(event.health_full.empty() == true);
+
+		yars.tick({ .health = 3 }, event);
+
+		REQUIRE(yars.characterHealth(hurt).current == 10);
+		REQUIRE(event.health_full == Yars::VectorId{ hurt });
+
+		yars.tick({ .health = Yars::Health_Max }, event);
+
+		REQUIRE(yars.characterHealth(weak).current == 10);
+		REQUIRE(event.health_full == Yars::VectorId{ hurt, weak });
+		REQUIRE(event.died.empty() == true);
+	}
+
+	SECTION("Damage")
+	{
+		yars.tick({ .health = -1 }, event);
+
+		REQUIRE(yars.characterHealth(hurt).current == 4);
+		REQUIRE(yars.characterHealth(full).current == 9);
+		REQUIRE(yars.characterHealth(weak).current == 0);
+		REQUIRE(event.died == Yars::VectorId{ weak });
+
+		yars.tick({ .health = Yars::Health_Min }, event);
+
+		REQUIRE(yars.characterHealth(full).current == 0);
+		REQUIRE(event.died.size() == 3);
+		REQUIRE(Yars::vectorContains(event.died, dead) == false);
+	}
+
+	SECTION("Deleted Characters")
+	{
+		yars.characterDelete(weak);
+
+		yars.tick({ .health = -1 }, event);
+
+		REQUIRE(event.died.empty() == true);
+	}
+
+	SECTION("Many Characters")
+	{
+		Yars::VectorId id_list;
+
+		for(size_t i = 0; i < 1000; i++)
+		{
+			id_list.push_back(create(yars, (uint32_t)(i % 10), 10));
+		}
+
+		yars.tick({ .health = -1 }, event);
+
+		REQUIRE(event.died.size() == 100 + 1);
+
+		for(size_t i = 0; i < id_list.size(); i++)
+		{
+			const uint32_t expect = (i % 10 == 0) ? 0 : (uint32_t)(i % 10) - 1;
+
+			REQUIRE(yars.characterHealth(id_list[i]).current == expect);
+		}
+	}
+
+	SECTION("Group")
+	{
+		REQUIRE(yars.tick({ .health = 5 }, { hurt, 1234 }, event) == false);
+		REQUIRE(yars.characterHealth(hurt).current == 5);
+
+		REQUIRE(yars.tick({ .health = 5 }, { hurt, dead }, event));
+		REQUIRE(yars.characterHealth(hurt).current == 10);
+		REQUIRE(yars.characterHealth(dead).current == 0);
+		REQUIRE(yars.characterHealth(weak).current == 1);
+		REQUIRE(event.health_full == Yars::VectorId{ hurt });
+	}
+}
+
+
+TEST_CASE("Tick.Decay", "[tick][skill]")
+{
+	Yars yars;
+	Yars::TickEvent event;
+
+	yars.skillAdd(Skill_Sword, { .attribute_contribution = { { Attr_Strength, 1 } } });
+
+	Yars::Id bubba = yars.characterCreate();
+	yars.characterSkillAdd(bubba, Skill_Sword);
+	yars.levelSet(yars.characterSkill(bubba, Skill_Sword).level, 3, 1);
+	yars.levelSet(yars.characterAttribute(bubba, Attr_Strength).level, 5);
+
+	Yars::Id other = yars.characterCreate();
+
+	SECTION("Skill")
+	{
+		yars.tick({ .decay_skill = { { Skill_Sword, 0.5f } } }, event);
+
+		REQUIRE(yars.characterSkill(bubba, Skill_Sword).level.value == 3);
+		REQUIRE(yars.characterSkill(bubba, Skill_Sword).level.partial == Approx(0.5f));
+
+		yars.tick({ .decay_skill = { { Skill_Sword, 1.0f } } }, event);
+
+		REQUIRE(yars.characterSkill(bubba, Skill_Sword).level.value == 2);
+
+		// Skills are not added
+		REQUIRE(yars.characterSkillExists(other, Skill_Sword) == false);
+	}
+
+	SECTION("Attribute")
+	{
+		yars.tick({ .decay_attribute = { { Attr_Strength, 4.0f } } }, event);
+
+		REQUIRE(yars.characterAttribute(bubba, Attr_Strength).level.value == 4);
+		REQUIRE(yars.characterAttributeExists(other, Attr_Strength) == false);
+	}
+
+	SECTION("Modifier Cache")
+	{
+		yars.characterModifierCacheEnable(bubba);
+
+		const float before = yars.calculateModifier(bubba, Skill_Sword);
+
+		yars.tick({ .decay_attribute = { { Attr_Strength, 100.0f } } }, event);
+
+		REQUIRE(yars.calculateModifier(bubba, Skill_Sword) != before);
+	}
+
+	SECTION("Deleted Characters")
+	{
+		yars.characterSkillAdd(other, Skill_Sword);
+		yars.levelSet(yars.characterSkill(other, Skill_Sword).level, 3);
+		yars.characterDelete(bubba);
+
+		yars.tick({ .decay_skill = { { Skill_Sword, 100.0f } } }, event);
+
+		REQUIRE(yars.characterSkill(other, Skill_Sword).level.value == 0);
+	}
+}
+
+
+TEST_CASE("Tick.FastForward", "[tick]")
+{
+	Yars yars;
+	Yars::TickEvent event;
+
+	yars.skillAdd(Skill_Sword, {});
+
+	Yars::Id hurt = create(yars, 5, 100);
+	Yars::Id dead = create(yars, 0, 100);
+
+	yars.characterSkillAdd(hurt, Skill_Sword);
+	yars.levelSet(yars.characterSkill(hurt, Skill_Sword).level, 10);
+
+	SECTION("Invalid")
+	{
+		REQUIRE(yars.characterFastForward(1234, { .health = 1 }, 10, event) == false);
+	}
+
+	SECTION("Same As Ticks")
+	{
+		const Yars::Tick tick =
+		{	.health      = 3
+		,	.decay_skill = { { Skill_Sword, 0.25f } }
+		};
+
+		Yars::Id other = create(yars, 5, 100);
+		yars.characterSkillAdd(other, Skill_Sword);
+		yars.levelSet(yars.characterSkill(other, Skill_Sword).level, 10);
+
+		for(size_t i = 0; i < 20; i++)
+		{
+			yars.tick(tick, { other }, event);
+		}
+
+		REQUIRE(yars.characterFastForward(hurt, tick, 20, event));
+
+		REQUIRE(yars.characterHealth(hurt).current == yars.characterHealth(other).current);
+		REQUIRE(yars.characterSkill(hurt, Skill_Sword).level.value == yars.characterSkill(other, Skill_Sword).level.value);
+		REQUIRE(yars.characterSkill(hurt, Skill_Sword).level.partial == Approx(yars.characterSkill(other, Skill_Sword).level.partial));
+	}
+
+	SECTION("Fractional Decay")
+	{
+		// 0.1 can not be stored exactly in a float, so every tick rounds
+		const Yars::Tick tick =
+		{	.decay_skill = { { Skill_Sword, 0.1f } }
+		};
+
+		Yars::Id other = create(yars, 5, 100);
+		yars.characterSkillAdd(other, Skill_Sword);
+		yars.levelSet(yars.characterSkill(other, Skill_Sword).level, 10);
+
+		for(size_t i = 0; i < 250; i++)
+		{
+			yars.tick(tick, { other }, event);
+		}
+
+		REQUIRE(yars.characterFastForward(hurt, tick, 250, event));
+
+		REQUIRE(yars.characterSkill(hurt, Skill_Sword).level.value == 6);
+		REQUIRE(yars.characterSkill(other, Skill_Sword).level.value == 6);
+		REQUIRE(yars.characterSkill(hurt, Skill_Sword).level.partial == Approx(5.0f));
+		REQUIRE(yars.characterSkill(hurt, Skill_Sword).level.partial == Approx(yars.characterSkill(other, Skill_Sword).level.partial).margin(0.001f));
+	}
+
+	SECTION("Full")
+	{
+		REQUIRE(yars.characterFastForward(hurt, { .health = 1 }, 1'000'000'000'000, event));
+		REQUIRE(yars.characterHealth(hurt).current == 100);
+		REQUIRE(event.health_full == Yars::VectorId{ hurt });
+	}
+
+	SECTION("Died")
+	{
+		REQUIRE(yars.characterFastForward(hurt, { .health = Yars::Health_Min }, std::numeric_limits<uint64_t>::max(), event));
+		REQUIRE(yars.characterHealth(hurt).current == 0);
+		REQUIRE(event.died == Yars::VectorId{ hurt });
+
+		REQUIRE(yars.characterFastForward(dead, { .health = 1 }, 10, event));
+		REQUIRE(yars.characterHealth(dead).current == 0);
+		REQUIRE(event.died == Yars::VectorId{ hurt });
+	}
+
+	SECTION("Zero Ticks")
+	{
+		REQUIRE(yars.characterFastForward(hurt, { .health = 1 }, 0, event));
+		REQUIRE(yars.characterHealth(hurt).current == 5);
+	}
+}
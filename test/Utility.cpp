@@ -36,6 +36,318 @@ TEST_CASE("mapKeyList")
 }
 
 
+TEST_CASE("FlatMap")
+{
+	Yars::FlatMap<Yars::Id, Yars::Id> m;
+
+	REQUIRE(m.empty() == true);
+	REQUIRE(m.find(0) == std::end(m));
+
+	SECTION("Insert and Grow")
+	{
+		for(Yars::Id id = 0; id < 1000; id++)
+		{
+			m[id] = id * 2;
+		}
+
+		REQUIRE(m.size() == 1000);
+		REQUIRE(m.capacity() >= 1000);
+
+		for(Yars::Id id = 0; id < 1000; id++)
+		{
+			REQUIRE(m.contains(id) == true);
+			REQUIRE(m.at(id) == id * 2);
+		}
+
+		REQUIRE(m.contains(1000) == false);
+
+		size_t count = 0;
+		for(const auto& [key, value] : m)
+		{
+			REQUIRE(value == key * 2);
+			count++;
+		}
+
+		REQUIRE(count == m.size());
+	}
+
+	SECTION("Erase")
+	{
+		for(Yars::Id id = 0; id < 100; id++)
+		{
+			m[id] = id;
+		}
+
+		for(Yars::Id id = 0; id < 100; id += 2)
+		{
+			REQUIRE(m.erase(id) == 1);
+		}
+
+		REQUIRE(m.erase(0) == 0);
+		REQUIRE(m.size() == 50);
+
+		for(Yars::Id id = 0; id < 100; id++)
+		{
+			REQUIRE(m.contains(id) == ((id % 2) == 1));
+		}
+
+		for(auto iter = std::begin(m); iter != std::end(m);)
+		{
+			iter = m.erase(iter);
+		}
+
+		REQUIRE(m.empty() == true);
+	}
+
+	SECTION("Reuse Deleted")
+	{
+		const size_t capacity = m.capacity();
+
+		for(size_t i = 0; i < 1000; i++)
+		{
+			m[(Yars::Id)i] = 0;
+			m.erase((Yars::Id)i);
+			m[(Yars::Id)(i + 1)] = 0;
+			m.erase((Yars::Id)(i + 1));
+		}
+
+		REQUIRE(m.empty() == true);
+		REQUIRE(m.capacity() <= std::max(capacity, (size_t)8));
+	}
+
+	SECTION("Copy and Compare")
+	{
+		Yars::FlatMap<std::string, int32_t> a =
+		{	{ "a", 1 }
+		,	{ "b", 2 }
+		};
+
+		Yars::FlatMap<std::string, int32_t> b = a;
+
+		REQUIRE(a == b);
+
+		b["b"] = 3;
+		REQUIRE(a != b);
+
+		b.erase("b");
+		b.emplace("b", 2);
+		REQUIRE(a == b);
+
+		Yars::FlatMap<std::string, int32_t> c = std::move(b);
+		REQUIRE(a == c);
+		REQUIRE(b.empty() == true);
+	}
+}
+
+
+TEST_CASE("SmallMap")
+{
+	Yars::SmallMap<std::string, int32_t, 4> m;
+
+	REQUIRE(m.empty() == true);
+	REQUIRE(m.is_inline() == true);
+	REQUIRE(m.find("a") == std::end(m));
+
+	m["d"] = 4;
+	m["b"] = 2;
+	m["a"] = 1;
+	m["c"] = 3;
+
+	REQUIRE(m.size() == 4);
+	REQUIRE(m.is_inline() == true);
+
+	SECTION("Sorted")
+	{
+		Yars::VectorString v = Yars::mapKeyList(m);
+
+		REQUIRE(v == Yars::VectorString{ "a", "b", "c", "d" });
+		REQUIRE(m.at("c") == 3);
+		REQUIRE(m.contains("e") == false);
+	}
+
+	SECTION("Erase")
+	{
+		REQUIRE(m.erase("b") == 1);
+		REQUIRE(m.erase("b") == 0);
+		REQUIRE(m.size() == 3);
+		REQUIRE(Yars::mapKeyList(m) == Yars::VectorString{ "a", "c", "d" });
+
+		for(auto iter = std::begin(m); iter != std::end(m);)
+		{
+			iter = m.erase(iter);
+		}
+
+		REQUIRE(m.empty() == true);
+	}
+
+	SECTION("Spill")
+	{
+		m["e"] = 5;
+
+		REQUIRE(m.size() == 5);
+		REQUIRE(m.is_inline() == false);
+
+		for(const auto& [key, value] : m)
+		{
+			REQUIRE(value == (key[0] - 'a' + 1));
+		}
+
+		m.clear();
+		REQUIRE(m.is_inline() == true);
+	}
+
+	SECTION("Copy and Move")
+	{
+		Yars::SmallMap<std::string, int32_t, 4> copy = m;
+		REQUIRE(copy == m);
+
+		copy["e"] = 5;
+		REQUIRE(copy != m);
+
+		Yars::SmallMap<std::string, int32_t, 4> spill = copy;
+		REQUIRE(spill == copy);
+
+		m = std::move(spill);
+		REQUIRE(m == copy);
+		REQUIRE(spill.empty() == true);
+
+		copy.erase("e");
+		m.swap(copy);
+		REQUIRE(m.size() == 4);
+		REQUIRE(copy.size() == 5);
+	}
+}
+
+
+TEST_CASE("FrozenMap")
+{
+	Yars::FlatMap<std::string, int32_t> source;
+
+	for(int32_t i = 0; i < 1000; i++)
+	{
+		source["key " + std::to_string(i)] = i;
+	}
+
+	Yars::FrozenMap<std::string, int32_t> m;
+
+	REQUIRE(m.empty() == true);
+	REQUIRE(m.find("key 0") == std::end(m));
+
+	REQUIRE(m.build(source) == true);
+	REQUIRE(source.empty() == true);
+	REQUIRE(m.size() == 1000);
+
+	SECTION("Find")
+	{
+		Yars::VectorInt32 seen(1000, 0);
+
+		for(int32_t i = 0; i < 1000; i++)
+		{
+			const std::string key   = "key " + std::to_string(i);
+			const size_t      index = m.indexOf(key);
+
+			REQUIRE(index < m.size());
+			REQUIRE(m.atIndex(index).first == key);
+			REQUIRE(m.at(key) == i);
+
+			seen[index]++;
+		}
+
+		// Minimal: every slot is used exactly once
+		REQUIRE(std::count(std::begin(seen), std::end(seen), 1) == 1000);
+
+		REQUIRE(m.contains("key 1000") == false);
+		REQUIRE(m.indexOf(std::string("key 1000")) == m.size());
+		REQUIRE(m.find("") == std::end(m));
+	}
+
+	SECTION("Modify")
+	{
+		m.at("key 1") = -1;
+		REQUIRE(m.find("key 1")->second == -1);
+	}
+
+	SECTION("Release")
+	{
+		m.release(source);
+
+		REQUIRE(m.empty() == true);
+		REQUIRE(source.size() == 1000);
+		REQUIRE(source.at("key 999") == 999);
+	}
+
+	SECTION("Empty")
+	{
+		Yars::FlatMap<std::string, int32_t> empty;
+
+		REQUIRE(m.build(empty) == true);
+		REQUIRE(m.empty() == true);
+		REQUIRE(m.contains("key 0") == false);
+	}
+}
+
+
+TEST_CASE("Name")
+{
+	constexpr Yars::Name name = "Skill"_yars;
+
+	static_assert(name.value() == Yars::nameHash("Skill"));
+	static_assert(name.view()  == "Skill");
+
+	REQUIRE(Yars::NameHash{}(std::string("Skill")) == Yars::NameHash{}(name));
+	REQUIRE(Yars::NameEqual{}(std::string("Skill"), name) == true);
+	REQUIRE(Yars::NameEqual{}(std::string("Skil"), name)  == false);
+
+	SECTION("SmallMapName")
+	{
+		Yars::SmallMapName<int32_t, 2> m;
+
+		m["a"]     = 1;
+		m["Skill"] = 2;
+
+		REQUIRE(m.contains(name) == true);
+		REQUIRE(m.find(name)->second == 2);
+		REQUIRE(m.contains("b"_yars) == false);
+		REQUIRE(m.at(name) == 2);
+		REQUIRE_THROWS_AS(m.at("b"_yars), std::out_of_range);
+
+		m["c"] = 3;
+
+		REQUIRE(m.is_inline() == false);
+		REQUIRE(m.find(name)->second == 2);
+		REQUIRE(m.find("b"_yars) == std::end(m));
+		REQUIRE(m.at(name) == 2);
+		REQUIRE_THROWS_AS(m.at("b"_yars), std::out_of_range);
+	}
+
+	SECTION("FrozenMapName")
+	{
+		Yars::FlatMapName<int32_t> source =
+		{	{ "a", 1 }
+		,	{ "Skill", 2 }
+		};
+
+		REQUIRE(source.find(name)->second == 2);
+
+		Yars::FrozenMapName<int32_t> m;
+		m.build(source);
+
+		REQUIRE(m.find(name)->second == 2);
+		REQUIRE(m.contains("b"_yars) == false);
+		REQUIRE(m.at(name) == 2);
+		REQUIRE_THROWS_AS(m.at("b"_yars), std::out_of_range);
+	}
+
+	SECTION("NameSchema")
+	{
+		constexpr Yars::NameSchema<2> schema = {{ "a", "Skill" }};
+		constexpr Yars::Name          skill  = schema("Skill");
+
+		static_assert(skill.value() == name.value());
+	}
+}
+
+
 TEST_CASE("multimapContains")
 {
 	Yars::MultimapIdId m =